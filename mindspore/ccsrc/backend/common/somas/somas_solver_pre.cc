@@ -23,12 +23,33 @@
 
 #include "backend/common/somas/somas_solver_core.h"
 #include "backend/common/somas/somas_solver_pre.h"
+#include "backend/common/somas/somas_solver_refine.h"
 #include "include/common/debug/common.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace somas {
 constexpr auto kSolBytesThreshold = 100 * 1024 * 1024;
 constexpr auto kSolNumThresholdMultiThread = 8;
+// The time limit in milliseconds of refining the best solution of the heuristics, 0 disables the refinement. It is
+// disabled by default, since the refinement may add up to the time limit to the compile of every graph.
+constexpr char kSomasRefineTimeEnv[] = "MS_DEV_SOMAS_REFINE_TIME";
+constexpr int64_t kDefaultRefineTimeMs = 0;
+
+int64_t GetRefineTimeLimit() {
+  auto env = common::GetEnv(kSomasRefineTimeEnv);
+  if (env.empty()) {
+    return kDefaultRefineTimeMs;
+  }
+  try {
+    return std::stoll(env);
+  } catch (const std::exception &) {
+    MS_LOG(WARNING) << "Invalid " << kSomasRefineTimeEnv << ": " << env << ", use the default " << kDefaultRefineTimeMs
+                    << " ms.";
+    return kDefaultRefineTimeMs;
+  }
+}
+
 Status SomasSolverPre::CheckTensors(const TensorsDescMap *pTensors, uint32_t index1, uint32_t index2) const {
   auto tensors = *pTensors;
   if (tensors[index1] == nullptr) {
@@ -169,6 +190,18 @@ Status SomasSolverPre::Solving(const session::KernelGraph &graph, TensorsDescMap
       *(tensor.second.get()) = *(vecTensorsMap[best_info.best_sol][tensor.first]);
     }
     max_offset_ = best_solver->GetUpperbound();
+    heuristic_offset_ = max_offset_;
+
+    // Tighten the peak of the best solution and compute the lower bound of the peak.
+    auto refine_start = std::chrono::system_clock::now();
+    SomasSolverRefiner refiner(tensors, pConstraints);
+    lower_bound_ = refiner.LowerBound();
+    auto refined_offset = refiner.Refine(GetRefineTimeLimit());
+    if (refined_offset < max_offset_) {
+      max_offset_ = refined_offset;
+    }
+    auto refine_end = std::chrono::system_clock::now();
+    refine_time_ = std::chrono::duration_cast<std::chrono::milliseconds>(refine_end - refine_start).count();
     constexpr float kFloatPresent = 100.0;
     MS_LOG(INFO) << "SOMAS SOLVER RESUME:";
     MS_LOG(INFO) << "Best Solution:[" << 1 + best_info.best_sol << "/" << total_sol << "] ";
@@ -179,6 +212,9 @@ Status SomasSolverPre::Solving(const session::KernelGraph &graph, TensorsDescMap
     MS_LOG(INFO) << "Best algorithm: " << algorithmTypeNames[best_solver->algorithm_];
     MS_LOG(INFO) << "Best sorting strategy: " << sortingNames[best_solver->sort_strategy_];
     MS_LOG(INFO) << "Best offset strategy: " << branchingNames[best_solver->branching_strategy_];
+    MS_LOG(INFO) << "Refined result:" << max_offset_ << " Bytes, lower bound:" << lower_bound_ << " Bytes, gap:"
+                 << GapToLowerBound() << " %, refine time:" << refine_time_ << " ms, search nodes:"
+                 << refiner.searched_count();
     MS_LOG(INFO) << "Time elapsed: " << total_time << " ms";
     MS_LOG(INFO) << "Spread:"
                  << static_cast<double>((best_info.worst - best_info.best) /
@@ -203,6 +239,34 @@ void SomasSolverPre::Log(const session::KernelGraph &graph, const TensorsDescMap
   SolverInputLog(graph, tensors, continuous_v);
   SolverOutputLog(graph, tensors);
   TensorRelationLog(pConstraints, graph);
+  SolverReportLog(graph);
+}
+
+double SomasSolverPre::GapToLowerBound() const {
+  if (lower_bound_ == 0) {
+    return 0;
+  }
+  constexpr double kPercent = 100.0;
+  return static_cast<double>(max_offset_ - std::min(max_offset_, lower_bound_)) * kPercent /
+         static_cast<double>(lower_bound_);
+}
+
+void SomasSolverPre::SolverReportLog(const session::KernelGraph &graph) const {
+  MS_LOG(INFO) << "SomasSolver::Log Writing somas_solver_report..";
+  auto context_ptr = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context_ptr);
+  auto save_graphs_path = context_ptr->get_param<std::string>(MS_CTX_SAVE_GRAPHS_PATH);
+  std::string filename =
+    GetSaveGraphsPathName("somas_solver_report_" + std::to_string(graph.graph_id()) + ".ir", save_graphs_path);
+  std::ostringstream oss;
+  oss << "graph_id=" << graph.graph_id() << std::endl;
+  oss << "heuristic_peak=" << heuristic_offset_ << std::endl;
+  oss << "refined_peak=" << max_offset_ << std::endl;
+  oss << "lower_bound=" << lower_bound_ << std::endl;
+  oss << "gap_percent=" << GapToLowerBound() << std::endl;
+  oss << "refine_time_ms=" << refine_time_ << std::endl;
+  (void)Common::SaveStringToFile(filename, oss.str());
+  MS_LOG(INFO) << "SomasSolver report Log done";
 }
 
 void SomasSolverPre::TensorRelationLog(const std::vector<DynamicBitSet> *pConstraints,
@@ -190,6 +190,8 @@ class SomasSolverPre {
   SomasSolverPre &operator=(const SomasSolverPre &) = delete;
 
   size_t GetMaxOffset() const { return max_offset_; }
+  // The lower bound of the peak, to report the quality of the solution.
+  size_t GetLowerBound() const { return lower_bound_; }
 
   Status Solving(const session::KernelGraph &graph, TensorsDescMap *ptensors,
                  const std::vector<DynamicBitSet> *pConstraints, const vector<vector<size_t>> &continuous_v,
@@ -208,6 +210,11 @@ class SomasSolverPre {
 
  private:
   size_t max_offset_;
+  size_t heuristic_offset_{0};
+  size_t lower_bound_{0};
+  int64_t refine_time_{0};
+  double GapToLowerBound() const;
+  void SolverReportLog(const session::KernelGraph &graph) const;
   void SolverInputLog(const session::KernelGraph &graph, const TensorsDescMap &tensors,
                       const vector<vector<size_t>> &continuous_v) const;
   void SolverOutputLog(const session::KernelGraph &graph, const TensorsDescMap &tensors) const;
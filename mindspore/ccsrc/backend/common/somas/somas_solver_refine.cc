@@ -0,0 +1,287 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/common/somas/somas_solver_refine.h"
+
+#include <algorithm>
+#include <map>
+
+namespace mindspore {
+namespace somas {
+namespace {
+// The number of the next unplaced blocks the search branches on, choosing the i-th of them costs i discrepancies.
+constexpr size_t kBranchWidth = 3;
+// The number of the largest tensors the cliques of the lower bound start from.
+constexpr size_t kLowerBoundSeedNum = 16;
+// Check the time limit once per this number of tensor pairs checked in placing a block.
+constexpr size_t kTimeCheckInterval = 4096;
+}  // namespace
+
+SomasSolverRefiner::SomasSolverRefiner(const TensorsDescMap &tensors, const std::vector<DynamicBitSet> *constraints)
+    : tensors_(tensors), constraints_(*constraints) {
+  std::map<size_t, SomasSolverTensorDescPtr> sorted_tensors;
+  for (const auto &tensor : tensors_) {
+    MS_EXCEPTION_IF_NULL(tensor.second);
+    (void)sorted_tensors.emplace(tensor.first, tensor.second);
+  }
+  for (const auto &tensor : sorted_tensors) {
+    const auto &desc = tensor.second;
+    if (desc->lifelong_) {
+      lifelong_memory_ += desc->size_;
+      continue;
+    }
+    if (desc->left_ != nullptr) {
+      continue;
+    }
+    // The contiguous tensors are linked by right_, which may point to the copies of the solver, so the tensors in the
+    // map are fetched by index.
+    Block block{{}, 0};
+    for (auto block_tensor = desc; block_tensor != nullptr;) {
+      block.tensors_.push_back(solver_tensors_.size());
+      solver_tensors_.push_back({block_tensor, block.size_});
+      block.size_ += block_tensor->size_;
+      if (block_tensor->right_ == nullptr) {
+        break;
+      }
+      auto iter = tensors_.find(block_tensor->right_->index_);
+      block_tensor = iter == tensors_.end() ? nullptr : iter->second;
+    }
+    blocks_.push_back(std::move(block));
+  }
+}
+
+size_t SomasSolverRefiner::LowerBound() {
+  if (lower_bound_ != 0) {
+    return lower_bound_;
+  }
+  // The tensors conflicting with each other pairwise take disjoint memory, so the total size of any clique of the
+  // conflicting tensors bounds the peak. The cliques are built greedily from the largest tensors.
+  size_t max_size = 0;
+  for (const auto &block : blocks_) {
+    max_size = std::max(max_size, block.size_);
+  }
+  std::vector<size_t> sorted_tensors;
+  for (size_t i = 0; i < solver_tensors_.size(); ++i) {
+    if (solver_tensors_[i].desc_->size_ > 0) {
+      sorted_tensors.push_back(i);
+    }
+  }
+  std::stable_sort(sorted_tensors.begin(), sorted_tensors.end(), [this](size_t a, size_t b) {
+    return solver_tensors_[a].desc_->size_ > solver_tensors_[b].desc_->size_;
+  });
+
+  auto seed_num = std::min(kLowerBoundSeedNum, sorted_tensors.size());
+  for (size_t seed = 0; seed < seed_num; ++seed) {
+    const auto &seed_tensor = solver_tensors_[sorted_tensors[seed]].desc_;
+    // The tensors conflicting with all the tensors in the clique.
+    DynamicBitSet candidates(constraints_.size());
+    const auto &seed_constraint = constraints_[seed_tensor->index_];
+    auto bit_size = std::min(candidates.bit_size_, seed_constraint.bit_size_);
+    for (size_t i = 0; i < bit_size; ++i) {
+      candidates.bit_[i] = ~seed_constraint.bit_[i];
+    }
+    size_t clique_size = seed_tensor->size_;
+    for (size_t i = 0; i < sorted_tensors.size(); ++i) {
+      const auto &tensor = solver_tensors_[sorted_tensors[i]].desc_;
+      if (i == seed || !candidates.IsBitTrue(tensor->index_)) {
+        continue;
+      }
+      clique_size += tensor->size_;
+      const auto &constraint = constraints_[tensor->index_];
+      for (size_t j = 0; j < std::min(bit_size, constraint.bit_size_); ++j) {
+        candidates.bit_[j] &= ~constraint.bit_[j];
+      }
+    }
+    max_size = std::max(max_size, clique_size);
+  }
+  lower_bound_ = max_size + lifelong_memory_;
+  return lower_bound_;
+}
+
+bool SomasSolverRefiner::TimeOut() {
+  if (!time_out_ && std::chrono::steady_clock::now() > deadline_) {
+    time_out_ = true;
+  }
+  return time_out_;
+}
+
+bool SomasSolverRefiner::PlaceBlock(size_t block, size_t *offset) {
+  // The offsets of the block which overlap the conflicting tensors placed, as [begin, end).
+  std::vector<std::pair<size_t, size_t>> forbidden;
+  size_t checked_count = 0;
+  for (auto index : blocks_[block].tensors_) {
+    const auto &tensor = solver_tensors_[index];
+    auto size = tensor.desc_->size_;
+    if (size == 0) {
+      continue;
+    }
+    const auto &constraint = constraints_[tensor.desc_->index_];
+    for (const auto &[placed_index, placed_offset] : placed_tensors_) {
+      if (++checked_count % kTimeCheckInterval == 0 && TimeOut()) {
+        return false;
+      }
+      const auto &placed = solver_tensors_[placed_index].desc_;
+      if (placed->size_ == 0 || constraint.IsBitTrue(placed->index_)) {
+        continue;
+      }
+      // The tensor at block offset o overlaps the placed one when placed_offset - in - size < o < placed_end - in.
+      auto placed_end = placed_offset + placed->size_;
+      if (placed_end <= tensor.offset_in_block_) {
+        continue;
+      }
+      auto tensor_end_in_block = tensor.offset_in_block_ + size;
+      auto begin = placed_offset + 1 > tensor_end_in_block ? placed_offset + 1 - tensor_end_in_block : 0;
+      (void)forbidden.emplace_back(begin, placed_end - tensor.offset_in_block_);
+    }
+  }
+  std::sort(forbidden.begin(), forbidden.end());
+  size_t lowest = 0;
+  for (const auto &[begin, end] : forbidden) {
+    if (begin > lowest) {
+      break;
+    }
+    lowest = std::max(lowest, end);
+  }
+  *offset = lowest;
+  return true;
+}
+
+void SomasSolverRefiner::Search(size_t max_discrepancy) {
+  placed_tensors_.clear();
+  std::vector<Decision> path;
+  size_t peak = 0;
+  size_t discrepancy = 0;
+  size_t next_choice = 0;
+  auto base_order = unplaced_blocks_;
+  while (!TimeOut()) {
+    ++searched_count_;
+    if (unplaced_blocks_.empty() && peak < best_peak_) {
+      best_peak_ = peak;
+      best_block_offsets_ = block_offsets_;
+      if (best_peak_ + lifelong_memory_ <= lower_bound_) {
+        break;
+      }
+    }
+    bool advanced = false;
+    auto width = std::min(kBranchWidth, unplaced_blocks_.size());
+    for (; next_choice < width && discrepancy + next_choice <= max_discrepancy; ++next_choice) {
+      auto block = unplaced_blocks_[next_choice];
+      size_t offset = 0;
+      if (!PlaceBlock(block, &offset)) {
+        break;
+      }
+      auto new_peak = std::max(peak, offset + blocks_[block].size_);
+      // Bound: the peak never goes down as more blocks are placed.
+      if (new_peak >= best_peak_) {
+        continue;
+      }
+      path.push_back({next_choice, block, placed_tensors_.size(), peak, discrepancy});
+      (void)unplaced_blocks_.erase(unplaced_blocks_.begin() + SizeToLong(next_choice));
+      for (auto index : blocks_[block].tensors_) {
+        (void)placed_tensors_.emplace_back(index, offset + solver_tensors_[index].offset_in_block_);
+      }
+      block_offsets_[block] = offset;
+      peak = new_peak;
+      discrepancy += next_choice;
+      next_choice = 0;
+      advanced = true;
+      break;
+    }
+    if (advanced) {
+      continue;
+    }
+    if (next_choice < width && !time_out_) {
+      discrepancy_limited_ = true;
+    }
+    // Backtrack to the last decision and try its next choice.
+    if (path.empty()) {
+      break;
+    }
+    const auto &decision = path.back();
+    placed_tensors_.resize(decision.placed_num_);
+    (void)unplaced_blocks_.insert(unplaced_blocks_.begin() + SizeToLong(decision.position_), decision.block_);
+    peak = decision.peak_;
+    discrepancy = decision.discrepancy_;
+    next_choice = decision.position_ + 1;
+    path.pop_back();
+  }
+  unplaced_blocks_ = base_order;
+}
+
+size_t SomasSolverRefiner::Refine(int64_t time_limit_ms) {
+  size_t total_peak = 0;
+  for (const auto &tensor : tensors_) {
+    total_peak = std::max(total_peak, tensor.second->offset_ + tensor.second->size_);
+  }
+  if (time_limit_ms <= 0 || blocks_.empty()) {
+    return total_peak;
+  }
+  deadline_ = std::chrono::steady_clock::now() + std::chrono::milliseconds(time_limit_ms);
+  (void)LowerBound();
+
+  // Start from the solution in the tensors, and place the blocks in the order of their offsets in it.
+  best_peak_ = 0;
+  block_offsets_.resize(blocks_.size());
+  for (size_t i = 0; i < blocks_.size(); ++i) {
+    const auto &start_tensor = solver_tensors_[blocks_[i].tensors_.front()].desc_;
+    block_offsets_[i] = start_tensor->offset_;
+    best_peak_ = std::max(best_peak_, start_tensor->offset_ + blocks_[i].size_);
+    unplaced_blocks_.push_back(i);
+  }
+  best_block_offsets_ = block_offsets_;
+  std::stable_sort(unplaced_blocks_.begin(), unplaced_blocks_.end(), [this](size_t a, size_t b) {
+    return block_offsets_[a] < block_offsets_[b] ||
+           (block_offsets_[a] == block_offsets_[b] && blocks_[a].size_ > blocks_[b].size_);
+  });
+
+  // Limited discrepancy search: the placement order deviates from the base order more in each round.
+  size_t max_discrepancy = blocks_.size() * (kBranchWidth - 1);
+  for (size_t discrepancy = 0; discrepancy <= max_discrepancy; ++discrepancy) {
+    if (best_peak_ + lifelong_memory_ <= lower_bound_ || TimeOut()) {
+      break;
+    }
+    discrepancy_limited_ = false;
+    Search(discrepancy);
+    // The whole search tree has been explored.
+    if (!discrepancy_limited_) {
+      break;
+    }
+  }
+
+  if (best_peak_ + lifelong_memory_ >= total_peak) {
+    return total_peak;
+  }
+  for (size_t i = 0; i < blocks_.size(); ++i) {
+    for (auto index : blocks_[i].tensors_) {
+      solver_tensors_[index].desc_->offset_ = best_block_offsets_[i] + solver_tensors_[index].offset_in_block_;
+    }
+  }
+  // The lifelong tensors conflict with all tensors, place them above the others as the solver does.
+  std::map<size_t, SomasSolverTensorDescPtr> lifelong_tensors;
+  for (const auto &tensor : tensors_) {
+    if (tensor.second->lifelong_) {
+      (void)lifelong_tensors.emplace(tensor.first, tensor.second);
+    }
+  }
+  size_t offset = best_peak_;
+  for (const auto &tensor : lifelong_tensors) {
+    tensor.second->offset_ = offset;
+    offset += tensor.second->size_;
+  }
+  return best_peak_ + lifelong_memory_;
+}
+}  // namespace somas
+}  // namespace mindspore
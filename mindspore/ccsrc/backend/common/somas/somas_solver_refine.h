@@ -0,0 +1,94 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_BACKEND_COMMON_SOMAS_SOMAS_SOLVER_REFINE_H_
+#define MINDSPORE_CCSRC_BACKEND_COMMON_SOMAS_SOMAS_SOLVER_REFINE_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "backend/common/somas/somas_solver_pre.h"
+
+namespace mindspore {
+namespace somas {
+// SomasSolverRefiner starts from the best solution of the heuristics and tightens its peak by a time-bounded branch and
+// bound search on the order of placing the blocks of contiguous tensors, where each block is placed at the lowest
+// offset free of the conflicting tensors placed before. It also computes a lower bound of the peak from the cliques of
+// conflicting tensors, to report how far the solution is from the optimum.
+class SomasSolverRefiner {
+ public:
+  SomasSolverRefiner(const TensorsDescMap &tensors, const std::vector<DynamicBitSet> *constraints);
+  ~SomasSolverRefiner() = default;
+
+  // The lower bound of the peak, including the lifelong tensors.
+  size_t LowerBound();
+
+  // Search for a lower peak than the solution in the tensors within the time limit, the offsets of the tensors are
+  // updated if one is found. Return the peak of the tensors, including the lifelong tensors.
+  size_t Refine(int64_t time_limit_ms);
+
+  size_t searched_count() const { return searched_count_; }
+
+ private:
+  struct Tensor {
+    SomasSolverTensorDescPtr desc_;
+    // The offset of the tensor in its block.
+    size_t offset_in_block_;
+  };
+  struct Block {
+    std::vector<size_t> tensors_;
+    size_t size_;
+  };
+  // The decision of the search path: the position of the block placed in the unplaced blocks and the state before it.
+  struct Decision {
+    size_t position_;
+    size_t block_;
+    size_t placed_num_;
+    size_t peak_;
+    size_t discrepancy_;
+  };
+
+  // Find the lowest offset of the block free of the conflicting tensors placed, return false if time is out.
+  bool PlaceBlock(size_t block, size_t *offset);
+  void Search(size_t max_discrepancy);
+  bool TimeOut();
+
+  const TensorsDescMap &tensors_;
+  const std::vector<DynamicBitSet> &constraints_;
+  std::vector<Tensor> solver_tensors_;
+  std::vector<Block> blocks_;
+  size_t lifelong_memory_{0};
+  size_t lower_bound_{0};
+
+  // The search state: the placed tensors with their offsets, the unplaced blocks and the offsets of blocks placed.
+  std::vector<std::pair<size_t, size_t>> placed_tensors_;
+  std::vector<size_t> unplaced_blocks_;
+  std::vector<size_t> block_offsets_;
+  std::vector<size_t> best_block_offsets_;
+  size_t best_peak_{0};
+  size_t searched_count_{0};
+  bool time_out_{false};
+  // Whether the search skipped some choices for the discrepancy limit.
+  bool discrepancy_limited_{false};
+  std::chrono::steady_clock::time_point deadline_;
+};
+}  // namespace somas
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_BACKEND_COMMON_SOMAS_SOMAS_SOLVER_REFINE_H_
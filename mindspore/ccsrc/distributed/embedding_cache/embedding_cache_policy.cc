@@ -0,0 +1,175 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed/embedding_cache/embedding_cache_policy.h"
+
+#include <algorithm>
+#include "utils/ms_utils.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace distributed {
+namespace {
+// The seeds to hash the id into different rows of the frequency sketch.
+constexpr uint32_t kSketchSeeds[kSketchDepth] = {0x9E3779B9, 0x85EBCA6B, 0xC2B2AE35, 0x27D4EB2F};
+// The max shift of the decayed frequency.
+constexpr size_t kMaxDecayShift = 31;
+
+uint32_t MixHash(uint32_t key) {
+  key ^= key >> 16;
+  key *= 0x85EBCA6B;
+  key ^= key >> 13;
+  key *= 0xC2B2AE35;
+  key ^= key >> 16;
+  return key;
+}
+}  // namespace
+
+uint32_t LFUPolicy::Frequency(size_t index) const {
+  size_t shift = std::min(epoch_ - epochs_[index], kMaxDecayShift);
+  return counts_[index] >> shift;
+}
+
+void LFUPolicy::OnAccess(size_t index, int) {
+  uint32_t count = Frequency(index);
+  counts_[index] = count == UINT32_MAX ? count : count + 1;
+  epochs_[index] = epoch_;
+}
+
+void LFUPolicy::OnInsert(size_t index, int) {
+  counts_[index] = 1;
+  epochs_[index] = epoch_;
+}
+
+void LFUPolicy::OnStep() {
+  if (++step_ % kLFUDecayStepInterval == 0) {
+    ++epoch_;
+  }
+}
+
+size_t LFUPolicy::SelectVictim(const std::vector<std::pair<size_t, int>> &candidates) {
+  size_t victim = 0;
+  uint32_t min_frequency = UINT32_MAX;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    uint32_t frequency = Frequency(candidates[i].first);
+    if (frequency < min_frequency) {
+      min_frequency = frequency;
+      victim = i;
+    }
+  }
+  return victim;
+}
+
+FrequencySketch::FrequencySketch(size_t capacity) : width_(1) {
+  while (width_ < capacity) {
+    width_ <<= 1;
+  }
+  table_.resize(width_ * kSketchDepth, 0);
+  sample_size_ = width_ * kSketchResetScale;
+}
+
+size_t FrequencySketch::IndexOf(int id, size_t depth) const {
+  return depth * width_ + (MixHash(static_cast<uint32_t>(id) ^ kSketchSeeds[depth]) & (width_ - 1));
+}
+
+void FrequencySketch::Increment(int id) {
+  for (size_t i = 0; i < kSketchDepth; ++i) {
+    auto &counter = table_[IndexOf(id, i)];
+    if (counter < kSketchMaxCount) {
+      ++counter;
+    }
+  }
+  if (++additions_ >= sample_size_) {
+    Reset();
+  }
+}
+
+uint8_t FrequencySketch::Estimate(int id) const {
+  uint8_t frequency = kSketchMaxCount;
+  for (size_t i = 0; i < kSketchDepth; ++i) {
+    frequency = std::min(frequency, table_[IndexOf(id, i)]);
+  }
+  return frequency;
+}
+
+void FrequencySketch::Reset() {
+  for (auto &counter : table_) {
+    counter >>= 1;
+  }
+  additions_ >>= 1;
+}
+
+void TinyLFUPolicy::OnAccess(size_t index, int id) {
+  sketch_.Increment(id);
+  // The id accessed again since insertion is worth keeping.
+  probation_[index] = false;
+}
+
+void TinyLFUPolicy::OnInsert(size_t index, int id) {
+  sketch_.Increment(id);
+  probation_[index] = victim_frequency_ >= 0 && sketch_.Estimate(id) < victim_frequency_;
+  victim_frequency_ = -1;
+}
+
+void TinyLFUPolicy::OnEvict(size_t index, int id) {
+  victim_frequency_ = sketch_.Estimate(id);
+  probation_[index] = false;
+}
+
+size_t TinyLFUPolicy::SelectVictim(const std::vector<std::pair<size_t, int>> &candidates) {
+  size_t victim = 0;
+  int min_frequency = INT32_MAX;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (probation_[candidates[i].first]) {
+      return i;
+    }
+    int frequency = sketch_.Estimate(candidates[i].second);
+    if (frequency < min_frequency) {
+      min_frequency = frequency;
+      victim = i;
+    }
+  }
+  return victim;
+}
+
+EmbeddingCachePolicyType GetEmbeddingCachePolicyType() {
+  std::string policy = common::GetEnv(kEnvEmbeddingCachePolicy);
+  if (policy.empty() || policy == "step") {
+    return EmbeddingCachePolicyType::kStepExpiry;
+  }
+  if (policy == "lfu") {
+    return EmbeddingCachePolicyType::kLFU;
+  }
+  if (policy == "tinylfu") {
+    return EmbeddingCachePolicyType::kTinyLFU;
+  }
+  MS_LOG(WARNING) << "Invalid value of environment variable " << kEnvEmbeddingCachePolicy << ": " << policy
+                  << ", the valid values are 'step', 'lfu' and 'tinylfu', use 'step' instead.";
+  return EmbeddingCachePolicyType::kStepExpiry;
+}
+
+std::unique_ptr<EmbeddingCachePolicy> CreateEmbeddingCachePolicy(EmbeddingCachePolicyType type, size_t capacity) {
+  switch (type) {
+    case EmbeddingCachePolicyType::kLFU:
+      return std::make_unique<LFUPolicy>(capacity);
+    case EmbeddingCachePolicyType::kTinyLFU:
+      return std::make_unique<TinyLFUPolicy>(capacity);
+    default:
+      return std::make_unique<StepExpiryPolicy>();
+  }
+}
+}  // namespace distributed
+}  // namespace mindspore
@@ -0,0 +1,148 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_CACHE_POLICY_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_CACHE_POLICY_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mindspore {
+namespace distributed {
+// The environment variable used to specify the eviction policy of embedding cache, the value could be 'step'(default),
+// 'lfu' or 'tinylfu'.
+constexpr char kEnvEmbeddingCachePolicy[] = "MS_EMBEDDING_CACHE_POLICY";
+// The number of evictable elements sampled for one eviction by the frequency based policies.
+constexpr size_t kEvictionSampleNum = 8;
+// The LFU policy halves the access frequency of elements every 'kLFUDecayStepInterval' steps.
+constexpr size_t kLFUDecayStepInterval = 16;
+// The depth of the count-min sketch used by TinyLFU policy.
+constexpr size_t kSketchDepth = 4;
+// The max value of the saturating counters of the count-min sketch.
+constexpr uint8_t kSketchMaxCount = 15;
+// The TinyLFU policy halves all counters of sketch after 'kSketchResetScale' * width increments.
+constexpr size_t kSketchResetScale = 10;
+
+enum class EmbeddingCachePolicyType { kStepExpiry = 0, kLFU, kTinyLFU };
+
+// The eviction policy of EmbeddingHashMap. The hash map collects the elements which are not used by current data step
+// and running graph step as eviction candidates, and the policy decides which candidate is swapped out for a new id.
+// The candidate is pair of (hash index, id).
+class EmbeddingCachePolicy {
+ public:
+  EmbeddingCachePolicy() = default;
+  virtual ~EmbeddingCachePolicy() = default;
+
+  // The number of candidates collected for selecting one victim.
+  virtual size_t sample_num() const { return 1; }
+
+  // Record an access to the cached id in the hash index.
+  virtual void OnAccess(size_t, int) {}
+  // Record the insertion of a new id into the hash index.
+  virtual void OnInsert(size_t, int) {}
+  // Record the eviction of the id in the hash index.
+  virtual void OnEvict(size_t, int) {}
+  // Called at the beginning of every data step.
+  virtual void OnStep() {}
+
+  // Select the victim from the candidates, return the position in 'candidates'.
+  virtual size_t SelectVictim(const std::vector<std::pair<size_t, int>> &) { return 0; }
+};
+
+// Evict the first expired element found by the cursor of hash map, which is the origin policy of EmbeddingHashMap.
+using StepExpiryPolicy = EmbeddingCachePolicy;
+
+// Evict the least frequently used element among the sampled candidates. The frequency is halved every
+// 'kLFUDecayStepInterval' steps lazily, so that the ids hot in the past would be evicted at last.
+class LFUPolicy : public EmbeddingCachePolicy {
+ public:
+  explicit LFUPolicy(size_t capacity) : counts_(capacity, 0), epochs_(capacity, 0) {}
+  ~LFUPolicy() override = default;
+
+  size_t sample_num() const override { return kEvictionSampleNum; }
+  void OnAccess(size_t index, int) override;
+  void OnInsert(size_t index, int) override;
+  void OnStep() override;
+  size_t SelectVictim(const std::vector<std::pair<size_t, int>> &candidates) override;
+
+  // Get the decayed access frequency of the element in the hash index.
+  uint32_t Frequency(size_t index) const;
+
+ private:
+  // The access count of every element and the decay epoch of the count.
+  std::vector<uint32_t> counts_;
+  std::vector<size_t> epochs_;
+  // The number of steps and the current decay epoch.
+  size_t step_{0};
+  size_t epoch_{0};
+};
+
+// The count-min sketch with 4-bit saturating counters to estimate the access frequency of ids, including the ids which
+// are not in the cache any more. All counters are halved periodically to keep the history fresh.
+class FrequencySketch {
+ public:
+  explicit FrequencySketch(size_t capacity);
+  ~FrequencySketch() = default;
+
+  void Increment(int id);
+  uint8_t Estimate(int id) const;
+
+ private:
+  size_t IndexOf(int id, size_t depth) const;
+  void Reset();
+
+  std::vector<uint8_t> table_;
+  // The width of every row of the sketch, which is power of two.
+  size_t width_;
+  size_t additions_{0};
+  size_t sample_size_;
+};
+
+// TinyLFU admission: a new id is admitted only if it is estimated to be accessed more frequently than the victim by the
+// frequency sketch. Every id of the batch has to be cached, so the id which is not admitted is put on probation
+// instead of being dropped, and the probationary elements are preferred to be evicted at the next swap. Otherwise the
+// candidate with the lowest estimated frequency is evicted.
+class TinyLFUPolicy : public EmbeddingCachePolicy {
+ public:
+  explicit TinyLFUPolicy(size_t capacity) : sketch_(capacity), probation_(capacity, false) {}
+  ~TinyLFUPolicy() override = default;
+
+  size_t sample_num() const override { return kEvictionSampleNum; }
+  void OnAccess(size_t index, int id) override;
+  void OnInsert(size_t index, int id) override;
+  void OnEvict(size_t index, int id) override;
+  size_t SelectVictim(const std::vector<std::pair<size_t, int>> &candidates) override;
+
+  bool IsProbation(size_t index) const { return probation_[index]; }
+
+ private:
+  FrequencySketch sketch_;
+  // Whether the id in the hash index is not admitted.
+  std::vector<bool> probation_;
+  // The estimated frequency of the last evicted id, which is compared with the id inserted after the eviction.
+  int victim_frequency_{-1};
+};
+
+// Parse the policy type from the environment variable 'MS_EMBEDDING_CACHE_POLICY'.
+EmbeddingCachePolicyType GetEmbeddingCachePolicyType();
+
+std::unique_ptr<EmbeddingCachePolicy> CreateEmbeddingCachePolicy(EmbeddingCachePolicyType type, size_t capacity);
+}  // namespace distributed
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_CACHE_POLICY_H_
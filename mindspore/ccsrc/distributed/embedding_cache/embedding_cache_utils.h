@@ -78,7 +78,7 @@ struct EmbeddingDeviceCache {
     device_to_host_ids = std::make_unique<int[]>(batch_ids_num);
     host_to_device_index = std::make_unique<int[]>(batch_ids_num);
     host_to_device_ids = std::make_unique<int[]>(batch_ids_num);
-    device_hash_map_ = std::make_shared<EmbeddingHashMap>(0, cache_vocab_size);
+    device_hash_map_ = std::make_shared<EmbeddingHashMap>(0, cache_vocab_size, GetEmbeddingCachePolicyType());
   }
 
   std::unique_ptr<int[]> device_to_host_index;
@@ -103,7 +103,7 @@ struct EmbeddingHostCache {
     new_id_index = std::make_unique<int[]>(batch_ids_num);
     host_to_device_index = std::make_unique<int[]>(batch_ids_num);
     device_to_host_index = std::make_unique<int[]>(batch_ids_num);
-    host_hash_map_ = std::make_shared<EmbeddingHashMap>(0, host_cache_vocab_size);
+    host_hash_map_ = std::make_shared<EmbeddingHashMap>(0, host_cache_vocab_size, GetEmbeddingCachePolicyType());
   }
 
   std::unique_ptr<int[]> host_to_server_index;
@@ -261,15 +261,26 @@ class BACKEND_EXPORT EmbeddingStoreManager {
     static EmbeddingStoreManager instance{};
     return instance;
   }
-  void Add(const std::string &name, std::shared_ptr<EmbeddingStore<int32_t, float>> emb_store) {}
-  std::shared_ptr<EmbeddingStore<int32_t, float>> Get(const std::string &name) { return nullptr; }
+  void Add(const std::string &name, std::shared_ptr<EmbeddingStore<int32_t, float>> emb_store) {
+    embedding_stores_[name] = emb_store;
+  }
+  std::shared_ptr<EmbeddingStore<int32_t, float>> Get(const std::string &name) {
+    const auto &iter = embedding_stores_.find(name);
+    if (iter == embedding_stores_.end()) {
+      return nullptr;
+    }
+    return iter->second;
+  }
 
-  bool IsExists(const std::string &name) const { return false; }
+  bool IsExists(const std::string &name) const { return embedding_stores_.count(name) != 0; }
 
  private:
   EmbeddingStoreManager() = default;
   ~EmbeddingStoreManager() = default;
   DISABLE_COPY_AND_ASSIGN(EmbeddingStoreManager);
+
+  // The embedding stores of all parameters which use persistent storage, the key is the parameter key.
+  std::map<std::string, std::shared_ptr<EmbeddingStore<int32_t, float>>> embedding_stores_;
 };
 }  // namespace distributed
 static distributed::EmbeddingCacheTableManager &embedding_cache_table_manager =
@@ -30,21 +30,28 @@ int EmbeddingHashMap::ParseData(const int id, int *const swap_out_index, int *co
     return hash_index;
   }
 
+  (void)miss_count_.fetch_add(1, std::memory_order_relaxed);
   if (!need_swap) {
     hash_count_++;
     (void)hash_id_to_index_.emplace(id, hash_index);
     hash_map_elements_[hash_index].set_id(id);
     hash_map_elements_[hash_index].set_step(data_step);
+    counted_steps_[IntToSize(hash_index)] = data_step;
+    policy_->OnInsert(IntToSize(hash_index), id);
     return hash_index;
   }
 
   swap_out_index[*swap_out_size] = hash_index;
   swap_out_ids[*swap_out_size] = hash_map_elements_[hash_index].id_;
   (*swap_out_size)++;
+  (void)swap_out_count_.fetch_add(1, std::memory_order_relaxed);
+  policy_->OnEvict(IntToSize(hash_index), hash_map_elements_[hash_index].id_);
   (void)hash_id_to_index_.erase(hash_map_elements_[hash_index].id_);
   (void)hash_id_to_index_.emplace(id, hash_index);
   hash_map_elements_[hash_index].set_id(id);
   hash_map_elements_[hash_index].set_step(data_step);
+  counted_steps_[IntToSize(hash_index)] = data_step;
+  policy_->OnInsert(IntToSize(hash_index), id);
   return hash_index;
 }
 
@@ -52,25 +59,41 @@ int EmbeddingHashMap::FindInsertionPos(const size_t, const size_t graph_running_
                                        bool *const need_wait_graph) {
   MS_EXCEPTION_IF_NULL(need_swap);
   MS_EXCEPTION_IF_NULL(need_wait_graph);
-  int hash_index = INVALID_INDEX_VALUE;
+  // Collect the expired elements as eviction candidates until the number of candidates reaches the sample number of
+  // policy, the empty element is used directly.
+  const size_t sample_num = policy_->sample_num();
   while (!expired_element_full_) {
-    if (hash_map_elements_[current_pos_].IsEmpty()) {
-      hash_index = current_pos_;
-    } else if (hash_map_elements_[current_pos_].IsExpired(graph_running_step)) {
-      hash_index = current_pos_;
-      *need_swap = true;
-    } else if (hash_map_elements_[current_pos_].StepEqual(graph_running_step)) {
+    auto &element = hash_map_elements_[current_pos_];
+    if (element.IsEmpty()) {
+      int hash_index = SizeToInt(current_pos_);
+      current_pos_ = (current_pos_ + 1) % hash_capacity_;
+      return hash_index;
+    } else if (element.IsExpired(graph_running_step)) {
+      (void)evict_candidates_.emplace_back(current_pos_, element.id_);
+    } else if (element.StepEqual(graph_running_step)) {
       graph_running_index_[graph_running_index_num_++] = current_pos_;
     }
     current_pos_ = (current_pos_ + 1) % hash_capacity_;
-    if (hash_index != INVALID_INDEX_VALUE) {
-      return hash_index;
-    }
     if (current_pos_ == current_batch_start_pos_) {
       expired_element_full_ = true;
       MS_LOG(INFO) << "Running step:" << graph_running_step << "(num:" << graph_running_index_num_
                    << ") will be used, index swap will wait until the graph completed.";
     }
+    if (evict_candidates_.size() >= sample_num) {
+      break;
+    }
+  }
+
+  // The candidate hit after being collected is used by current data step and can not be evicted.
+  while (!evict_candidates_.empty()) {
+    size_t victim = policy_->SelectVictim(evict_candidates_);
+    size_t index = evict_candidates_[victim].first;
+    evict_candidates_[victim] = evict_candidates_.back();
+    evict_candidates_.pop_back();
+    if (hash_map_elements_[index].IsExpired(graph_running_step)) {
+      *need_swap = true;
+      return SizeToInt(index);
+    }
   }
 
   if (graph_running_index_pos_ != graph_running_index_num_) {
@@ -102,6 +125,8 @@ void EmbeddingHashMap::Reset() {
   graph_running_index_num_ = 0;
   graph_running_index_pos_ = 0;
   expired_element_full_ = false;
+  evict_candidates_.clear();
+  policy_->OnStep();
 }
 }  // namespace distributed
 }  // namespace mindspore
@@ -18,11 +18,13 @@
 #define MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_HASH_MAP_H_
 
 #include <cmath>
+#include <atomic>
 #include <utility>
 #include <memory>
 #include <vector>
 #include "utils/hash_map.h"
 #include "utils/convert_utils_base.h"
+#include "distributed/embedding_cache/embedding_cache_policy.h"
 
 namespace mindspore {
 namespace distributed {
@@ -43,11 +45,24 @@ struct HashMapElement {
   void set_step(size_t step) { step_ = step; }
 };
 
+// The cumulative statistics of accesses and swaps of a hash map since it is created.
+struct EmbeddingHashMapCounter {
+  size_t hit_count_{0};
+  size_t miss_count_{0};
+  size_t swap_out_count_{0};
+
+  double hit_rate() const {
+    size_t access_count = hit_count_ + miss_count_;
+    return access_count == 0 ? 0.0 : static_cast<double>(hit_count_) / access_count;
+  }
+};
+
 // EmbeddingHashMap is used to manage the id -> index mapping of the embedding cache table on the host
 // side. The cache content can be stored on the device or host side.
 class EmbeddingHashMap {
  public:
-  EmbeddingHashMap(size_t hash_count, size_t hash_capacity)
+  EmbeddingHashMap(size_t hash_count, size_t hash_capacity,
+                   EmbeddingCachePolicyType policy_type = EmbeddingCachePolicyType::kStepExpiry)
       : hash_count_(hash_count),
         hash_capacity_(hash_capacity),
         current_pos_(0),
@@ -62,6 +77,8 @@ class EmbeddingHashMap {
     hash_map_elements_.front().set_step(SIZE_MAX);
     hash_map_elements_.back().set_step(SIZE_MAX);
     graph_running_index_ = std::make_unique<int[]>(hash_capacity);
+    policy_ = CreateEmbeddingCachePolicy(policy_type, hash_capacity);
+    counted_steps_.resize(hash_capacity, SIZE_MAX);
   }
 
   ~EmbeddingHashMap() = default;
@@ -78,6 +95,27 @@ class EmbeddingHashMap {
     hash_map_elements_[IntToSize(hash_index)].set_step(step);
   }
 
+  // Record a hit of the cached id in the hash index for the eviction policy and statistics. An id repeated in the batch
+  // of one data step is counted only once by both, including the one which missed first in the step.
+  void RecordAccess(const int hash_index, const size_t data_step) {
+    auto index = IntToSize(hash_index);
+    if (counted_steps_[index] == data_step) {
+      return;
+    }
+    counted_steps_[index] = data_step;
+    policy_->OnAccess(index, hash_map_elements_[index].id_);
+    (void)hit_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  // Get the cumulative statistics of accesses and swaps.
+  EmbeddingHashMapCounter counter() const {
+    EmbeddingHashMapCounter counter;
+    counter.hit_count_ = hit_count_.load(std::memory_order_relaxed);
+    counter.miss_count_ = miss_count_.load(std::memory_order_relaxed);
+    counter.swap_out_count_ = swap_out_count_.load(std::memory_order_relaxed);
+    return counter;
+  }
+
   // Get the id -> index mapping.
   const mindspore::HashMap<int, int> &hash_id_to_index() const { return hash_id_to_index_; }
 
@@ -123,6 +161,18 @@ class EmbeddingHashMap {
 
   // The flag indicates hash map is full.
   bool expired_element_full_;
+
+  // The eviction policy which selects the element to be swapped out from the evictable candidates.
+  std::unique_ptr<EmbeddingCachePolicy> policy_;
+  // The evictable candidates (hash index, id) collected by the cursor but not evicted yet in current data step.
+  std::vector<std::pair<size_t, int>> evict_candidates_;
+
+  // The data step in which the access of each element is counted last time.
+  std::vector<size_t> counted_steps_;
+  // The cumulative statistics, which may be read by other threads.
+  std::atomic<size_t> hit_count_{0};
+  std::atomic<size_t> miss_count_{0};
+  std::atomic<size_t> swap_out_count_{0};
 };
 }  // namespace distributed
 }  // namespace mindspore
@@ -0,0 +1,238 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed/embedding_cache/embedding_store.h"
+
+#include <map>
+#include <algorithm>
+#include <utility>
+
+#include "utils/ms_utils.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace distributed {
+template <typename K, typename V>
+EmbeddingStore<K, V>::EmbeddingStore(const std::string &name, size_t cache_capacity, size_t emb_dim)
+    : name_(name), cache_capacity_(cache_capacity), emb_dim_(emb_dim), row_size_(emb_dim * sizeof(V)) {}
+
+template <typename K, typename V>
+EmbeddingStore<K, V>::~EmbeddingStore() {
+  try {
+    if (storage_ != nullptr) {
+      (void)Finalize();
+    }
+  } catch (...) {
+    // exit
+  }
+}
+
+template <typename K, typename V>
+bool EmbeddingStore<K, V>::Initialize() {
+  if (cache_capacity_ == 0 || emb_dim_ == 0) {
+    MS_LOG(ERROR) << "The cache capacity[" << cache_capacity_ << "] and embedding dim[" << emb_dim_
+                  << "] of embedding store[" << name_ << "] must be positive.";
+    return false;
+  }
+
+  // 1. Create the memory-mapped block files in the folder of this store.
+  std::string store_path = common::GetEnv(kEnvEmbeddingStorePath);
+  if (store_path.empty()) {
+    store_path = kDefaultEmbeddingStorePath;
+  }
+  std::map<std::string, std::string> storage_config = {{storage::kFileStoragePath, store_path + "/" + name_}};
+  storage_ = std::make_unique<storage::MmapBlockFile>(storage_config, row_size_);
+  RETURN_IF_FALSE_WITH_LOG(storage_->Initialize(), "Initialize storage of embedding store[" << name_ << "] failed.");
+
+  // 2. Allocate the in-memory cache, all slots are free at first.
+  cache_values_.resize(cache_capacity_ * emb_dim_);
+  slot_keys_.resize(cache_capacity_);
+  slot_dirty_.assign(cache_capacity_, false);
+  free_slots_.resize(cache_capacity_);
+  for (size_t i = 0; i < cache_capacity_; ++i) {
+    free_slots_[i] = cache_capacity_ - i - 1;
+  }
+  return true;
+}
+
+template <typename K, typename V>
+bool EmbeddingStore<K, V>::Finalize() {
+  if (storage_ == nullptr) {
+    return true;
+  }
+  RETURN_IF_FALSE_WITH_LOG(Flush(nullptr), "Flush embedding store[" << name_ << "] failed.");
+  bool ret = flush_future_.get();
+  (void)storage_->Finalize();
+  storage_ = nullptr;
+  return ret;
+}
+
+template <typename K, typename V>
+bool EmbeddingStore<K, V>::Get(const void *, size_t key_num, const void *keys, void *values) {
+  return Get(key_num, keys, values);
+}
+
+template <typename K, typename V>
+bool EmbeddingStore<K, V>::Get(size_t key_num, const void *keys, void *values) {
+  MS_ERROR_IF_NULL(keys);
+  MS_ERROR_IF_NULL(values);
+  MS_ERROR_IF_NULL(storage_);
+  const K *keys_data = reinterpret_cast<const K *>(keys);
+  V *values_data = reinterpret_cast<V *>(values);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  // 1. Get the values hit in the in-memory cache, and record the rows in block files for missing keys.
+  std::vector<std::pair<size_t, size_t>> miss_rows;
+  for (size_t i = 0; i < key_num; ++i) {
+    V *output = values_data + i * emb_dim_;
+    auto cache_iter = key_to_slot_.find(keys_data[i]);
+    if (cache_iter != key_to_slot_.end()) {
+      lru_list_.splice(lru_list_.begin(), lru_list_, cache_iter->second.lru_iter);
+      const V *cached = cache_values_.data() + cache_iter->second.slot * emb_dim_;
+      (void)std::copy(cached, cached + emb_dim_, output);
+      continue;
+    }
+    auto row_iter = key_to_row_.find(keys_data[i]);
+    if (row_iter != key_to_row_.end()) {
+      (void)miss_rows.emplace_back(row_iter->second, i);
+    } else {
+      std::fill(output, output + emb_dim_, static_cast<V>(0));
+    }
+  }
+
+  // 2. Load the missing rows in ascending row order, so that the block files are read sequentially, and the pages of
+  // the whole batch are read ahead before copying.
+  std::sort(miss_rows.begin(), miss_rows.end());
+  for (const auto &miss_row : miss_rows) {
+    storage_->Prefetch(miss_row.first);
+  }
+  for (const auto &miss_row : miss_rows) {
+    const K &key = keys_data[miss_row.second];
+    V *output = values_data + miss_row.second * emb_dim_;
+    // The duplicate key in the batch may have been loaded.
+    auto cache_iter = key_to_slot_.find(key);
+    if (cache_iter != key_to_slot_.end()) {
+      const V *cached = cache_values_.data() + cache_iter->second.slot * emb_dim_;
+      (void)std::copy(cached, cached + emb_dim_, output);
+      continue;
+    }
+
+    const V *stored = reinterpret_cast<const V *>(storage_->GetRow(miss_row.first));
+    MS_ERROR_IF_NULL(stored);
+    size_t slot = 0;
+    RETURN_IF_FALSE_WITH_LOG(AllocSlot(&slot), "Allocate cache slot of embedding store[" << name_ << "] failed.");
+    V *cached = cache_values_.data() + slot * emb_dim_;
+    (void)std::copy(stored, stored + emb_dim_, cached);
+    (void)std::copy(stored, stored + emb_dim_, output);
+    slot_dirty_[slot] = false;
+    InsertCache(key, slot);
+  }
+  return true;
+}
+
+template <typename K, typename V>
+bool EmbeddingStore<K, V>::Put(void *, size_t key_num, const void *keys, const void *values) {
+  MS_ERROR_IF_NULL(keys);
+  MS_ERROR_IF_NULL(values);
+  MS_ERROR_IF_NULL(storage_);
+  const K *keys_data = reinterpret_cast<const K *>(keys);
+  const V *values_data = reinterpret_cast<const V *>(values);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_t i = 0; i < key_num; ++i) {
+    const V *input = values_data + i * emb_dim_;
+    size_t slot = 0;
+    auto cache_iter = key_to_slot_.find(keys_data[i]);
+    if (cache_iter != key_to_slot_.end()) {
+      slot = cache_iter->second.slot;
+      lru_list_.splice(lru_list_.begin(), lru_list_, cache_iter->second.lru_iter);
+    } else {
+      RETURN_IF_FALSE_WITH_LOG(AllocSlot(&slot), "Allocate cache slot of embedding store[" << name_ << "] failed.");
+      InsertCache(keys_data[i], slot);
+    }
+    (void)std::copy(input, input + emb_dim_, cache_values_.data() + slot * emb_dim_);
+    slot_dirty_[slot] = true;
+  }
+  return true;
+}
+
+template <typename K, typename V>
+bool EmbeddingStore<K, V>::Flush(void *) {
+  MS_ERROR_IF_NULL(storage_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t slot : lru_list_) {
+      if (slot_dirty_[slot]) {
+        RETURN_IF_FALSE_WITH_LOG(WriteBack(slot), "Write back embedding store[" << name_ << "] failed.");
+        slot_dirty_[slot] = false;
+      }
+    }
+  }
+
+  // Only one writing of block files is in flight.
+  if (flush_future_.valid() && !flush_future_.get()) {
+    MS_LOG(WARNING) << "The last flush of embedding store[" << name_ << "] failed.";
+  }
+  auto storage = storage_.get();
+  flush_future_ = std::async(std::launch::async, [storage]() { return storage->Sync(); });
+  return true;
+}
+
+template <typename K, typename V>
+bool EmbeddingStore<K, V>::AllocSlot(size_t *slot) {
+  MS_ERROR_IF_NULL(slot);
+  if (!free_slots_.empty()) {
+    *slot = free_slots_.back();
+    free_slots_.pop_back();
+    return true;
+  }
+
+  // Evict the least recently used row, and spill it to the block files if it is dirty.
+  if (lru_list_.empty()) {
+    MS_LOG(ERROR) << "There is no slot to evict in embedding store[" << name_ << "].";
+    return false;
+  }
+  size_t victim = lru_list_.back();
+  if (slot_dirty_[victim]) {
+    RETURN_IF_FALSE(WriteBack(victim));
+    slot_dirty_[victim] = false;
+  }
+  lru_list_.pop_back();
+  (void)key_to_slot_.erase(slot_keys_[victim]);
+  *slot = victim;
+  return true;
+}
+
+template <typename K, typename V>
+bool EmbeddingStore<K, V>::WriteBack(size_t slot) {
+  auto row_iter = key_to_row_.emplace(slot_keys_[slot], key_to_row_.size()).first;
+  V *stored = reinterpret_cast<V *>(storage_->GetRow(row_iter->second));
+  MS_ERROR_IF_NULL(stored);
+  const V *cached = cache_values_.data() + slot * emb_dim_;
+  (void)std::copy(cached, cached + emb_dim_, stored);
+  return true;
+}
+
+template <typename K, typename V>
+void EmbeddingStore<K, V>::InsertCache(const K &key, size_t slot) {
+  lru_list_.push_front(slot);
+  slot_keys_[slot] = key;
+  key_to_slot_[key] = CacheEntry{slot, lru_list_.begin()};
+}
+
+template class EmbeddingStore<int32_t, float>;
+}  // namespace distributed
+}  // namespace mindspore
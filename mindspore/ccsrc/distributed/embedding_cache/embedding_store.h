@@ -17,27 +17,106 @@
 #ifndef MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_STORE_H_
 #define MINDSPORE_CCSRC_DISTRIBUTED_EMBEDDING_CACHE_EMBEDDING_STORE_H_
 
+#include <list>
+#include <mutex>
+#include <future>
+#include <memory>
 #include <string>
+#include <vector>
+#include <unordered_map>
+#include "distributed/persistent/storage/mmap_block_file.h"
 #include "include/backend/visible.h"
 
 namespace mindspore {
 namespace distributed {
+// The environment variable used to specify the folder of the embedding store files.
+constexpr char kEnvEmbeddingStorePath[] = "MS_EMBEDDING_STORE_PATH";
+// The default folder of the embedding store files.
+constexpr char kDefaultEmbeddingStorePath[] = "./embedding_store";
+
+// EmbeddingStore is used to store the embedding table which may be larger than the host memory. The hot rows are kept
+// in a bounded in-memory cache(LRU), and the cold rows are spilled to the memory-mapped block files on local disk.
+// The block files are scratch space of one training process: the mapping from keys to rows is only kept in memory, so
+// the rows in an existing folder are not recovered by a new store and will be overwritten. The embedding table should
+// be saved by checkpoint for restarting.
 template <typename K, typename V>
 class BACKEND_EXPORT EmbeddingStore {
  public:
-  EmbeddingStore(std::string, size_t, size_t) {}
-  ~EmbeddingStore() = default;
+  // The 'cache_capacity' is the max row number of in-memory cache, and 'emb_dim' is the element number of one row.
+  EmbeddingStore(const std::string &name, size_t cache_capacity, size_t emb_dim);
+  ~EmbeddingStore();
+
+  // Create the storage folder and allocate the in-memory cache.
+  bool Initialize();
+  // Flush all dirty rows and wait for the writing to complete, then release storage.
+  bool Finalize();
+
+  // Get the values of a batch of keys, the 'input' is the in-memory embedding table of the parameter which is not
+  // used by the tiered store. The values of keys which have never been put are filled with zero.
+  bool Get(const void *input, size_t key_num, const void *keys, void *values);
+
+  bool Get(size_t key_num, const void *keys, void *values);
+
+  // Put the values of a batch of keys into the in-memory cache, the least recently used rows are spilled to the disk
+  // if the cache is full.
+  bool Put(void *input, size_t key_num, const void *keys, const void *values);
+
+  // Write all dirty rows of the in-memory cache to the memory-mapped block files, and write the block files to disk
+  // asynchronously, the next Flush or Finalize waits for the previous writing.
+  bool Flush(void *input);
+
+  // Get the number of rows in the in-memory cache.
+  size_t cache_size() const { return key_to_slot_.size(); }
+  // Get the number of rows spilled to the disk.
+  size_t storage_size() const { return key_to_row_.size(); }
+
+ private:
+  // The position of a key in the in-memory cache, the iterator points to the slot in 'lru_list_'.
+  struct CacheEntry {
+    size_t slot;
+    std::list<size_t>::iterator lru_iter;
+  };
+
+  // Get a free slot of the in-memory cache, evict the least recently used row if the cache is full.
+  bool AllocSlot(size_t *slot);
+
+  // Write the row in the slot to the block file, a new row in the block file is allocated for a new key.
+  bool WriteBack(size_t slot);
+
+  // Insert the key into the in-memory cache as the most recently used one.
+  void InsertCache(const K &key, size_t slot);
 
-  bool Initialize() { return true; }
-  bool Finalize() { return true; }
+  // The name of the embedding store, it is the key of the parameter.
+  std::string name_;
+  // The max row number of the in-memory cache.
+  size_t cache_capacity_;
+  // The element number of one row.
+  size_t emb_dim_;
+  // The length of one row in bytes.
+  size_t row_size_;
 
-  bool Get(const void *input, size_t key_num, const void *keys, void *values) { return true; }
+  // The rows of the in-memory cache.
+  std::vector<V> cache_values_;
+  // The key and dirty flag of every slot of the in-memory cache.
+  std::vector<K> slot_keys_;
+  std::vector<bool> slot_dirty_;
+  // The free slots of the in-memory cache.
+  std::vector<size_t> free_slots_;
+  // The slots ordered by recent usage, the front is the most recently used one.
+  std::list<size_t> lru_list_;
+  // The mapping from key to the slot of the in-memory cache.
+  std::unordered_map<K, CacheEntry> key_to_slot_;
 
-  bool Get(size_t key_num, const void *keys, void *values) { return true; }
+  // The mapping from key to the row of the block files, a key keeps its row once allocated. It is not persisted.
+  std::unordered_map<K, size_t> key_to_row_;
+  // The memory-mapped block files to store the spilled rows.
+  std::unique_ptr<storage::MmapBlockFile> storage_;
 
-  bool Put(void *input, size_t key_num, const void *keys, const void *values) { return true; }
+  // The future of the last asynchronous writing of block files.
+  std::future<bool> flush_future_;
 
-  bool Flush(void *input) { return true; }
+  // Protect the in-memory cache and the mapping of storage rows.
+  std::mutex mutex_;
 };
 }  // namespace distributed
 }  // namespace mindspore
@@ -0,0 +1,184 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "distributed/persistent/storage/mmap_block_file.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <utility>
+
+#include "distributed/persistent/storage/file_io_utils.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace distributed {
+namespace storage {
+MmapBlockFile::MmapBlockFile(const std::map<std::string, std::string> &storage_config, size_t row_size)
+    : row_size_(row_size), rows_per_block_(0) {
+  auto file_path_iter = storage_config.find(kFileStoragePath);
+  if (file_path_iter != storage_config.end()) {
+    file_path_ = file_path_iter->second;
+  }
+
+  auto block_length_iter = storage_config.find(kMaxBlockLength);
+  if (block_length_iter != storage_config.end() && !(block_length_iter->second).empty()) {
+    max_block_length_ = std::stoul(block_length_iter->second);
+  } else {
+    max_block_length_ = kDefaultMaxMmapBlockLength;
+  }
+  if (row_size_ != 0) {
+    rows_per_block_ = max_block_length_ / row_size_;
+  }
+}
+
+MmapBlockFile::~MmapBlockFile() {
+  try {
+    (void)Finalize();
+  } catch (...) {
+    // exit
+  }
+}
+
+bool MmapBlockFile::Initialize() {
+#if defined(_WIN32) || defined(_WIN64)
+  MS_LOG(ERROR) << "The memory-mapped block file is not supported on windows.";
+  return false;
+#else
+  if (file_path_.empty()) {
+    MS_LOG(ERROR) << "The file storage path is empty.";
+    return false;
+  }
+  if (rows_per_block_ == 0) {
+    MS_LOG(ERROR) << "The row size[" << row_size_ << "] is zero or larger than the max block length["
+                  << max_block_length_ << "].";
+    return false;
+  }
+  if (!FileIOUtils::IsFileOrDirExist(file_path_)) {
+    FileIOUtils::CreateDirRecursive(file_path_);
+  }
+  return true;
+#endif
+}
+
+bool MmapBlockFile::Finalize() {
+  std::lock_guard<std::mutex> lock(blocks_mutex_);
+#if !defined(_WIN32) && !defined(_WIN64)
+  for (auto &mapped_block : blocks_) {
+    if (mapped_block.addr != nullptr && munmap(mapped_block.addr, mapped_block.length) != 0) {
+      MS_LOG(ERROR) << "Unmap block file[" << mapped_block.block->block_file_name() << "] failed, errno: " << errno;
+    }
+    if (mapped_block.fd >= 0) {
+      (void)close(mapped_block.fd);
+    }
+  }
+#endif
+  blocks_.clear();
+  return true;
+}
+
+void *MmapBlockFile::GetRow(size_t row_index) {
+  size_t block_index = row_index / rows_per_block_;
+  std::lock_guard<std::mutex> lock(blocks_mutex_);
+  if (block_index >= blocks_.size() || blocks_[block_index].addr == nullptr) {
+    if (!MapBlock(block_index)) {
+      return nullptr;
+    }
+  }
+  return reinterpret_cast<char *>(blocks_[block_index].addr) + (row_index % rows_per_block_) * row_size_;
+}
+
+void MmapBlockFile::Prefetch(size_t row_index) const {
+#if !defined(_WIN32) && !defined(_WIN64)
+  size_t block_index = row_index / rows_per_block_;
+  std::lock_guard<std::mutex> lock(blocks_mutex_);
+  if (block_index >= blocks_.size() || blocks_[block_index].addr == nullptr) {
+    return;
+  }
+  // The advised range must start from a page boundary.
+  static const size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  size_t offset = (row_index % rows_per_block_) * row_size_;
+  size_t aligned_offset = offset - offset % page_size;
+  (void)madvise(reinterpret_cast<char *>(blocks_[block_index].addr) + aligned_offset,
+                offset + row_size_ - aligned_offset, MADV_WILLNEED);
+#endif
+}
+
+bool MmapBlockFile::Sync() const {
+#if defined(_WIN32) || defined(_WIN64)
+  return false;
+#else
+  // Only hold the lock to collect mapped regions, the writing to disk may take a long time.
+  std::vector<std::pair<void *, size_t>> regions;
+  {
+    std::lock_guard<std::mutex> lock(blocks_mutex_);
+    for (const auto &mapped_block : blocks_) {
+      if (mapped_block.addr != nullptr) {
+        (void)regions.emplace_back(mapped_block.addr, mapped_block.length);
+      }
+    }
+  }
+  for (const auto &region : regions) {
+    if (msync(region.first, region.second, MS_SYNC) != 0) {
+      MS_LOG(ERROR) << "Sync memory-mapped block file failed, errno: " << errno;
+      return false;
+    }
+  }
+  return true;
+#endif
+}
+
+bool MmapBlockFile::MapBlock(size_t block_index) {
+#if defined(_WIN32) || defined(_WIN64)
+  return false;
+#else
+  if (block_index >= blocks_.size()) {
+    blocks_.resize(block_index + 1);
+  }
+  auto &mapped_block = blocks_[block_index];
+  mapped_block.block = std::make_shared<Block>(file_path_ + "/" + kBlockFilePrefix + std::to_string(block_index));
+  const std::string &file_name = mapped_block.block->block_file_name();
+
+  mapped_block.fd = open(file_name.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR);
+  if (mapped_block.fd < 0) {
+    MS_LOG(ERROR) << "Open block file[" << file_name << "] failed, errno: " << errno;
+    return false;
+  }
+  // The file is sparse after truncating, the disk space is only allocated for the written pages.
+  mapped_block.length = rows_per_block_ * row_size_;
+  if (ftruncate(mapped_block.fd, static_cast<off_t>(mapped_block.length)) != 0) {
+    MS_LOG(ERROR) << "Truncate block file[" << file_name << "] failed, errno: " << errno;
+    (void)close(mapped_block.fd);
+    mapped_block.fd = -1;
+    return false;
+  }
+
+  void *addr = mmap(nullptr, mapped_block.length, PROT_READ | PROT_WRITE, MAP_SHARED, mapped_block.fd, 0);
+  if (addr == MAP_FAILED) {
+    MS_LOG(ERROR) << "Map block file[" << file_name << "] failed, errno: " << errno;
+    (void)close(mapped_block.fd);
+    mapped_block.fd = -1;
+    return false;
+  }
+  mapped_block.addr = addr;
+  return true;
+#endif
+}
+}  // namespace storage
+}  // namespace distributed
+}  // namespace mindspore
@@ -0,0 +1,96 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_DISTRIBUTED_PERSISTENT_STORAGE_MMAP_BLOCK_FILE_H_
+#define MINDSPORE_CCSRC_DISTRIBUTED_PERSISTENT_STORAGE_MMAP_BLOCK_FILE_H_
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "distributed/persistent/storage/block.h"
+#include "distributed/persistent/storage/constants.h"
+
+namespace mindspore {
+namespace distributed {
+namespace storage {
+// The default maximum length of each memory-mapped block file : 256MB.
+constexpr size_t kDefaultMaxMmapBlockLength = 256 << 20;
+
+// Row addressed file storage, which is composed of many fixed length block files in the 'file_path_'(dir). Each block
+// file is memory-mapped at once it is used, so the rows are read and written in place, and the page cache of the
+// operating system decides which part stays in memory, this makes the storage could be several times larger than the
+// host memory.
+class MmapBlockFile {
+ public:
+  MmapBlockFile(const std::map<std::string, std::string> &storage_config, size_t row_size);
+  ~MmapBlockFile();
+
+  // Create the folder of block files if it does not exist.
+  bool Initialize();
+
+  // Unmap and close all block files.
+  bool Finalize();
+
+  // Get the memory-mapped address of the row, the block file containing the row is created and mapped if need.
+  void *GetRow(size_t row_index);
+
+  // Advise the operating system that the row will be accessed soon, so that the pages are read ahead asynchronously.
+  void Prefetch(size_t row_index) const;
+
+  // Write all dirty pages of the mapped block files to disk, and wait for the writing to complete.
+  bool Sync() const;
+
+  // Get the number of rows could be held by one block file.
+  size_t rows_per_block() const { return rows_per_block_; }
+
+ private:
+  // The memory-mapped block file.
+  struct MappedBlock {
+    std::shared_ptr<Block> block;
+    int fd{-1};
+    void *addr{nullptr};
+    size_t length{0};
+  };
+
+  // Create, truncate and map the block file by block index.
+  bool MapBlock(size_t block_index);
+
+  // Folder path to save all block files.
+  std::string file_path_;
+
+  // The length of one row in bytes.
+  size_t row_size_;
+
+  // The number of rows in one block file.
+  size_t rows_per_block_;
+
+  // Maximum size of each block file.
+  size_t max_block_length_;
+
+  // All mapped block files, the index of the vector is the block index.
+  std::vector<MappedBlock> blocks_;
+
+  // Protect 'blocks_' when the blocks are mapped and synchronized in different threads.
+  mutable std::mutex blocks_mutex_;
+};
+}  // namespace storage
+}  // namespace distributed
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_DISTRIBUTED_PERSISTENT_STORAGE_MMAP_BLOCK_FILE_H_
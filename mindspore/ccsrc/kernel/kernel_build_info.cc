@@ -64,6 +64,12 @@ const std::vector<TypeId> &KernelBuildInfo::GetAllInputDeviceTypes() const { ret
 
 const std::vector<TypeId> &KernelBuildInfo::GetAllOutputDeviceTypes() const { return outputs_device_type_; }
 
+std::vector<std::string> KernelBuildInfo::GetAllOutputReshapeType() const { return output_reshape_type_; }
+
+std::vector<std::string> KernelBuildInfo::GetAllInputReshapeType() const { return input_reshape_type_; }
+
+const std::vector<std::string> &KernelBuildInfo::GetAllInputValueDepend() const { return input_value_depend_; }
+
 void KernelBuildInfo::SetOutputFormat(const std::string &format, size_t index) {
   if (index >= outputs_format_.size()) {
     MS_LOG(EXCEPTION) << "The index [" << index << "] is exceed the number of output";
@@ -73,6 +73,8 @@ class BACKEND_EXPORT KernelBuildInfo {
 
   std::vector<std::string> GetAllInputReshapeType() const;
 
+  const std::vector<std::string> &GetAllInputValueDepend() const;
+
   std::string core_type() const { return core_type_; }
 
   void SetOutputFormat(const std::string &format, size_t index);
@@ -69,6 +69,10 @@ PYBIND_REGISTER(ConfigManager, 0, ([](const py::module *m) {
                     .def("get_enable_autotune", &ConfigManager::enable_autotune)
                     .def("set_autotune_interval", &ConfigManager::set_autotune_interval)
                     .def("get_autotune_interval", &ConfigManager::autotune_interval)
+                    .def("set_autotune_cpu_budget", &ConfigManager::set_autotune_cpu_budget)
+                    .def("get_autotune_cpu_budget", &ConfigManager::autotune_cpu_budget)
+                    .def("set_autotune_memory_budget", &ConfigManager::set_autotune_memory_budget)
+                    .def("get_autotune_memory_budget", &ConfigManager::autotune_memory_budget)
                     .def("set_enable_watchdog", &ConfigManager::set_enable_watchdog)
                     .def("get_enable_watchdog", &ConfigManager::enable_watchdog)
                     .def("set_multiprocessing_timeout_interval", &ConfigManager::set_multiprocessing_timeout_interval)
@@ -77,6 +81,12 @@ PYBIND_REGISTER(ConfigManager, 0, ([](const py::module *m) {
                     .def("get_dynamic_shape", &ConfigManager::dynamic_shape)
                     .def("set_fast_recovery", &ConfigManager::set_fast_recovery)
                     .def("get_fast_recovery", &ConfigManager::fast_recovery)
+                    .def("set_shuffle_max_rows_in_memory", &ConfigManager::set_shuffle_max_rows_in_memory)
+                    .def("get_shuffle_max_rows_in_memory", &ConfigManager::shuffle_max_rows_in_memory)
+                    .def("set_shuffle_spill_dir", &ConfigManager::set_shuffle_spill_dir)
+                    .def("get_shuffle_spill_dir", &ConfigManager::shuffle_spill_dir)
+                    .def("set_batch_recycle_memory", &ConfigManager::set_batch_recycle_memory)
+                    .def("get_batch_recycle_memory", &ConfigManager::batch_recycle_memory)
                     .def("load", [](ConfigManager &c, const std::string &s) { THROW_IF_ERROR(c.LoadFile(s)); });
                 }));
 
@@ -25,7 +25,15 @@ namespace mindspore {
 namespace dataset {
 PYBIND_REGISTER(TreeConsumer, 0, ([](const py::module *m) {
                   (void)py::class_<TreeConsumer, std::shared_ptr<TreeConsumer>>(*m, "TreeConsumer")
-                    .def("Reset", [](TreeConsumer &self, int64_t step) { THROW_IF_ERROR(self.Reset(step)); });
+                    .def(
+                      "Reset",
+                      [](TreeConsumer &self, int64_t step, const std::string &checkpoint) {
+                        THROW_IF_ERROR(self.Reset(step, checkpoint));
+                      },
+                      py::arg("step"), py::arg("checkpoint") = "")
+                    .def("SaveCheckpoint", [](TreeConsumer &self, int64_t step, const std::string &file_path) {
+                      THROW_IF_ERROR(self.SaveCheckpoint(step, file_path));
+                    });
                 }));
 PYBIND_REGISTER(PythonIteratorConsumer, 1, ([](const py::module *m) {
                   (void)py::class_<PythonIteratorConsumer, TreeConsumer, std::shared_ptr<PythonIteratorConsumer>>(
@@ -195,12 +195,13 @@ PYBIND_REGISTER(MapNode, 2, ([](const py::module *m) {
                                      const py::list &input_columns, const py::list &output_columns,
                                      std::vector<std::shared_ptr<PyDSCallback>> &py_callbacks, int64_t max_rowsize,
                                      const ManualOffloadMode &offload,
-                                     std::shared_ptr<PythonMultiprocessingRuntime> &python_mp) {
+                                     std::shared_ptr<PythonMultiprocessingRuntime> &python_mp, bool batched) {
                       auto map = std::make_shared<MapNode>(
                         self, std::move(toTensorOperations(operations)), toStringVector(input_columns),
                         toStringVector(output_columns), nullptr,
                         std::vector<std::shared_ptr<DSCallback>>(py_callbacks.begin(), py_callbacks.end()), offload,
                         python_mp);
+                      map->SetBatched(batched);
                       THROW_IF_ERROR(map->ValidateParams());
                       return map;
                     }));
@@ -20,6 +20,7 @@
 
 #include "mindspore/ccsrc/minddata/dataset/kernels/data/compose_op.h"
 #include "minddata/dataset/kernels/py_func_op.h"
+#include "minddata/dataset/kernels/shared_row_channel.h"
 
 namespace mindspore {
 namespace dataset {
@@ -46,5 +47,109 @@ PYBIND_REGISTER(TensorOp, 0, ([](const py::module *m) {
                   (void)py::class_<TensorOp, std::shared_ptr<TensorOp>>(*m, "TensorOp")
                     .def("__deepcopy__", [](py::object &t, py::dict memo) { return t; });
                 }));
+
+PYBIND_REGISTER(SharedRowChannel, 0, ([](const py::module *m) {
+                  auto channel =
+                    py::class_<SharedRowChannel, std::shared_ptr<SharedRowChannel>>(*m, "SharedRowChannel");
+                  (void)py::enum_<SharedRowChannel::Slot>(channel, "Slot", py::arithmetic())
+                    .value("REQUEST", SharedRowChannel::Slot::kRequest)
+                    .value("RESPONSE", SharedRowChannel::Slot::kResponse)
+                    .export_values();
+                  (void)py::enum_<SharedRowChannel::Kind>(channel, "Kind", py::arithmetic())
+                    .value("EMPTY", SharedRowChannel::Kind::kEmpty)
+                    .value("ARRAYS", SharedRowChannel::Kind::kArrays)
+                    .value("BYTES", SharedRowChannel::Kind::kBytes)
+                    .value("OVERFLOW", SharedRowChannel::Kind::kOverflow)
+                    .export_values();
+                  (void)channel
+                    .def(py::init([](size_t slot_size) {
+                      std::shared_ptr<SharedRowChannel> out;
+                      THROW_IF_ERROR(SharedRowChannel::Create(slot_size, &out));
+                      return out;
+                    }))
+                    .def_static("is_supported", &SharedRowChannel::IsSupported)
+                    .def("put_arrays",
+                         [](SharedRowChannel &self, SharedRowChannel::Slot slot, int32_t func_idx,
+                            const py::object &data) {
+                           // a tuple of arrays or a single array, anything else is serialized by the caller
+                           bool is_tuple = py::isinstance<py::tuple>(data);
+                           py::tuple items = is_tuple ? data.cast<py::tuple>() : py::make_tuple(data);
+                           std::vector<py::array> holders;
+                           std::vector<SharedRowChannel::ArrayView> arrays;
+                           for (auto item : items) {
+                             if (!py::isinstance<py::array>(item)) {
+                               return false;
+                             }
+                             auto arr = py::array::ensure(item, py::array::c_style);
+                             DataType type = DataType::FromNpArray(arr);
+                             if (!type.IsNumeric() || arr.ndim() > SharedRowChannel::kMaxRank) {
+                               return false;
+                             }
+                             std::vector<dsize_t> shape(arr.shape(), arr.shape() + arr.ndim());
+                             arrays.push_back(SharedRowChannel::ArrayView{type, TensorShape(shape),
+                                                                          static_cast<const uchar *>(arr.data())});
+                             holders.push_back(arr);
+                           }
+                           bool put = false;
+                           py::gil_scoped_release gil_release;
+                           THROW_IF_ERROR(self.PutArrays(slot, func_idx, arrays, is_tuple, &put));
+                           return put;
+                         })
+                    .def("put_bytes",
+                         [](SharedRowChannel &self, SharedRowChannel::Slot slot, int32_t func_idx,
+                            const py::bytes &data) {
+                           char *buffer = nullptr;
+                           ssize_t length = 0;
+                           if (PyBytes_AsStringAndSize(data.ptr(), &buffer, &length) != 0) {
+                             throw py::error_already_set();
+                           }
+                           bool put = false;
+                           py::gil_scoped_release gil_release;
+                           THROW_IF_ERROR(self.PutBytes(slot, func_idx, buffer, static_cast<size_t>(length), &put));
+                           return put;
+                         })
+                    .def("put_overflow",
+                         [](SharedRowChannel &self, SharedRowChannel::Slot slot, int32_t func_idx) {
+                           THROW_IF_ERROR(self.PutOverflow(slot, func_idx));
+                         })
+                    .def("wait",
+                         [](SharedRowChannel &self, SharedRowChannel::Slot slot, int32_t timeout_ms) {
+                           bool ready = false;
+                           py::gil_scoped_release gil_release;
+                           THROW_IF_ERROR(self.Wait(slot, timeout_ms, &ready));
+                           return ready;
+                         })
+                    .def("kind", &SharedRowChannel::GetKind)
+                    .def("func_idx", &SharedRowChannel::GetFuncIdx)
+                    .def("get_arrays",
+                         [](const std::shared_ptr<SharedRowChannel> &self, SharedRowChannel::Slot slot, bool copy) {
+                           // the views are valid until the slot is put into again, they keep the channel alive
+                           std::vector<SharedRowChannel::ArrayView> arrays;
+                           THROW_IF_ERROR(self->GetArrays(slot, &arrays));
+                           py::object base = py::cast(self);
+                           py::list items;
+                           for (const auto &array : arrays) {
+                             if (copy) {
+                               items.append(py::array(array.type.AsNumpyType(), array.shape.AsVector(), array.data));
+                             } else {
+                               items.append(
+                                 py::array(array.type.AsNumpyType(), array.shape.AsVector(), array.data, base));
+                             }
+                           }
+                           if (!self->IsTuple(slot) && items.size() == 1) {
+                             return py::object(items[0]);
+                           }
+                           return py::object(py::tuple(items));
+                         })
+                    .def("get_bytes",
+                         [](const SharedRowChannel &self, SharedRowChannel::Slot slot) {
+                           const char *bytes = nullptr;
+                           size_t size = 0;
+                           THROW_IF_ERROR(self.GetBytes(slot, &bytes, &size));
+                           return py::bytes(bytes, size);
+                         })
+                    .def("close", &SharedRowChannel::Close)
+                    .def("is_closed", &SharedRowChannel::IsClosed);
+                }));
 }  // namespace dataset
 }  // namespace mindspore
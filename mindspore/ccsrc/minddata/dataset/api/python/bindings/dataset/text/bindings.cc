@@ -142,7 +142,11 @@ PYBIND_REGISTER(Vectors, 0, ([](const py::module *m) {
                       std::shared_ptr<Vectors> vectors;
                       THROW_IF_ERROR(Vectors::BuildFromFile(&vectors, path, max_vectors));
                       return vectors;
-                    });
+                    })
+                    .def_static("convert_to_binary",
+                                [](const std::string &path, const std::string &binary_path, int32_t max_vectors) {
+                                  THROW_IF_ERROR(Vectors::ConvertToBinary(path, binary_path, max_vectors));
+                                });
                 }));
 }  // namespace dataset
 }  // namespace mindspore
@@ -259,6 +259,22 @@ class ConfigManager {
   // @param interval - autotune interval in steps
   void set_autotune_interval(int64_t interval) { autotune_interval_ = interval; }
 
+  // getter function
+  // @return - Cores AutoTune may give to the dataset pipeline, 0 if not limited
+  int32_t autotune_cpu_budget() const { return autotune_cpu_budget_; }
+
+  // setter function
+  // @param num_cores - Cores AutoTune may give to the dataset pipeline, 0 if not limited
+  void set_autotune_cpu_budget(int32_t num_cores) { autotune_cpu_budget_ = num_cores; }
+
+  // getter function
+  // @return - Memory in MB AutoTune may give to the dataset pipeline, 0 if not limited
+  int64_t autotune_memory_budget() const { return autotune_memory_budget_; }
+
+  // setter function
+  // @param size - Memory in MB AutoTune may give to the dataset pipeline, 0 if not limited
+  void set_autotune_memory_budget(int64_t size) { autotune_memory_budget_ = size; }
+
   // setter function
   // @param enable - To enable watchdog python thread
   void set_enable_watchdog(bool enable) { enable_watchdog_ = enable; }
@@ -293,6 +309,32 @@ class ConfigManager {
   // @return - Flag to indicate whether md pipeline recovers fast in failover reset
   bool fast_recovery() const { return fast_recovery_; }
 
+  // setter function
+  // @notes The rows of a shuffle buffer beyond the limit are spilled to a scratch file in the shuffle spill dir
+  // @param rows - The maximum number of rows of a shuffle buffer kept in memory, 0 for no limit (default=0)
+  void set_shuffle_max_rows_in_memory(int32_t rows) { shuffle_max_rows_in_memory_ = rows; }
+
+  // getter function
+  // @return - The maximum number of rows of a shuffle buffer kept in memory, 0 for no limit
+  int32_t shuffle_max_rows_in_memory() const { return shuffle_max_rows_in_memory_; }
+
+  // setter function
+  // @param dir - The directory of the scratch files of the spilled shuffle buffer rows (default="/tmp")
+  void set_shuffle_spill_dir(const std::string &dir) { shuffle_spill_dir_ = dir; }
+
+  // getter function
+  // @return - The directory of the scratch files of the spilled shuffle buffer rows
+  std::string shuffle_spill_dir() const { return shuffle_spill_dir_; }
+
+  // setter function
+  // @notes The buffers of the released batches are kept and handed out again to the next batches of the same size
+  // @param size - The memory in MB of the released batch buffers kept by a batch op, 0 to disable (default=0)
+  void set_batch_recycle_memory(int32_t size) { batch_recycle_memory_ = size; }
+
+  // getter function
+  // @return - The memory in MB of the released batch buffers kept by a batch op, 0 if disabled
+  int32_t batch_recycle_memory() const { return batch_recycle_memory_; }
+
  private:
   // Private helper function that takes a nlohmann json format and populates the settings
   // @param j - The json nlohmann json info
@@ -323,11 +365,16 @@ class ConfigManager {
   bool enable_autotune_;
   bool save_autoconfig_;  // True if should save AutoTune configuration
   int64_t autotune_interval_;
+  int32_t autotune_cpu_budget_{0};     // Cores for the pipeline tuned by the AutoTune model, 0 if not limited
+  int64_t autotune_memory_budget_{0};  // Memory in MB for the pipeline tuned by the AutoTune model, 0 if not limited
   bool enable_watchdog_;                       // Watchdog python thread enabled flag
   uint32_t multiprocessing_timeout_interval_;  // Multiprocessing timeout interval in seconds
   std::string autotune_json_filepath_;         // Filepath name of the final AutoTune Configuration JSON file
   bool dynamic_shape_{false};
   bool fast_recovery_{true};  // Used for failover scenario to recover quickly or produce same augmentations
+  int32_t shuffle_max_rows_in_memory_{0};  // Rows of a shuffle buffer kept in memory, the others are spilled
+  std::string shuffle_spill_dir_{"/tmp"};  // Directory of the scratch files of the spilled shuffle buffer rows
+  int32_t batch_recycle_memory_{0};        // Memory in MB of the released batch buffers kept for recycling
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -89,12 +89,21 @@ Tensor &Tensor::operator=(Tensor &&other) noexcept {
 }
 
 Status Tensor::CreateEmpty(const TensorShape &shape, const DataType &type, TensorPtr *out) {
+  return CreateEmpty(shape, type, GlobalContext::Instance()->mem_pool(), out);
+}
+
+Status Tensor::CreateEmpty(const TensorShape &shape, const DataType &type, const std::shared_ptr<MemoryPool> &pool,
+                           TensorPtr *out) {
   CHECK_FAIL_RETURN_UNEXPECTED(shape.known(), "Failed to create empty tensor, tensor shape is unknown.");
   CHECK_FAIL_RETURN_UNEXPECTED(type != DataType::DE_UNKNOWN, "Failed to create empty tensor, data type is unknown.");
+  RETURN_UNEXPECTED_IF_NULL(pool);
   RETURN_UNEXPECTED_IF_NULL(out);
   const TensorAlloc *alloc = GlobalContext::Instance()->tensor_allocator();
   *out = std::allocate_shared<Tensor>(*alloc, shape, type);
   CHECK_FAIL_RETURN_UNEXPECTED(out != nullptr, "Failed to create empty tensor, allocate memory failed.");
+  if (pool != GlobalContext::Instance()->mem_pool()) {
+    (*out)->data_allocator_ = std::make_unique<Allocator<unsigned char>>(pool);
+  }
   // if it's a string tensor and it has no elements, Just initialize the shape and type.
   if (!type.IsNumeric()) {
     if (shape.NumOfElements() == 0) {
@@ -111,6 +111,14 @@ Status StorageContainer::Write(const ReadableSlice &dest, off64_t offset) const
 }
 
 Status StorageContainer::Insert(const std::vector<ReadableSlice> &buf, off64_t *offset) noexcept {
+  BSpaceDescriptor bspd{0};
+  return Insert(buf, offset, &bspd);
+}
+
+Status StorageContainer::Insert(const std::vector<ReadableSlice> &buf, off64_t *offset,
+                                BSpaceDescriptor *bspd) noexcept {
+  RETURN_UNEXPECTED_IF_NULL(offset);
+  RETURN_UNEXPECTED_IF_NULL(bspd);
   size_t sz = 0;
   for (auto &v : buf) {
     sz += v.GetSize();
@@ -121,9 +129,8 @@ Status StorageContainer::Insert(const std::vector<ReadableSlice> &buf, off64_t *
   if (sz > bs_->GetMaxSize()) {
     RETURN_STATUS_UNEXPECTED("Request size too big");
   }
-  BSpaceDescriptor bspd{0};
   addr_t addr = 0;
-  RETURN_IF_NOT_OK(bs_->Alloc(sz, &bspd, &addr));
+  RETURN_IF_NOT_OK(bs_->Alloc(sz, bspd, &addr));
   *offset = static_cast<off64_t>(addr);
   // We will do piecewise copy of the data to a large buffer
   std::string mem;
@@ -145,6 +152,8 @@ Status StorageContainer::Insert(const std::vector<ReadableSlice> &buf, off64_t *
   return Status::OK();
 }
 
+void StorageContainer::Free(const BSpaceDescriptor &bspd) noexcept { bs_->Free(&bspd); }
+
 Status StorageContainer::Truncate() const noexcept {
   if (is_open_) {
     RETURN_IF_NOT_OK(cont_.TruncateFile(fd_));
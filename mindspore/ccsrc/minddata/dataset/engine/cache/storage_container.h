@@ -50,6 +50,12 @@ class StorageContainer {
 
   Status Insert(const std::vector<ReadableSlice> &buf, off64_t *offset) noexcept;
 
+  // Same as above, and also returns the descriptor of the space of the data, which can be given back by Free
+  Status Insert(const std::vector<ReadableSlice> &buf, off64_t *offset, BSpaceDescriptor *bspd) noexcept;
+
+  // Give back the space of the data inserted before, so that it can be reused by the following inserts
+  void Free(const BSpaceDescriptor &bspd) noexcept;
+
   Status Write(const ReadableSlice &dest, off64_t offset) const noexcept;
 
   Status Read(WritableSlice *dest, off64_t offset) const noexcept;
@@ -58,6 +64,9 @@ class StorageContainer {
 
   bool IsOpen() const { return is_open_; }
 
+  // The largest size of the data which can be inserted
+  uint64_t GetMaxSize() const { return bs_ == nullptr ? 0 : bs_->GetMaxSize(); }
+
   static Status CreateStorageContainer(std::shared_ptr<StorageContainer> *out_sc, const std::string &path);
 
  private:
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include <algorithm>
+#include <fstream>
 #include <memory>
 #include <string>
 #include <map>
@@ -31,6 +32,7 @@
 #include "minddata/dataset/engine/tree_adapter.h"
 
 #ifndef ENABLE_ANDROID
+#include "minddata/dataset/engine/serdes.h"
 #include "minddata/mindrecord/include/shard_index_generator.h"
 #include "minddata/mindrecord/include/shard_header.h"
 #include "minddata/mindrecord/include/shard_writer.h"
@@ -348,7 +350,7 @@ Status ToDevice::Terminate() {
   return TreeConsumer::Terminate();
 }
 
-Status TreeConsumer::Reset(int64_t step) {
+Status TreeConsumer::Reset(int64_t step, const std::string &checkpoint) {
   MS_LOG(INFO) << "Resetting TreeConsumer";
 
   MS_LOG(INFO) << "Terminating pipeline with UUID:" << tree_adapter_->tree_->GetUniqueId();
@@ -375,6 +377,20 @@ Status TreeConsumer::Reset(int64_t step) {
 #endif
   tree_adapter_ = std::make_unique<TreeAdapter>(TreeAdapter::UsageFlag::kDeReset);
   RETURN_IF_NOT_OK(tree_adapter_->Compile(old_root, num_epochs_, step));
+  // In fast recovery the new pipeline starts from the epoch of the step, otherwise it starts from the first epoch
+  epoch_offset_ = 0;
+  if (GlobalContext::config_manager()->fast_recovery() && step > 0) {
+    int64_t epoch_size = 0;
+    RETURN_IF_NOT_OK(GetEpochSize(&epoch_size));
+    epoch_offset_ = step / epoch_size;
+  }
+  if (!checkpoint.empty()) {
+#ifndef ENABLE_ANDROID
+    RETURN_IF_NOT_OK(RestoreCheckpoint(step, checkpoint));
+#else
+    RETURN_STATUS_UNEXPECTED("Restoring a checkpoint of the pipeline is not supported.");
+#endif
+  }
   RETURN_IF_NOT_OK(tree_adapter_->Launch());
   MS_LOG(INFO) << "Launched a new pipeline after reset. UUID: " << tree_adapter_->tree_->GetUniqueId();
   std::shared_ptr<DatasetOp> root2 = std::shared_ptr<DatasetOp>(tree_adapter_->GetRoot());
@@ -382,7 +398,82 @@ Status TreeConsumer::Reset(int64_t step) {
   return Status::OK();
 }
 
+Status TreeConsumer::GetEpochSize(int64_t *size) const {
+  RETURN_UNEXPECTED_IF_NULL(size);
+  RETURN_UNEXPECTED_IF_NULL(tree_adapter_->input_ir_);
+  RETURN_IF_NOT_OK(tree_adapter_->input_ir_->GetDatasetSize(nullptr, false, size));
+  CHECK_FAIL_RETURN_UNEXPECTED(*size > 0, "Cannot checkpoint the pipeline, dataset size is undefined.");
+  return Status::OK();
+}
+
 #ifndef ENABLE_ANDROID
+Status TreeConsumer::SaveCheckpoint(int64_t step, const std::string &file_path) {
+  CHECK_FAIL_RETURN_UNEXPECTED(step >= 0, "Cannot checkpoint the pipeline, step must be >= 0. step: " +
+                                            std::to_string(step));
+  RETURN_UNEXPECTED_IF_NULL(tree_adapter_->tree_);
+  int64_t epoch_size = 0;
+  RETURN_IF_NOT_OK(GetEpochSize(&epoch_size));
+  int64_t epoch = step / epoch_size;
+  CHECK_FAIL_RETURN_UNEXPECTED(epoch >= epoch_offset_, "Cannot checkpoint the pipeline, step " +
+                                                         std::to_string(step) + " is before the reset step.");
+  auto local_epoch = static_cast<int32_t>(epoch - epoch_offset_);
+  nlohmann::json op_states = nlohmann::json::array();
+  for (auto itr = tree_adapter_->tree_->begin(); itr != tree_adapter_->tree_->end(); ++itr) {
+    nlohmann::json state;
+    RETURN_IF_NOT_OK(itr->GetEpochState(local_epoch, &state));
+    if (!state.is_null()) {
+      nlohmann::json op_state;
+      op_state["op_name"] = itr->Name();
+      op_state["state"] = state;
+      op_states.push_back(op_state);
+    }
+  }
+  nlohmann::json out_json;
+  out_json["epoch"] = epoch;
+  out_json["ops"] = op_states;
+  RETURN_IF_NOT_OK(Serdes::SaveJSONToFile(out_json, file_path));
+  MS_LOG(INFO) << "Saved the state of the pipeline at epoch " << epoch << " to " << file_path;
+  return Status::OK();
+}
+
+Status TreeConsumer::RestoreCheckpoint(int64_t step, const std::string &checkpoint) {
+  CHECK_FAIL_RETURN_UNEXPECTED(GlobalContext::config_manager()->fast_recovery(),
+                               "Cannot restore the pipeline from a checkpoint when fast recovery is disabled.");
+  nlohmann::json checkpoint_json;
+  std::ifstream json_in(checkpoint);
+  CHECK_FAIL_RETURN_UNEXPECTED(json_in, "Invalid file, failed to open checkpoint file: " + checkpoint);
+  try {
+    json_in >> checkpoint_json;
+  } catch (const std::exception &e) {
+    json_in.close();
+    RETURN_STATUS_UNEXPECTED("Invalid file, failed to parse checkpoint file: " + checkpoint +
+                             ", error message: " + e.what());
+  }
+  json_in.close();
+  CHECK_FAIL_RETURN_UNEXPECTED(checkpoint_json.contains("epoch") && checkpoint_json.contains("ops"),
+                               "Invalid checkpoint file: " + checkpoint);
+  int64_t epoch = checkpoint_json["epoch"].get<int64_t>();
+  CHECK_FAIL_RETURN_UNEXPECTED(epoch == epoch_offset_,
+                               "Cannot restore the pipeline, the checkpoint is saved at epoch " +
+                                 std::to_string(epoch) + " but step " + std::to_string(step) + " is in epoch " +
+                                 std::to_string(epoch_offset_) + ".");
+  // The ops are matched by their names in the order of the tree, the ops added by the reset have no state
+  const nlohmann::json &op_states = checkpoint_json["ops"];
+  size_t index = 0;
+  for (auto itr = tree_adapter_->tree_->begin(); itr != tree_adapter_->tree_->end() && index < op_states.size();
+       ++itr) {
+    if (itr->Name() == op_states[index].value("op_name", "")) {
+      RETURN_IF_NOT_OK(itr->SetEpochState(op_states[index]["state"]));
+      index++;
+    }
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(index == op_states.size(),
+                               "Cannot restore the pipeline, the pipeline does not match the checkpoint file: " +
+                                 checkpoint);
+  MS_LOG(INFO) << "Restored the state of the pipeline at epoch " << epoch << " from " << checkpoint;
+  return Status::OK();
+}
+
 // SaveToDisk
 Status SaveToDisk::ValidateParams() {
   if (dataset_path_.empty()) {
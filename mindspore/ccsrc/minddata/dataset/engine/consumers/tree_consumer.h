@@ -60,8 +60,20 @@ class TreeConsumer {
   /// Function to reset the current consumer to the provided step.
   /// The consumer will terminate the pipeline and create a new one with skip injected.
   /// \param step the step to reset the pipeline to.
+  /// \param checkpoint the file saved by SaveCheckpoint for the epoch of the step, whose state is restored into the
+  ///     new pipeline in fast recovery mode. The data of the epochs before are then not replayed or resampled.
   /// \return Status error code
-  Status Reset(int64_t step);
+  Status Reset(int64_t step, const std::string &checkpoint = "");
+
+#ifndef ENABLE_ANDROID
+  /// Function to save the state the pipeline starts the epoch of the provided step with into a checkpoint file,
+  /// which is the cursors and random states of the samplers and ops. The shuffle buffers and connectors are empty
+  /// at the start of an epoch, so they need not be saved.
+  /// \param step the step whose epoch is saved.
+  /// \param file_path the checkpoint file to write.
+  /// \return Status error code
+  Status SaveCheckpoint(int64_t step, const std::string &file_path);
+#endif
 
   /// Function to stop the consumer.
   /// \return Status error code
@@ -94,6 +106,23 @@ class TreeConsumer {
   virtual std::string Name() = 0;
 
   int32_t num_epochs_;
+
+ private:
+  /// Get the dataset size of one epoch of the input IR tree.
+  /// \param[out] size the dataset size.
+  /// \return Status error code
+  Status GetEpochSize(int64_t *size) const;
+
+#ifndef ENABLE_ANDROID
+  /// Restore the state of the ops of the new pipeline from a checkpoint file before the pipeline is launched.
+  /// \param step the step the pipeline is reset to.
+  /// \param checkpoint the checkpoint file saved by SaveCheckpoint.
+  /// \return Status error code
+  Status RestoreCheckpoint(int64_t step, const std::string &checkpoint);
+#endif
+
+  /// The epoch of the whole run where the current pipeline starts, which is not 0 after a fast recovery reset
+  int64_t epoch_offset_{0};
 };
 
 /// Consumer that iterates over the dataset and returns the rows one by one as a vector or a map
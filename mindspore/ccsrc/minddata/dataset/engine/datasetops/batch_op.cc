@@ -27,6 +27,10 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+constexpr size_t kBytesInMB = 1024 * 1024;
+}  // namespace
+
 BatchOp::Builder::Builder(int32_t batch_size) : builder_drop_(false), builder_pad_(false), builder_pad_map_({}) {
   builder_batch_size_ = batch_size;
   std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
@@ -75,6 +79,10 @@ BatchOp::BatchOp(int32_t batch_size, bool drop, bool pad, int32_t op_queue_size,
     // ensure there is at least 2 queue slots for whole operation..  If only 1 worker, incrase it to 2
     worker_connector_size_ = std::max(2, worker_connector_size_);
   }
+  int32_t recycle_memory = GlobalContext::config_manager()->batch_recycle_memory();
+  if (recycle_memory > 0) {
+    batch_pool_ = std::make_shared<RecyclePool>(static_cast<size_t>(recycle_memory) * kBytesInMB);
+  }
 }
 
 Status BatchOp::operator()() {
@@ -165,7 +173,7 @@ void BatchOp::Print(std::ostream &out, bool show_all) const {
 }
 
 Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *src, TensorRow *dest, dsize_t batch_size,
-                          bool concat_batch) {
+                          bool concat_batch, const std::shared_ptr<MemoryPool> &pool) {
   RETURN_UNEXPECTED_IF_NULL(src);
   RETURN_UNEXPECTED_IF_NULL(dest);
   if ((*src)->size() != batch_size) {
@@ -188,7 +196,7 @@ Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *src, TensorRow *d
   auto num_columns = (*src)->front().size();
   for (size_t i = 0; i < num_columns; i++) {
     std::shared_ptr<Tensor> new_tensor;
-    RETURN_IF_NOT_OK(ConvertRowsToTensor(src, &new_tensor, batch_size, i));
+    RETURN_IF_NOT_OK(ConvertRowsToTensor(src, &new_tensor, batch_size, i, pool));
     dest->emplace_back(new_tensor);
   }
 
@@ -196,7 +204,7 @@ Status BatchOp::BatchRows(const std::unique_ptr<TensorQTable> *src, TensorRow *d
 }
 
 Status BatchOp::ConvertRowsToTensor(const std::unique_ptr<TensorQTable> *src, std::shared_ptr<Tensor> *dst,
-                                    dsize_t batch_size, size_t col) {
+                                    dsize_t batch_size, size_t col, const std::shared_ptr<MemoryPool> &pool) {
   RETURN_UNEXPECTED_IF_NULL(src);
   RETURN_UNEXPECTED_IF_NULL(dst);
   std::shared_ptr<Tensor> first_tensor = (*src)->at(0).at(col);  // first row, column i
@@ -206,7 +214,11 @@ Status BatchOp::ConvertRowsToTensor(const std::unique_ptr<TensorQTable> *src, st
 
   std::shared_ptr<Tensor> new_tensor;
   if (first_type.IsNumeric()) {  // numeric tensor
-    RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, &new_tensor));
+    if (pool == nullptr) {
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, &new_tensor));
+    } else {
+      RETURN_IF_NOT_OK(Tensor::CreateEmpty(new_shape, first_type, pool, &new_tensor));
+    }
     dsize_t j = 0;
     for (auto row : **src) {
       std::shared_ptr<Tensor> old_tensor = row.at(col);  // row j, column i
@@ -284,7 +296,7 @@ Status BatchOp::MakeBatchedRow(std::pair<std::unique_ptr<TensorQTable>, CBatchIn
   if (pad_) {
     RETURN_IF_NOT_OK(PadColumns(&table_pair.first, pad_info_, column_name_id_map_));
   }  // do padding if needed
-  RETURN_IF_NOT_OK(BatchRows(&table_pair.first, new_row, table_pair.first->size(), concat_batch));
+  RETURN_IF_NOT_OK(BatchRows(&table_pair.first, new_row, table_pair.first->size(), concat_batch, batch_pool_));
   return Status::OK();
 }
 
@@ -701,7 +713,7 @@ Status BatchOp::GetNextRowPullMode(TensorRow *const row) {
     RETURN_IF_NOT_OK(PadColumns(&table, pad_info_, column_name_id_map_));
   }  // do padding if needed
   if (!table->empty()) {
-    RETURN_IF_NOT_OK(BatchRows(&table, row, table->size()));
+    RETURN_IF_NOT_OK(BatchRows(&table, row, table->size(), false, batch_pool_));
     batch_cnt_++;
     batch_num_++;
   }
@@ -285,6 +285,30 @@ Status DatasetOp::GetNumClasses(int64_t *num_classes) {
   }
 }
 
+Status DatasetOp::GetEpochState(int32_t epoch, nlohmann::json *state) {
+  RETURN_UNEXPECTED_IF_NULL(state);
+  if (sampler_ != nullptr) {
+    // The sampler starts a pass over the data in each repeat of the epoch
+    nlohmann::json sampler_states = nlohmann::json::array();
+    RETURN_IF_NOT_OK(
+      sampler_->GetPassState(static_cast<int64_t>(epoch) * op_num_repeats_per_epoch_, &sampler_states));
+    if (!sampler_states.empty()) {
+      (*state)["samplers"] = sampler_states;
+    }
+  }
+  return Status::OK();
+}
+
+Status DatasetOp::SetEpochState(const nlohmann::json &state) {
+  if (sampler_ != nullptr && state.contains("samplers")) {
+    size_t index = 0;
+    RETURN_IF_NOT_OK(sampler_->SetPassState(state["samplers"], &index));
+    CHECK_FAIL_RETURN_UNEXPECTED(index == state["samplers"].size(),
+                                 "Invalid checkpoint, the samplers of " + Name() + " do not match the checkpoint.");
+  }
+  return Status::OK();
+}
+
 Status DatasetOp::GetClassIndexing(std::vector<std::pair<std::string, std::vector<int32_t>>> *output_class_indexing) {
   RETURN_UNEXPECTED_IF_NULL(output_class_indexing);
   if (child_.size() == 1) {
@@ -23,6 +23,7 @@
 #include <vector>
 #include <utility>
 
+#include <nlohmann/json.hpp>
 #include "minddata/dataset/callback/callback_manager.h"
 #include "minddata/dataset/include/dataset/constants.h"
 #include "minddata/dataset/engine/operator_connector.h"
@@ -195,6 +196,19 @@ class DatasetOp : public std::enable_shared_from_this<DatasetOp> {
   // \return Status The status code returned
   virtual Status Reset();
 
+  // \brief Gets the state the operator starts an epoch with, so that the operator restored with it produces the
+  //     data from that epoch on as it did, without producing the data before it. The base class implementation
+  //     gets the state of the sampler, derived classes with random state of their own override it.
+  // \param[in] epoch The epoch counted from the start of the pipeline
+  // \param[out] state The state, left null if the operator is stateless
+  // \return Status The status code returned
+  virtual Status GetEpochState(int32_t epoch, nlohmann::json *state);
+
+  // \brief Restores the state got by GetEpochState, before the operator is launched.
+  // \param[in] state The state of the operator
+  // \return Status The status code returned
+  virtual Status SetEpochState(const nlohmann::json &state);
+
   // \brief During tree prepare phase, operators may have specific post-operations to perform depending on
   //     their role.
   // \notes Derived versions of this function should always call it's superclass version first
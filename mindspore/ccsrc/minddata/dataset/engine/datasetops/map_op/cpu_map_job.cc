@@ -28,6 +28,9 @@ CpuMapJob::CpuMapJob() = default;
 // Constructor
 CpuMapJob::CpuMapJob(std::vector<std::shared_ptr<TensorOp>> operations) : MapJob(std::move(operations)) {}
 
+// Constructor
+CpuMapJob::CpuMapJob(bool batched) : batched_(batched) {}
+
 // Destructor
 CpuMapJob::~CpuMapJob() = default;
 
@@ -39,8 +42,8 @@ Status CpuMapJob::Run(std::vector<TensorRow> in, std::vector<TensorRow> *out) {
     TensorRow input_row = in[row];
     TensorRow result_row;
     for (size_t i = 0; i < ops_.size(); i++) {
-      // Call compute function for cpu
-      Status rc = ops_[i]->Compute(input_row, &result_row);
+      // Call compute function for cpu, the batched rows are computed as a whole
+      Status rc = batched_ ? ops_[i]->BatchCompute(input_row, &result_row) : ops_[i]->Compute(input_row, &result_row);
       if (rc.IsError()) {
         RETURN_IF_NOT_OK(RebuildMapErrorMsg(input_row, i, &rc));
       }
@@ -30,6 +30,10 @@ class CpuMapJob : public MapJob {
   // Constructor
   explicit CpuMapJob(std::vector<std::shared_ptr<TensorOp>> operations);
 
+  // Constructor
+  // @param batched Whether the rows are batches, which are passed to BatchCompute() of the ops
+  explicit CpuMapJob(bool batched);
+
   // Destructor
   ~CpuMapJob();
 
@@ -38,6 +42,8 @@ class CpuMapJob : public MapJob {
 
  private:
   Status RebuildMapErrorMsg(const TensorRow &input_row, const size_t &i, Status *rc);
+
+  bool batched_{false};
 };
 
 }  // namespace dataset
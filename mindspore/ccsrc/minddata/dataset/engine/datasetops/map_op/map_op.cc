@@ -107,7 +107,7 @@ Status MapOp::GenerateWorkerJob(const std::unique_ptr<MapWorkerJob> *worker_job,
     // map_job could be nullptr when we are at the first tensor op or when the target device of the prev op
     // is different with that of the current op.
     if (map_job == nullptr) {
-      map_job = std::make_shared<CpuMapJob>();
+      map_job = std::make_shared<CpuMapJob>(batched_);
     }
     RETURN_IF_NOT_OK(map_job->AddOperation(tfuncs_[worker_id][j]));
 
@@ -145,6 +145,10 @@ class MapOp : public ParallelOp<std::unique_ptr<MapWorkerJob>, TensorRow> {
   /// \param python_mp PythonMultiprocessingRuntime
   void SetPythonMp(std::shared_ptr<PythonMultiprocessingRuntime> python_mp);
 
+  /// Set whether the rows are batches output by BatchOp, which are passed to BatchCompute() of the tensor ops
+  /// \param batched whether the rows are batches
+  void SetBatched(bool batched) { batched_ = batched; }
+
   /// Return the list of PIDs of worker processes
   /// \return vector of int
   std::vector<int32_t> GetMPWorkerPIDs() const override;
@@ -178,6 +182,8 @@ class MapOp : public ParallelOp<std::unique_ptr<MapWorkerJob>, TensorRow> {
 
   std::shared_ptr<PythonMultiprocessingRuntime> python_mp_;  // python multiprocessing instance
 
+  bool batched_{false};  // the rows are batches, whose tensors are the samples stacked along the first dimension
+
   // Private function for worker/thread to loop continuously. It comprises the main
   // logic of MapOp: getting the data from previous Op, validating user specified column names,
   // applying a list of TensorOps to each of the data, process the results and then
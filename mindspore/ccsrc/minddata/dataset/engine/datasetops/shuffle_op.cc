@@ -14,8 +14,13 @@
  * limitations under the License.
  */
 #if defined(_WIN32) || defined(_WIN64)
+#include <process.h>
 #include <stdlib.h>
+#else
+#include <unistd.h>
 #endif
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <iomanip>
 #include <iostream>
@@ -25,13 +30,23 @@
 #include "minddata/dataset/core/config_manager.h"
 #include "minddata/dataset/engine/datasetops/shuffle_op.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
+#ifndef ENABLE_ANDROID
+#include "minddata/dataset/engine/cache/cache_fbb.h"
+#include "minddata/dataset/engine/cache/storage_container.h"
+#endif
 
 #include "minddata/dataset/util/log_adapter.h"
+#include "minddata/dataset/util/path.h"
 #include "minddata/dataset/util/random.h"
 #include "minddata/dataset/util/status.h"
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// used to name the scratch files of the shuffle ops in this process
+std::atomic<uint32_t> g_spill_file_count{0};
+}  // namespace
+
 constexpr int32_t ShuffleOp::kShuffleStateInit;
 constexpr int32_t ShuffleOp::kShuffleStateActive;
 constexpr int32_t ShuffleOp::kShuffleStateDrain;
@@ -43,9 +58,58 @@ ShuffleOp::ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_con
       shuffle_seed_(shuffle_seed),
       reshuffle_each_epoch_(reset_every_epoch),
       rng_(shuffle_seed),
+      num_draws_(0),
+      pass_draws_({0}),
       shuffle_buffer_(std::make_unique<TensorTable>()),
       shuffle_last_row_idx_(0),
-      shuffle_buffer_state_(kShuffleStateInit) {}
+      shuffle_buffer_state_(kShuffleStateInit),
+      max_rows_in_memory_(0),
+      rows_in_memory_(0) {
+#ifndef ENABLE_ANDROID
+  std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
+  // The rows are spilled only if the shuffle buffer can not be kept in memory
+  if (cfg->shuffle_max_rows_in_memory() > 0 && cfg->shuffle_max_rows_in_memory() < shuffle_size) {
+    max_rows_in_memory_ = cfg->shuffle_max_rows_in_memory();
+    spill_dir_ = cfg->shuffle_spill_dir();
+  }
+#endif
+}
+
+ShuffleOp::~ShuffleOp() {
+#ifndef ENABLE_ANDROID
+  if (spill_container_ != nullptr) {
+    spill_container_.reset();
+    Status rc = Path(spill_file_).Remove();
+    if (rc.IsError()) {
+      MS_LOG(WARNING) << "Shuffle operator failed to remove the scratch file: " << spill_file_ << ", " << rc;
+    }
+  }
+#endif
+}
+
+Status ShuffleOp::GetEpochState(int32_t epoch, nlohmann::json *state) {
+  RETURN_UNEXPECTED_IF_NULL(state);
+  // The shuffle op starts a pass over the data in each repeat of the epoch
+  size_t pass = static_cast<size_t>(epoch) * static_cast<size_t>(op_num_repeats_per_epoch_);
+  std::unique_lock<std::mutex> lock(pass_draws_mux_);
+  CHECK_FAIL_RETURN_UNEXPECTED(pass < pass_draws_.size(),
+                               "Shuffle operator has not started epoch " + std::to_string(epoch) + " yet.");
+  (*state)["seed"] = shuffle_seed_;
+  (*state)["draws"] = pass_draws_[pass];
+  return Status::OK();
+}
+
+Status ShuffleOp::SetEpochState(const nlohmann::json &state) {
+  CHECK_FAIL_RETURN_UNEXPECTED(state.contains("seed") && state.contains("draws"),
+                               "Invalid checkpoint, expect the seed and draws of a shuffle operator.");
+  shuffle_seed_ = state["seed"].get<uint32_t>();
+  num_draws_ = state["draws"].get<int64_t>();
+  rng_ = std::mt19937_64(shuffle_seed_);
+  rng_.discard(static_cast<uint64_t>(num_draws_));
+  std::unique_lock<std::mutex> lock(pass_draws_mux_);
+  pass_draws_ = {num_draws_};
+  return Status::OK();
+}
 
 // Private function to re-init the shuffle op for another epoch.  Shuffle op calls this by
 // itself rather than waiting for the reset driven from operators above it in the pipeline.
@@ -57,9 +121,12 @@ Status ShuffleOp::SelfReset() {
   // and all subsequent epochs will then keep on using the rng_ without resetting it
   if (!reshuffle_each_epoch_) {
     rng_ = std::mt19937_64(shuffle_seed_);
+    num_draws_ = 0;
   }
 
   shuffle_buffer_ = std::make_unique<TensorTable>();
+  spilled_rows_.clear();
+  rows_in_memory_ = 0;
   shuffle_last_row_idx_ = 0;
   shuffle_buffer_state_ = kShuffleStateInit;
   return Status::OK();
@@ -89,18 +156,106 @@ Status ShuffleOp::AddRowToShuffleBuffer(TensorRow new_shuffle_row) {
   // If we are already at the full size, then we overwrite the last slot with our row (and the last
   // slot better be empty because it should already have been swapped out during the random row
   // selection that was done previously!)
+  // If the rows in memory have reached the limit, the new row is spilled and its slot is left empty.
+  std::unique_ptr<SpilledRow> spilled;
+  if (max_rows_in_memory_ > 0 && rows_in_memory_ >= max_rows_in_memory_) {
+    RETURN_IF_NOT_OK(SpillRow(new_shuffle_row, &spilled));
+  }
+  if (spilled != nullptr) {
+    new_shuffle_row = TensorRow();
+  } else {
+    rows_in_memory_++;
+  }
   if (shuffle_last_row_idx_ < (shuffle_size_ - 1)) {
     shuffle_buffer_->push_back(std::move(new_shuffle_row));
+    spilled_rows_.push_back(std::move(spilled));
     shuffle_last_row_idx_ = (shuffle_buffer_->size()) - 1;
   } else {
-    if (!(*shuffle_buffer_)[shuffle_last_row_idx_].empty()) {
+    if (!(*shuffle_buffer_)[shuffle_last_row_idx_].empty() || spilled_rows_[shuffle_last_row_idx_] != nullptr) {
       RETURN_STATUS_UNEXPECTED("[Internal ERROR] Last row of shuffle buffer should not be occupied!");
     }
     (*shuffle_buffer_)[shuffle_last_row_idx_] = std::move(new_shuffle_row);
+    spilled_rows_[shuffle_last_row_idx_] = std::move(spilled);
   }
   return Status::OK();
 }
 
+Status ShuffleOp::SpillRow(const TensorRow &row, std::unique_ptr<SpilledRow> *spilled) {
+  RETURN_UNEXPECTED_IF_NULL(spilled);
+  *spilled = nullptr;
+#ifndef ENABLE_ANDROID
+  // The tensors without data can not be serialized, so the row is kept in memory.
+  if (std::any_of(row.begin(), row.end(), [](const auto &tensor) { return tensor->GetBuffer() == nullptr; })) {
+    return Status::OK();
+  }
+  if (spill_container_ == nullptr) {
+    std::string file_name = "shuffle_" + std::to_string(getpid()) + "_" + std::to_string(g_spill_file_count++);
+    spill_file_ = (Path(spill_dir_) / file_name).ToString();
+    RETURN_IF_NOT_OK(StorageContainer::CreateStorageContainer(&spill_container_, spill_file_));
+    MS_LOG(INFO) << "Shuffle operator spills the rows beyond " << max_rows_in_memory_
+                 << " rows of the shuffle buffer to: " << spill_file_;
+  }
+  std::shared_ptr<flatbuffers::FlatBufferBuilder> fbb;
+  RETURN_IF_NOT_OK(SerializeTensorRowHeader(row, &fbb));
+  std::vector<ReadableSlice> buf;
+  buf.reserve(row.size() + 1);
+  buf.emplace_back(fbb->GetBufferPointer(), fbb->GetSize());
+  size_t size = fbb->GetSize();
+  for (const auto &tensor : row) {
+    buf.emplace_back(tensor->GetBuffer(), tensor->SizeInBytes());
+    size += tensor->SizeInBytes();
+  }
+  if (size > spill_container_->GetMaxSize()) {
+    // The row does not fit in the scratch file at all, so it is always kept in memory.
+    MS_LOG(DEBUG) << "Shuffle operator keeps the row in memory since it is larger than the scratch file: " << size;
+    return Status::OK();
+  }
+  auto result = std::make_unique<SpilledRow>();
+  off64_t offset = 0;
+  Status rc = spill_container_->Insert(buf, &offset, &result->bspd);
+  if (rc.StatusCode() == StatusCode::kMDBuddySpaceFull) {
+    // The row is kept in memory until the space of the spilled rows is given back.
+    MS_LOG(DEBUG) << "Shuffle operator keeps the row in memory since the scratch file is full.";
+    return Status::OK();
+  }
+  RETURN_IF_NOT_OK(rc);
+  result->offset = offset;
+  result->size = size;
+  result->id = row.getId();
+  result->path = row.getPath();
+  *spilled = std::move(result);
+#endif
+  return Status::OK();
+}
+
+Status ShuffleOp::RestoreRow(const SpilledRow &spilled, TensorRow *row) {
+  RETURN_UNEXPECTED_IF_NULL(row);
+#ifndef ENABLE_ANDROID
+  CHECK_FAIL_RETURN_UNEXPECTED(spill_container_ != nullptr, "[Internal ERROR] Scratch file of shuffle buffer is null.");
+  std::string mem;
+  mem.resize(spilled.size);
+  WritableSlice all(mem.data(), spilled.size);
+  RETURN_IF_NOT_OK(spill_container_->Read(&all, spilled.offset));
+  spill_container_->Free(spilled.bspd);
+  // The header is followed by the data of each column, the same as the rows sent to the cache server.
+  auto msg = GetTensorRowHeaderMsg(all.GetPointer());
+  int64_t ts_offset = msg->size_of_this();
+  TensorRow result;
+  result.reserve(msg->column()->size());
+  for (uint32_t k = 0; k < msg->column()->size(); ++k) {
+    ReadableSlice data(all, ts_offset, msg->data_sz()->Get(k));
+    std::shared_ptr<Tensor> tensor;
+    RETURN_IF_NOT_OK(RestoreOneTensor(msg->column()->Get(k), data, &tensor));
+    result.push_back(std::move(tensor));
+    ts_offset += static_cast<int64_t>(data.GetSize());
+  }
+  result.setId(spilled.id);
+  result.setPath(spilled.path);
+  *row = std::move(result);
+#endif
+  return Status::OK();
+}
+
 // Class functor operator () override.
 // All dataset ops operate by launching a thread (see ExecutionTree). This class functor will
 // provide the master loop that drives the logic for performing the work
@@ -142,7 +297,15 @@ Status ShuffleOp::operator()() {
       // tensor table. We remove the data from the shuffle buffer, leaving that slot
       // in the table as an empty vector
       int64_t random_slot = rng_() % (shuffle_last_row_idx_ + 1);
-      TensorRow random_row = std::move((*shuffle_buffer_)[random_slot]);
+      num_draws_++;
+      TensorRow random_row;
+      if (spilled_rows_[random_slot] != nullptr) {
+        RETURN_IF_NOT_OK(RestoreRow(*spilled_rows_[random_slot], &random_row));
+        spilled_rows_[random_slot] = nullptr;
+      } else {
+        random_row = std::move((*shuffle_buffer_)[random_slot]);
+        rows_in_memory_--;
+      }
       MS_LOG(DEBUG) << "Shuffle operator sending a row to output.";
       RETURN_IF_NOT_OK(out_connector_->Add(std::move(random_row)));
 
@@ -152,6 +315,7 @@ Status ShuffleOp::operator()() {
       // tail of the shuffle buffer.
       if (random_slot != shuffle_last_row_idx_) {
         (*shuffle_buffer_)[random_slot] = std::move((*shuffle_buffer_)[shuffle_last_row_idx_]);
+        spilled_rows_[random_slot] = std::move(spilled_rows_[shuffle_last_row_idx_]);
       }
 
       // Step 4)
@@ -177,6 +341,12 @@ Status ShuffleOp::operator()() {
       }
     }
 
+    // Keep the state of the next pass before the EOE, so that it is there once the epoch is seen by the consumer
+    {
+      std::unique_lock<std::mutex> lock(pass_draws_mux_);
+      pass_draws_.push_back(reshuffle_each_epoch_ ? num_draws_ : 0);
+    }
+
     // Since we overloaded eoeReceived function, we are responsible to flow the EOE up the
     // pipeline manually now that we are done draining the shuffle buffer
     MS_LOG(DEBUG) << "Shuffle operator sending EOE.";
@@ -18,6 +18,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <queue>
 #include <random>
 #include <string>
@@ -28,10 +29,12 @@
 #include "minddata/dataset/core/tensor_shape.h"
 #include "minddata/dataset/engine/dataset_iterator.h"
 #include "minddata/dataset/engine/datasetops/pipeline_op.h"
+#include "minddata/dataset/util/buddy.h"
 #include "minddata/dataset/util/status.h"
 
 namespace mindspore {
 namespace dataset {
+class StorageContainer;
 
 class ShuffleOp : public PipelineOp {
   // Shuffle buffer state flags
@@ -54,7 +57,7 @@ class ShuffleOp : public PipelineOp {
   ShuffleOp(int32_t shuffle_size, uint32_t shuffle_seed, int32_t op_connector_size, bool reset_every_epoch);
 
   // Destructor
-  ~ShuffleOp() = default;
+  ~ShuffleOp();
 
   // A print method typically used for debugging
   // @param out - The output stream to write output to
@@ -87,6 +90,18 @@ class ShuffleOp : public PipelineOp {
   // @return Name of the current Op
   std::string Name() const override { return kShuffleOp; }
 
+  // Base-class override for the state at the start of an epoch, which is the seed of rng_ with the count of the
+  // numbers drawn from it before the epoch. The shuffle buffer is always empty at the start of an epoch.
+  // @param epoch - The epoch counted from the start of the pipeline
+  // @param state - The state of the op
+  // @return Status The status code returned
+  Status GetEpochState(int32_t epoch, nlohmann::json *state) override;
+
+  // Base-class override to restore the state got by GetEpochState
+  // @param state - The state of the op
+  // @return Status The status code returned
+  Status SetEpochState(const nlohmann::json &state) override;
+
  private:
   // Private function to add a new row to the shuffle buffer.
   // @return Status The status code returned
@@ -102,6 +117,28 @@ class ShuffleOp : public PipelineOp {
   // @return Status The status code returned
   Status SelfReset();
 
+  // The location of a row of the shuffle buffer which is spilled to the scratch file
+  struct SpilledRow {
+    int64_t offset;
+    size_t size;
+    BSpaceDescriptor bspd;
+    row_id_type id;
+    std::vector<std::string> path;
+  };
+
+  // Private function to write a row of the shuffle buffer to the scratch file, the scratch file is created
+  // on the first call.
+  // @param row - The row to be spilled
+  // @param spilled - The location of the spilled row, nullptr if the row has to be kept in memory
+  // @return Status The status code returned
+  Status SpillRow(const TensorRow &row, std::unique_ptr<SpilledRow> *spilled);
+
+  // Private function to read a spilled row back from the scratch file and give back its space.
+  // @param spilled - The location of the spilled row
+  // @param row - The row read back
+  // @return Status The status code returned
+  Status RestoreRow(const SpilledRow &spilled, TensorRow *row);
+
   int32_t shuffle_size_;  // User config for the size of the shuffle buffer (number of rows)
   uint32_t shuffle_seed_;
   bool reshuffle_each_epoch_;
@@ -111,10 +148,21 @@ class ShuffleOp : public PipelineOp {
   // (ie uniform_int_distribution) because we will need to create up to |dataset| instances
   // of the distribution object in the common case of a perfect shuffle
   std::mt19937_64 rng_;
+  int64_t num_draws_;                 // Count of the numbers drawn from rng_ since it is seeded
+  std::vector<int64_t> pass_draws_;  // num_draws_ at the start of each pass, for GetEpochState
+  std::mutex pass_draws_mux_;
   // A single (potentially large) buffer of tensor rows for performing shuffling.
   std::unique_ptr<TensorTable> shuffle_buffer_;
   int32_t shuffle_last_row_idx_;  // Internal tracking of the last slot of our shuffle buffer
   int32_t shuffle_buffer_state_;  // State tracking for the shuffle buffer phases of work
+  // The rows of the shuffle buffer beyond max_rows_in_memory_ are spilled to the scratch file, and the slot of a
+  // spilled row in shuffle_buffer_ is left empty while the same slot in spilled_rows_ holds its location.
+  int32_t max_rows_in_memory_;  // 0 if all the rows are kept in memory
+  int32_t rows_in_memory_;
+  std::vector<std::unique_ptr<SpilledRow>> spilled_rows_;
+  std::string spill_dir_;
+  std::string spill_file_;
+  std::shared_ptr<StorageContainer> spill_container_;
 
   std::unique_ptr<ChildIterator> child_iterator_;  // An iterator for fetching.
 };
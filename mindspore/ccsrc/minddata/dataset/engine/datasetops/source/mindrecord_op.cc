@@ -184,11 +184,35 @@ Status MindRecordOp::WorkerEntry(int32_t worker_id) {
 
 Status MindRecordOp::GetRowFromReader(TensorRow *fetched_row, uint64_t row_id, int32_t worker_id) {
   *fetched_row = {};
+  if (shard_reader_->IsMmapMode()) {
+    // The tensors are created from the views into the mapped files directly, no intermediate copy of blob data.
+    auto rc = shard_reader_->GetNextViewById(row_id);
+    auto task_type = rc.first;
+    const auto &tupled_buffer = rc.second;
+    if (task_type == mindrecord::TaskType::kPaddedTask) {
+      RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, nullptr, 0, mindrecord::json(), task_type));
+      std::vector<std::string> file_path(fetched_row->size(), dataset_file_[0]);
+      fetched_row->setPath(file_path);
+      fetched_row->setId(row_id);
+    }
+    if (task_type == mindrecord::TaskType::kCommonTask) {
+      for (const auto &tupled_row : tupled_buffer) {
+        const auto &blob_view = std::get<0>(tupled_row);
+        RETURN_IF_NOT_OK(
+          LoadTensorRow(fetched_row, blob_view.first, blob_view.second, std::get<1>(tupled_row), task_type));
+        std::vector<std::string> file_path(fetched_row->size(), dataset_file_[0]);
+        fetched_row->setPath(file_path);
+        fetched_row->setId(row_id);
+      }
+    }
+    return Status::OK();
+  }
+
   auto rc = shard_reader_->GetNextById(row_id, worker_id);
   auto task_type = rc.first;
-  auto tupled_buffer = rc.second;
+  const auto &tupled_buffer = rc.second;
   if (task_type == mindrecord::TaskType::kPaddedTask) {
-    RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, {}, mindrecord::json(), task_type));
+    RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, nullptr, 0, mindrecord::json(), task_type));
     std::vector<std::string> file_path(fetched_row->size(), dataset_file_[0]);
     fetched_row->setPath(file_path);
     fetched_row->setId(row_id);
@@ -198,9 +222,9 @@ Status MindRecordOp::GetRowFromReader(TensorRow *fetched_row, uint64_t row_id, i
   }
   if (task_type == mindrecord::TaskType::kCommonTask) {
     for (const auto &tupled_row : tupled_buffer) {
-      std::vector<uint8_t> columns_blob = std::get<0>(tupled_row);
-      mindrecord::json columns_json = std::get<1>(tupled_row);
-      RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, columns_blob, columns_json, task_type));
+      const std::vector<uint8_t> &columns_blob = std::get<0>(tupled_row);
+      const mindrecord::json &columns_json = std::get<1>(tupled_row);
+      RETURN_IF_NOT_OK(LoadTensorRow(fetched_row, columns_blob.data(), columns_blob.size(), columns_json, task_type));
       std::vector<std::string> file_path(fetched_row->size(), dataset_file_[0]);
       fetched_row->setPath(file_path);
       fetched_row->setId(row_id);
@@ -210,7 +234,7 @@ Status MindRecordOp::GetRowFromReader(TensorRow *fetched_row, uint64_t row_id, i
   return Status::OK();
 }
 
-Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint8_t> &columns_blob,
+Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const uint8_t *columns_blob, uint64_t blob_size,
                                    const mindrecord::json &columns_json, const mindrecord::TaskType task_type) {
   for (int32_t i_col = 0; i_col < columns_to_load_.size(); i_col++) {
     auto column_name = columns_to_load_[i_col];
@@ -247,9 +271,9 @@ Status MindRecordOp::LoadTensorRow(TensorRow *tensor_row, const std::vector<uint
         data = reinterpret_cast<const unsigned char *>(data_ptr.get());
       }
     } else {
-      RETURN_IF_NOT_OK(shard_column->GetColumnValueByName(column_name, columns_blob, columns_json, &data, &data_ptr,
-                                                          &n_bytes, &column_data_type, &column_data_type_size,
-                                                          &column_shape));
+      RETURN_IF_NOT_OK(shard_column->GetColumnValueByName(column_name, columns_blob, blob_size, columns_json, &data,
+                                                          &data_ptr, &n_bytes, &column_data_type,
+                                                          &column_data_type_size, &column_shape));
     }
 
     std::shared_ptr<Tensor> tensor;
@@ -122,9 +122,10 @@ class MindRecordOp : public MappableLeafOp {
 
   /// Parses a single cell and puts the data into a tensor
   /// @param tensor_row - the tensor row to put the parsed data in
-  /// @param columns_blob - the blob data received from the reader
+  /// @param columns_blob - the blob data received from the reader, it may be a view into the memory-mapped file
+  /// @param blob_size - the size of the blob data in bytes
   /// @param columns_json - the data for fields received from the reader
-  Status LoadTensorRow(TensorRow *tensor_row, const std::vector<uint8_t> &columns_blob,
+  Status LoadTensorRow(TensorRow *tensor_row, const uint8_t *columns_blob, uint64_t blob_size,
                        const mindrecord::json &columns_json, const mindrecord::TaskType task_type);
 
   Status LoadTensorRow(row_id_type row_id, TensorRow *row) override {
@@ -28,10 +28,13 @@ RandomSamplerRT::RandomSamplerRT(bool replacement, int64_t num_samples, bool res
                                  int64_t samples_per_tensor)
     : SamplerRT(num_samples, samples_per_tensor),
       seed_(GetSeed()),
+      restored_pass_(0),
       replacement_(replacement),
       next_id_(0),
       dist(nullptr),
-      reshuffle_each_epoch_(reshuffle_each_epoch) {}
+      reshuffle_each_epoch_(reshuffle_each_epoch) {
+  first_seed_ = seed_;
+}
 
 Status RandomSamplerRT::GetNextSample(TensorRow *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
@@ -97,6 +100,15 @@ Status RandomSamplerRT::InitSampler() {
     dist = std::make_unique<std::uniform_int_distribution<int64_t>>(0, num_rows_ - 1);
   }
 
+  // A restored sampler reseeds and reshuffles as each pass before the restored one did in ResetSampler
+  for (int64_t pass = 0; reshuffle_each_epoch_ && pass < restored_pass_; pass++) {
+    seed_++;
+    rnd_.seed(seed_);
+    if (!replacement_) {
+      std::shuffle(shuffled_ids_.begin(), shuffled_ids_.end(), rnd_);
+    }
+  }
+
   is_initialized = true;
   return Status::OK();
 }
@@ -142,5 +154,28 @@ Status RandomSamplerRT::to_json(nlohmann::json *out_json) {
   *out_json = args;
   return Status::OK();
 }
+
+Status RandomSamplerRT::GetPassState(int64_t pass, nlohmann::json *states) {
+  RETURN_UNEXPECTED_IF_NULL(states);
+  nlohmann::json state;
+  state["sampler_name"] = "RandomSampler";
+  state["seed"] = first_seed_;
+  state["pass"] = restored_pass_ + pass;
+  states->push_back(state);
+  return SamplerRT::GetPassState(pass, states);
+}
+
+Status RandomSamplerRT::SetPassState(const nlohmann::json &states, size_t *index) {
+  RETURN_UNEXPECTED_IF_NULL(index);
+  CHECK_FAIL_RETURN_UNEXPECTED(!is_initialized,
+                               "[Internal ERROR] The state of a sampler must be set before it is initialized.");
+  CHECK_FAIL_RETURN_UNEXPECTED(*index < states.size() && states[*index].value("sampler_name", "") == "RandomSampler",
+                               "Invalid checkpoint, expect the state of a RandomSampler.");
+  first_seed_ = states[*index]["seed"].get<uint32_t>();
+  restored_pass_ = states[*index]["pass"].get<int64_t>();
+  seed_ = first_seed_;
+  (*index)++;
+  return SamplerRT::SetPassState(states, index);
+}
 }  // namespace dataset
 }  // namespace mindspore
@@ -57,8 +57,16 @@ class RandomSamplerRT : public SamplerRT {
   /// \return Status of the function
   Status to_json(nlohmann::json *out_json) override;
 
+  // The state of a pass is the seed of the first pass with the number of passes before it, the shuffled ids
+  // of the pass are got again by redoing the shuffles of the passes before it.
+  Status GetPassState(int64_t pass, nlohmann::json *states) override;
+
+  Status SetPassState(const nlohmann::json &states, size_t *index) override;
+
  private:
   uint32_t seed_;
+  uint32_t first_seed_;     // the seed of the first pass
+  int64_t restored_pass_;  // the number of passes before the first pass of a restored sampler
   bool replacement_;
   std::vector<int64_t> shuffled_ids_;  // only used for NO REPLACEMENT
   int64_t next_id_;
@@ -209,5 +209,19 @@ Status SamplerRT::to_json(nlohmann::json *out_json) {
   return Status::OK();
 }
 
+Status SamplerRT::GetPassState(int64_t pass, nlohmann::json *states) {
+  for (const auto &child : child_) {
+    RETURN_IF_NOT_OK(child->GetPassState(pass, states));
+  }
+  return Status::OK();
+}
+
+Status SamplerRT::SetPassState(const nlohmann::json &states, size_t *index) {
+  for (const auto &child : child_) {
+    RETURN_IF_NOT_OK(child->SetPassState(states, index));
+  }
+  return Status::OK();
+}
+
 }  // namespace dataset
 }  // namespace mindspore
@@ -165,6 +165,19 @@ class SamplerRT {
   /// \return Status of the function
   virtual Status to_json(nlohmann::json *out_json);
 
+  // Get the states the sampler and its child samplers start a pass over the data with. The base class
+  // implementation only gets the states of the child samplers, samplers with random state override it.
+  // @param int64_t pass - the number of passes before the pass
+  // @param nlohmann::json *states - the states of the stateful samplers are appended to it
+  // @return Status The status code returned
+  virtual Status GetPassState(int64_t pass, nlohmann::json *states);
+
+  // Restore the states got by GetPassState, before the sampler is initialized.
+  // @param const nlohmann::json &states - the states of the stateful samplers
+  // @param size_t *index - the index of the next state to restore, moved past the restored states
+  // @return Status The status code returned
+  virtual Status SetPassState(const nlohmann::json &states, size_t *index);
+
  protected:
   // Number of rows of data from the place this sampler is sampling from. If this sampler
   // has a child sampler, num_rows_ is the number of ids the child sampler will
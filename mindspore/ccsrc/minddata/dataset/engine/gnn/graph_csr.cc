@@ -0,0 +1,245 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/engine/gnn/graph_csr.h"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <utility>
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+namespace {
+// the samples are drawn from a dense copy of positions unless the neighbors are this times more than the samples
+constexpr size_t kSparseSampleRatio = 4;
+}  // namespace
+
+void GraphCsr::AddEdge(NodeIdType src_id, NodeIdType dst_id, NodeType dst_type, WeightType weight) {
+  staged_src_.push_back(src_id);
+  staged_dst_.push_back(dst_id);
+  staged_dst_type_.push_back(dst_type);
+  staged_weight_.push_back(weight);
+}
+
+Status GraphCsr::Build() {
+  CHECK_FAIL_RETURN_UNEXPECTED(adjacency_.empty(), "[Internal ERROR] The adjacency of graph is built already.");
+  const size_t edge_num = staged_src_.size();
+  // the rows are numbered in the order the nodes first appear as source
+  for (size_t i = 0; i < edge_num; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED(staged_weight_[i] >= 0, "Invalid edge weight, it should not be negative, but got: " +
+                                                           std::to_string(staged_weight_[i]));
+    (void)node_rows_.emplace(staged_src_[i], static_cast<uint32_t>(node_rows_.size()));
+  }
+  const size_t row_num = node_rows_.size();
+
+  // count the neighbors of each row, then turn the counts into offsets
+  for (size_t i = 0; i < edge_num; ++i) {
+    auto &adjacency = adjacency_[staged_dst_type_[i]];
+    if (adjacency.offsets.empty()) {
+      adjacency.offsets.assign(row_num + 1, 0);
+    }
+    ++adjacency.offsets[node_rows_[staged_src_[i]] + 1];
+  }
+  std::unordered_map<NodeType, std::vector<int64_t>> cursors;
+  std::unordered_map<NodeType, std::vector<WeightType>> weights;
+  for (auto &item : adjacency_) {
+    auto &offsets = item.second.offsets;
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    item.second.neighbors.resize(offsets.back());
+    weights[item.first].resize(offsets.back());
+    cursors[item.first] = std::vector<int64_t>(offsets.begin(), offsets.end() - 1);
+  }
+
+  // place the edges in the order they are added, so that the neighbors of a node keep the order
+  for (size_t i = 0; i < edge_num; ++i) {
+    const NodeType type = staged_dst_type_[i];
+    int64_t pos = cursors[type][node_rows_[staged_src_[i]]]++;
+    adjacency_[type].neighbors[pos] = staged_dst_[i];
+    weights[type][pos] = staged_weight_[i];
+  }
+  std::vector<NodeIdType>().swap(staged_src_);
+  std::vector<NodeIdType>().swap(staged_dst_);
+  std::vector<NodeType>().swap(staged_dst_type_);
+  std::vector<WeightType>().swap(staged_weight_);
+
+  for (auto &item : adjacency_) {
+    auto &adjacency = item.second;
+    adjacency.alias_probability.resize(adjacency.neighbors.size());
+    adjacency.alias_index.resize(adjacency.neighbors.size());
+    for (size_t row = 0; row < row_num; ++row) {
+      BuildAliasTable(weights[item.first], adjacency.offsets[row], adjacency.offsets[row + 1], &adjacency);
+    }
+  }
+  MS_LOG(INFO) << "Build the adjacency of graph with " << edge_num << " edges, " << row_num
+               << " nodes have neighbors.";
+  return Status::OK();
+}
+
+void GraphCsr::BuildAliasTable(const std::vector<WeightType> &weights, int64_t begin, int64_t end,
+                               Adjacency *adjacency) {
+  const int64_t count = end - begin;
+  if (count <= 0) {
+    return;
+  }
+  double sum = std::accumulate(weights.begin() + begin, weights.begin() + end, 0.0);
+  std::vector<double> scaled(count, 1.0);
+  if (sum > 0) {
+    for (int64_t i = 0; i < count; ++i) {
+      scaled[i] = weights[begin + i] * count / sum;
+    }
+  }
+  // every column is filled up to 1 by one large column, small and large columns are the local index in the row
+  std::vector<uint32_t> small;
+  std::vector<uint32_t> large;
+  for (int64_t i = 0; i < count; ++i) {
+    scaled[i] < 1.0 ? small.push_back(i) : large.push_back(i);
+  }
+  float *probability = adjacency->alias_probability.data() + begin;
+  uint32_t *alias = adjacency->alias_index.data() + begin;
+  while (!small.empty() && !large.empty()) {
+    uint32_t s = small.back();
+    small.pop_back();
+    uint32_t l = large.back();
+    probability[s] = static_cast<float>(scaled[s]);
+    alias[s] = l;
+    scaled[l] = scaled[l] + scaled[s] - 1.0;
+    if (scaled[l] < 1.0) {
+      large.pop_back();
+      small.push_back(l);
+    }
+  }
+  // the rest are 1 within the rounding error
+  for (auto i : small) {
+    probability[i] = 1.0;
+    alias[i] = i;
+  }
+  for (auto i : large) {
+    probability[i] = 1.0;
+    alias[i] = i;
+  }
+}
+
+void GraphCsr::GetNeighbors(NodeIdType node_id, NodeType neighbor_type, const NodeIdType **neighbors,
+                            size_t *count) const {
+  *neighbors = nullptr;
+  *count = 0;
+  auto row_itr = node_rows_.find(node_id);
+  auto adjacency_itr = adjacency_.find(neighbor_type);
+  if (row_itr == node_rows_.end() || adjacency_itr == adjacency_.end()) {
+    return;
+  }
+  const auto &offsets = adjacency_itr->second.offsets;
+  *count = static_cast<size_t>(offsets[row_itr->second + 1] - offsets[row_itr->second]);
+  if (*count > 0) {
+    *neighbors = adjacency_itr->second.neighbors.data() + offsets[row_itr->second];
+  }
+}
+
+Status GraphCsr::GetAllNeighbors(NodeIdType node_id, NodeType neighbor_type, std::vector<NodeIdType> *out_neighbors,
+                                 bool exclude_itself) const {
+  RETURN_UNEXPECTED_IF_NULL(out_neighbors);
+  const NodeIdType *neighbors = nullptr;
+  size_t count = 0;
+  GetNeighbors(node_id, neighbor_type, &neighbors, &count);
+  std::vector<NodeIdType> result;
+  result.reserve(count + 1);
+  if (!exclude_itself) {
+    result.push_back(node_id);
+  }
+  if (count == 0) {
+    MS_LOG(DEBUG) << "No neighbors. node_id:" << node_id << " neighbor_type:" << neighbor_type;
+  } else {
+    result.insert(result.end(), neighbors, neighbors + count);
+  }
+  *out_neighbors = std::move(result);
+  return Status::OK();
+}
+
+void GraphCsr::RandomSample(const NodeIdType *neighbors, size_t count, size_t samples_num, std::mt19937 *rnd,
+                            std::vector<NodeIdType> *out) {
+  // partial Fisher-Yates shuffle, the positions not in 'swapped' hold themselves
+  if (count < samples_num * kSparseSampleRatio) {
+    std::vector<size_t> positions(count);
+    std::iota(positions.begin(), positions.end(), 0);
+    for (size_t i = 0; i < samples_num; ++i) {
+      std::uniform_int_distribution<size_t> dist(i, count - 1);
+      std::swap(positions[i], positions[dist(*rnd)]);
+      out->push_back(neighbors[positions[i]]);
+    }
+    return;
+  }
+  std::unordered_map<size_t, size_t> swapped;
+  for (size_t i = 0; i < samples_num; ++i) {
+    std::uniform_int_distribution<size_t> dist(i, count - 1);
+    size_t j = dist(*rnd);
+    auto i_itr = swapped.find(i);
+    auto j_itr = swapped.find(j);
+    size_t value_i = i_itr == swapped.end() ? i : i_itr->second;
+    size_t value_j = j_itr == swapped.end() ? j : j_itr->second;
+    swapped[j] = value_i;
+    out->push_back(neighbors[value_j]);
+  }
+}
+
+Status GraphCsr::GetSampledNeighbors(NodeIdType node_id, NodeType neighbor_type, int32_t samples_num,
+                                     SamplingStrategy strategy, std::mt19937 *rnd,
+                                     std::vector<NodeIdType> *out_neighbors) const {
+  RETURN_UNEXPECTED_IF_NULL(rnd);
+  RETURN_UNEXPECTED_IF_NULL(out_neighbors);
+  CHECK_FAIL_RETURN_UNEXPECTED(samples_num >= 0, "Invalid samples number: " + std::to_string(samples_num));
+  std::vector<NodeIdType> result;
+  result.reserve(samples_num);
+  const NodeIdType *neighbors = nullptr;
+  size_t count = 0;
+  GetNeighbors(node_id, neighbor_type, &neighbors, &count);
+  const auto total = static_cast<size_t>(samples_num);
+  if (count == 0) {
+    MS_LOG(DEBUG) << "There are no neighbors. node_id:" << node_id << " neighbor_type:" << neighbor_type;
+    // If there are no neighbors, they are filled with kDefaultNodeId
+    result.assign(total, kDefaultNodeId);
+  } else if (strategy == SamplingStrategy::kRandom) {
+    while (result.size() < total) {
+      RandomSample(neighbors, count, std::min(count, total - result.size()), rnd, &result);
+    }
+  } else if (strategy == SamplingStrategy::kEdgeWeight) {
+    const auto &adjacency = adjacency_.at(neighbor_type);
+    const int64_t begin = neighbors - adjacency.neighbors.data();
+    const float *probability = adjacency.alias_probability.data() + begin;
+    const uint32_t *alias = adjacency.alias_index.data() + begin;
+    std::uniform_int_distribution<size_t> column_dist(0, count - 1);
+    std::uniform_real_distribution<float> probability_dist(0.0, 1.0);
+    for (size_t i = 0; i < total; ++i) {
+      size_t column = column_dist(*rnd);
+      result.push_back(probability_dist(*rnd) < probability[column] ? neighbors[column] : neighbors[alias[column]]);
+    }
+  } else {
+    RETURN_STATUS_UNEXPECTED("Invalid strategy");
+  }
+  *out_neighbors = std::move(result);
+  return Status::OK();
+}
+
+size_t GraphCsr::EdgeCount() const {
+  size_t count = 0;
+  for (const auto &item : adjacency_) {
+    count += item.second.neighbors.size();
+  }
+  return count;
+}
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
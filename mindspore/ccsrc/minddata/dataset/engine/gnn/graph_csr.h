@@ -0,0 +1,116 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_CSR_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_CSR_H_
+
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "minddata/dataset/engine/gnn/node.h"
+#include "minddata/dataset/include/dataset/constants.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+namespace gnn {
+
+// GraphCsr stores the adjacency of the graph in compressed sparse row format. The neighbors are grouped by the type of
+// neighbor node, and for each type the neighbors of all the nodes are kept in contiguous arrays:
+//   offsets:           | row 0 | row 1 | ... | row n |       n + 1 offsets, row i is the i-th node with neighbors
+//   neighbors:         | neighbors of row 0 | neighbors of row 1 | ... |
+//   alias probability: | alias table of row 0 | ... |      one probability and one alias for each neighbor
+//   alias index:       | alias table of row 0 | ... |
+// The alias tables are built from the edge weights once, so that a neighbor is sampled by weight in O(1).
+class GraphCsr {
+ public:
+  GraphCsr() = default;
+
+  ~GraphCsr() = default;
+
+  // Add an edge, the edges are staged until Build is called
+  // @param NodeIdType src_id - source node id
+  // @param NodeIdType dst_id - destination node id
+  // @param NodeType dst_type - type of destination node
+  // @param WeightType weight - edge weight, it should not be negative
+  void AddEdge(NodeIdType src_id, NodeIdType dst_id, NodeType dst_type, WeightType weight);
+
+  // Build the csr arrays and the alias tables from the staged edges, then release the staged edges. The neighbors of
+  // a node keep the order in which the edges are added.
+  // @return Status The status code returned
+  Status Build();
+
+  // Get the neighbors of a node
+  // @param NodeIdType node_id - node id
+  // @param NodeType neighbor_type - type of neighbor
+  // @param const NodeIdType **neighbors - Returned address of the first neighbor, nullptr if there is no neighbor
+  // @param size_t *count - Returned number of neighbors
+  void GetNeighbors(NodeIdType node_id, NodeType neighbor_type, const NodeIdType **neighbors, size_t *count) const;
+
+  // Get all the neighbors of a node
+  // @param NodeIdType node_id - node id
+  // @param NodeType neighbor_type - type of neighbor
+  // @param std::vector<NodeIdType> *out_neighbors - Returned neighbors id, the node itself is the first one unless
+  //     exclude_itself is true
+  // @return Status The status code returned
+  Status GetAllNeighbors(NodeIdType node_id, NodeType neighbor_type, std::vector<NodeIdType> *out_neighbors,
+                         bool exclude_itself = false) const;
+
+  // Get the sampled neighbors of a node. With kRandom, the neighbors are sampled without replacement round by round
+  // until there are enough samples. With kEdgeWeight, every sample is drawn from the alias table independently.
+  // @param NodeIdType node_id - node id
+  // @param NodeType neighbor_type - type of neighbor
+  // @param int32_t samples_num - Number of neighbors to be acquired, filled with kDefaultNodeId if no neighbor
+  // @param SamplingStrategy strategy - Sampling strategy
+  // @param std::mt19937 *rnd - random generator
+  // @param std::vector<NodeIdType> *out_neighbors - Returned neighbors id
+  // @return Status The status code returned
+  Status GetSampledNeighbors(NodeIdType node_id, NodeType neighbor_type, int32_t samples_num,
+                             SamplingStrategy strategy, std::mt19937 *rnd,
+                             std::vector<NodeIdType> *out_neighbors) const;
+
+  // @return size_t - number of edges in the csr arrays
+  size_t EdgeCount() const;
+
+ private:
+  struct Adjacency {
+    std::vector<int64_t> offsets;
+    std::vector<NodeIdType> neighbors;
+    std::vector<float> alias_probability;
+    std::vector<uint32_t> alias_index;
+  };
+
+  // Build the alias table of the neighbors in [begin, end) with Vose's method
+  static void BuildAliasTable(const std::vector<WeightType> &weights, int64_t begin, int64_t end,
+                              Adjacency *adjacency);
+
+  // Sample without replacement, it only touches the drawn positions when the neighbors are much more than samples
+  static void RandomSample(const NodeIdType *neighbors, size_t count, size_t samples_num, std::mt19937 *rnd,
+                           std::vector<NodeIdType> *out);
+
+  std::unordered_map<NodeIdType, uint32_t> node_rows_;  // node id to the row in the offsets
+  std::unordered_map<NodeType, Adjacency> adjacency_;
+
+  // the staged edges before Build is called
+  std::vector<NodeIdType> staged_src_;
+  std::vector<NodeIdType> staged_dst_;
+  std::vector<NodeType> staged_dst_type_;
+  std::vector<WeightType> staged_weight_;
+};
+}  // namespace gnn
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_CSR_H_
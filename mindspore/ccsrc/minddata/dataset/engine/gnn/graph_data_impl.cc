@@ -25,6 +25,7 @@
 #include "minddata/dataset/engine/gnn/graph_loader.h"
 #include "minddata/dataset/engine/gnn/graph_loader_array.h"
 #include "minddata/dataset/util/random.h"
+#include "minddata/dataset/util/task_manager.h"
 namespace mindspore {
 namespace dataset {
 namespace gnn {
@@ -179,13 +180,13 @@ Status GraphDataImpl::GetAllNeighbors(const std::vector<NodeIdType> &node_list,
     std::shared_ptr<Node> node;
     RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[i], &node));
     if (format == OutputFormat::kNormal) {
-      RETURN_IF_NOT_OK(node->GetAllNeighbors(neighbor_type, &neighbors[i]));
+      RETURN_IF_NOT_OK(graph_csr_.GetAllNeighbors(node->id(), neighbor_type, &neighbors[i]));
       max_neighbor_num = max_neighbor_num > neighbors[i].size() ? max_neighbor_num : neighbors[i].size();
     } else if (format == OutputFormat::kCoo) {
-      RETURN_IF_NOT_OK(node->GetAllNeighbors(neighbor_type, &neighbors[i], true));
+      RETURN_IF_NOT_OK(graph_csr_.GetAllNeighbors(node->id(), neighbor_type, &neighbors[i], true));
       total_edge_num += neighbors[i].size();
     } else {
-      RETURN_IF_NOT_OK(node->GetAllNeighbors(neighbor_type, &neighbors[i], true));
+      RETURN_IF_NOT_OK(graph_csr_.GetAllNeighbors(node->id(), neighbor_type, &neighbors[i], true));
       total_edge_num += neighbors[i].size();
       if (i < node_list.size() - 1) {
         offset_table[i + 1] = total_edge_num;
@@ -262,33 +263,80 @@ Status GraphDataImpl::GetSampledNeighbors(const std::vector<NodeIdType> &node_li
     RETURN_IF_NOT_OK(CheckNeighborType(type));
   }
   RETURN_UNEXPECTED_IF_NULL(out);
-  std::vector<std::vector<NodeIdType>> neighbors_vec(node_list.size());
-  for (size_t node_idx = 0; node_idx < node_list.size(); ++node_idx) {
-    std::shared_ptr<Node> input_node;
-    RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[node_idx], &input_node));
-    neighbors_vec[node_idx].emplace_back(node_list[node_idx]);
-    std::vector<NodeIdType> input_list = {node_list[node_idx]};
-    for (size_t i = 0; i < neighbor_nums.size(); ++i) {
-      std::vector<NodeIdType> neighbors;
-      neighbors.reserve(input_list.size() * neighbor_nums[i]);
-      for (const auto &node_id : input_list) {
-        if (node_id == kDefaultNodeId) {
-          for (int32_t j = 0; j < neighbor_nums[i]; ++j) {
-            neighbors.emplace_back(kDefaultNodeId);
+  // each row is the input node followed by the neighbors of every hop
+  size_t row_size = 1;
+  size_t hop_size = 1;
+  for (const auto &num : neighbor_nums) {
+    hop_size *= num;
+    row_size += hop_size;
+  }
+  std::shared_ptr<Tensor> tensor;
+  TensorShape shape({static_cast<dsize_t>(node_list.size()), static_cast<dsize_t>(row_size)});
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(shape, DataType(DataType::DE_INT32), &tensor));
+  NodeIdType *buffer = &*tensor->begin<NodeIdType>();
+  RETURN_UNEXPECTED_IF_NULL(buffer);
+
+  auto sample_nodes = [&](size_t begin, size_t end, std::mt19937 *rnd) -> Status {
+    std::vector<NodeIdType> out_neighbors;
+    for (size_t node_idx = begin; node_idx < end; ++node_idx) {
+      std::shared_ptr<Node> input_node;
+      RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[node_idx], &input_node));
+      NodeIdType *row = buffer + node_idx * row_size;
+      row[0] = node_list[node_idx];
+      // the nodes of the last hop are in [input_begin, input_end) of the row
+      size_t input_begin = 0;
+      size_t input_end = 1;
+      size_t pos = 1;
+      for (size_t i = 0; i < neighbor_nums.size(); ++i) {
+        for (size_t j = input_begin; j < input_end; ++j) {
+          if (row[j] == kDefaultNodeId) {
+            std::fill_n(row + pos, neighbor_nums[i], kDefaultNodeId);
+          } else {
+            RETURN_IF_NOT_OK(graph_csr_.GetSampledNeighbors(row[j], neighbor_types[i], neighbor_nums[i], strategy,
+                                                            rnd, &out_neighbors));
+            std::copy(out_neighbors.begin(), out_neighbors.end(), row + pos);
           }
-        } else {
-          std::shared_ptr<Node> node;
-          RETURN_IF_NOT_OK(GetNodeByNodeId(node_id, &node));
-          std::vector<NodeIdType> out;
-          RETURN_IF_NOT_OK(node->GetSampledNeighbors(neighbor_types[i], neighbor_nums[i], strategy, &out, &rnd_));
-          neighbors.insert(neighbors.end(), out.begin(), out.end());
+          pos += neighbor_nums[i];
         }
+        input_begin = input_end;
+        input_end = pos;
       }
-      neighbors_vec[node_idx].insert(neighbors_vec[node_idx].end(), neighbors.begin(), neighbors.end());
-      input_list = std::move(neighbors);
     }
-  }
-  RETURN_IF_NOT_OK(CreateTensorByVector<NodeIdType>(neighbors_vec, DataType(DataType::DE_INT32), out));
+    return Status::OK();
+  };
+  RETURN_IF_NOT_OK(ParallelSample(node_list.size(), sample_nodes));
+  tensor->Squeeze();
+  *out = std::move(tensor);
+  return Status::OK();
+}
+
+Status GraphDataImpl::ParallelSample(size_t count, const std::function<Status(size_t, size_t, std::mt19937 *)> &func) {
+  const uint32_t base_seed = rnd_();
+  const size_t block_num = (count + kSampleBlockSize - 1) / kSampleBlockSize;
+  auto sample_blocks = [&func, base_seed, block_num, count](size_t first_block, size_t step) -> Status {
+    for (size_t block = first_block; block < block_num; block += step) {
+      std::seed_seq seed_seq{base_seed, static_cast<uint32_t>(block)};
+      std::mt19937 rnd(seed_seq);
+      size_t begin = block * kSampleBlockSize;
+      RETURN_IF_NOT_OK(func(begin, std::min(begin + kSampleBlockSize, count), &rnd));
+    }
+    return Status::OK();
+  };
+
+  size_t worker_num = std::min(block_num, static_cast<size_t>(std::max(num_workers_, 1)));
+  if (worker_num <= 1) {
+    return sample_blocks(0, 1);
+  }
+  TaskGroup vg;
+  for (size_t wkr_id = 0; wkr_id < worker_num; ++wkr_id) {
+    RETURN_IF_NOT_OK(vg.CreateAsyncTask("GraphSampler", [&sample_blocks, wkr_id, worker_num]() -> Status {
+      TaskManager::FindMe()->Post();
+      return sample_blocks(wkr_id, worker_num);
+    }));
+  }
+  // wait for threads to finish and check its return code
+  RETURN_IF_NOT_OK(vg.join_all(Task::WaitFlag::kBlocking));
+  RETURN_IF_NOT_OK(vg.GetTaskErrorIfAny());
   return Status::OK();
 }
 
@@ -333,7 +381,7 @@ Status GraphDataImpl::GetNegSampledNeighbors(const std::vector<NodeIdType> &node
     std::shared_ptr<Node> node;
     RETURN_IF_NOT_OK(GetNodeByNodeId(node_list[node_idx], &node));
     std::vector<NodeIdType> neighbors;
-    RETURN_IF_NOT_OK(node->GetAllNeighbors(neg_neighbor_type, &neighbors));
+    RETURN_IF_NOT_OK(graph_csr_.GetAllNeighbors(node->id(), neg_neighbor_type, &neighbors));
     std::unordered_set<NodeIdType> exclude_nodes;
     (void)std::transform(neighbors.begin(), neighbors.end(),
                          std::insert_iterator<std::unordered_set<NodeIdType>>(exclude_nodes, exclude_nodes.begin()),
@@ -371,9 +419,7 @@ Status GraphDataImpl::RandomWalk(const std::vector<NodeIdType> &node_list, const
                                  std::shared_ptr<Tensor> *out) {
   RETURN_UNEXPECTED_IF_NULL(out);
   RETURN_IF_NOT_OK(random_walk_.Build(node_list, meta_path, step_home_param, step_away_param, default_node));
-  std::vector<std::vector<NodeIdType>> walks;
-  RETURN_IF_NOT_OK(random_walk_.SimulateWalk(&walks));
-  RETURN_IF_NOT_OK(CreateTensorByVector<NodeIdType>({walks}, DataType(DataType::DE_INT32), out));
+  RETURN_IF_NOT_OK(random_walk_.SimulateWalk(out));
   return Status::OK();
 }
 
@@ -741,20 +787,24 @@ Status GraphDataImpl::RandomWalkBase::Build(const std::vector<NodeIdType> &node_
   return Status::OK();
 }
 
-Status GraphDataImpl::RandomWalkBase::Node2vecWalk(const NodeIdType &start_node, std::vector<NodeIdType> *walk_path) {
+Status GraphDataImpl::RandomWalkBase::Node2vecWalk(const NodeIdType &start_node, std::mt19937 *rnd,
+                                                   NodeIdType *walk_path) {
+  RETURN_UNEXPECTED_IF_NULL(rnd);
   RETURN_UNEXPECTED_IF_NULL(walk_path);
-  // Simulate a random walk starting from start node.
-  auto walk = std::vector<NodeIdType>(1, start_node);  // walk is an vector
+  // Simulate a random walk starting from start node, the walk is walk_path[0, walk_size)
+  walk_path[0] = start_node;
+  size_t walk_size = 1;
+  std::vector<NodeIdType> cur_neighbors;
   // walk simulate
-  while (walk.size() - 1 < meta_path_.size()) {
-    // current nodE
-    auto cur_node_id = walk.back();
+  while (walk_size - 1 < meta_path_.size()) {
+    // current node
+    auto cur_node_id = walk_path[walk_size - 1];
     std::shared_ptr<Node> cur_node;
     RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(cur_node_id, &cur_node));
 
     // current neighbors
-    std::vector<NodeIdType> cur_neighbors;
-    RETURN_IF_NOT_OK(cur_node->GetAllNeighbors(meta_path_[walk.size() - 1], &cur_neighbors, true));
+    RETURN_IF_NOT_OK(
+      graph_->graph_csr_.GetAllNeighbors(cur_node_id, meta_path_[walk_size - 1], &cur_neighbors, true));
     std::sort(cur_neighbors.begin(), cur_neighbors.end());
 
     // break if no neighbors
@@ -764,79 +814,88 @@ Status GraphDataImpl::RandomWalkBase::Node2vecWalk(const NodeIdType &start_node,
 
     // walk by the fist node, then by the previous 2 nodes
     std::shared_ptr<StochasticIndex> stochastic_index;
-    if (walk.size() == 1) {
-      RETURN_IF_NOT_OK(GetNodeProbability(cur_node_id, meta_path_[0], &stochastic_index));
+    if (walk_size == 1) {
+      RETURN_IF_NOT_OK(GetNodeProbability(cur_node_id, meta_path_[0], rnd, &stochastic_index));
     } else {
-      NodeIdType prev_node_id = walk[walk.size() - 2];
-      RETURN_IF_NOT_OK(GetEdgeProbability(prev_node_id, cur_node_id, walk.size() - 2, &stochastic_index));
+      NodeIdType prev_node_id = walk_path[walk_size - 2];
+      RETURN_IF_NOT_OK(GetEdgeProbability(prev_node_id, cur_node_id, walk_size - 2, rnd, &stochastic_index));
     }
-    NodeIdType next_node_id = cur_neighbors[WalkToNextNode(*stochastic_index)];
-    walk.push_back(next_node_id);
-  }
-
-  while (walk.size() - 1 < meta_path_.size()) {
-    walk.push_back(default_node_);
+    walk_path[walk_size] = cur_neighbors[WalkToNextNode(*stochastic_index, rnd)];
+    ++walk_size;
   }
 
-  *walk_path = std::move(walk);
+  std::fill(walk_path + walk_size, walk_path + meta_path_.size() + 1, default_node_);
   return Status::OK();
 }
 
-Status GraphDataImpl::RandomWalkBase::SimulateWalk(std::vector<std::vector<NodeIdType>> *walks) {
+Status GraphDataImpl::RandomWalkBase::SimulateWalk(std::shared_ptr<Tensor> *walks) {
   RETURN_UNEXPECTED_IF_NULL(walks);
-  for (int32_t i = 0; i < num_walks_; ++i) {
-    for (const auto &node : node_list_) {
-      std::vector<NodeIdType> walk;
-      RETURN_IF_NOT_OK(Node2vecWalk(node, &walk));
-      walks->push_back(walk);
+  // the walks of the i-th round are the rows [i * node number, (i + 1) * node number)
+  const size_t walk_num = static_cast<size_t>(num_walks_) * node_list_.size();
+  const size_t walk_length = meta_path_.size() + 1;
+  std::shared_ptr<Tensor> tensor;
+  RETURN_IF_NOT_OK(
+    Tensor::CreateEmpty(TensorShape({static_cast<dsize_t>(walk_num), static_cast<dsize_t>(walk_length)}),
+                        DataType(DataType::DE_INT32), &tensor));
+  NodeIdType *buffer = &*tensor->begin<NodeIdType>();
+  RETURN_UNEXPECTED_IF_NULL(buffer);
+  auto walk_nodes = [this, buffer, walk_length](size_t begin, size_t end, std::mt19937 *rnd) -> Status {
+    for (size_t i = begin; i < end; ++i) {
+      RETURN_IF_NOT_OK(Node2vecWalk(node_list_[i % node_list_.size()], rnd, buffer + i * walk_length));
     }
-  }
+    return Status::OK();
+  };
+  RETURN_IF_NOT_OK(graph_->ParallelSample(walk_num, walk_nodes));
+  tensor->Squeeze();
+  *walks = std::move(tensor);
   return Status::OK();
 }
 
 Status GraphDataImpl::RandomWalkBase::GetNodeProbability(const NodeIdType &node_id, const NodeType &node_type,
+                                                         std::mt19937 *rnd,
                                                          std::shared_ptr<StochasticIndex> *node_probability) {
   RETURN_UNEXPECTED_IF_NULL(node_probability);
   // Generate alias nodes
   std::shared_ptr<Node> node;
   RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(node_id, &node));
-  std::vector<NodeIdType> neighbors;
-  RETURN_IF_NOT_OK(node->GetAllNeighbors(node_type, &neighbors, true));
-  std::sort(neighbors.begin(), neighbors.end());
-  auto non_normalized_probability = std::vector<float>(neighbors.size(), 1.0);
+  const NodeIdType *neighbors = nullptr;
+  size_t neighbor_count = 0;
+  graph_->graph_csr_.GetNeighbors(node_id, node_type, &neighbors, &neighbor_count);
+  auto non_normalized_probability = std::vector<float>(neighbor_count, 1.0);
   *node_probability =
-    std::make_shared<StochasticIndex>(GenerateProbability(Normalize<float>(non_normalized_probability)));
+    std::make_shared<StochasticIndex>(GenerateProbability(Normalize<float>(non_normalized_probability), rnd));
   return Status::OK();
 }
 
 Status GraphDataImpl::RandomWalkBase::GetEdgeProbability(const NodeIdType &src, const NodeIdType &dst,
-                                                         uint32_t meta_path_index,
+                                                         uint32_t meta_path_index, std::mt19937 *rnd,
                                                          std::shared_ptr<StochasticIndex> *edge_probability) {
   RETURN_UNEXPECTED_IF_NULL(edge_probability);
   // Get the alias edge setup lists for a given edge.
   std::shared_ptr<Node> src_node;
   RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(src, &src_node));
   std::vector<NodeIdType> src_neighbors;
-  RETURN_IF_NOT_OK(src_node->GetAllNeighbors(meta_path_[meta_path_index], &src_neighbors, true));
+  RETURN_IF_NOT_OK(graph_->graph_csr_.GetAllNeighbors(src, meta_path_[meta_path_index], &src_neighbors, true));
 
   std::shared_ptr<Node> dst_node;
   RETURN_IF_NOT_OK(graph_->GetNodeByNodeId(dst, &dst_node));
   std::vector<NodeIdType> dst_neighbors;
-  RETURN_IF_NOT_OK(dst_node->GetAllNeighbors(meta_path_[meta_path_index + 1], &dst_neighbors, true));
+  RETURN_IF_NOT_OK(graph_->graph_csr_.GetAllNeighbors(dst, meta_path_[meta_path_index + 1], &dst_neighbors, true));
 
   CHECK_FAIL_RETURN_UNEXPECTED(std::fabs(step_home_param_) > std::numeric_limits<float>::epsilon(),
                                "Invalid data, step home parameter can't be zero.");
   CHECK_FAIL_RETURN_UNEXPECTED(std::fabs(step_away_param_) > std::numeric_limits<float>::epsilon(),
                                "Invalid data, step away parameter can't be zero.");
   std::sort(dst_neighbors.begin(), dst_neighbors.end());
+  std::sort(src_neighbors.begin(), src_neighbors.end());
   std::vector<float> non_normalized_probability;
+  non_normalized_probability.reserve(dst_neighbors.size());
   for (const auto &dst_nbr : dst_neighbors) {
     if (dst_nbr == src) {
       non_normalized_probability.push_back(1.0 / step_home_param_);  // replace 1.0 with G[dst][dst_nbr]['weight']
       continue;
     }
-    auto it = std::find(src_neighbors.begin(), src_neighbors.end(), dst_nbr);
-    if (it != src_neighbors.end()) {
+    if (std::binary_search(src_neighbors.begin(), src_neighbors.end(), dst_nbr)) {
       // stay close, this node connect both src and dst
       non_normalized_probability.push_back(1.0);  // replace 1.0 with G[dst][dst_nbr]['weight']
     } else {
@@ -846,21 +905,21 @@ Status GraphDataImpl::RandomWalkBase::GetEdgeProbability(const NodeIdType &src,
   }
 
   *edge_probability =
-    std::make_shared<StochasticIndex>(GenerateProbability(Normalize<float>(non_normalized_probability)));
+    std::make_shared<StochasticIndex>(GenerateProbability(Normalize<float>(non_normalized_probability), rnd));
   return Status::OK();
 }
 
-StochasticIndex GraphDataImpl::RandomWalkBase::GenerateProbability(const std::vector<float> &probability) {
+StochasticIndex GraphDataImpl::RandomWalkBase::GenerateProbability(const std::vector<float> &probability,
+                                                                   std::mt19937 *rnd) {
   uint32_t K = probability.size();
   std::vector<int32_t> switch_to_large_index(K, 0);
   std::vector<float> weight(K, .0);
   std::vector<int32_t> smaller;
   std::vector<int32_t> larger;
-  auto random_device = GetRandomDevice();
   std::uniform_real_distribution<> distribution(-kGnnEpsilon, kGnnEpsilon);
   float accumulate_threshold = 0.0;
   for (uint32_t i = 0; i < K; i++) {
-    float threshold_one = distribution(random_device);
+    float threshold_one = distribution(*rnd);
     accumulate_threshold += threshold_one;
     weight[i] = i < K - 1 ? probability[i] * K + threshold_one : probability[i] * K - accumulate_threshold;
     weight[i] < 1.0 ? smaller.push_back(i) : larger.push_back(i);
@@ -878,18 +937,17 @@ StochasticIndex GraphDataImpl::RandomWalkBase::GenerateProbability(const std::ve
   return StochasticIndex(switch_to_large_index, weight);
 }
 
-uint32_t GraphDataImpl::RandomWalkBase::WalkToNextNode(const StochasticIndex &stochastic_index) {
-  auto switch_to_large_index = stochastic_index.first;
-  auto weight = stochastic_index.second;
+uint32_t GraphDataImpl::RandomWalkBase::WalkToNextNode(const StochasticIndex &stochastic_index, std::mt19937 *rnd) {
+  const auto &switch_to_large_index = stochastic_index.first;
+  const auto &weight = stochastic_index.second;
   const uint32_t size_of_index = switch_to_large_index.size();
 
-  auto random_device = GetRandomDevice();
   std::uniform_real_distribution<> distribution(0.0, 1.0);
 
   // Generate random integer between [0, K)
-  uint32_t random_idx = std::floor(distribution(random_device) * size_of_index);
+  uint32_t random_idx = std::floor(distribution(*rnd) * size_of_index);
 
-  if (distribution(random_device) < weight[random_idx]) {
+  if (distribution(*rnd) < weight[random_idx]) {
     return random_idx;
   }
   return switch_to_large_index[random_idx];
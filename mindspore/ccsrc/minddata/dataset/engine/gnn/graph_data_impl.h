@@ -17,7 +17,9 @@
 #define MINDSPORE_CCSRC_MINDDATA_DATASET_ENGINE_GNN_GRAPH_DATA_IMPL_H_
 
 #include <algorithm>
+#include <functional>
 #include <memory>
+#include <random>
 #include <string>
 #include <map>
 #include <unordered_map>
@@ -25,6 +27,7 @@
 #include <vector>
 #include <utility>
 
+#include "minddata/dataset/engine/gnn/graph_csr.h"
 #include "minddata/dataset/engine/gnn/graph_data.h"
 #if !defined(_WIN32) && !defined(_WIN64)
 #include "minddata/dataset/engine/gnn/graph_shared_memory.h"
@@ -37,6 +40,8 @@ namespace gnn {
 
 const float kGnnEpsilon = 0.0001;
 const uint32_t kMaxNumWalks = 80;
+// the number of input nodes sampled with one random generator, the blocks are sampled by the worker threads
+const size_t kSampleBlockSize = 1024;
 using StochasticIndex = std::pair<std::vector<int32_t>, std::vector<float>>;
 
 class GraphDataImpl : public GraphData {
@@ -202,20 +207,23 @@ class GraphDataImpl : public GraphData {
 
     ~RandomWalkBase() = default;
 
-    Status SimulateWalk(std::vector<std::vector<NodeIdType>> *walks);
+    // Simulate the walks of all the nodes in parallel
+    // @param std::shared_ptr<Tensor> *walks - Returned walks, each row is (meta path size + 1) nodes
+    // @return Status The status code returned
+    Status SimulateWalk(std::shared_ptr<Tensor> *walks);
 
    private:
-    Status Node2vecWalk(const NodeIdType &start_node, std::vector<NodeIdType> *walk_path);
+    Status Node2vecWalk(const NodeIdType &start_node, std::mt19937 *rnd, NodeIdType *walk_path);
 
-    Status GetNodeProbability(const NodeIdType &node_id, const NodeType &node_type,
+    Status GetNodeProbability(const NodeIdType &node_id, const NodeType &node_type, std::mt19937 *rnd,
                               std::shared_ptr<StochasticIndex> *node_probability);
 
     Status GetEdgeProbability(const NodeIdType &src, const NodeIdType &dst, uint32_t meta_path_index,
-                              std::shared_ptr<StochasticIndex> *edge_probability);
+                              std::mt19937 *rnd, std::shared_ptr<StochasticIndex> *edge_probability);
 
-    static StochasticIndex GenerateProbability(const std::vector<float> &probability);
+    static StochasticIndex GenerateProbability(const std::vector<float> &probability, std::mt19937 *rnd);
 
-    static uint32_t WalkToNextNode(const StochasticIndex &stochastic_index);
+    static uint32_t WalkToNextNode(const StochasticIndex &stochastic_index, std::mt19937 *rnd);
 
     template <typename T>
     std::vector<float> Normalize(const std::vector<T> &non_normalized_probability);
@@ -283,6 +291,13 @@ class GraphDataImpl : public GraphData {
 
   Status CheckSamplesNum(NodeIdType samples_num);
 
+  // Sample the input nodes in blocks of kSampleBlockSize with num_workers_ threads. Each block has its own random
+  // generator seeded from rnd_ and the block index, so the results only depend on the seed.
+  // @param size_t count - Number of input nodes
+  // @param std::function func - Sample the nodes in [begin, end) with the random generator of the block
+  // @return Status The status code returned
+  Status ParallelSample(size_t count, const std::function<Status(size_t, size_t, std::mt19937 *)> &func);
+
   Status CheckNeighborType(NodeType neighbor_type);
 
   std::string data_format_;
@@ -297,6 +312,7 @@ class GraphDataImpl : public GraphData {
 #endif
   std::unordered_map<NodeType, std::vector<NodeIdType>> node_type_map_;
   std::unordered_map<NodeIdType, std::shared_ptr<Node>> node_id_map_;
+  GraphCsr graph_csr_;  // the neighbors of all the nodes
 
   std::unordered_map<EdgeType, std::vector<EdgeIdType>> edge_type_map_;
   std::unordered_map<EdgeIdType, std::shared_ptr<Edge>> edge_id_map_;
@@ -73,7 +73,7 @@ Status GraphLoader::GetNodesAndEdges() {
 
       RETURN_IF_NOT_OK(edge_ptr->SetNode(src_itr->second->id(), dst_itr->second->id()));
 
-      RETURN_IF_NOT_OK(src_itr->second->AddNeighbor(dst_itr->second, edge_ptr->weight()));
+      graph_impl_->graph_csr_.AddEdge(src_id, dst_id, dst_itr->second->type(), edge_ptr->weight());
       RETURN_IF_NOT_OK(src_itr->second->AddAdjacent(dst_itr->second, edge_ptr));
 
       e_id_map->insert({edge_ptr->id(), edge_ptr});  // add edge to edge_id_map_
@@ -82,6 +82,8 @@ Status GraphLoader::GetNodesAndEdges() {
     }
   }
 
+  RETURN_IF_NOT_OK(graph_impl_->graph_csr_.Build());
+
   for (auto &itr : graph_impl_->node_type_map_) {
     itr.second.shrink_to_fit();
   }
@@ -50,6 +50,7 @@ std::shared_ptr<DatasetNode> MapNode::Copy() {
   std::vector<std::shared_ptr<TensorOperation>> operations = operations_;
   auto node = std::make_shared<MapNode>(nullptr, operations, input_columns_, output_columns_, cache_, callbacks_,
                                         offload_, python_mp_);
+  node->SetBatched(batched_);
   (void)node->SetNumWorkers(num_workers_);
   (void)node->SetConnectorQueueSize(connector_que_size_);
   return node;
@@ -94,6 +95,7 @@ Status MapNode::Build(std::vector<std::shared_ptr<DatasetOp>> *const node_ops) {
   if (python_mp_ != nullptr) {
     map_op->SetPythonMp(python_mp_);
   }
+  map_op->SetBatched(batched_);
   node_ops->push_back(map_op);
   return Status::OK();
 }
@@ -153,6 +155,9 @@ Status MapNode::to_json(nlohmann::json *out_json) {
   args["connector_queue_size"] = connector_que_size_;
   args["input_columns"] = input_columns_;
   args["output_columns"] = output_columns_;
+  if (batched_) {
+    args["batched"] = batched_;
+  }
   if (cache_ != nullptr) {
     nlohmann::json cache_args;
     RETURN_IF_NOT_OK(cache_->to_json(&cache_args));
@@ -194,7 +199,11 @@ Status MapNode::from_json(nlohmann::json json_obj, std::shared_ptr<DatasetNode>
   std::vector<std::string> output_columns = json_obj["output_columns"];
   std::vector<std::shared_ptr<TensorOperation>> operations;
   RETURN_IF_NOT_OK(Serdes::ConstructTensorOps(json_obj["operations"], &operations));
-  *result = std::make_shared<MapNode>(ds, operations, input_columns, output_columns);
+  auto map_node = std::make_shared<MapNode>(ds, operations, input_columns, output_columns);
+  if (json_obj.find("batched") != json_obj.end()) {
+    map_node->SetBatched(json_obj["batched"]);
+  }
+  *result = map_node;
   (void)(*result)->SetNumWorkers(json_obj["num_parallel_workers"]);
   (void)(*result)->SetConnectorQueueSize(json_obj["connector_queue_size"]);
   return Status::OK();
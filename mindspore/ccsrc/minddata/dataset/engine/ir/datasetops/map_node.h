@@ -94,6 +94,13 @@ class MapNode : public DatasetNode {
   /// \brief setter to set offload flag of node
   void SetOffload(ManualOffloadMode offload);
 
+  /// \brief Getter of whether the rows are batches output by BatchOp
+  bool Batched() const { return batched_; }
+
+  /// \brief Setter of whether the rows are batches output by BatchOp, whose tensors are the samples stacked along the
+  ///     first dimension. The batches are passed to BatchCompute() of the tensor ops as a whole.
+  void SetBatched(bool batched) { batched_ = batched; }
+
   /// \brief Get the arguments of node
   /// \param[out] out_json JSON string of all attributes
   /// \return Status of the function
@@ -127,6 +134,9 @@ class MapNode : public DatasetNode {
   /// \brief ManualOffloadMode to indicate manual_offload status
   ManualOffloadMode offload_;
 
+  /// \brief Whether the rows are batches, which are computed as a whole
+  bool batched_ = false;
+
   std::shared_ptr<PythonMultiprocessingRuntime> python_mp_;
 };
 }  // namespace dataset
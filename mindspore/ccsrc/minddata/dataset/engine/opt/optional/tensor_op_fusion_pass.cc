@@ -16,6 +16,8 @@
 
 #include "minddata/dataset/engine/opt/optional/tensor_op_fusion_pass.h"
 
+#include <iterator>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -24,11 +26,65 @@
 #include "minddata/dataset/kernels/image/random_crop_decode_resize_op.h"
 #include "minddata/dataset/kernels/ir/data/transforms_ir.h"
 #include "minddata/dataset/kernels/ir/vision/decode_ir.h"
+#include "minddata/dataset/kernels/ir/vision/hwc_to_chw_ir.h"
+#include "minddata/dataset/kernels/ir/vision/normalize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_crop_decode_resize_ir.h"
+#include "minddata/dataset/kernels/ir/vision/random_crop_decode_resize_normalize_ir.h"
 #include "minddata/dataset/kernels/ir/vision/random_resized_crop_ir.h"
+#include "minddata/dataset/kernels/ir/vision/rescale_ir.h"
 
 namespace mindspore {
 namespace dataset {
+namespace {
+using OpIterator = std::vector<std::shared_ptr<TensorOperation>>::iterator;
+
+bool IsOp(const OpIterator &itr, const OpIterator &end, const std::string &name) {
+  return itr != end && *itr != nullptr && (*itr)->Name() == name;
+}
+
+// Fuse the Rescale, Normalize and HwcToChw following RandomResizedCrop, so that the image is normalized and transposed
+// into the output tensor in one pass. Rescale and Normalize are optional, but at least one of them is required since
+// the fused op always outputs float32. 'next' is moved to the first op which is not fused.
+std::shared_ptr<TensorOperation> FuseNormalize(const vision::RandomResizedCropOperation &crop_ir, const OpIterator &end,
+                                               OpIterator *next) {
+  float rescale = 1.0;
+  float shift = 0.0;
+  std::vector<float> mean = {0.0};
+  std::vector<float> std = {1.0};
+  bool normalized = false;
+  auto itr = *next;
+  if (IsOp(itr, end, vision::kRescaleOperation)) {
+    auto *rescale_ir = dynamic_cast<vision::RescaleOperation *>(itr->get());
+    if (rescale_ir == nullptr) {
+      return nullptr;
+    }
+    rescale = rescale_ir->Rescale();
+    shift = rescale_ir->Shift();
+    normalized = true;
+    ++itr;
+  }
+  if (IsOp(itr, end, vision::kNormalizeOperation)) {
+    auto *normalize_ir = dynamic_cast<vision::NormalizeOperation *>(itr->get());
+    // the cropped image is always HWC, Normalize with is_hwc=false would fail on it
+    if (normalize_ir != nullptr && normalize_ir->IsHwc()) {
+      mean = normalize_ir->Mean();
+      std = normalize_ir->Std();
+      normalized = true;
+      ++itr;
+    }
+  }
+  if (!normalized) {
+    return nullptr;
+  }
+  bool to_chw = IsOp(itr, end, vision::kHwcToChwOperation);
+  if (to_chw) {
+    ++itr;
+  }
+  *next = itr;
+  return std::make_shared<vision::RandomCropDecodeResizeNormalizeOperation>(crop_ir, rescale, shift, mean, std,
+                                                                            to_chw);
+}
+}  // namespace
 
 Status TensorOpFusionPass::Visit(std::shared_ptr<MapNode> node, bool *const modified) {
   RETURN_UNEXPECTED_IF_NULL(node);
@@ -59,9 +115,17 @@ Status TensorOpFusionPass::Visit(std::shared_ptr<MapNode> node, bool *const modi
   RETURN_OK_IF_TRUE(itr == ops.end());
   auto *fused_ir = dynamic_cast<vision::RandomResizedCropOperation *>((itr + 1)->get());
   RETURN_UNEXPECTED_IF_NULL(fused_ir);
-  // fuse the two ops
-  (*itr) = std::make_shared<vision::RandomCropDecodeResizeOperation>(*fused_ir);
-  ops.erase(itr + 1);
+  auto next = itr + 2;
+  auto fused_normalize = FuseNormalize(*fused_ir, ops.end(), &next);
+  if (fused_normalize != nullptr) {
+    MS_LOG(INFO) << "Fusing Decode, RandomResizedCrop and the following normalization into " << fused_normalize->Name()
+                 << ", " << std::distance(itr, next) << " ops are fused.";
+    (*itr) = fused_normalize;
+  } else {
+    // fuse the two ops
+    (*itr) = std::make_shared<vision::RandomCropDecodeResizeOperation>(*fused_ir);
+  }
+  ops.erase(itr + 1, next);
   node->setOperations(ops);
   *modified = true;
   return Status::OK();
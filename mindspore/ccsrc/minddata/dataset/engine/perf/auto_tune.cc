@@ -24,6 +24,7 @@
 #include <string>
 #include <sstream>
 #include <iomanip>
+#include <limits>
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/engine/datasetops/source/nonmappable_leaf_op.h"
 #include "minddata/dataset/engine/serdes.h"
@@ -53,9 +54,20 @@ AutoTune::AutoTune(TreeAdapter *tree_adap, ProfilingManager *profiling_mgr)
       phase_3_ID_(0),
       avg_batch_time(0.0),
       phase_3_prev_avg_(0.0),
+      cpu_budget_(GlobalContext::config_manager()->autotune_cpu_budget()),
+      memory_budget_(GlobalContext::config_manager()->autotune_memory_budget()),
+      model_iterations_(0),
+      model_stable_count_(0),
       save_autoconfig_(GlobalContext::config_manager()->save_autoconfig()) {
   max_workers_ = GlobalContext::config_manager()->num_cpu_threads();
   autotune_json_filepath_ = GlobalContext::config_manager()->get_autotune_json_filepath();
+  // With a budget the pipeline is tuned by the model, which never goes beyond the budget
+  if (cpu_budget_ > 0 || memory_budget_ > 0) {
+    AT_phase_ = AutoTunePhase::kAutoTunePhaseModel;
+  }
+  if (cpu_budget_ > 0) {
+    max_workers_ = std::min(max_workers_, cpu_budget_);
+  }
 }
 
 Status AutoTune::Main() {
@@ -75,6 +87,9 @@ Status AutoTune::Main() {
   }
   bool output_final_config = save_autoconfig_ && !nodes_offloaded;
   bool output_intermediate_config = save_intermediate_autoconfig_ && output_final_config;
+  if (AT_phase_ == AutoTunePhase::kAutoTunePhaseModel && cpu_budget_ > 0) {
+    RETURN_IF_NOT_OK(ApplyCpuBudget());
+  }
   RETURN_IF_NOT_OK(ATMainLoop(output_intermediate_config));
   RETURN_IF_NOT_OK(profiling_manager_->Stop());
   PostMainLogging();
@@ -471,6 +486,8 @@ Status AutoTune::RunIteration() {
     RETURN_IF_NOT_OK(AnalyseTime());
   } else if (AT_phase_ == AutoTunePhase::kAutoTunePhaseMemory) {
     RETURN_IF_NOT_OK(AnalyseMemory());
+  } else if (AT_phase_ == AutoTunePhase::kAutoTunePhaseModel) {
+    RETURN_IF_NOT_OK(AnalyseModel());
   }
   return Status::OK();
 }
@@ -747,5 +764,210 @@ Status AutoTune::AnalyseMemory() {
   }
   return Status::OK();
 }
+
+Status AutoTune::ApplyCpuBudget() {
+  std::map<int32_t, double> op_costs;
+  int32_t fixed_workers = 0;
+  int32_t total_workers = 0;
+  for (auto op_id : parallel_ops_ids_) {
+    int32_t num_workers = ops_[op_id]->NumWorkers();
+    if (SkipOpsCheck(op_id) || ops_[op_id]->Name() == "DataQueueOp") {
+      fixed_workers += num_workers;
+      continue;
+    }
+    // Nothing is measured yet, so each worker is taken as a busy core
+    op_costs[op_id] = num_workers;
+    total_workers += num_workers;
+  }
+  int32_t budget = cpu_budget_ - fixed_workers;
+  if (op_costs.empty() || total_workers <= budget) {
+    return Status::OK();
+  }
+  MS_LOG(INFO) << "The ops use " << total_workers << " workers, which are more than the CPU budget of " << budget
+               << " cores left for them.";
+  std::map<int32_t, int32_t> ops_num_workers;
+  AllocateWorkers(op_costs, budget, true, &ops_num_workers);
+  for (auto &item : ops_num_workers) {
+    int32_t num_workers = ops_[item.first]->NumWorkers();
+    if (item.second != num_workers) {
+      RETURN_IF_NOT_OK(RequestNumWorkerChange(item.first, num_workers, &item.second));
+    }
+  }
+  return Status::OK();
+}
+
+void AutoTune::AllocateWorkers(const std::map<int32_t, double> &op_costs, int32_t budget, bool fill_budget,
+                               std::map<int32_t, int32_t> *ops_num_workers) const {
+  int32_t allocated = 0;
+  for (const auto &item : op_costs) {
+    (*ops_num_workers)[item.first] = MIN_NUM_WORKERS;
+    allocated += MIN_NUM_WORKERS;
+  }
+  while (allocated < budget) {
+    // The throughput of the pipeline is bound by the op with the fewest workers for its cost
+    int32_t bottleneck_id = -1;
+    double lowest_throughput = std::numeric_limits<double>::max();
+    for (const auto &item : op_costs) {
+      double throughput = (*ops_num_workers)[item.first] / item.second;
+      if (throughput < lowest_throughput) {
+        lowest_throughput = throughput;
+        bottleneck_id = item.first;
+      }
+    }
+    // Stop when the bottleneck can not get more workers, or when the workers of every op stay below the high cpu
+    // utilization threshold at the current throughput
+    if ((*ops_num_workers)[bottleneck_id] >= max_workers_ ||
+        (!fill_budget && lowest_throughput * MAP_OP_WORKER_HIGH_THRESHOLD >= TO_PERCENT)) {
+      break;
+    }
+    (*ops_num_workers)[bottleneck_id]++;
+    allocated++;
+  }
+}
+
+Status AutoTune::GetProcessMemory(double *memory_mb) {
+  std::vector<float> pss;
+#ifndef ENABLE_ANDROID
+  if (mode_ == AutoTuneMode::kAutoTuneModeEpoch) {
+    RETURN_IF_NOT_OK(
+      profiling_manager_->GetMainProcessMemoryInfoByEpoch(ProcessMemoryMetric::kPSS, cur_epoch_running_, &pss));
+  } else if (mode_ == AutoTuneMode::kAutoTuneModeStep) {
+    RETURN_IF_NOT_OK(profiling_manager_->GetMainProcessMemoryInfoByStep(ProcessMemoryMetric::kPSS, last_step_autotuned_,
+                                                                         cur_step_running_ - 1, &pss));
+  }
+#endif
+  *memory_mb = Mean(pss);
+  return Status::OK();
+}
+
+Status AutoTune::AllocateConnectors(const std::map<int32_t, double> &out_ops_queue_util, bool isBottleneck,
+                                    bool *changed) {
+  *changed = false;
+  double queued_rows = 0;
+  int64_t total_capacity = 0;
+  std::vector<int32_t> queue_ops;
+  for (const auto &op : ops_) {
+    if (op.second->inlined() || op.second->Name() == "DataQueueOp") {
+      continue;
+    }
+    queued_rows += out_ops_queue_util.at(op.first) * op.second->ConnectorCapacity();
+    total_capacity += op.second->ConnectorCapacity();
+    (void)queue_ops.emplace_back(op.first);
+  }
+  double memory_mb = 0;
+  RETURN_IF_NOT_OK(GetProcessMemory(&memory_mb));
+  if (queue_ops.empty() || memory_mb == 0) {
+    return Status::OK();
+  }
+  (void)memory_samples_.emplace_back(queued_rows, memory_mb);
+
+  // Fit memory = base + row_size * rows by least squares over the samples of all the iterations
+  double mean_rows = 0;
+  double mean_memory = 0;
+  for (const auto &sample : memory_samples_) {
+    mean_rows += sample.first;
+    mean_memory += sample.second;
+  }
+  mean_rows /= memory_samples_.size();
+  mean_memory /= memory_samples_.size();
+  double var_rows = 0;
+  double cov_rows_memory = 0;
+  for (const auto &sample : memory_samples_) {
+    var_rows += (sample.first - mean_rows) * (sample.first - mean_rows);
+    cov_rows_memory += (sample.first - mean_rows) * (sample.second - mean_memory);
+  }
+  double target_capacity;
+  if (var_rows > 0 && cov_rows_memory > 0) {
+    double row_size = cov_rows_memory / var_rows;
+    double base = mean_memory - row_size * mean_rows;
+    // The connectors must fit in the budget even when they are full
+    target_capacity = (memory_budget_ - base) / row_size;
+    MS_LOG(INFO) << "Modeled memory of the pipeline: " << base << " MB + " << row_size
+                 << " MB per queued row, connector capacity within budget: " << target_capacity;
+  } else if (memory_mb > memory_budget_) {
+    // Not enough samples for the model yet, so shrink the connectors towards the budget, which gives a new sample
+    float reduce_percent_mode =
+      mode_ == AutoTuneMode::kAutoTuneModeEpoch ? QUEUE_REDUCTION_PERCENTAGE_EPOCH : QUEUE_REDUCTION_PERCENTAGE_STEP;
+    target_capacity = total_capacity * reduce_percent_mode;
+  } else {
+    return Status::OK();
+  }
+  // The connectors only grow when the pipeline is the bottleneck
+  double scale = std::max(target_capacity / total_capacity, 0.0);
+  scale = std::min(scale, isBottleneck ? static_cast<double>(MODEL_QUEUE_GROWTH_LIMIT) : 1.0);
+  for (auto op_id : queue_ops) {
+    int64_t capacity = ops_[op_id]->ConnectorCapacity();
+    // Keep a slot for each worker, as the memory phase does
+    int64_t new_capacity =
+      std::max(static_cast<int64_t>(capacity * scale), static_cast<int64_t>(ops_[op_id]->NumWorkers()));
+    new_capacity = std::min(std::max(new_capacity, static_cast<int64_t>(MIN_QUEUE_SIZE)),
+                            static_cast<int64_t>(MAX_QUEUE_SIZE));
+    if (new_capacity != capacity) {
+      RETURN_IF_NOT_OK(RequestConnectorCapacityChange(op_id, capacity, new_capacity));
+      *changed = true;
+    }
+  }
+  return Status::OK();
+}
+
+Status AutoTune::AnalyseModel() {
+  bool isBottleneck = false;
+  RETURN_IF_NOT_OK(IsDSaBottleneck(&isBottleneck));
+  // collect stats
+  std::map<int32_t, int32_t> ops_num_workers;
+  RETURN_IF_NOT_OK(GetOpsNumWorker(&ops_num_workers));
+  std::map<int32_t, double> out_ops_queue_util;
+  std::map<int32_t, double> in_ops_queue_util;
+  RETURN_IF_NOT_OK(GetOpsQueueUtil(&out_ops_queue_util, &in_ops_queue_util));
+  std::map<int32_t, double> ops_cpu_util;
+  RETURN_IF_NOT_OK(GetOpsCpuUtil(&ops_cpu_util));
+  // model the cores each op uses at the current throughput
+  std::map<int32_t, double> op_costs;
+  int32_t fixed_workers = 0;
+  for (const auto &op_id : parallel_ops_ids_) {
+    int32_t num_workers = ops_num_workers[op_id];
+    if (SkipOpsCheck(op_id) || ops_[op_id]->Name() == "DataQueueOp") {
+      fixed_workers += num_workers;
+      continue;
+    }
+    double cost = ops_cpu_util[op_id] / TO_PERCENT;
+    // An op which drains its input connector slower than it fills its output is short of workers, even when they
+    // wait on IO rather than use the cpu, so all of its workers are taken as busy
+    if (in_ops_queue_util[op_id] - out_ops_queue_util[op_id] > INPUT_OUTPUT_QUEUE_DIFF_THRESHOLD) {
+      cost = std::max(cost, static_cast<double>(num_workers));
+    }
+    op_costs[op_id] = std::max(cost, MODEL_MIN_OP_COST);
+    MS_LOG(DEBUG) << "Op (" << ops_[op_id]->NameWithID() << ") workers=" << num_workers << ", cost=" << op_costs[op_id]
+                  << " cores.";
+  }
+  bool changed = false;
+  if (!op_costs.empty()) {
+    // Use up the budget only when the pipeline is the bottleneck, otherwise just keep the current throughput
+    int32_t budget = (cpu_budget_ > 0 ? cpu_budget_ : max_workers_) - fixed_workers;
+    std::map<int32_t, int32_t> new_num_workers;
+    AllocateWorkers(op_costs, budget, isBottleneck, &new_num_workers);
+    for (auto &item : new_num_workers) {
+      int32_t num_workers = ops_num_workers[item.first];
+      if (item.second != num_workers) {
+        RETURN_IF_NOT_OK(RequestNumWorkerChange(item.first, num_workers, &item.second));
+        changed = true;
+      }
+    }
+  }
+  if (memory_budget_ > 0) {
+    bool resized = false;
+    RETURN_IF_NOT_OK(AllocateConnectors(out_ops_queue_util, isBottleneck, &resized));
+    changed = changed || resized;
+  }
+  model_stable_count_ = changed ? 0 : model_stable_count_ + 1;
+  model_iterations_++;
+  int32_t max_iterations =
+    mode_ == AutoTuneMode::kAutoTuneModeEpoch ? MODEL_MAX_ITERATIONS_EPOCH : MODEL_MAX_ITERATIONS_STEP;
+  if (model_stable_count_ >= MODEL_STABLE_ITERATIONS || model_iterations_ >= max_iterations) {
+    MS_LOG(INFO) << "Dataset AutoTune model converged after " << model_iterations_ << " iterations.";
+    AT_phase_ = AutoTunePhase::kAutoTuneEnd;
+  }
+  return Status::OK();
+}
 }  // namespace dataset
 }  // namespace mindspore
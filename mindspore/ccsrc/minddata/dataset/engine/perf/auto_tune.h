@@ -21,6 +21,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 #include "minddata/dataset/util/status.h"
 #include "minddata/dataset/util/log_adapter.h"
@@ -146,7 +147,7 @@ class AutoTune {
   const float_t MAP_OP_WORKER_LOW_THRESHOLD = 35;
   // Running mode specifics
   enum AutoTuneMode { kAutoTuneModeEpoch, kAutoTuneModeStep };
-  enum AutoTunePhase { kAutoTunePhaseTime, kAutoTunePhaseMemory, kAutoTuneEnd };
+  enum AutoTunePhase { kAutoTunePhaseTime, kAutoTunePhaseMemory, kAutoTunePhaseModel, kAutoTuneEnd };
   enum AutoTuneMemPhase { kAutoTuneMemInit, kAutoTuneMemSet, kAutotTuneMemCompare };
   // Early stop specifics
   const int32_t EARLY_STOP_TRIAL_THRESHOLD_EPOCH = 4;
@@ -155,6 +156,12 @@ class AutoTune {
   const float MEMORY_COMPARISON_LOWER_BOUND_PERCENT = 0.02;
   const float QUEUE_REDUCTION_PERCENTAGE_EPOCH = 0.5;
   const float QUEUE_REDUCTION_PERCENTAGE_STEP = 0.8;
+  // Model specifics
+  const int32_t MODEL_MAX_ITERATIONS_EPOCH = 3;
+  const int32_t MODEL_MAX_ITERATIONS_STEP = 10;
+  const int32_t MODEL_STABLE_ITERATIONS = 2;
+  const double MODEL_MIN_OP_COST = 0.01;
+  const float MODEL_QUEUE_GROWTH_LIMIT = 2.0;
 
   /// Get the out connector capacity of the operator
   /// \param[in] op_id operator id
@@ -192,6 +199,38 @@ class AutoTune {
   /// \return Status code
   Status AnalyseMemory();
 
+  /// Model-based AutoTune algorithm, used when a CPU or memory budget is given. It models the cores each op needs
+  /// from its cpu utilization and the memory of the queued rows from the process memory, then sets the workers and
+  /// connector capacities of all the ops together within the budgets.
+  /// \return Status code
+  Status AnalyseModel();
+
+  /// Cut down the workers of the ops to the CPU budget before the pipeline is tuned
+  /// \return Status code
+  Status ApplyCpuBudget();
+
+  /// Allocate the workers to the ops by their cost. A worker is given to the op with the lowest modeled throughput
+  /// (workers / cost) at a time, until the budget is used up or each op sustains the current throughput.
+  /// \param op_costs map from op_id to the cores the op uses at the current throughput
+  /// \param budget the number of workers to allocate, at least one for each op
+  /// \param fill_budget true to use up the budget, false to stop once the current throughput is sustained
+  /// \param[out] ops_num_workers map from op_id to the allocated num_workers
+  void AllocateWorkers(const std::map<int32_t, double> &op_costs, int32_t budget, bool fill_budget,
+                       std::map<int32_t, int32_t> *ops_num_workers) const;
+
+  /// Fit the memory of the process against the rows queued in the connectors and resize the connectors to the
+  /// memory budget
+  /// \param out_ops_queue_util map from op_id to output queue utilization
+  /// \param isBottleneck whether the dataset pipeline is the bottleneck
+  /// \param[out] changed true if any connector is resized
+  /// \return Status code
+  Status AllocateConnectors(const std::map<int32_t, double> &out_ops_queue_util, bool isBottleneck, bool *changed);
+
+  /// Get the average memory used by the main process, in MB
+  /// \param[out] memory_mb the average PSS of the main process
+  /// \return Status code
+  Status GetProcessMemory(double *memory_mb);
+
   /// Send a ChangeRequest to the operator to update the number of workers
   /// \param op_id operator ID
   /// \param old_workers Old number of workers for logging purposes
@@ -289,6 +328,13 @@ class AutoTune {
   double phase_3_prev_avg_;
   std::vector<int32_t> OP_values;
 
+  // Model phase - Analyse Model
+  int32_t cpu_budget_;     // Cores for the pipeline, 0 if not limited
+  int64_t memory_budget_;  // Memory for the pipeline in MB, 0 if not limited
+  int32_t model_iterations_;
+  int32_t model_stable_count_;
+  std::vector<std::pair<double, double>> memory_samples_;  // (rows queued in the connectors, process memory in MB)
+
   /// True if should save AutoTune configuration
   bool save_autoconfig_;
 
@@ -322,6 +322,8 @@ Serdes::InitializeFuncPtr() {
   ops_ptr[vision::kRandomColorOperation] = &(vision::RandomColorOperation::from_json);
   ops_ptr[vision::kRandomColorAdjustOperation] = &(vision::RandomColorAdjustOperation::from_json);
   ops_ptr[vision::kRandomCropDecodeResizeOperation] = &(vision::RandomCropDecodeResizeOperation::from_json);
+  ops_ptr[vision::kRandomCropDecodeResizeNormalizeOperation] =
+    &(vision::RandomCropDecodeResizeNormalizeOperation::from_json);
   ops_ptr[vision::kRandomCropOperation] = &(vision::RandomCropOperation::from_json);
   ops_ptr[vision::kRandomCropWithBBoxOperation] = &(vision::RandomCropWithBBoxOperation::from_json);
   ops_ptr[vision::kRandomHorizontalFlipOperation] = &(vision::RandomHorizontalFlipOperation::from_json);
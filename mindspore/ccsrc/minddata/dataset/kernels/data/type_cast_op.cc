@@ -29,6 +29,9 @@ Status TypeCastOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr
   IO_CHECK(input, output);
   return TypeCast(input, output, type_);
 }
+
+Status TypeCastOp::BatchCompute(const TensorRow &input, TensorRow *output) { return TensorOp::Compute(input, output); }
+
 Status TypeCastOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
   RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
   outputs[0] = type_;
@@ -39,6 +39,9 @@ class TypeCastOp : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  // TypeCast is element-wise, so the whole batch is cast in one call
+  Status BatchCompute(const TensorRow &input, TensorRow *output) override;
+
   Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
 
   std::string Name() const override { return kTypeCastOp; }
@@ -15,6 +15,9 @@
  */
 #include "minddata/dataset/kernels/image/hwc_to_chw_op.h"
 
+#include <string>
+#include <utility>
+
 #ifndef ENABLE_ANDROID
 #include "minddata/dataset/kernels/image/image_utils.h"
 #else
@@ -24,12 +27,77 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// Transpose a batch of [H, W, C] images to [C, H, W], image_len is H * W.
+template <typename T>
+void HwcToChwBatch(const T *input, T *output, dsize_t num_images, dsize_t image_len, dsize_t num_channels) {
+  for (dsize_t n = 0; n < num_images; n++) {
+    const T *src = input + n * image_len * num_channels;
+    T *dst = output + n * image_len * num_channels;
+    for (dsize_t c = 0; c < num_channels; c++) {
+      for (dsize_t i = 0; i < image_len; i++) {
+        dst[c * image_len + i] = src[i * num_channels + c];
+      }
+    }
+  }
+}
+}  // namespace
+
 Status HwcToChwOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) {
   IO_CHECK(input, output);
   // input.shape == HWC
   // output.shape == CHW
   return HwcToChw(input, output);
 }
+
+Status HwcToChwOp::BatchCompute(const TensorRow &input, TensorRow *output) {
+  IO_CHECK_VECTOR(input, output);
+  CHECK_FAIL_RETURN_UNEXPECTED(input.size() == 1,
+                               "HWC2CHW: input should be one column, but got: " + std::to_string(input.size()));
+  const auto &batch = input[0];
+  // a batch of [H, W] images is kept as it is, the same as one [H, W] image
+  if (batch->Rank() == kMinImageRank + 1) {
+    output->push_back(batch);
+    return Status::OK();
+  }
+  if (batch->Rank() != kDefaultImageRank + 1 || !batch->type().IsNumeric()) {
+    return TensorOp::BatchCompute(input, output);
+  }
+  const TensorShape &shape = batch->shape();
+  const dsize_t num_images = shape[0];
+  const dsize_t height = shape[1];
+  const dsize_t width = shape[2];
+  const dsize_t num_channels = shape[3];
+  std::shared_ptr<Tensor> transposed;
+  RETURN_IF_NOT_OK(
+    Tensor::CreateEmpty(TensorShape({num_images, num_channels, height, width}), batch->type(), &transposed));
+  if (transposed->Size() > 0) {
+    // only the size of the elements matters to the transpose
+    switch (batch->type().SizeInBytes()) {
+      case sizeof(uint8_t):
+        HwcToChwBatch(&*batch->begin<uint8_t>(), &*transposed->begin<uint8_t>(), num_images, height * width,
+                      num_channels);
+        break;
+      case sizeof(uint16_t):
+        HwcToChwBatch(&*batch->begin<uint16_t>(), &*transposed->begin<uint16_t>(), num_images, height * width,
+                      num_channels);
+        break;
+      case sizeof(uint32_t):
+        HwcToChwBatch(&*batch->begin<uint32_t>(), &*transposed->begin<uint32_t>(), num_images, height * width,
+                      num_channels);
+        break;
+      case sizeof(uint64_t):
+        HwcToChwBatch(&*batch->begin<uint64_t>(), &*transposed->begin<uint64_t>(), num_images, height * width,
+                      num_channels);
+        break;
+      default:
+        RETURN_STATUS_UNEXPECTED("HWC2CHW: unsupported data type: " + batch->type().ToString());
+    }
+  }
+  output->push_back(std::move(transposed));
+  return Status::OK();
+}
+
 Status HwcToChwOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
   RETURN_IF_NOT_OK(TensorOp::OutputShape(inputs, outputs));
   outputs.clear();
@@ -29,6 +29,9 @@ namespace dataset {
 class HwcToChwOp : public TensorOp {
  public:
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
+  // The batch of [H, W, C] images is transposed to [N, C, H, W] in one pass
+  Status BatchCompute(const TensorRow &input, TensorRow *output) override;
   Status OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) override;
 
   std::string Name() const override { return kHwcToChwOp; }
@@ -501,7 +501,11 @@ void JpegErrorExitCustom(j_common_ptr cinfo) {
 }
 
 Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int crop_x, int crop_y,
-                         int crop_w, int crop_h) {
+                         int crop_w, int crop_h, int scale_denom) {
+  constexpr int kMaxScaleDenom = 8;
+  CHECK_FAIL_RETURN_UNEXPECTED(
+    scale_denom > 0 && scale_denom <= kMaxScaleDenom && (scale_denom & (scale_denom - 1)) == 0,
+    "JpegCropAndDecode: scale_denom should be 1, 2, 4 or 8, but got: " + std::to_string(scale_denom));
   struct jpeg_decompress_struct cinfo;
   auto DestroyDecompressAndReturnError = [&cinfo](const std::string &err) {
     jpeg_destroy_decompress(&cinfo);
@@ -515,6 +519,9 @@ Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<T
     JpegSetSource(&cinfo, input->GetBuffer(), input->SizeInBytes());
     (void)jpeg_read_header(&cinfo, TRUE);
     RETURN_IF_NOT_OK(JpegSetColorSpace(&cinfo));
+    // the IDCT outputs the scaled image directly, the skipped coefficients are never computed
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = static_cast<unsigned int>(scale_denom);
     jpeg_calc_output_dimensions(&cinfo);
     RETURN_IF_NOT_OK(CheckJpegExit(&cinfo));
   } catch (std::runtime_error &e) {
@@ -1119,6 +1126,47 @@ Status NormalizePad(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor
   return Status::OK();
 }
 
+Status NormalizeToFloat(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output,
+                        const std::vector<float> &scale, const std::vector<float> &shift, bool to_chw) {
+  RETURN_UNEXPECTED_IF_NULL(input);
+  RETURN_UNEXPECTED_IF_NULL(output);
+  CHECK_FAIL_RETURN_UNEXPECTED(
+    input->Rank() == kDefaultImageRank && input->type() == DataType::DE_UINT8,
+    "NormalizeToFloat: input should be an image of shape <H,W,C> and type uint8, got shape: " +
+      input->shape().ToString() + ", and type: " + input->type().ToString());
+  const dsize_t height = input->shape()[0];
+  const dsize_t width = input->shape()[1];
+  const dsize_t channels = input->shape()[kChannelIndexHWC];
+  CHECK_FAIL_RETURN_UNEXPECTED(
+    static_cast<dsize_t>(scale.size()) == channels && static_cast<dsize_t>(shift.size()) == channels,
+    "NormalizeToFloat: number of channels does not match the size of scale and shift vectors, got channels: " +
+      std::to_string(channels) + ", size of scale: " + std::to_string(scale.size()));
+  TensorShape out_shape = to_chw ? TensorShape({channels, height, width}) : input->shape();
+  std::shared_ptr<Tensor> output_tensor;
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(out_shape, DataType(DataType::DE_FLOAT32), &output_tensor));
+  const uint8_t *src = input->GetBuffer();
+  float *dst = &*output_tensor->begin<float>();
+  const dsize_t pixels = height * width;
+  if (to_chw) {
+    // write the planes one by one, so that the output is written sequentially
+    for (dsize_t c = 0; c < channels; c++) {
+      float *plane = dst + c * pixels;
+      const uint8_t *channel = src + c;
+      for (dsize_t i = 0; i < pixels; i++) {
+        plane[i] = static_cast<float>(channel[i * channels]) * scale[c] + shift[c];
+      }
+    }
+  } else {
+    for (dsize_t i = 0; i < pixels; i++) {
+      for (dsize_t c = 0; c < channels; c++) {
+        dst[i * channels + c] = static_cast<float>(src[i * channels + c]) * scale[c] + shift[c];
+      }
+    }
+  }
+  *output = output_tensor;
+  return Status::OK();
+}
+
 Status AdjustBrightness(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, float alpha) {
   try {
     RETURN_IF_NOT_OK(ValidateImage(input, "AdjustBrightness", {1, 2, 3, 4, 5, 6, 10, 11, 12}, {3}, {3}));
@@ -159,8 +159,13 @@ bool IsNonEmptyPNG(const std::shared_ptr<Tensor> &input);
 
 void JpegSetSource(j_decompress_ptr c_info, const void *data, int64_t data_size);
 
+/// \brief Decode the crop of a jpeg image, optionally at a reduced scale with libjpeg DCT scaling
+/// \param input: the encoded jpeg image
+/// \param output: decoded image Tensor of shape <h,w,3> and type DE_UINT8
+/// \param x, y, w, h: crop box in the coordinates of the scaled image, all zero means the whole image
+/// \param scale_denom: the image is decoded at 1/scale_denom of its size, should be 1, 2, 4 or 8
 Status JpegCropAndDecode(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, int x = 0, int y = 0,
-                         int w = 0, int h = 0);
+                         int w = 0, int h = 0, int scale_denom = 1);
 
 /// \brief Returns Rescaled image
 /// \param input: Tensor of shape <H,W,C> or <H,W> and any OpenCv compatible type, see CVTensor.
@@ -261,6 +266,15 @@ Status Normalize(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *
 Status NormalizePad(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output, std::vector<float> mean,
                     std::vector<float> std, const std::string &dtype, bool is_hwc);
 
+/// \brief Returns image normalized by y = x * scale + shift in one pass, optionally transposed to CHW
+/// \param input: Tensor of shape <H,W,C> and type DE_UINT8
+/// \param output: Normalized image Tensor of shape <H,W,C> or <C,H,W> and type DE_FLOAT32
+/// \param scale: vector of scale of each channel, the size is C
+/// \param shift: vector of shift of each channel, the size is C
+/// \param to_chw: write the output in CHW format
+Status NormalizeToFloat(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output,
+                        const std::vector<float> &scale, const std::vector<float> &shift, bool to_chw);
+
 /// \brief Returns image with adjusted brightness.
 /// \param input: Tensor of shape <H,W,3> in RGB order and any OpenCv compatible type, see CVTensor.
 /// \param alpha: Alpha value to adjust brightness by. Should be a positive number.
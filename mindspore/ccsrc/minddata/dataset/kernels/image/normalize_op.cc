@@ -16,6 +16,8 @@
 #include "minddata/dataset/kernels/image/normalize_op.h"
 
 #include <random>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "minddata/dataset/kernels/data/data_utils.h"
@@ -28,6 +30,26 @@
 
 namespace mindspore {
 namespace dataset {
+namespace {
+// Normalize a batch of images in one pass, channel_len is the number of the contiguous elements of one channel,
+// which is 1 for HWC images and H * W for CHW images.
+template <typename T>
+void NormalizeBatch(const T *input, float *output, dsize_t size, dsize_t channel_len, const std::vector<float> &means,
+                    const std::vector<float> &stds) {
+  const auto num_channels = static_cast<dsize_t>(means.size());
+  dsize_t i = 0;
+  while (i < size) {
+    for (dsize_t c = 0; c < num_channels; c++) {
+      const float mean = means[c];
+      const float std_dev = stds[c];
+      for (dsize_t j = 0; j < channel_len; j++, i++) {
+        output[i] = (static_cast<float>(input[i]) - mean) / std_dev;
+      }
+    }
+  }
+}
+}  // namespace
+
 NormalizeOp::NormalizeOp(const std::vector<float> &mean, const std::vector<float> &std, bool is_hwc)
     : mean_(mean), std_(std), is_hwc_(is_hwc) {}
 
@@ -71,6 +93,51 @@ Status NormalizeOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_pt
   }
 }
 
+Status NormalizeOp::BatchCompute(const TensorRow &input, TensorRow *output) {
+  IO_CHECK_VECTOR(input, output);
+  CHECK_FAIL_RETURN_UNEXPECTED(input.size() == 1,
+                               "Normalize: input should be one column, but got: " + std::to_string(input.size()));
+  const TensorShape &shape = input[0]->shape();
+  if ((shape.Rank() != kMinImageRank + 1 && shape.Rank() != kDefaultImageRank + 1) || !input[0]->type().IsNumeric()) {
+    return TensorOp::BatchCompute(input, output);
+  }
+  // a batch of [H, W] images is normalized as one channel
+  dsize_t num_channels = 1;
+  dsize_t channel_len = shape[-2] * shape[-1];
+  if (shape.Rank() == kDefaultImageRank + 1) {
+    num_channels = is_hwc_ ? shape[-1] : shape[1];
+    channel_len = is_hwc_ ? 1 : channel_len;
+  }
+  std::vector<float> means = mean_;
+  std::vector<float> stds = std_;
+  if (means.size() == 1 && stds.size() == 1) {
+    means.assign(num_channels, mean_[0]);
+    stds.assign(num_channels, std_[0]);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(static_cast<dsize_t>(means.size()) == num_channels && stds.size() == means.size(),
+                               "Normalize: number of channels does not match the size of mean and std vectors, got "
+                               "channels: " +
+                                 std::to_string(num_channels) + ", size of mean: " + std::to_string(mean_.size()) +
+                                 ", size of std: " + std::to_string(std_.size()));
+
+  std::shared_ptr<Tensor> batch = input[0];
+  if (batch->type() != DataType::DE_UINT8 && batch->type() != DataType::DE_FLOAT32) {
+    RETURN_IF_NOT_OK(TypeCast(input[0], &batch, DataType(DataType::DE_FLOAT32)));
+  }
+  std::shared_ptr<Tensor> normalized;
+  RETURN_IF_NOT_OK(Tensor::CreateEmpty(shape, DataType(DataType::DE_FLOAT32), &normalized));
+  if (normalized->Size() > 0) {
+    float *dst = &*normalized->begin<float>();
+    if (batch->type() == DataType::DE_UINT8) {
+      NormalizeBatch(&*batch->begin<uint8_t>(), dst, normalized->Size(), channel_len, means, stds);
+    } else {
+      NormalizeBatch(&*batch->begin<float>(), dst, normalized->Size(), channel_len, means, stds);
+    }
+  }
+  output->push_back(std::move(normalized));
+  return Status::OK();
+}
+
 void NormalizeOp::Print(std::ostream &out) const {
   out << "NormalizeOp, mean: ";
   for (const auto &m : mean_) {
@@ -36,6 +36,9 @@ class NormalizeOp : public TensorOp {
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
 
+  // The batches of [H, W] and [H, W, C] or [C, H, W] images are normalized in one pass
+  Status BatchCompute(const TensorRow &input, TensorRow *output) override;
+
   std::string Name() const override { return kNormalizeOp; }
 
  private:
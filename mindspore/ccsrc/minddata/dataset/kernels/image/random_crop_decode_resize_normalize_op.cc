@@ -0,0 +1,134 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/image/random_crop_decode_resize_normalize_op.h"
+
+#include <algorithm>
+
+#include "minddata/dataset/kernels/image/decode_op.h"
+#include "minddata/dataset/kernels/image/image_utils.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// libjpeg-turbo scales the image by 1/2, 1/4 and 1/8 in the IDCT
+constexpr int kMaxJpegScaleDenom = 8;
+constexpr size_t kCropBoxSize = 4;
+}  // namespace
+
+RandomCropDecodeResizeNormalizeOp::RandomCropDecodeResizeNormalizeOp(const RandomCropAndResizeOp &rhs, float rescale,
+                                                                     float shift, const std::vector<float> &mean,
+                                                                     const std::vector<float> &std, bool to_chw)
+    : RandomCropDecodeResizeOp(rhs), rescale_(rescale), shift_(shift), mean_(mean), std_(std), to_chw_(to_chw) {
+  // caller provided 1 mean/std value --> duplicate it for each channel of the decoded RGB image
+  if (mean_.size() == 1 && std_.size() == 1) {
+    mean_.resize(kDefaultImageChannel, mean_[0]);
+    std_.resize(kDefaultImageChannel, std_[0]);
+  }
+  // ((x * rescale + shift) - mean) / std == x * (rescale / std) + (shift - mean) / std
+  for (size_t c = 0; c < mean_.size() && c < std_.size(); c++) {
+    channel_scale_.push_back(rescale_ / std_[c]);
+    channel_shift_.push_back((shift_ - mean_[c]) / std_[c]);
+  }
+}
+
+void RandomCropDecodeResizeNormalizeOp::Print(std::ostream &out) const {
+  out << Name() << ": " << target_height_ << " " << target_width_ << ", rescale: " << rescale_ << ", shift: " << shift_
+      << ", mean: {";
+  for (const auto &m : mean_) {
+    out << m << ", ";
+  }
+  out << "}, std: {";
+  for (const auto &s : std_) {
+    out << s << ", ";
+  }
+  out << "}, to_chw: " << to_chw_;
+}
+
+int RandomCropDecodeResizeNormalizeOp::GetScaleDenom(int crop_height, int crop_width, int target_height,
+                                                     int target_width) {
+  int scale_denom = 1;
+  while (scale_denom < kMaxJpegScaleDenom && crop_height / (scale_denom * 2) >= target_height &&
+         crop_width / (scale_denom * 2) >= target_width) {
+    scale_denom *= 2;
+  }
+  return scale_denom;
+}
+
+Status RandomCropDecodeResizeNormalizeOp::DecodeCropResize(const std::shared_ptr<Tensor> &input, bool new_crop_box,
+                                                            std::vector<int> *crop_box,
+                                                            std::shared_ptr<Tensor> *output) {
+  auto &x = (*crop_box)[0];
+  auto &y = (*crop_box)[1];
+  auto &crop_height = (*crop_box)[2];
+  auto &crop_width = (*crop_box)[3];
+  if (!IsNonEmptyJPEG(input)) {
+    DecodeOp op(true);
+    std::shared_ptr<Tensor> decoded;
+    RETURN_IF_NOT_OK(op.Compute(input, &decoded));
+    if (new_crop_box) {
+      auto h_in = static_cast<int>(decoded->shape()[0]);
+      auto w_in = static_cast<int>(decoded->shape()[1]);
+      RETURN_IF_NOT_OK(GetCropBox(h_in, w_in, &x, &y, &crop_height, &crop_width));
+    }
+    return CropAndResize(decoded, output, x, y, crop_height, crop_width, target_height_, target_width_,
+                         interpolation_);
+  }
+  int h_in = 0;
+  int w_in = 0;
+  RETURN_IF_NOT_OK(GetJpegImageInfo(input, &w_in, &h_in));
+  if (new_crop_box) {
+    RETURN_IF_NOT_OK(GetCropBox(h_in, w_in, &x, &y, &crop_height, &crop_width));
+  }
+  // decode the crop box at reduced scale, the scaled image has ceil(size / scale_denom) pixels in each dimension
+  const int scale_denom = GetScaleDenom(crop_height, crop_width, target_height_, target_width_);
+  const int scaled_h_in = (h_in + scale_denom - 1) / scale_denom;
+  const int scaled_w_in = (w_in + scale_denom - 1) / scale_denom;
+  const int scaled_x = x / scale_denom;
+  const int scaled_y = y / scale_denom;
+  const int scaled_width = std::min(scaled_w_in, (x + crop_width + scale_denom - 1) / scale_denom) - scaled_x;
+  const int scaled_height = std::min(scaled_h_in, (y + crop_height + scale_denom - 1) / scale_denom) - scaled_y;
+  std::shared_ptr<Tensor> decoded;
+  RETURN_IF_NOT_OK(
+    JpegCropAndDecode(input, &decoded, scaled_x, scaled_y, scaled_width, scaled_height, scale_denom));
+  return Resize(decoded, output, target_height_, target_width_, 0.0, 0.0, interpolation_);
+}
+
+Status RandomCropDecodeResizeNormalizeOp::Compute(const TensorRow &input, TensorRow *output) {
+  IO_CHECK_VECTOR(input, output);
+  output->resize(input.size());
+  // all the images of the row share the crop box of the first one
+  std::vector<int> crop_box(kCropBoxSize, 0);
+  for (size_t i = 0; i < input.size(); i++) {
+    if (input[i] == nullptr) {
+      RETURN_STATUS_UNEXPECTED("RandomCropDecodeResizeNormalize: input image is empty since got nullptr.");
+    }
+    std::shared_ptr<Tensor> resized;
+    RETURN_IF_NOT_OK(DecodeCropResize(input[i], i == 0, &crop_box, &resized));
+    RETURN_IF_NOT_OK(NormalizeToFloat(resized, &(*output)[i], channel_scale_, channel_shift_, to_chw_));
+  }
+  return Status::OK();
+}
+
+Status RandomCropDecodeResizeNormalizeOp::OutputType(const std::vector<DataType> &inputs,
+                                                     std::vector<DataType> &outputs) {
+  RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
+  for (auto &type : outputs) {
+    type = DataType(DataType::DE_FLOAT32);
+  }
+  return Status::OK();
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,78 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_RANDOM_CROP_DECODE_RESIZE_NORMALIZE_OP_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_RANDOM_CROP_DECODE_RESIZE_NORMALIZE_OP_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/kernels/image/random_crop_decode_resize_op.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief The fusion of Decode, RandomResizedCrop, Rescale, Normalize and HWC2CHW. The jpeg image is decoded at the
+///     smallest DCT scale which is not smaller than the target size, only the crop box is decoded, and the resized
+///     image is normalized and transposed in one pass into the output tensor.
+class RandomCropDecodeResizeNormalizeOp : public RandomCropDecodeResizeOp {
+ public:
+  /// \brief Constructor
+  /// \param[in] rhs the RandomResizedCrop to fuse
+  /// \param[in] rescale the rescale factor before normalization, 1.0 if there is no Rescale
+  /// \param[in] shift the shift before normalization, 0.0 if there is no Rescale
+  /// \param[in] mean the mean of each channel, {0.0} if there is no Normalize
+  /// \param[in] std the std of each channel, {1.0} if there is no Normalize
+  /// \param[in] to_chw whether to output the image in CHW format
+  RandomCropDecodeResizeNormalizeOp(const RandomCropAndResizeOp &rhs, float rescale, float shift,
+                                    const std::vector<float> &mean, const std::vector<float> &std, bool to_chw);
+
+  ~RandomCropDecodeResizeNormalizeOp() override = default;
+
+  void Print(std::ostream &out) const override;
+
+  Status Compute(const TensorRow &input, TensorRow *output) override;
+
+  Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
+
+  std::string Name() const override { return kRandomCropDecodeResizeNormalizeOp; }
+
+  /// \brief Get the largest libjpeg scale denominator, with which the scaled crop is still not smaller than the target
+  static int GetScaleDenom(int crop_height, int crop_width, int target_height, int target_width);
+
+ private:
+  /// \brief Decode, crop and resize one image to the target size
+  /// \param[in] input the encoded image
+  /// \param[in] new_crop_box whether to generate a new crop box, or else the crop box of the last image is used
+  /// \param[in, out] crop_box x, y, crop height and crop width in the coordinates of the decoded image
+  /// \param[out] output the resized image in HWC format
+  Status DecodeCropResize(const std::shared_ptr<Tensor> &input, bool new_crop_box, std::vector<int> *crop_box,
+                          std::shared_ptr<Tensor> *output);
+
+  float rescale_;
+  float shift_;
+  std::vector<float> mean_;
+  std::vector<float> std_;
+  bool to_chw_;
+  // the folded coefficients of each channel, output = input * scale + shift
+  std::vector<float> channel_scale_;
+  std::vector<float> channel_shift_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_IMAGE_RANDOM_CROP_DECODE_RESIZE_NORMALIZE_OP_H_
@@ -24,6 +24,9 @@ Status RescaleOp::Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<
   IO_CHECK(input, output);
   return Rescale(input, output, rescale_, shift_);
 }
+
+Status RescaleOp::BatchCompute(const TensorRow &input, TensorRow *output) { return TensorOp::Compute(input, output); }
+
 Status RescaleOp::OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) {
   RETURN_IF_NOT_OK(TensorOp::OutputType(inputs, outputs));
   outputs[0] = DataType(DataType::DE_FLOAT32);
@@ -37,6 +37,9 @@ class RescaleOp : public TensorOp {
   }
 
   Status Compute(const std::shared_ptr<Tensor> &input, std::shared_ptr<Tensor> *output) override;
+
+  // Rescale is element-wise, so the whole batch is rescaled in one call
+  Status BatchCompute(const TensorRow &input, TensorRow *output) override;
   Status OutputType(const std::vector<DataType> &inputs, std::vector<DataType> &outputs) override;
 
   std::string Name() const override { return kRescaleOp; }
@@ -50,6 +50,11 @@ class NormalizeOperation : public TensorOperation {
 
   static Status from_json(nlohmann::json op_params, std::shared_ptr<TensorOperation> *operation);
 
+  /// \brief Getter functions
+  const std::vector<float> &Mean() const { return mean_; }
+  const std::vector<float> &Std() const { return std_; }
+  bool IsHwc() const { return is_hwc_; }
+
  private:
   std::vector<float> mean_;
   std::vector<float> std_;
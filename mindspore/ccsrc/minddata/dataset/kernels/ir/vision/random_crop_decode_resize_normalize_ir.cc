@@ -0,0 +1,111 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/dataset/kernels/ir/vision/random_crop_decode_resize_normalize_ir.h"
+
+#ifndef ENABLE_ANDROID
+#include "minddata/dataset/kernels/image/random_crop_decode_resize_normalize_op.h"
+#endif
+
+#include "minddata/dataset/kernels/ir/validators.h"
+#include "minddata/dataset/util/validators.h"
+
+namespace mindspore {
+namespace dataset {
+namespace vision {
+#ifndef ENABLE_ANDROID
+// RandomCropDecodeResizeNormalizeOperation
+RandomCropDecodeResizeNormalizeOperation::RandomCropDecodeResizeNormalizeOperation(
+  const std::vector<int32_t> &size, const std::vector<float> &scale, const std::vector<float> &ratio,
+  InterpolationMode interpolation, int32_t max_attempts, float rescale, float shift, const std::vector<float> &mean,
+  const std::vector<float> &std, bool to_chw)
+    : RandomCropDecodeResizeOperation(size, scale, ratio, interpolation, max_attempts),
+      rescale_(rescale),
+      shift_(shift),
+      mean_(mean),
+      std_(std),
+      to_chw_(to_chw) {}
+
+RandomCropDecodeResizeNormalizeOperation::RandomCropDecodeResizeNormalizeOperation(
+  const RandomResizedCropOperation &base, float rescale, float shift, const std::vector<float> &mean,
+  const std::vector<float> &std, bool to_chw)
+    : RandomCropDecodeResizeOperation(base),
+      rescale_(rescale),
+      shift_(shift),
+      mean_(mean),
+      std_(std),
+      to_chw_(to_chw) {}
+
+RandomCropDecodeResizeNormalizeOperation::~RandomCropDecodeResizeNormalizeOperation() = default;
+
+std::string RandomCropDecodeResizeNormalizeOperation::Name() const { return kRandomCropDecodeResizeNormalizeOperation; }
+
+Status RandomCropDecodeResizeNormalizeOperation::ValidateParams() {
+  RETURN_IF_NOT_OK(RandomCropDecodeResizeOperation::ValidateParams());
+  RETURN_IF_NOT_OK(ValidateVectorMeanStd(kRandomCropDecodeResizeNormalizeOperation, mean_, std_));
+  return Status::OK();
+}
+
+std::shared_ptr<TensorOp> RandomCropDecodeResizeNormalizeOperation::Build() {
+  auto base_op = std::dynamic_pointer_cast<RandomCropAndResizeOp>(RandomCropDecodeResizeOperation::Build());
+  if (base_op == nullptr) {
+    return nullptr;
+  }
+  return std::make_shared<RandomCropDecodeResizeNormalizeOp>(*base_op, rescale_, shift_, mean_, std_, to_chw_);
+}
+
+Status RandomCropDecodeResizeNormalizeOperation::to_json(nlohmann::json *out_json) {
+  nlohmann::json args;
+  RETURN_IF_NOT_OK(RandomCropDecodeResizeOperation::to_json(&args));
+  args["rescale"] = rescale_;
+  args["shift"] = shift_;
+  args["mean"] = mean_;
+  args["std"] = std_;
+  args["to_chw"] = to_chw_;
+  *out_json = args;
+  return Status::OK();
+}
+
+Status RandomCropDecodeResizeNormalizeOperation::from_json(nlohmann::json op_params,
+                                                           std::shared_ptr<TensorOperation> *operation) {
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "size", kRandomCropDecodeResizeNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "scale", kRandomCropDecodeResizeNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "ratio", kRandomCropDecodeResizeNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "interpolation", kRandomCropDecodeResizeNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "max_attempts", kRandomCropDecodeResizeNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "rescale", kRandomCropDecodeResizeNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "shift", kRandomCropDecodeResizeNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "mean", kRandomCropDecodeResizeNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "std", kRandomCropDecodeResizeNormalizeOperation));
+  RETURN_IF_NOT_OK(ValidateParamInJson(op_params, "to_chw", kRandomCropDecodeResizeNormalizeOperation));
+  std::vector<int32_t> size = op_params["size"];
+  std::vector<float> scale = op_params["scale"];
+  std::vector<float> ratio = op_params["ratio"];
+  InterpolationMode interpolation = static_cast<InterpolationMode>(op_params["interpolation"]);
+  int32_t max_attempts = op_params["max_attempts"];
+  float rescale = op_params["rescale"];
+  float shift = op_params["shift"];
+  std::vector<float> mean = op_params["mean"];
+  std::vector<float> std = op_params["std"];
+  bool to_chw = op_params["to_chw"];
+  *operation = std::make_shared<vision::RandomCropDecodeResizeNormalizeOperation>(
+    size, scale, ratio, interpolation, max_attempts, rescale, shift, mean, std, to_chw);
+  return Status::OK();
+}
+#endif
+}  // namespace vision
+}  // namespace dataset
+}  // namespace mindspore
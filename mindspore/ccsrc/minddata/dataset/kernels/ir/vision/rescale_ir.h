@@ -49,6 +49,10 @@ class RescaleOperation : public TensorOperation {
 
   static Status from_json(nlohmann::json op_params, std::shared_ptr<TensorOperation> *operation);
 
+  /// \brief Getter functions
+  float Rescale() const { return rescale_; }
+  float Shift() const { return shift_; }
+
  private:
   float rescale_;
   float shift_;
@@ -20,6 +20,7 @@
 
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/kernels/ir/data/transforms_ir.h"
+#include "minddata/dataset/kernels/shared_row_channel.h"
 #include "minddata/dataset/kernels/tensor_op.h"
 #include "minddata/dataset/util/status.h"
 #include "minddata/dataset/util/validators.h"
@@ -47,20 +48,28 @@ Status PyFuncOp::Compute(const TensorRow &input, TensorRow *output) {
       goto ComputeReturn;
     }
     try {
-      // Transform input tensor vector into numpy array vector
-      py::tuple input_args(input.size());
       py::object ret_py_obj;
-      if (input.size() > 0) {
-        for (size_t i = 0; i < input.size(); i++) {
-          py::array new_data;
-          RETURN_IF_NOT_OK(input.at(i)->GetDataAsNumpy(&new_data));
-          // possible memcpy here
-          input_args[i] = new_data;
+      bool in_worker = false;
+      RETURN_IF_NOT_OK(ComputeInWorker(input, output, &ret_py_obj, &in_worker));
+      if (in_worker && !ret_py_obj) {
+        // The result has come back as tensors
+        goto ComputeReturn;
+      }
+      if (!in_worker) {
+        // Transform input tensor vector into numpy array vector
+        py::tuple input_args(input.size());
+        if (input.size() > 0) {
+          for (size_t i = 0; i < input.size(); i++) {
+            py::array new_data;
+            RETURN_IF_NOT_OK(input.at(i)->GetDataAsNumpy(&new_data));
+            // possible memcpy here
+            input_args[i] = new_data;
+          }
+          // Invoke python function
+          ret_py_obj = this->py_func_ptr_(*input_args);
+        } else {
+          ret_py_obj = this->py_func_ptr_();
         }
-        // Invoke python function
-        ret_py_obj = this->py_func_ptr_(*input_args);
-      } else {
-        ret_py_obj = this->py_func_ptr_();
       }
       if (output_type_ != DataType::DE_UNKNOWN) {
         RETURN_IF_NOT_OK(CastOutput(ret_py_obj, output));
@@ -99,6 +108,44 @@ TimeoutError:
   goto ComputeReturn;
 }
 
+Status PyFuncOp::ComputeInWorker(const TensorRow &input, TensorRow *output, py::object *ret_py_obj, bool *done) {
+  RETURN_UNEXPECTED_IF_NULL(output);
+  RETURN_UNEXPECTED_IF_NULL(ret_py_obj);
+  RETURN_UNEXPECTED_IF_NULL(done);
+  *done = false;
+  // Only the functions run by python multiprocessing have a pipe to the worker process of the current thread
+  if (output_type_ != DataType::DE_UNKNOWN || !py::hasattr(py_func_ptr_, "native_pipe")) {
+    return Status::OK();
+  }
+  py::object pipe = py_func_ptr_.attr("native_pipe")();
+  if (pipe.is_none()) {
+    return Status::OK();
+  }
+  auto channel = pipe.attr("channel").cast<std::shared_ptr<SharedRowChannel>>();
+  RETURN_UNEXPECTED_IF_NULL(channel);
+  auto func_idx = py_func_ptr_.attr("idx").cast<int32_t>();
+  SharedRowChannel::Kind kind = SharedRowChannel::kEmpty;
+  TensorRow result;
+  {
+    // The other threads of the pipeline can run python while this thread waits for the worker
+    py::gil_scoped_release gil_release;
+    RETURN_IF_NOT_OK(channel->Call(func_idx, input, &result, &kind));
+  }
+  if (kind == SharedRowChannel::kEmpty) {
+    return Status::OK();
+  }
+  if (kind == SharedRowChannel::kArrays) {
+    for (auto &tensor : result) {
+      output->push_back(tensor);
+    }
+  } else {
+    // The result is not numeric or too large, the pipe gets it from the channel and raises the error of the worker
+    *ret_py_obj = pipe.attr("take_response")();
+  }
+  *done = true;
+  return Status::OK();
+}
+
 Status PyFuncOp::CastOutput(const py::object &ret_py_obj, TensorRow *output) {
   try {
     std::shared_ptr<Tensor> out;
@@ -58,6 +58,15 @@ class PyFuncOp : public TensorOp {
   bool IsRandom();
 
  private:
+  /// \brief Ship the row to the worker process of python multiprocessing through its shared row channel, the GIL is
+  ///     released while the worker runs the function. The GIL must be held by the caller.
+  /// \param[in] input The input row.
+  /// \param[out] output The result when it comes back as numeric tensors.
+  /// \param[out] ret_py_obj The result when it comes back as another python object.
+  /// \param[out] done false if the row is not shipped, then the function is to be called as usual.
+  /// \return Status
+  Status ComputeInWorker(const TensorRow &input, TensorRow *output, py::object *ret_py_obj, bool *done);
+
   py::function py_func_ptr_;
   DataType::Type output_type_;
 };
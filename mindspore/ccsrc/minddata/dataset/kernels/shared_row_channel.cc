@@ -0,0 +1,367 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/kernels/shared_row_channel.h"
+
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
+#include <semaphore.h>
+#include <sys/mman.h>
+#include <time.h>
+#endif
+#include <atomic>
+#include <cerrno>
+#include <new>
+#include <string>
+
+#include "./securec.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/util/task_manager.h"
+
+namespace mindspore {
+namespace dataset {
+#if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
+namespace {
+// the arrays and the payloads are aligned as numpy aligns its buffers
+constexpr size_t kAlignment = 64;
+// the waiting thread of a Call checks whether it is interrupted at this interval
+constexpr int32_t kCallWaitMs = 100;
+constexpr int64_t kMsPerSecond = 1000;
+constexpr int64_t kNsPerMs = 1000000;
+constexpr int64_t kNsPerSecond = 1000000000;
+
+size_t AlignUp(size_t n) { return (n + kAlignment - 1) / kAlignment * kAlignment; }
+
+// the header of an array in the payload of a slot, which is followed by the data of the array
+struct ArrayHeader {
+  int32_t type;
+  int32_t rank;
+  int64_t dims[SharedRowChannel::kMaxRank];
+  uint64_t nbytes;
+};
+}  // namespace
+
+struct SharedRowChannel::SlotHeader {
+  sem_t ready;
+  int32_t kind;
+  int32_t func_idx;
+  int32_t is_tuple;
+  int32_t num_arrays;
+  uint64_t size;  // size of the payload in use
+};
+
+struct SharedRowChannel::ChannelHeader {
+  std::atomic<int32_t> closed;
+  SlotHeader slots[2];
+};
+
+bool SharedRowChannel::IsSupported() { return true; }
+
+Status SharedRowChannel::Create(size_t slot_size, std::shared_ptr<SharedRowChannel> *out) {
+  RETURN_UNEXPECTED_IF_NULL(out);
+  CHECK_FAIL_RETURN_UNEXPECTED(slot_size > 0, "Invalid slot size of shared row channel: 0.");
+  slot_size = AlignUp(slot_size);
+  size_t mapped_size = AlignUp(sizeof(ChannelHeader)) + 2 * slot_size;
+  // the anonymous shared mapping is inherited by the worker processes forked later, and its pages are only allocated
+  // once they are touched
+  void *base = mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  CHECK_FAIL_RETURN_UNEXPECTED(base != MAP_FAILED, "Failed to map " + std::to_string(mapped_size) +
+                                                     " bytes of shared memory for shared row channel, errno: " +
+                                                     std::to_string(errno));
+  auto header = new (base) ChannelHeader();
+  header->closed.store(0);
+  for (auto &slot : header->slots) {
+    if (sem_init(&slot.ready, 1, 0) != 0) {
+      int err = errno;
+      (void)munmap(base, mapped_size);
+      RETURN_STATUS_UNEXPECTED("Failed to init the semaphore of shared row channel, errno: " + std::to_string(err));
+    }
+    slot.kind = kEmpty;
+  }
+  *out = std::shared_ptr<SharedRowChannel>(new SharedRowChannel(base, mapped_size, slot_size));
+  return Status::OK();
+}
+
+SharedRowChannel::SharedRowChannel(void *base, size_t mapped_size, size_t slot_size)
+    : base_(base), mapped_size_(mapped_size), slot_size_(slot_size) {}
+
+SharedRowChannel::~SharedRowChannel() {
+  // the semaphores are shared with the other processes, so they are not destroyed here
+  (void)munmap(base_, mapped_size_);
+}
+
+SharedRowChannel::SlotHeader *SharedRowChannel::GetSlot(Slot slot) const {
+  return &static_cast<ChannelHeader *>(base_)->slots[slot];
+}
+
+uchar *SharedRowChannel::GetPayload(Slot slot) const {
+  return static_cast<uchar *>(base_) + AlignUp(sizeof(ChannelHeader)) + static_cast<size_t>(slot) * slot_size_;
+}
+
+Status SharedRowChannel::PutArrays(Slot slot, int32_t func_idx, const std::vector<ArrayView> &arrays, bool is_tuple,
+                                   bool *put) {
+  RETURN_UNEXPECTED_IF_NULL(put);
+  *put = false;
+  size_t size = 0;
+  for (const auto &array : arrays) {
+    CHECK_FAIL_RETURN_UNEXPECTED(array.type.IsNumeric(),
+                                 "Only numeric arrays can be put into shared row channel, got: " +
+                                   array.type.ToString());
+    if (array.shape.Rank() > kMaxRank) {
+      return Status::OK();
+    }
+    size += AlignUp(sizeof(ArrayHeader)) + AlignUp(static_cast<size_t>(array.shape.NumOfElements()) *
+                                                   array.type.SizeInBytes());
+  }
+  if (size > slot_size_) {
+    return Status::OK();
+  }
+  uchar *payload = GetPayload(slot);
+  size_t offset = 0;
+  for (const auto &array : arrays) {
+    auto array_header = reinterpret_cast<ArrayHeader *>(payload + offset);
+    array_header->type = static_cast<int32_t>(array.type.value());
+    array_header->rank = static_cast<int32_t>(array.shape.Rank());
+    for (int32_t i = 0; i < array_header->rank; ++i) {
+      array_header->dims[i] = array.shape[i];
+    }
+    array_header->nbytes = static_cast<uint64_t>(array.shape.NumOfElements()) * array.type.SizeInBytes();
+    offset += AlignUp(sizeof(ArrayHeader));
+    if (array_header->nbytes > 0) {
+      RETURN_UNEXPECTED_IF_NULL(array.data);
+      errno_t ret = memcpy_s(payload + offset, slot_size_ - offset, array.data, array_header->nbytes);
+      CHECK_FAIL_RETURN_UNEXPECTED(ret == EOK, "Failed to copy array into shared row channel, error code: " +
+                                                 std::to_string(ret));
+    }
+    offset += AlignUp(array_header->nbytes);
+  }
+  SlotHeader *header = GetSlot(slot);
+  header->kind = kArrays;
+  header->func_idx = func_idx;
+  header->is_tuple = is_tuple ? 1 : 0;
+  header->num_arrays = static_cast<int32_t>(arrays.size());
+  header->size = offset;
+  CHECK_FAIL_RETURN_UNEXPECTED(sem_post(&header->ready) == 0,
+                               "Failed to signal shared row channel, errno: " + std::to_string(errno));
+  *put = true;
+  return Status::OK();
+}
+
+Status SharedRowChannel::PutBytes(Slot slot, int32_t func_idx, const char *bytes, size_t size, bool *put) {
+  RETURN_UNEXPECTED_IF_NULL(put);
+  *put = false;
+  if (size > slot_size_) {
+    return Status::OK();
+  }
+  if (size > 0) {
+    RETURN_UNEXPECTED_IF_NULL(bytes);
+    errno_t ret = memcpy_s(GetPayload(slot), slot_size_, bytes, size);
+    CHECK_FAIL_RETURN_UNEXPECTED(ret == EOK,
+                                 "Failed to copy bytes into shared row channel, error code: " + std::to_string(ret));
+  }
+  SlotHeader *header = GetSlot(slot);
+  header->kind = kBytes;
+  header->func_idx = func_idx;
+  header->is_tuple = 0;
+  header->num_arrays = 0;
+  header->size = size;
+  CHECK_FAIL_RETURN_UNEXPECTED(sem_post(&header->ready) == 0,
+                               "Failed to signal shared row channel, errno: " + std::to_string(errno));
+  *put = true;
+  return Status::OK();
+}
+
+Status SharedRowChannel::PutOverflow(Slot slot, int32_t func_idx) {
+  SlotHeader *header = GetSlot(slot);
+  header->kind = kOverflow;
+  header->func_idx = func_idx;
+  header->is_tuple = 0;
+  header->num_arrays = 0;
+  header->size = 0;
+  CHECK_FAIL_RETURN_UNEXPECTED(sem_post(&header->ready) == 0,
+                               "Failed to signal shared row channel, errno: " + std::to_string(errno));
+  return Status::OK();
+}
+
+Status SharedRowChannel::Wait(Slot slot, int32_t timeout_ms, bool *ready) {
+  RETURN_UNEXPECTED_IF_NULL(ready);
+  *ready = false;
+  struct timespec deadline {};
+  CHECK_FAIL_RETURN_UNEXPECTED(clock_gettime(CLOCK_REALTIME, &deadline) == 0,
+                               "Failed to get the time, errno: " + std::to_string(errno));
+  int64_t nsec = static_cast<int64_t>(deadline.tv_nsec) + (timeout_ms % kMsPerSecond) * kNsPerMs;
+  deadline.tv_sec += static_cast<time_t>(timeout_ms / kMsPerSecond + nsec / kNsPerSecond);
+  deadline.tv_nsec = static_cast<decltype(deadline.tv_nsec)>(nsec % kNsPerSecond);
+  while (sem_timedwait(&GetSlot(slot)->ready, &deadline) != 0) {
+    if (errno == ETIMEDOUT) {
+      return Status::OK();
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED(errno == EINTR, "Failed to wait for shared row channel, errno: " +
+                                                   std::to_string(errno));
+  }
+  *ready = !IsClosed();
+  return Status::OK();
+}
+
+SharedRowChannel::Kind SharedRowChannel::GetKind(Slot slot) const { return static_cast<Kind>(GetSlot(slot)->kind); }
+
+int32_t SharedRowChannel::GetFuncIdx(Slot slot) const { return GetSlot(slot)->func_idx; }
+
+bool SharedRowChannel::IsTuple(Slot slot) const { return GetSlot(slot)->is_tuple != 0; }
+
+Status SharedRowChannel::GetArrays(Slot slot, std::vector<ArrayView> *arrays) const {
+  RETURN_UNEXPECTED_IF_NULL(arrays);
+  const SlotHeader *header = GetSlot(slot);
+  CHECK_FAIL_RETURN_UNEXPECTED(header->kind == kArrays, "Shared row channel does not hold arrays.");
+  arrays->clear();
+  const uchar *payload = GetPayload(slot);
+  size_t offset = 0;
+  for (int32_t i = 0; i < header->num_arrays; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED(offset + sizeof(ArrayHeader) <= header->size, "Shared row channel is corrupted.");
+    auto array_header = reinterpret_cast<const ArrayHeader *>(payload + offset);
+    CHECK_FAIL_RETURN_UNEXPECTED(array_header->rank >= 0 && array_header->rank <= kMaxRank,
+                                 "Shared row channel is corrupted.");
+    offset += AlignUp(sizeof(ArrayHeader));
+    std::vector<dsize_t> dims(array_header->dims, array_header->dims + array_header->rank);
+    arrays->push_back(ArrayView{DataType(static_cast<DataType::Type>(array_header->type)), TensorShape(dims),
+                                payload + offset});
+    offset += AlignUp(array_header->nbytes);
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(offset <= header->size, "Shared row channel is corrupted.");
+  return Status::OK();
+}
+
+Status SharedRowChannel::GetBytes(Slot slot, const char **bytes, size_t *size) const {
+  RETURN_UNEXPECTED_IF_NULL(bytes);
+  RETURN_UNEXPECTED_IF_NULL(size);
+  const SlotHeader *header = GetSlot(slot);
+  CHECK_FAIL_RETURN_UNEXPECTED(header->kind == kBytes, "Shared row channel does not hold bytes.");
+  *bytes = reinterpret_cast<const char *>(GetPayload(slot));
+  *size = header->size;
+  return Status::OK();
+}
+
+Status SharedRowChannel::Call(int32_t func_idx, const TensorRow &input, TensorRow *output, Kind *kind) {
+  RETURN_UNEXPECTED_IF_NULL(output);
+  RETURN_UNEXPECTED_IF_NULL(kind);
+  *kind = kEmpty;
+  std::vector<ArrayView> arrays;
+  arrays.reserve(input.size());
+  for (const auto &tensor : input) {
+    RETURN_UNEXPECTED_IF_NULL(tensor);
+    if (!tensor->type().IsNumeric()) {
+      return Status::OK();
+    }
+    arrays.push_back(ArrayView{tensor->type(), tensor->shape(), tensor->GetBuffer()});
+  }
+  bool put = false;
+  RETURN_IF_NOT_OK(PutArrays(kRequest, func_idx, arrays, true, &put));
+  if (!put) {
+    return Status::OK();
+  }
+  bool ready = false;
+  while (!ready) {
+    RETURN_IF_NOT_OK(Wait(kResponse, kCallWaitMs, &ready));
+    if (!ready) {
+      if (IsClosed()) {
+        return Status::OK();
+      }
+      Task *task = TaskManager::FindMe();
+      if (task != nullptr && task->Interrupted()) {
+        return Status(StatusCode::kMDInterrupted);
+      }
+    }
+  }
+  *kind = GetKind(kResponse);
+  if (*kind != kArrays) {
+    return Status::OK();
+  }
+  RETURN_IF_NOT_OK(GetArrays(kResponse, &arrays));
+  for (const auto &array : arrays) {
+    std::shared_ptr<Tensor> tensor;
+    RETURN_IF_NOT_OK(Tensor::CreateFromMemory(array.shape, array.type, array.data, &tensor));
+    output->push_back(tensor);
+  }
+  return Status::OK();
+}
+
+void SharedRowChannel::Close() {
+  auto header = static_cast<ChannelHeader *>(base_);
+  if (header->closed.exchange(1) == 0) {
+    for (auto &slot : header->slots) {
+      (void)sem_post(&slot.ready);
+    }
+  }
+}
+
+bool SharedRowChannel::IsClosed() const { return static_cast<ChannelHeader *>(base_)->closed.load() != 0; }
+#else
+struct SharedRowChannel::SlotHeader {};
+
+bool SharedRowChannel::IsSupported() { return false; }
+
+Status SharedRowChannel::Create(size_t slot_size, std::shared_ptr<SharedRowChannel> *out) {
+  RETURN_STATUS_UNEXPECTED("Shared row channel is not supported on this platform.");
+}
+
+SharedRowChannel::SharedRowChannel(void *base, size_t mapped_size, size_t slot_size)
+    : base_(base), mapped_size_(mapped_size), slot_size_(slot_size) {}
+
+SharedRowChannel::~SharedRowChannel() = default;
+
+SharedRowChannel::SlotHeader *SharedRowChannel::GetSlot(Slot slot) const { return nullptr; }
+
+uchar *SharedRowChannel::GetPayload(Slot slot) const { return nullptr; }
+
+Status SharedRowChannel::PutArrays(Slot slot, int32_t func_idx, const std::vector<ArrayView> &arrays, bool is_tuple,
+                                   bool *put) {
+  RETURN_STATUS_UNEXPECTED("Shared row channel is not supported on this platform.");
+}
+
+Status SharedRowChannel::PutBytes(Slot slot, int32_t func_idx, const char *bytes, size_t size, bool *put) {
+  RETURN_STATUS_UNEXPECTED("Shared row channel is not supported on this platform.");
+}
+
+Status SharedRowChannel::PutOverflow(Slot slot, int32_t func_idx) {
+  RETURN_STATUS_UNEXPECTED("Shared row channel is not supported on this platform.");
+}
+
+Status SharedRowChannel::Wait(Slot slot, int32_t timeout_ms, bool *ready) {
+  RETURN_STATUS_UNEXPECTED("Shared row channel is not supported on this platform.");
+}
+
+SharedRowChannel::Kind SharedRowChannel::GetKind(Slot slot) const { return kEmpty; }
+
+int32_t SharedRowChannel::GetFuncIdx(Slot slot) const { return 0; }
+
+bool SharedRowChannel::IsTuple(Slot slot) const { return false; }
+
+Status SharedRowChannel::GetArrays(Slot slot, std::vector<ArrayView> *arrays) const {
+  RETURN_STATUS_UNEXPECTED("Shared row channel is not supported on this platform.");
+}
+
+Status SharedRowChannel::GetBytes(Slot slot, const char **bytes, size_t *size) const {
+  RETURN_STATUS_UNEXPECTED("Shared row channel is not supported on this platform.");
+}
+
+Status SharedRowChannel::Call(int32_t func_idx, const TensorRow &input, TensorRow *output, Kind *kind) {
+  RETURN_STATUS_UNEXPECTED("Shared row channel is not supported on this platform.");
+}
+
+void SharedRowChannel::Close() {}
+
+bool SharedRowChannel::IsClosed() const { return true; }
+#endif
+}  // namespace dataset
+}  // namespace mindspore
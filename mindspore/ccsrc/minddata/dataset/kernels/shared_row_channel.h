@@ -0,0 +1,144 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_SHARED_ROW_CHANNEL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_SHARED_ROW_CHANNEL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "minddata/dataset/core/data_type.h"
+#include "minddata/dataset/core/tensor_row.h"
+#include "minddata/dataset/core/tensor_shape.h"
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief A channel in shared memory between a thread of the pipeline and the worker process of python
+///     multiprocessing it ships rows to. The request slot carries a row to the worker and the response slot carries
+///     the result back, each slot holds one row at a time. The numeric arrays of a row are copied into the slot and
+///     read in place by the other side, so they are neither pickled nor sent through a pipe. The memory is mapped
+///     before the worker is forked and the slots are signalled by process-shared semaphores, so a thread waits for
+///     the worker without holding the GIL.
+class SharedRowChannel {
+ public:
+  /// \brief The slots of the channel.
+  enum Slot : int32_t { kRequest = 0, kResponse = 1 };
+
+  /// \brief What a slot holds.
+  enum Kind : int32_t {
+    kEmpty = 0,     // nothing, e.g. the row is not sent
+    kArrays = 1,    // numeric arrays
+    kBytes = 2,     // a row serialized by the caller
+    kOverflow = 3,  // a row larger than the slot, which is sent by the caller in another way
+  };
+
+  /// \brief A numeric array in a slot or to be put into a slot.
+  struct ArrayView {
+    DataType type;
+    TensorShape shape;
+    const uchar *data;
+  };
+
+  /// \brief The maximum rank of the arrays in a slot, an array of higher rank is not put.
+  static constexpr int32_t kMaxRank = 8;
+
+  /// \brief Whether the channel is supported on this platform.
+  static bool IsSupported();
+
+  /// \brief Create a channel.
+  /// \param[in] slot_size The size in bytes of the payload of each slot.
+  /// \param[out] out The channel created.
+  /// \return Status code.
+  static Status Create(size_t slot_size, std::shared_ptr<SharedRowChannel> *out);
+
+  SharedRowChannel(const SharedRowChannel &) = delete;
+
+  SharedRowChannel &operator=(const SharedRowChannel &) = delete;
+
+  ~SharedRowChannel();
+
+  /// \brief Put arrays into a slot and signal the other side.
+  /// \param[in] slot The slot to put into.
+  /// \param[in] func_idx The index of the function, which is passed along with the row.
+  /// \param[in] arrays The arrays, which are copied into the slot.
+  /// \param[in] is_tuple Whether the arrays are a tuple rather than a single array.
+  /// \param[out] put false if the arrays do not fit into the slot, nothing is put then.
+  /// \return Status code.
+  Status PutArrays(Slot slot, int32_t func_idx, const std::vector<ArrayView> &arrays, bool is_tuple, bool *put);
+
+  /// \brief Put serialized bytes into a slot and signal the other side.
+  /// \param[out] put false if the bytes do not fit into the slot, nothing is put then.
+  Status PutBytes(Slot slot, int32_t func_idx, const char *bytes, size_t size, bool *put);
+
+  /// \brief Signal the other side that the row of a slot is sent in another way.
+  Status PutOverflow(Slot slot, int32_t func_idx);
+
+  /// \brief Wait until the other side has put into a slot.
+  /// \param[in] slot The slot to wait for.
+  /// \param[in] timeout_ms The timeout in milliseconds.
+  /// \param[out] ready false if timed out or the channel is closed.
+  /// \return Status code.
+  Status Wait(Slot slot, int32_t timeout_ms, bool *ready);
+
+  /// \brief The kind of the content of a slot, valid after a Wait of it.
+  Kind GetKind(Slot slot) const;
+
+  /// \brief The index of the function passed along with the content of a slot.
+  int32_t GetFuncIdx(Slot slot) const;
+
+  /// \brief Whether the arrays of a slot are a tuple rather than a single array.
+  bool IsTuple(Slot slot) const;
+
+  /// \brief Get the arrays of a slot, which point into the slot and are valid until the slot is put into again.
+  Status GetArrays(Slot slot, std::vector<ArrayView> *arrays) const;
+
+  /// \brief Get the bytes of a slot, which point into the slot and are valid until the slot is put into again.
+  Status GetBytes(Slot slot, const char **bytes, size_t *size) const;
+
+  /// \brief Ship a row to the worker and wait for the result. The GIL must not be held by the caller.
+  /// \param[in] func_idx The index of the function to run in the worker.
+  /// \param[in] input The row to ship.
+  /// \param[out] output The result when it comes back as numeric arrays.
+  /// \param[out] kind The kind of the response, which is left in the response slot unless it is kArrays. kEmpty if
+  ///     the row is not shipped because it is not numeric or too large, or if the channel is closed.
+  /// \return Status code.
+  Status Call(int32_t func_idx, const TensorRow &input, TensorRow *output, Kind *kind);
+
+  /// \brief Close the channel and wake up the waiters of both sides.
+  void Close();
+
+  /// \brief Whether the channel is closed by either side.
+  bool IsClosed() const;
+
+ private:
+  struct SlotHeader;
+  struct ChannelHeader;
+
+  SharedRowChannel(void *base, size_t mapped_size, size_t slot_size);
+
+  SlotHeader *GetSlot(Slot slot) const;
+
+  uchar *GetPayload(Slot slot) const;
+
+  void *base_;
+  size_t mapped_size_;
+  size_t slot_size_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_KERNELS_SHARED_ROW_CHANNEL_H_
@@ -15,6 +15,8 @@
  */
 #include "minddata/dataset/kernels/tensor_op.h"
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace mindspore {
@@ -54,6 +56,62 @@ Status TensorOp::Compute(const std::shared_ptr<DeviceTensor> &input, std::shared
                 "different device. If so, please implement it in the derived class.");
 }
 
+// Name: BatchCompute()
+// Description: This BatchCompute() unstacks the samples of the batched columns, calls Compute() on each of them and
+//              stacks the results. The derived class can override it to process the whole batch at once.
+Status TensorOp::BatchCompute(const TensorRow &input, TensorRow *output) {
+  IO_CHECK_VECTOR(input, output);
+  dsize_t batch_size = input[0]->Rank() > 0 ? input[0]->shape()[0] : 0;
+  for (const auto &tensor : input) {
+    RETURN_UNEXPECTED_IF_NULL(tensor);
+    CHECK_FAIL_RETURN_UNEXPECTED(tensor->type().IsNumeric() && tensor->Rank() > 0,
+                                 Name() + ": the batched input should be numeric tensors of at least 1 dimension, "
+                                          "but got type: " + tensor->type().ToString() +
+                                   ", rank: " + std::to_string(tensor->Rank()));
+    CHECK_FAIL_RETURN_UNEXPECTED(tensor->shape()[0] == batch_size && batch_size > 0,
+                                 Name() + ": the batched input should have the same positive batch size, but got: " +
+                                   std::to_string(batch_size) + " and " + std::to_string(tensor->shape()[0]));
+  }
+  std::vector<TensorRow> results(batch_size);
+  for (dsize_t i = 0; i < batch_size; i++) {
+    TensorRow sample;
+    for (const auto &tensor : input) {
+      std::vector<dsize_t> sample_shape = tensor->shape().AsVector();
+      (void)sample_shape.erase(sample_shape.begin());
+      auto sample_bytes = static_cast<dsize_t>(tensor->SizeInBytes()) / batch_size;
+      std::shared_ptr<Tensor> sample_tensor;
+      RETURN_IF_NOT_OK(Tensor::CreateFromMemory(TensorShape(sample_shape), tensor->type(),
+                                                tensor->GetBuffer() + i * sample_bytes, &sample_tensor));
+      sample.push_back(std::move(sample_tensor));
+    }
+    RETURN_IF_NOT_OK(Compute(sample, &results[i]));
+  }
+
+  for (size_t col = 0; col < results[0].size(); col++) {
+    const auto &first = results[0][col];
+    std::vector<dsize_t> batch_shape = first->shape().AsVector();
+    (void)batch_shape.insert(batch_shape.begin(), batch_size);
+    CHECK_FAIL_RETURN_UNEXPECTED(first->type().IsNumeric(),
+                                 Name() + ": the output of each sample should be numeric to be stacked, but got: " +
+                                   first->type().ToString());
+    std::shared_ptr<Tensor> batch;
+    RETURN_IF_NOT_OK(Tensor::CreateEmpty(TensorShape(batch_shape), first->type(), &batch));
+    for (dsize_t i = 0; i < batch_size; i++) {
+      CHECK_FAIL_RETURN_UNEXPECTED(results[i].size() == results[0].size(),
+                                   Name() + ": the output of each sample should have the same number of columns.");
+      const auto &tensor = results[i][col];
+      CHECK_FAIL_RETURN_UNEXPECTED(tensor->shape() == first->shape() && tensor->type() == first->type(),
+                                   Name() + ": the output of each sample should have the same shape and type to be "
+                                            "stacked, but got: " + first->shape().ToString() + " " +
+                                     first->type().ToString() + " and " + tensor->shape().ToString() + " " +
+                                     tensor->type().ToString());
+      RETURN_IF_NOT_OK(batch->InsertTensor({i}, tensor));
+    }
+    output->push_back(std::move(batch));
+  }
+  return Status::OK();
+}
+
 Status TensorOp::OutputShape(const std::vector<TensorShape> &inputs, std::vector<TensorShape> &outputs) {
   if (inputs.size() != NumInput()) {
     return Status(StatusCode::kMDUnexpectedError,
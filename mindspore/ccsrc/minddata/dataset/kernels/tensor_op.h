@@ -96,6 +96,7 @@ constexpr char kRandomColorOp[] = "RandomColorOp";
 constexpr char kRandomCropAndResizeOp[] = "RandomCropAndResizeOp";
 constexpr char kRandomCropAndResizeWithBBoxOp[] = "RandomCropAndResizeWithBBoxOp";
 constexpr char kRandomCropDecodeResizeOp[] = "RandomCropDecodeResizeOp";
+constexpr char kRandomCropDecodeResizeNormalizeOp[] = "RandomCropDecodeResizeNormalizeOp";
 constexpr char kRandomCropOp[] = "RandomCropOp";
 constexpr char kRandomCropWithBBoxOp[] = "RandomCropWithBBoxOp";
 constexpr char kRandomEqualizeOp[] = "RandomEqualizeOp";
@@ -262,6 +263,14 @@ class TensorOp {
   // @return Status
   virtual Status Compute(const std::shared_ptr<DeviceTensor> &input, std::shared_ptr<DeviceTensor> *output);
 
+  // Perform an operation on a batch of rows, where each tensor of input is the samples of one column stacked along
+  // the first dimension, like the output of BatchOp. The derived class can override it to process the whole batch in
+  // one call, otherwise the samples are unstacked, passed to Compute() one by one and the results are stacked again.
+  // @param input is a vector of the batched tensors of the columns, which have the same size of the first dimension.
+  // @param output is the address to an empty vector where the batched results will be placed.
+  // @return Status
+  virtual Status BatchCompute(const TensorRow &input, TensorRow *output);
+
   // Returns true oif the TensorOp takes one input and returns one output.
   // @return true/false
   bool OneToOne() { return NumInput() == 1 && NumOutput() == 1; }
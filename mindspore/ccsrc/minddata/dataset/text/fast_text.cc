@@ -22,6 +22,8 @@ namespace mindspore {
 namespace dataset {
 FastText::FastText(const std::unordered_map<std::string, std::vector<float>> &map, int32_t dim) : Vectors(map, dim) {}
 
+FastText::FastText(const std::shared_ptr<VectorsBinary> &binary) : Vectors(binary) {}
+
 Status CheckFastText(const std::string &file_path) {
   Path path = Path(file_path);
   if (path.Exists() && !path.IsDirectory()) {
@@ -39,6 +41,12 @@ Status CheckFastText(const std::string &file_path) {
 
 Status FastText::BuildFromFile(std::shared_ptr<FastText> *fast_text, const std::string &path, int32_t max_vectors) {
   RETURN_UNEXPECTED_IF_NULL(fast_text);
+  if (VectorsBinary::IsBinaryFile(path)) {
+    std::shared_ptr<VectorsBinary> binary;
+    RETURN_IF_NOT_OK(LoadBinary(path, max_vectors, &binary));
+    *fast_text = std::make_shared<FastText>(binary);
+    return Status::OK();
+  }
   RETURN_IF_NOT_OK(CheckFastText(path));
   std::unordered_map<std::string, std::vector<float>> map;
   int vector_dim = -1;
@@ -22,6 +22,8 @@ namespace mindspore {
 namespace dataset {
 GloVe::GloVe(const std::unordered_map<std::string, std::vector<float>> &map, int32_t dim) : Vectors(map, dim) {}
 
+GloVe::GloVe(const std::shared_ptr<VectorsBinary> &binary) : Vectors(binary) {}
+
 Status CheckGloVe(const std::string &file_path) {
   Path path = Path(file_path);
   if (path.Exists() && !path.IsDirectory()) {
@@ -45,6 +47,12 @@ Status CheckGloVe(const std::string &file_path) {
 
 Status GloVe::BuildFromFile(std::shared_ptr<GloVe> *glove, const std::string &path, int32_t max_vectors) {
   RETURN_UNEXPECTED_IF_NULL(glove);
+  if (VectorsBinary::IsBinaryFile(path)) {
+    std::shared_ptr<VectorsBinary> binary;
+    RETURN_IF_NOT_OK(LoadBinary(path, max_vectors, &binary));
+    *glove = std::make_shared<GloVe>(binary);
+    return Status::OK();
+  }
   RETURN_IF_NOT_OK(CheckGloVe(path));
   std::unordered_map<std::string, std::vector<float>> map;
   int vector_dim = -1;
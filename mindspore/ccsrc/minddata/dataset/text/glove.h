@@ -41,6 +41,10 @@ class GloVe : public Vectors {
   /// \param[in] dim Dimension of the vectors.
   GloVe(const std::unordered_map<std::string, std::vector<float>> &map, int32_t dim);
 
+  /// Constructor.
+  /// \param[in] binary The vectors mapped from a binary vectors file.
+  explicit GloVe(const std::shared_ptr<VectorsBinary> &binary);
+
   /// Destructor.
   ~GloVe() = default;
 
@@ -48,6 +52,8 @@ class GloVe : public Vectors {
   /// \param[out] glove GloVe object which contains the pre-train vectors.
   /// \param[in] path Path to the pre-trained word vector file.
   /// \param[in] max_vectors This can be used to limit the number of pre-trained vectors loaded (default=0, no limit).
+  /// \note The binary vectors file generated by Vectors::ConvertToBinary is mapped instead of parsed, and its name is
+  ///     not checked.
   static Status BuildFromFile(std::shared_ptr<GloVe> *glove, const std::string &path, int32_t max_vectors = 0);
 };
 }  // namespace dataset
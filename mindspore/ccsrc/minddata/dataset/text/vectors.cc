@@ -119,8 +119,36 @@ Vectors::Vectors(const std::unordered_map<std::string, std::vector<float>> &map,
   dim_ = dim;
 }
 
+Vectors::Vectors(const std::shared_ptr<VectorsBinary> &binary) : dim_(binary->Dim()), binary_(binary) {}
+
+Status Vectors::LoadBinary(const std::string &path, int32_t max_vectors, std::shared_ptr<VectorsBinary> *binary) {
+  RETURN_UNEXPECTED_IF_NULL(binary);
+  if (max_vectors > 0) {
+    MS_LOG(WARNING) << "Vectors: max_vectors is ignored for the binary vectors file, "
+                    << "it should be set when the file is converted.";
+  }
+  std::unique_ptr<VectorsBinary> result;
+  RETURN_IF_NOT_OK(VectorsBinary::Load(path, &result));
+  *binary = std::move(result);
+  return Status::OK();
+}
+
+Status Vectors::ConvertToBinary(const std::string &path, const std::string &binary_path, int32_t max_vectors) {
+  std::unordered_map<std::string, std::vector<float>> map;
+  int vector_dim = -1;
+  RETURN_IF_NOT_OK(Load(path, max_vectors, &map, &vector_dim));
+  RETURN_IF_NOT_OK(VectorsBinary::Write(map, vector_dim, binary_path));
+  return Status::OK();
+}
+
 Status Vectors::BuildFromFile(std::shared_ptr<Vectors> *vectors, const std::string &path, int32_t max_vectors) {
   RETURN_UNEXPECTED_IF_NULL(vectors);
+  if (VectorsBinary::IsBinaryFile(path)) {
+    std::shared_ptr<VectorsBinary> binary;
+    RETURN_IF_NOT_OK(LoadBinary(path, max_vectors, &binary));
+    *vectors = std::make_shared<Vectors>(binary);
+    return Status::OK();
+  }
   std::unordered_map<std::string, std::vector<float>> map;
   int vector_dim = -1;
   RETURN_IF_NOT_OK(Load(path, max_vectors, &map, &vector_dim));
@@ -142,12 +170,20 @@ std::vector<float> Vectors::Lookup(const std::string &token, const std::vector<f
   if (lower_case_backup) {
     transform(lower_token.begin(), lower_token.end(), lower_token.begin(), ::tolower);
   }
-  auto str_index = map_.find(lower_token);
-  if (str_index == map_.end()) {
+  const float *vector = Find(lower_token);
+  if (vector == nullptr) {
     return init_vec;
   } else {
-    return str_index->second;
+    return std::vector<float>(vector, vector + dim_);
+  }
+}
+
+const float *Vectors::Find(const std::string &token) const {
+  if (binary_ != nullptr) {
+    return binary_->Find(token);
   }
+  auto str_index = map_.find(token);
+  return str_index == map_.end() ? nullptr : str_index->second.data();
 }
 }  // namespace dataset
 }  // namespace mindspore
@@ -28,6 +28,7 @@
 
 #include "minddata/dataset/core/tensor.h"
 #include "minddata/dataset/include/dataset/iterator.h"
+#include "minddata/dataset/text/vectors_binary.h"
 
 namespace mindspore {
 namespace dataset {
@@ -42,6 +43,10 @@ class Vectors {
   /// \param[in] dim Dimension of the vectors.
   Vectors(const std::unordered_map<std::string, std::vector<float>> &map, int32_t dim);
 
+  /// Constructor.
+  /// \param[in] binary The vectors mapped from a binary vectors file.
+  explicit Vectors(const std::shared_ptr<VectorsBinary> &binary);
+
   /// Destructor.
   virtual ~Vectors() = default;
 
@@ -49,8 +54,18 @@ class Vectors {
   /// \param[out] vectors Vectors object which contains the pre-train vectors.
   /// \param[in] path Path to the pre-trained word vector file.
   /// \param[in] max_vectors This can be used to limit the number of pre-trained vectors loaded (default=0, no limit).
+  /// \note The binary vectors file generated by ConvertToBinary is mapped instead of parsed, and max_vectors is
+  ///     ignored since the vectors are limited when the file is converted.
   static Status BuildFromFile(std::shared_ptr<Vectors> *vectors, const std::string &path, int32_t max_vectors = 0);
 
+  /// \brief Convert a pre-train vector file to the binary format, which can be loaded by the BuildFromFile of
+  ///     Vectors, GloVe and FastText without parsing.
+  /// \param[in] path Path to the pre-trained word vector file.
+  /// \param[in] binary_path Path to the binary vectors file to write.
+  /// \param[in] max_vectors This can be used to limit the number of pre-trained vectors converted
+  ///     (default=0, no limit).
+  static Status ConvertToBinary(const std::string &path, const std::string &binary_path, int32_t max_vectors = 0);
+
   /// \brief Look up embedding vectors of token.
   /// \param[in] token A token to be looked up.
   /// \param[in] unk_init In case of the token is out-of-vectors (OOV), the result will be initialized with `unk_init`.
@@ -81,8 +96,19 @@ class Vectors {
   static Status Load(const std::string &path, int32_t max_vectors,
                      std::unordered_map<std::string, std::vector<float>> *map, int32_t *vector_dim);
 
+  /// \brief Map a binary vectors file generated by ConvertToBinary.
+  /// \param[in] path Path to the binary vectors file.
+  /// \param[in] max_vectors It is only used to warn that the limit is ignored.
+  /// \param[out] binary The mapped vectors.
+  static Status LoadBinary(const std::string &path, int32_t max_vectors, std::shared_ptr<VectorsBinary> *binary);
+
+  /// \brief Find the vector of token in the map or the binary vectors.
+  /// \return The address of the vector, nullptr if the token does not exist.
+  const float *Find(const std::string &token) const;
+
   int32_t dim_;
   std::unordered_map<std::string, std::vector<float>> map_;
+  std::shared_ptr<VectorsBinary> binary_;  // the mapped vectors, map_ is empty when it is not nullptr
 };
 }  // namespace dataset
 }  // namespace mindspore
@@ -0,0 +1,201 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/text/vectors_binary.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <sys/stat.h>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string_view>
+#include <utility>
+
+#include "utils/file_utils.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+const uint64_t kWordLen = sizeof(uint64_t);
+// magic, dimension, number of vectors and size of tokens
+const uint64_t kHeaderWords = 4;
+
+uint64_t WordCount(uint64_t bytes) { return (bytes + kWordLen - 1) / kWordLen; }
+
+void WritePadding(uint64_t bytes, std::ofstream *out) {
+  const char padding[kWordLen] = {0};
+  uint64_t padding_len = WordCount(bytes) * kWordLen - bytes;
+  if (padding_len > 0) {
+    (void)out->write(padding, static_cast<std::streamsize>(padding_len));
+  }
+}
+}  // namespace
+
+VectorsBinary::~VectorsBinary() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (mapped_ && munmap(const_cast<uint8_t *>(data_), size_) != 0) {
+    MS_LOG(ERROR) << "Vectors: failed to unmap binary vectors file, errno: " << errno;
+  }
+#endif
+}
+
+Status VectorsBinary::Write(const std::unordered_map<std::string, std::vector<float>> &map, int32_t dim,
+                            const std::string &path) {
+  CHECK_FAIL_RETURN_UNEXPECTED(dim > 0, "Vectors: dimension of vectors must be positive, but got: " +
+                                          std::to_string(dim));
+  std::vector<std::pair<const std::string *, const std::vector<float> *>> items;
+  items.reserve(map.size());
+  uint64_t token_size = 0;
+  for (const auto &item : map) {
+    CHECK_FAIL_RETURN_UNEXPECTED(item.second.size() == static_cast<size_t>(dim),
+                                 "Vectors: all vectors must have the same number of dimensions, but got dim " +
+                                   std::to_string(item.second.size()) + " while expecting " + std::to_string(dim));
+    items.emplace_back(&item.first, &item.second);
+    token_size += item.first.size();
+  }
+  std::sort(items.begin(), items.end(), [](const auto &a, const auto &b) { return *a.first < *b.first; });
+
+  std::ofstream out(path, std::ios::out | std::ios::binary | std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED(out.is_open(), "Vectors: invalid file, failed to open binary vectors file: " + path);
+  const uint64_t header[kHeaderWords - 1] = {static_cast<uint64_t>(dim), static_cast<uint64_t>(items.size()),
+                                             token_size};
+  (void)out.write(kVectorsBinaryMagic, kWordLen);
+  (void)out.write(reinterpret_cast<const char *>(header), sizeof(header));
+  for (const auto &item : items) {
+    (void)out.write(reinterpret_cast<const char *>(item.second->data()),
+                    static_cast<std::streamsize>(item.second->size() * sizeof(float)));
+  }
+  WritePadding(items.size() * dim * sizeof(float), &out);
+  uint64_t offset = 0;
+  (void)out.write(reinterpret_cast<const char *>(&offset), kWordLen);
+  for (const auto &item : items) {
+    offset += item.first->size();
+    (void)out.write(reinterpret_cast<const char *>(&offset), kWordLen);
+  }
+  for (const auto &item : items) {
+    (void)out.write(item.first->data(), static_cast<std::streamsize>(item.first->size()));
+  }
+  WritePadding(token_size, &out);
+  out.close();
+  CHECK_FAIL_RETURN_UNEXPECTED(!out.fail(), "Vectors: failed to write binary vectors file: " + path);
+  return Status::OK();
+}
+
+bool VectorsBinary::IsBinaryFile(const std::string &path) {
+  std::ifstream in(path, std::ios::in | std::ios::binary);
+  char magic[kWordLen] = {0};
+  if (!in.read(magic, kWordLen)) {
+    return false;
+  }
+  return memcmp(magic, kVectorsBinaryMagic, kWordLen) == 0;
+}
+
+Status VectorsBinary::Load(const std::string &path, std::unique_ptr<VectorsBinary> *binary) {
+  RETURN_UNEXPECTED_IF_NULL(binary);
+  auto realpath = FileUtils::GetRealPath(common::SafeCStr(path));
+  CHECK_FAIL_RETURN_UNEXPECTED(realpath.has_value(), "Vectors: get real path failed, path: " + path);
+  auto file_path = realpath.value();
+  auto result = std::make_unique<VectorsBinary>();
+#if !defined(_WIN32) && !defined(_WIN64)
+  int fd = open(file_path.c_str(), O_RDONLY);
+  CHECK_FAIL_RETURN_UNEXPECTED(fd >= 0, "Vectors: invalid file, failed to open binary vectors file: " + file_path);
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size < static_cast<off_t>(kHeaderWords * kWordLen)) {
+    (void)close(fd);
+    RETURN_STATUS_UNEXPECTED("Vectors: invalid file, binary vectors file is truncated: " + file_path);
+  }
+  auto length = static_cast<uint64_t>(file_stat.st_size);
+  // the pages are shared by all the processes which map the same file
+  void *addr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+  (void)close(fd);
+  CHECK_FAIL_RETURN_UNEXPECTED(addr != MAP_FAILED, "Vectors: failed to map binary vectors file, errno: " +
+                                                     std::to_string(errno) + ". Please check file: " + file_path);
+  result->data_ = reinterpret_cast<const uint8_t *>(addr);
+  result->size_ = length;
+  result->mapped_ = true;
+#else
+  std::ifstream in(file_path, std::ios::in | std::ios::binary | std::ios::ate);
+  CHECK_FAIL_RETURN_UNEXPECTED(in.good(), "Vectors: invalid file, failed to open binary vectors file: " + file_path);
+  auto length = static_cast<uint64_t>(in.tellg());
+  result->buffer_.resize(WordCount(length));
+  (void)in.seekg(0, std::ios::beg);
+  (void)in.read(reinterpret_cast<char *>(result->buffer_.data()), static_cast<std::streamsize>(length));
+  CHECK_FAIL_RETURN_UNEXPECTED(in.good(), "Vectors: failed to read binary vectors file: " + file_path);
+  result->data_ = reinterpret_cast<const uint8_t *>(result->buffer_.data());
+  result->size_ = length;
+#endif
+  RETURN_IF_NOT_OK(result->Parse(file_path));
+  *binary = std::move(result);
+  return Status::OK();
+}
+
+Status VectorsBinary::Parse(const std::string &path) {
+  const auto *words = reinterpret_cast<const uint64_t *>(data_);
+  const uint64_t word_count = size_ / kWordLen;
+  CHECK_FAIL_RETURN_UNEXPECTED(word_count >= kHeaderWords && memcmp(data_, kVectorsBinaryMagic, kWordLen) == 0,
+                               "Vectors: invalid file, it is not a binary vectors file: " + path);
+  dim_ = words[1];
+  count_ = words[2];
+  const uint64_t token_size = words[3];
+  CHECK_FAIL_RETURN_UNEXPECTED(dim_ > 0 && dim_ <= std::numeric_limits<int32_t>::max(),
+                               "Vectors: invalid file, dimension of binary vectors file is invalid: " + path);
+  // each section is checked against the remaining words, so that the sizes can not overflow
+  uint64_t offset = kHeaderWords;
+  CHECK_FAIL_RETURN_UNEXPECTED(count_ <= (word_count - offset) * kWordLen / sizeof(float) / dim_,
+                               "Vectors: invalid file, binary vectors file is truncated: " + path);
+  vectors_ = reinterpret_cast<const float *>(words + offset);
+  offset += WordCount(count_ * dim_ * sizeof(float));
+  CHECK_FAIL_RETURN_UNEXPECTED(count_ + 1 <= word_count - offset,
+                               "Vectors: invalid file, binary vectors file is truncated: " + path);
+  token_offsets_ = words + offset;
+  offset += count_ + 1;
+  CHECK_FAIL_RETURN_UNEXPECTED(WordCount(token_size) == word_count - offset,
+                               "Vectors: invalid file, binary vectors file is truncated: " + path);
+  tokens_ = reinterpret_cast<const char *>(words + offset);
+  CHECK_FAIL_RETURN_UNEXPECTED(token_offsets_[0] == 0 && token_offsets_[count_] == token_size,
+                               "Vectors: invalid file, token offsets of binary vectors file are invalid: " + path);
+  for (uint64_t i = 0; i < count_; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED(token_offsets_[i] <= token_offsets_[i + 1],
+                                 "Vectors: invalid file, token offsets of binary vectors file are invalid: " + path);
+  }
+  MS_LOG(INFO) << "Vectors: load " << count_ << " vectors of dimension " << dim_ << " from binary file: " << path;
+  return Status::OK();
+}
+
+const float *VectorsBinary::Find(const std::string &token) const {
+  uint64_t low = 0;
+  uint64_t high = count_;
+  while (low < high) {
+    uint64_t mid = low + (high - low) / 2;
+    std::string_view current(tokens_ + token_offsets_[mid], token_offsets_[mid + 1] - token_offsets_[mid]);
+    int cmp = current.compare(token);
+    if (cmp == 0) {
+      return vectors_ + mid * dim_;
+    }
+    if (cmp < 0) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  return nullptr;
+}
+}  // namespace dataset
+}  // namespace mindspore
@@ -0,0 +1,91 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_VECTORS_BINARY_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_VECTORS_BINARY_H_
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "minddata/dataset/util/status.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief The first 8 bytes of the binary vectors file, the last byte is the version of the format.
+const char kVectorsBinaryMagic[] = "MSVECTR1";
+
+/// \brief Pre-train word vectors in the binary format, the file is mapped instead of parsed when it is loaded.
+///     The layout of the file is
+///       | magic | dimension | number of vectors | size of tokens |
+///       | vectors: number of vectors * dimension float32, padded to 8 bytes |
+///       | token offsets: number of vectors + 1 uint64 | tokens: sorted and concatenated, padded to 8 bytes |
+///     The i-th vector belongs to the i-th token, so a token is looked up by binary search on the tokens.
+class VectorsBinary {
+ public:
+  /// Constructor.
+  VectorsBinary() = default;
+
+  /// Destructor.
+  ~VectorsBinary();
+
+  VectorsBinary(const VectorsBinary &) = delete;
+
+  VectorsBinary &operator=(const VectorsBinary &) = delete;
+
+  /// \brief Write the vectors to a binary file.
+  /// \param[in] map A map between string and vector.
+  /// \param[in] dim Dimension of the vectors.
+  /// \param[in] path Path to the binary file.
+  static Status Write(const std::unordered_map<std::string, std::vector<float>> &map, int32_t dim,
+                      const std::string &path);
+
+  /// \brief Map the binary file and verify it.
+  /// \param[in] path Path to the binary file.
+  /// \param[out] binary The loaded binary vectors.
+  static Status Load(const std::string &path, std::unique_ptr<VectorsBinary> *binary);
+
+  /// \brief Whether the file starts with the magic of the binary format.
+  static bool IsBinaryFile(const std::string &path);
+
+  /// \brief Find the vector of token.
+  /// \return The address of the vector in the mapped file, nullptr if the token does not exist.
+  const float *Find(const std::string &token) const;
+
+  /// \brief Getter of dimension.
+  int32_t Dim() const { return static_cast<int32_t>(dim_); }
+
+  /// \brief Getter of the number of vectors.
+  uint64_t Count() const { return count_; }
+
+ private:
+  /// \brief Locate the sections of the loaded file and verify them.
+  Status Parse(const std::string &path);
+
+  const uint8_t *data_ = nullptr;  // the content of the binary file
+  uint64_t size_ = 0;              // the size of the binary file
+  bool mapped_ = false;            // the content is mapped from the file, or else it is read into buffer_
+  std::vector<uint64_t> buffer_;   // the content of the binary file when the file could not be mapped
+
+  uint64_t dim_ = 0;
+  uint64_t count_ = 0;
+  const float *vectors_ = nullptr;
+  const uint64_t *token_offsets_ = nullptr;
+  const char *tokens_ = nullptr;
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_VECTORS_BINARY_H_
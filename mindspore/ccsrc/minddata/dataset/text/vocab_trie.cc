@@ -0,0 +1,106 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/text/vocab_trie.h"
+
+#include <algorithm>
+#include <queue>
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// the bytes after the first one of a UTF-8 character are 10xxxxxx
+bool IsContinuationByte(char c) { return (static_cast<uint8_t>(c) & 0xC0) == 0x80; }
+}  // namespace
+
+VocabTrie::VocabTrie() : nodes_({Node{0, 0, false}}) {}
+
+VocabTrie::VocabTrie(const Vocab &vocab) : VocabTrie() {
+  std::vector<std::string_view> words;
+  words.reserve(vocab.GetVocab().size());
+  for (const auto &item : vocab.GetVocab()) {
+    (void)words.emplace_back(item.first);
+  }
+  std::sort(words.begin(), words.end());
+
+  // the nodes are created breadth first, so that the children of each node are created together
+  struct Range {
+    uint32_t node;
+    size_t begin;  // the words in [begin, end) start with the prefix of node
+    size_t end;
+    size_t depth;  // the length of the prefix of node
+  };
+  std::queue<Range> ranges;
+  ranges.push({kRoot, 0, words.size(), 0});
+  while (!ranges.empty()) {
+    Range range = ranges.front();
+    ranges.pop();
+    size_t i = range.begin;
+    // the word equals to the prefix is sorted before the longer ones
+    if (i < range.end && words[i].size() == range.depth) {
+      nodes_[range.node].is_word = true;
+      ++i;
+    }
+    auto first_child = static_cast<uint32_t>(labels_.size());
+    while (i < range.end) {
+      auto label = static_cast<uint8_t>(words[i][range.depth]);
+      size_t j = i + 1;
+      while (j < range.end && static_cast<uint8_t>(words[j][range.depth]) == label) {
+        ++j;
+      }
+      auto child = static_cast<uint32_t>(nodes_.size());
+      nodes_.push_back(Node{0, 0, false});
+      labels_.push_back(label);
+      children_.push_back(child);
+      ranges.push({child, i, j, range.depth + 1});
+      i = j;
+    }
+    nodes_[range.node].first_child = first_child;
+    nodes_[range.node].child_num = static_cast<uint32_t>(labels_.size()) - first_child;
+  }
+}
+
+uint32_t VocabTrie::Child(uint32_t node, uint8_t label) const {
+  const Node &parent = nodes_[node];
+  auto begin = labels_.begin() + parent.first_child;
+  auto end = begin + parent.child_num;
+  auto iter = std::lower_bound(begin, end, label);
+  if (iter == end || *iter != label) {
+    return kNoNode;
+  }
+  return children_[static_cast<size_t>(iter - labels_.begin())];
+}
+
+uint32_t VocabTrie::Walk(uint32_t node, std::string_view prefix) const {
+  for (size_t i = 0; i < prefix.size() && node != kNoNode; ++i) {
+    node = Child(node, static_cast<uint8_t>(prefix[i]));
+  }
+  return node;
+}
+
+size_t VocabTrie::LongestMatch(uint32_t node, std::string_view text) const {
+  size_t matched = 0;
+  size_t i = 0;
+  while (node != kNoNode && i < text.size()) {
+    node = Child(node, static_cast<uint8_t>(text[i]));
+    ++i;
+    if (node != kNoNode && nodes_[node].is_word && (i == text.size() || !IsContinuationByte(text[i]))) {
+      matched = i;
+    }
+  }
+  return matched;
+}
+}  // namespace dataset
+}  // namespace mindspore
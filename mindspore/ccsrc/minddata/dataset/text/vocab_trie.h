@@ -0,0 +1,76 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_VOCAB_TRIE_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_VOCAB_TRIE_H_
+
+#include <cstdint>
+#include <limits>
+#include <string_view>
+#include <vector>
+
+#include "minddata/dataset/include/dataset/text.h"
+
+namespace mindspore {
+namespace dataset {
+/// \brief A prefix trie of the words in a Vocab, which finds the longest word at the beginning of a string without
+///     building any substring of it. The children of a node are stored contiguously and sorted by their bytes.
+class VocabTrie {
+ public:
+  /// \brief The node of the empty prefix.
+  static constexpr uint32_t kRoot = 0;
+
+  /// \brief The node returned when no word starts with the prefix.
+  static constexpr uint32_t kNoNode = std::numeric_limits<uint32_t>::max();
+
+  /// Constructor, the trie is empty.
+  VocabTrie();
+
+  /// Constructor.
+  /// \param[in] vocab The vocab whose words are indexed, the trie does not follow the later changes of it.
+  explicit VocabTrie(const Vocab &vocab);
+
+  /// Destructor.
+  ~VocabTrie() = default;
+
+  /// \brief Walk down the trie along prefix.
+  /// \param[in] node The node to walk from.
+  /// \param[in] prefix The bytes to walk along.
+  /// \return The node of the prefix, kNoNode if no word starts with it.
+  uint32_t Walk(uint32_t node, std::string_view prefix) const;
+
+  /// \brief Find the longest word that text starts with, the word must end at the boundary of a UTF-8 character.
+  /// \param[in] node The node to match from, the prefix of the node is not a part of text.
+  /// \param[in] text The text to be matched.
+  /// \return The length of the word in bytes excluding the prefix of node, 0 if no word is found.
+  size_t LongestMatch(uint32_t node, std::string_view text) const;
+
+ private:
+  struct Node {
+    uint32_t first_child;  // index of the first child in labels_ and children_
+    uint32_t child_num;
+    bool is_word;
+  };
+
+  /// \brief Find the child of node by its byte.
+  uint32_t Child(uint32_t node, uint8_t label) const;
+
+  std::vector<Node> nodes_;
+  std::vector<uint8_t> labels_;     // the byte of the edge to each child
+  std::vector<uint32_t> children_;  // the node of each child
+};
+}  // namespace dataset
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_TEXT_VOCAB_TRIE_H_
@@ -0,0 +1,139 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "minddata/dataset/util/recycle_pool.h"
+
+#include <cstdlib>
+#include <limits>
+#include "./securec.h"
+
+namespace mindspore {
+namespace dataset {
+namespace {
+// The size of a block is kept in front of it, and the header keeps the block aligned as malloc does.
+constexpr size_t kHeaderSize = alignof(std::max_align_t);
+
+void *BlockOf(void *header) { return static_cast<char *>(header) + kHeaderSize; }
+
+void *HeaderOf(void *block) { return static_cast<char *>(block) - kHeaderSize; }
+
+size_t SizeOf(void *block) { return *static_cast<size_t *>(HeaderOf(block)); }
+}  // namespace
+
+RecyclePool::RecyclePool(size_t max_cached_bytes)
+    : max_cached_bytes_(max_cached_bytes), cached_bytes_(0), recycled_count_(0) {}
+
+RecyclePool::~RecyclePool() {
+  for (void *block : lru_) {
+    free(HeaderOf(block));
+  }
+}
+
+Status RecyclePool::Allocate(size_t n, void **p) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  {
+    std::unique_lock<std::mutex> lck(mux_);
+    auto it = free_blocks_.find(n);
+    if (it != free_blocks_.end()) {
+      // the most recently freed block is the most likely one still in the cache
+      auto block = it->second.back();
+      *p = *block;
+      lru_.erase(block);
+      it->second.pop_back();
+      if (it->second.empty()) {
+        (void)free_blocks_.erase(it);
+      }
+      cached_bytes_ -= n;
+      ++recycled_count_;
+      return Status::OK();
+    }
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED(n <= get_max_size(), "Failed to allocate memory, size is too large: " +
+                                                      std::to_string(n));
+  void *header = nullptr;
+  RETURN_IF_NOT_OK(DeMalloc(n + kHeaderSize, &header, false));
+  *static_cast<size_t *>(header) = n;
+  *p = BlockOf(header);
+  return Status::OK();
+}
+
+Status RecyclePool::Reallocate(void **p, size_t old_sz, size_t new_sz) {
+  RETURN_UNEXPECTED_IF_NULL(p);
+  if (old_sz >= new_sz) {
+    // Do nothing if we shrink.
+    return Status::OK();
+  }
+  void *q = nullptr;
+  RETURN_IF_NOT_OK(Allocate(new_sz, &q));
+  errno_t err = memcpy_s(q, new_sz, *p, old_sz);
+  if (err != EOK) {
+    Deallocate(q);
+    RETURN_STATUS_UNEXPECTED("Failed to copy memory, error code: " + std::to_string(err));
+  }
+  Deallocate(*p);
+  *p = q;
+  return Status::OK();
+}
+
+void RecyclePool::Deallocate(void *p) {
+  if (p == nullptr) {
+    return;
+  }
+  size_t n = SizeOf(p);
+  if (n > max_cached_bytes_) {
+    free(HeaderOf(p));
+    return;
+  }
+  std::unique_lock<std::mutex> lck(mux_);
+  while (cached_bytes_ + n > max_cached_bytes_) {
+    EvictOldest();
+  }
+  lru_.push_front(p);
+  free_blocks_[n].push_back(lru_.begin());
+  cached_bytes_ += n;
+}
+
+void RecyclePool::EvictOldest() {
+  void *block = lru_.back();
+  size_t n = SizeOf(block);
+  // the least recently freed block is also the least recently freed one of its size
+  auto it = free_blocks_.find(n);
+  it->second.pop_front();
+  if (it->second.empty()) {
+    (void)free_blocks_.erase(it);
+  }
+  lru_.pop_back();
+  cached_bytes_ -= n;
+  free(HeaderOf(block));
+}
+
+uint64_t RecyclePool::get_max_size() const { return std::numeric_limits<size_t>::max() - kHeaderSize; }
+
+size_t RecyclePool::CachedBlocks() const {
+  std::unique_lock<std::mutex> lck(mux_);
+  return lru_.size();
+}
+
+size_t RecyclePool::CachedBytes() const {
+  std::unique_lock<std::mutex> lck(mux_);
+  return cached_bytes_;
+}
+
+uint64_t RecyclePool::RecycledCount() const {
+  std::unique_lock<std::mutex> lck(mux_);
+  return recycled_count_;
+}
+}  // namespace dataset
+}  // namespace mindspore
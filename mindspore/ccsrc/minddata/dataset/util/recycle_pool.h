@@ -0,0 +1,82 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RECYCLE_POOL_H_
+#define MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RECYCLE_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include "minddata/dataset/util/memory_pool.h"
+
+namespace mindspore {
+namespace dataset {
+// A memory pool for the blocks which are allocated again and
+// again with the same sizes, e.g. the buffers of the batches
+// of a pipeline. A freed block is kept and handed out to the
+// next allocation of the same size, so that the block is not
+// returned to the system and page faulted again. The freed
+// blocks kept take at most max_cached_bytes, when a freed
+// block exceeds it the least recently freed blocks are
+// released first, whatever their sizes are, so the blocks of
+// the sizes no longer allocated do not stay in the pool.
+class RecyclePool : public MemoryPool {
+ public:
+  explicit RecyclePool(size_t max_cached_bytes);
+
+  RecyclePool(const RecyclePool &) = delete;
+
+  RecyclePool &operator=(const RecyclePool &) = delete;
+
+  ~RecyclePool() override;
+
+  Status Allocate(size_t n, void **p) override;
+
+  Status Reallocate(void **p, size_t old_sz, size_t new_sz) override;
+
+  void Deallocate(void *p) override;
+
+  uint64_t get_max_size() const override;
+
+  int PercentFree() const override { return 100; }
+
+  // Number of the freed blocks kept for recycling
+  size_t CachedBlocks() const;
+
+  // Total size of the freed blocks kept for recycling
+  size_t CachedBytes() const;
+
+  // Number of the allocations served by a kept block
+  uint64_t RecycledCount() const;
+
+ private:
+  // Release the least recently freed block, mux_ must be held
+  void EvictOldest();
+
+  mutable std::mutex mux_;
+  std::list<void *> lru_;  // freed blocks, the most recently freed one first
+  // size of the blocks -> freed blocks in lru_, the most recently freed one last
+  std::unordered_map<size_t, std::deque<std::list<void *>::iterator>> free_blocks_;
+  size_t max_cached_bytes_;
+  size_t cached_bytes_;
+  uint64_t recycled_count_;
+};
+}  // namespace dataset
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_DATASET_UTIL_RECYCLE_POOL_H_
@@ -121,6 +121,11 @@ void BindShardWriter(py::module *m) {
            THROW_IF_ERROR(s.SetPageSize(page_size));
            return SUCCESS;
          })
+    .def("set_raw_page_format",
+         [](ShardWriter &s, const std::string &raw_page_format) {
+           THROW_IF_ERROR(s.SetRawPageFormat(raw_page_format));
+           return SUCCESS;
+         })
     .def("set_shard_header",
          [](ShardWriter &s, std::shared_ptr<ShardHeader> header_data) {
            THROW_IF_ERROR(s.SetShardHeader(header_data));
@@ -73,7 +73,14 @@ const int kUnsignedInt4 = 4;
 enum LabelCategory { kSchemaLabel, kStatisticsLabel, kIndexLabel };
 
 const char kVersion[] = "3.0";
-const std::vector<std::string> kSupportedVersion = {"2.0", kVersion};
+
+// layout of the raw data page, the rows are stored one after another by default, while the columnar layout stores the
+// rows of a row group column by column
+const char kRawPageFormatRow[] = "row";
+const char kRawPageFormatColumnar[] = "columnar";
+// version of the files with columnar layout, which the readers predating the layout reject instead of misreading
+const char kVersionColumnar[] = "3.1";
+const std::vector<std::string> kSupportedVersion = {"2.0", kVersion, kVersionColumnar};
 
 enum ShardType {
   kNLP = 0,
@@ -0,0 +1,190 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_BINARY_INDEX_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_BINARY_INDEX_H_
+
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/mindrecord_macro.h"
+#include "minddata/mindrecord/include/shard_error.h"
+
+namespace mindspore {
+namespace mindrecord {
+// suffix of the binary index file, it is placed beside the meta file(.db) of the shard
+const char kBinaryIndexSuffix[] = ".idx";
+// environment variable to ignore the binary index and query the meta file(.db) by sqlite, "0" means ignored
+const char kEnvMindRecordBinaryIndex[] = "MS_MINDRECORD_BINARY_INDEX";
+// the first 8 bytes of the binary index file, the last byte is the version of the format
+const char kBinaryIndexMagic[] = "MRINDEX1";
+
+// the columns of a row in the binary index, they are the same as the fixed columns of table INDEXES in meta file
+enum BinaryIndexColumn {
+  kIndexRowId = 0,
+  kIndexRowGroupId,
+  kIndexPageIdRaw,
+  kIndexPageOffsetRaw,
+  kIndexPageOffsetRawEnd,
+  kIndexPageIdBlob,
+  kIndexPageOffsetBlob,
+  kIndexPageOffsetBlobEnd,
+  kIndexColumnNum
+};
+
+// the names of the fixed columns, in the order of BinaryIndexColumn
+const std::array<std::string, kIndexColumnNum> kBinaryIndexColumnNames = {
+  "ROW_ID",       "ROW_GROUP_ID",     "PAGE_ID_RAW",         "PAGE_OFFSET_RAW", "PAGE_OFFSET_RAW_END",
+  "PAGE_ID_BLOB", "PAGE_OFFSET_BLOB", "PAGE_OFFSET_BLOB_END"};
+
+// The location of one index field in the binary index, the pointers refer to the loaded file.
+struct BinaryIndexField {
+  std::string name;
+  bool numeric = false;
+  uint64_t value_count = 0;
+  const uint64_t *value_offsets = nullptr;    // value_count + 1 offsets of the values in 'values'
+  const char *values = nullptr;               // the sorted distinct values
+  const uint64_t *value_ids = nullptr;        // the value id of each row
+  const uint64_t *posting_offsets = nullptr;  // value_count + 1 offsets of the rows of each value in 'postings'
+  const uint64_t *postings = nullptr;         // the rows of each value, in the order of row id
+};
+
+// ShardBinaryIndex is the compact index of one shard, it answers the queries of ShardReader without sqlite. The rows
+// are sorted by row id, and every field is a 8 bytes integer so that the file could be used after being mapped:
+//   | magic | shard file size | row count | page count | field count | name size | shard name |
+//   | rows: row count * kIndexColumnNum |
+//   | row group summaries: page count * (blob page id, first row, row count), sorted by blob page id |
+//   | field 0 | ... |
+// and each index field is stored as
+//   | name size | name | numeric | value count | value offsets | value size | values |
+//   | value ids of rows | posting offsets | postings |
+// The strings are padded to 8 bytes. The values of a field are sorted, the numeric values by number, and each
+// number is stored in one form, so that "1" and "1.0" are one value.
+class MINDRECORD_API ShardBinaryIndex {
+ public:
+  ShardBinaryIndex() = default;
+
+  ~ShardBinaryIndex();
+
+  ShardBinaryIndex(const ShardBinaryIndex &) = delete;
+
+  ShardBinaryIndex &operator=(const ShardBinaryIndex &) = delete;
+
+  /// \brief load the binary index of the mindrecord file
+  /// \param[in] file the path of the mindrecord file
+  /// \param[in] shard_name the file name of the shard, it is verified with the name in the index, and the size of
+  ///            the mindrecord file is verified with the size when the index was generated
+  /// \param[out] index the loaded index
+  /// \return Status
+  static Status Load(const std::string &file, const std::string &shard_name, std::unique_ptr<ShardBinaryIndex> *index);
+
+  /// \brief get the number of rows
+  uint64_t GetRowCount() const { return row_count_; }
+
+  /// \brief get a fixed column of the row at 'pos', the rows are sorted by row id
+  uint64_t GetRowColumn(uint64_t pos, BinaryIndexColumn column) const { return rows_[pos * kIndexColumnNum + column]; }
+
+  /// \brief find the position of the row by row id
+  /// \return false if the row does not exist
+  bool FindRow(uint64_t row_id, uint64_t *pos) const;
+
+  /// \brief get the positions of the rows in the blob page
+  /// \param[in] page_id the id of blob page
+  /// \param[in] criteria the field name and value which the rows should match, empty field means all the rows
+  /// \param[out] positions the positions of the rows, in the order of row id
+  /// \return Status
+  Status GetRowsInPage(uint64_t page_id, const std::pair<std::string, std::string> &criteria,
+                       std::vector<uint64_t> *positions) const;
+
+  /// \brief get the distinct blob page ids of the rows which match the criteria, empty field means all the pages
+  Status GetPagesByCategory(const std::pair<std::string, std::string> &criteria,
+                            std::vector<uint64_t> *page_ids) const;
+
+  /// \brief get the distinct values of the field
+  Status GetDistinctValues(const std::string &field, std::vector<std::string> *values) const;
+
+  /// \brief select the fields of the rows like sql, the fields are the fixed columns or the index fields
+  /// \param[in] positions the positions of the rows
+  /// \param[in] fields the names of fields to select
+  /// \param[out] rows the values of the selected fields as string
+  /// \return Status
+  Status SelectRows(const std::vector<uint64_t> &positions, const std::vector<std::string> &fields,
+                    std::vector<std::vector<std::string>> *rows) const;
+
+ private:
+  /// \brief parse the loaded file and verify it
+  Status Parse(const std::string &shard_name, uint64_t shard_size);
+
+  /// \brief parse one index field at 'offset' of the file
+  Status ParseField(uint64_t *offset, BinaryIndexField *field);
+
+  /// \brief get the field by name
+  Status GetField(const std::string &name, const BinaryIndexField **field) const;
+
+  /// \brief get the value of the field by value id
+  std::string GetValue(const BinaryIndexField &field, uint64_t value_id) const;
+
+  /// \brief find the value id of the field, the numeric value is compared by number like sqlite
+  /// \return false if the value does not exist
+  bool FindValue(const BinaryIndexField &field, const std::string &value, uint64_t *value_id) const;
+
+  const uint8_t *data_ = nullptr;  // the content of the index file
+  uint64_t size_ = 0;              // the size of the index file
+  bool mapped_ = false;            // the content is mapped from the file, or else it is read into buffer_
+  std::vector<uint64_t> buffer_;   // the content of the index file when the file could not be mapped
+
+  uint64_t row_count_ = 0;
+  const uint64_t *rows_ = nullptr;   // row count * kIndexColumnNum
+  uint64_t page_count_ = 0;
+  const uint64_t *pages_ = nullptr;  // page count * (blob page id, first row, row count)
+  std::vector<BinaryIndexField> fields_;
+  std::map<std::string, size_t> field_ids_;
+};
+
+// ShardBinaryIndexBuilder collects the rows generated for the meta file of a shard and writes the binary index.
+class MINDRECORD_API ShardBinaryIndexBuilder {
+ public:
+  /// \brief constructor
+  /// \param[in] shard_name the file name of the shard
+  explicit ShardBinaryIndexBuilder(const std::string &shard_name) : shard_name_(shard_name) {}
+
+  ~ShardBinaryIndexBuilder() = default;
+
+  /// \brief add the rows of a raw page, the tuples of a row are (placeholder, sql type, value) of table INDEXES
+  Status AddRows(const std::vector<std::vector<std::tuple<std::string, std::string, std::string>>> &rows);
+
+  /// \brief write the binary index of the mindrecord file, the index is invalid once the mindrecord file is modified
+  /// \param[in] file the path of the mindrecord file
+  /// \return Status
+  Status Write(const std::string &file);
+
+ private:
+  std::string shard_name_;
+  std::vector<std::array<uint64_t, kIndexColumnNum>> rows_;
+  std::vector<std::string> field_names_;
+  std::vector<bool> field_numeric_;
+  std::vector<std::map<std::string, uint64_t>> field_values_;  // value to the id in the order of first appearance
+  std::vector<std::vector<uint64_t>> row_values_;              // the value ids of each field, one for each row
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_BINARY_INDEX_H_
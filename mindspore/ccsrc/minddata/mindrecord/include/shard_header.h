@@ -130,6 +130,10 @@ class MINDRECORD_API ShardHeader {
 
   void SetCompressionSize(const uint64_t &compression_size) { compression_size_ = compression_size; }
 
+  std::string GetRawPageFormat() const { return raw_page_format_; }
+
+  void SetRawPageFormat(const std::string &raw_page_format) { raw_page_format_ = raw_page_format; }
+
   std::vector<std::string> SerializeHeader();
 
   Status PagesToFile(const std::string dump_file_name);
@@ -190,6 +194,7 @@ class MINDRECORD_API ShardHeader {
   uint64_t header_size_;
   uint64_t page_size_;
   uint64_t compression_size_;
+  std::string raw_page_format_;
 
   std::shared_ptr<Index> index_;
   std::vector<std::string> shard_addresses_;
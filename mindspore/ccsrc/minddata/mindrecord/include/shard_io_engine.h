@@ -0,0 +1,160 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_IO_ENGINE_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_IO_ENGINE_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/mindrecord_macro.h"
+#include "minddata/mindrecord/include/shard_error.h"
+
+namespace mindspore {
+namespace mindrecord {
+// environment variable of the max bytes read ahead and not consumed yet, 0 means prefetching is disabled
+const char kEnvMindRecordPrefetchSize[] = "MS_MINDRECORD_PREFETCH_SIZE";
+// environment variable of the number of threads issuing the prefetching reads
+const char kEnvMindRecordIoThreads[] = "MS_MINDRECORD_IO_THREADS";
+const int kDefaultIoThreadNum = 4;
+const int kMaxIoThreadNum = 64;
+// the max number of requests sorted and coalesced together
+const int kMaxIoBatchSize = 64;
+// the reads of two blobs are coalesced if the gap between them is not larger than 64KB
+const uint64_t kMaxCoalesceGap = 64 << 10;
+// the max length of one coalesced read, 8MB
+const uint64_t kMaxCoalesceLength = 8 << 20;
+
+// The location of the blob of one task in the shard files.
+struct BlobLocation {
+  TaskType task_type = TaskType::kCommonTask;
+  uint32_t shard_id = 0;
+  uint64_t file_offset = 0;
+  uint64_t blob_size = 0;
+  json var_fields;
+};
+
+// ShardIoEngine reads the blobs of the upcoming tasks ahead of consumption by a pool of threads using pread. The
+// requests of a batch are sorted by file offset, and the adjacent ones are coalesced into one read, so that the random
+// reads after shuffle are issued with high depth. The bytes read but not taken are bounded by 'max_inflight_bytes'.
+class MINDRECORD_API ShardIoEngine {
+ public:
+  // Get the location of the blob by task id.
+  using Locator = std::function<Status(int64_t, BlobLocation *)>;
+
+  ShardIoEngine(uint64_t max_inflight_bytes, int io_thread_num);
+
+  ~ShardIoEngine();
+
+  /// \brief open the shard files for pread
+  Status Open(const std::vector<std::string> &file_paths);
+
+  /// \brief stop prefetching and close the shard files
+  void Close();
+
+  /// \brief start prefetching the blobs of tasks in the order of consumption
+  /// \param[in] locator get the location of the blob by task id
+  /// \param[in] task_ids the ids of tasks in the order they will be taken
+  Status Start(const Locator &locator, const std::vector<int64_t> &task_ids);
+
+  /// \brief stop prefetching and drop the blobs not taken yet
+  void Stop();
+
+  /// \brief take the prefetched blob of the task, wait if the read is in flight
+  /// \param[in] task_id the id of task
+  /// \param[out] blob the blob data of the task
+  /// \param[out] location the location and scalar fields of the task
+  /// \return false if the task is not prefetched, the caller should read it by itself
+  bool Take(int64_t task_id, std::vector<uint8_t> *blob, BlobLocation *location);
+
+  /// \brief get the number of tasks taken from the prefetched blobs
+  uint64_t hit_count() const { return hit_count_; }
+
+ private:
+  // The read of one blob.
+  struct BlobRequest {
+    int64_t task_id;
+    BlobLocation location;
+  };
+
+  // The coalesced read of several blobs in one shard file.
+  struct IoRequest {
+    uint32_t shard_id;
+    uint64_t file_offset;
+    uint64_t length;
+    std::vector<BlobRequest> blobs;
+  };
+
+  // Walk through the tasks and issue the coalesced reads within the bytes budget.
+  void ScheduleLoop();
+
+  // Consume one miss of the task when the schedule thread passes it, return false if the task is not missed, must be
+  // called with 'mutex_' held.
+  bool ConsumeMissed(int64_t task_id);
+
+  // Check whether the schedule thread is waiting for the bytes budget, must be called with 'mutex_' held.
+  bool ScheduleBlocked() const;
+
+  // Sort the blob requests and coalesce the adjacent ones.
+  static std::vector<IoRequest> Coalesce(std::vector<BlobRequest> *blobs);
+
+  // Serve the coalesced reads.
+  void IoLoop();
+
+  // Read the coalesced request and split it into blobs.
+  Status Read(const IoRequest &request, std::vector<std::vector<uint8_t>> *blobs);
+
+  uint64_t max_inflight_bytes_;
+  int io_thread_num_;
+  std::vector<int> fds_;
+
+  Locator locator_;
+  std::vector<int64_t> task_ids_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_schedule_;  // wake up the schedule thread when the budget is released
+  std::condition_variable cv_io_;        // wake up the io threads when the reads are issued
+  std::condition_variable cv_ready_;     // wake up the consumers when the blobs are read
+  bool running_ = false;
+  uint64_t blocked_size_ = 0;  // the size of the blob the schedule thread is waiting to issue, 0 if not waiting
+  bool schedule_done_ = false;  // all tasks are scheduled
+  uint64_t inflight_bytes_ = 0;
+  std::deque<IoRequest> io_queue_;
+  // the number of reads not finished or not taken of the task, a task may be sampled more than once
+  std::unordered_map<int64_t, int> pending_;
+  // the read blobs of the task, the empty optional means the read is failed
+  std::unordered_map<int64_t, std::deque<std::optional<std::pair<std::vector<uint8_t>, BlobLocation>>>> ready_;
+  // the number of times the task is taken before it is scheduled, the schedule thread skips it then, and every task
+  // passed by the schedule thread consumes one miss, so only the misses ahead of the schedule thread are kept
+  std::unordered_map<int64_t, int> missed_;
+  std::atomic<uint64_t> hit_count_{0};
+
+  std::thread schedule_thread_;
+  std::vector<std::thread> io_threads_;
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_IO_ENGINE_H_
@@ -0,0 +1,102 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_RAW_CHUNK_H_
+#define MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_RAW_CHUNK_H_
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/mindrecord_macro.h"
+#include "minddata/mindrecord/include/shard_error.h"
+
+namespace mindspore {
+namespace mindrecord {
+// size of the fixed fields at the head of a chunk: chunk size, first row id, row count and directory size
+const uint64_t kRawChunkHeadLen = 4 * kInt64Len;
+
+enum RawColumnEncoding { kRawColumnPlain = 0, kRawColumnDictionary = 1, kRawColumnRunLength = 2 };
+
+// The location of one column in a columnar raw chunk, the offset is relative to the first payload.
+struct RawChunkColumn {
+  std::string name;
+  RawColumnEncoding encoding = kRawColumnPlain;
+  uint64_t offset = 0;
+  uint64_t size = 0;
+};
+
+// The decoded rows of the chunk read last time, the adjacent rows usually share the same chunk.
+struct RawChunkCache {
+  uint64_t offset = 0;
+  uint64_t first_row_id = 0;
+  std::vector<json> rows;
+};
+
+// ShardRawChunk encodes the raw rows of one row group column by column. The layout of a chunk in the raw page is
+//   | chunk size | first row id | row count | directory size | directory | payload of column 0 | ... |
+// and every field is 8 bytes except the msgpack encoded directory and payloads. The scalar columns are encoded with
+// run length encoding or dictionary encoding when it is smaller than the plain array, so that a subset of columns
+// could be read and decoded without touching the others.
+class MINDRECORD_API ShardRawChunk {
+ public:
+  /// \brief encode the rows of a chunk, the result does not include the leading chunk size
+  /// \param[in] begin the first raw json row of the chunk
+  /// \param[in] end the end of the raw json rows of the chunk
+  /// \param[in] first_row_id the row id of the first row in the shard
+  /// \param[out] chunk the encoded chunk
+  /// \return Status
+  static Status Encode(std::vector<json>::const_iterator begin, std::vector<json>::const_iterator end,
+                       uint64_t first_row_id, std::vector<uint8_t> *chunk);
+
+  /// \brief read the chunk which starts at 'offset' of the file, only the columns in 'columns' are read and decoded
+  /// \param[in] fs the file stream of the shard
+  /// \param[in] offset the offset of the chunk size field in the file
+  /// \param[in] columns the columns to project, empty means all the columns
+  /// \param[out] rows the projected rows of the chunk
+  /// \param[out] first_row_id the row id of the first row in the shard
+  /// \param[out] chunk_size the bytes of the chunk following the chunk size field
+  /// \return Status
+  static Status Read(std::fstream *fs, uint64_t offset, const std::vector<std::string> &columns,
+                     std::vector<json> *rows, uint64_t *first_row_id, uint64_t *chunk_size);
+
+  /// \brief read one row of the chunk which starts at 'offset' of the file, the chunk is only read again when the
+  ///        row is not in the cached chunk
+  /// \param[in] fs the file stream of the shard
+  /// \param[in] offset the offset of the chunk size field in the file
+  /// \param[in] row_id the row id of the row in the shard
+  /// \param[in] columns the columns to project, empty means all the columns
+  /// \param[in/out] cache the rows of the chunk read last time
+  /// \param[out] row the projected row
+  /// \return Status
+  static Status ReadRow(std::fstream *fs, uint64_t offset, uint64_t row_id, const std::vector<std::string> &columns,
+                        RawChunkCache *cache, json *row);
+
+ private:
+  /// \brief choose the encoding of a column by the number of runs and distinct values
+  static RawColumnEncoding ChooseEncoding(const std::vector<json> &values);
+
+  /// \brief encode the values of a column to msgpack
+  static std::vector<uint8_t> EncodeColumn(const std::vector<json> &values, RawColumnEncoding encoding);
+
+  /// \brief decode the msgpack payload of a column to 'row_count' values
+  static Status DecodeColumn(const uint8_t *payload, uint64_t size, RawColumnEncoding encoding, uint64_t row_count,
+                             std::vector<json> *values);
+};
+}  // namespace mindrecord
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_MINDDATA_MINDRECORD_INCLUDE_SHARD_RAW_CHUNK_H_
@@ -42,11 +42,13 @@
 #include <vector>
 #include "minddata/mindrecord/include/common/log_adapter.h"
 #include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/shard_binary_index.h"
 #include "minddata/mindrecord/include/shard_category.h"
 #include "minddata/mindrecord/include/shard_column.h"
 #include "minddata/mindrecord/include/shard_distributed_sample.h"
 #include "minddata/mindrecord/include/shard_error.h"
 #include "minddata/mindrecord/include/shard_index_generator.h"
+#include "minddata/mindrecord/include/shard_io_engine.h"
 #include "minddata/mindrecord/include/shard_operator.h"
 #include "minddata/mindrecord/include/shard_pk_sample.h"
 #include "minddata/mindrecord/include/shard_reader.h"
@@ -58,7 +60,11 @@ namespace mindrecord {
 using ROW_GROUPS = std::pair<std::vector<std::vector<std::vector<uint64_t>>>, std::vector<std::vector<json>>>;
 using ROW_GROUP_BRIEF = std::tuple<std::string, int, uint64_t, std::vector<std::vector<uint64_t>>, std::vector<json>>;
 using TASK_CONTENT = std::pair<TaskType, std::vector<std::tuple<std::vector<uint8_t>, json>>>;
+using BLOB_VIEW = std::pair<const uint8_t *, uint64_t>;  // address and size of the blob data in the mapped file
+using TASK_VIEW_CONTENT = std::pair<TaskType, std::vector<std::tuple<BLOB_VIEW, json>>>;
 const int kNumBatchInMap = 1000;  // iterator buffer size in row-reader mode
+// environment variable to read the blob data from the memory-mapped mindrecord files, "1" means enabled
+const char kEnvMindRecordMmap[] = "MS_MINDRECORD_MMAP";
 
 class MINDRECORD_API ShardReader {
  public:
@@ -175,6 +181,11 @@ class MINDRECORD_API ShardReader {
   /// \brief return a row by id
   /// \return a batch of images and image data
   TASK_CONTENT GetNextById(const int64_t &task_id, const int32_t &consumer_id);
+
+  /// \brief return a row by id without copying the blob data, only available in mmap mode
+  /// \return the views into the mapped files, which are valid until the reader is closed
+  TASK_VIEW_CONTENT GetNextViewById(const int64_t &task_id);
+
   /// \brief  get blob filed list
   /// \return blob field list
   std::pair<ShardType, std::vector<std::string>> GetBlobFields();
@@ -187,6 +198,31 @@ class MINDRECORD_API ShardReader {
   /// \return null
   void SetAllInIndex(bool all_in_index) { all_in_index_ = all_in_index; }
 
+  /// \brief set flag of mmap mode, it takes effect in the next Open
+  /// \return null
+  void SetMmapMode(bool use_mmap) { use_mmap_ = use_mmap; }
+
+  /// \brief check whether the shard files are memory-mapped
+  bool IsMmapMode() const { return !mapped_shards_.empty(); }
+
+  /// \brief set flag of querying the binary index files instead of the meta files, it takes effect in the next Open
+  /// \return null
+  void SetBinaryIndexMode(bool use_binary_index) { use_binary_index_ = use_binary_index; }
+
+  /// \brief check whether the shard is queried by the binary index file
+  bool HasBinaryIndex(int shard_id) const {
+    return shard_id >= 0 && shard_id < static_cast<int>(binary_indexes_.size()) && binary_indexes_[shard_id] != nullptr;
+  }
+
+  /// \brief set the prefetching of blob data, it takes effect in the next Open
+  /// \param[in] prefetch_size max bytes read ahead and not consumed yet, 0 means prefetching is disabled
+  /// \param[in] io_thread_num number of threads issuing the prefetching reads
+  /// \return null
+  void SetPrefetch(uint64_t prefetch_size, int io_thread_num) {
+    prefetch_size_ = prefetch_size;
+    io_thread_num_ = io_thread_num;
+  }
+
   /// \brief get all classes
   Status GetAllClasses(const std::string &category_field, std::shared_ptr<std::set<std::string>> category_ptr);
 
@@ -204,6 +240,10 @@ class MINDRECORD_API ShardReader {
   /// \brief sqlite call back function
   static int SelectCallback(void *p_data, int num_fields, char **p_fields, char **p_col_names);
 
+  /// \brief get the sqlite handle of the meta file, the meta file of the shard with binary index is opened at the
+  ///        first query which the binary index does not support
+  Status GetDatabase(int shard_id, sqlite3 **db);
+
  private:
   /// \brief wrap up labels to json format
   Status ConvertLabelToJson(const std::vector<std::vector<std::string>> &labels, std::shared_ptr<std::fstream> fs,
@@ -222,8 +262,12 @@ class MINDRECORD_API ShardReader {
   Status ReadRowGroupByShardIDAndSampleID(const std::vector<std::string> &columns, const uint32_t &shard_id,
                                           const uint32_t &sample_id, std::shared_ptr<ROW_GROUPS> *row_group_ptr);
 
-  /// \brief read all rows in one shard
-  Status ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
+  /// \brief get the fields of index to read the rows of the columns
+  Status GenerateRowFields(const std::vector<std::string> &columns, std::vector<std::string> *fields);
+
+  /// \brief read all rows in one shard, or only the row of 'row_id' if it is not negative
+  Status ReadAllRowsInShard(int shard_id, const std::vector<std::string> &fields, int64_t row_id,
+                            const std::vector<std::string> &columns,
                             std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
                             std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr);
 
@@ -240,6 +284,9 @@ class MINDRECORD_API ShardReader {
   std::vector<std::vector<uint64_t>> GetImageOffset(int group_id, int shard_id,
                                                     const std::pair<std::string, std::string> &criteria = {"", ""});
 
+  /// \brief convert the blob offsets selected from index, the offset skips the size field of blob data
+  std::vector<std::vector<uint64_t>> ConvertImageOffsets(const std::vector<std::vector<std::string>> &image_offsets);
+
   /// \brief get page id by category
   Status GetPagesByCategory(int shard_id, const std::pair<std::string, std::string> &criteria,
                             std::shared_ptr<std::vector<uint64_t>> *pages_ptr);
@@ -282,14 +329,35 @@ class MINDRECORD_API ShardReader {
   /// \brief read one row by one task
   Status ConsumerOneTask(int64_t task_id, uint32_t consumer_id, std::shared_ptr<TASK_CONTENT> *task_content_pt);
 
+  /// \brief read one row by one task, the blob data is the view into the mapped file
+  Status ConsumerOneTaskView(int64_t task_id, std::shared_ptr<TASK_VIEW_CONTENT> *task_content_ptr);
+
+  /// \brief get the type, shard id, blob offset in file, blob size and scalar fields of one task
+  Status GetTaskLocation(int64_t task_id, TaskType *task_type, uint32_t *shard_id, uint64_t *file_offset,
+                         uint64_t *blob_size, json *var_fields);
+
+  /// \brief get the view of blob data in the mapped shard file
+  Status GetBlobView(uint32_t shard_id, uint64_t file_offset, uint64_t blob_size, BLOB_VIEW *blob_view);
+
+  /// \brief map all shard files read-only in mmap mode
+  Status MapShardFiles();
+
+  /// \brief unmap all shard files
+  void UnmapShardFiles();
+
+  /// \brief start prefetching the blob data of tasks in the order of sample ids
+  void StartPrefetch();
+
   /// \brief get labels from binary file
   Status GetLabelsFromBinaryFile(int shard_id, const std::vector<std::string> &columns,
                                  const std::vector<std::vector<std::string>> &label_offsets,
                                  std::shared_ptr<std::vector<json>> *labels_ptr);
 
   /// \brief get classes in one shard
-  void GetClassesInShard(sqlite3 *db, int shard_id, const std::string &sql,
-                         std::shared_ptr<std::set<std::string>> category_ptr);
+  void GetClassesInShard(int shard_id, const std::string &field, std::shared_ptr<std::set<std::string>> category_ptr);
+
+  /// \brief convert the criteria on column to the criteria on field of index
+  std::pair<std::string, std::string> GetIndexCriteria(const std::pair<std::string, std::string> &criteria);
 
   /// \brief get number of classes
   int64_t GetNumClasses(const std::string &category_field);
@@ -306,6 +374,8 @@ class MINDRECORD_API ShardReader {
   std::shared_ptr<ShardColumn> shard_column_;  // shard column
 
   std::vector<sqlite3 *> database_paths_;                                        // sqlite handle list
+  std::vector<std::unique_ptr<ShardBinaryIndex>> binary_indexes_;                // binary index list, may be nullptr
+  std::mutex database_mutex_;                                                    // locker of opening meta files
   std::vector<string> file_paths_;                                               // file paths
   std::vector<std::shared_ptr<std::fstream>> file_streams_;                      // single-file handle list
   std::vector<std::vector<std::shared_ptr<std::fstream>>> file_streams_random_;  // multiple-file handle list
@@ -319,8 +389,16 @@ class MINDRECORD_API ShardReader {
   std::mutex shard_locker_;                                // locker of shard
 
   // flags
-  bool all_in_index_ = true;  // if all columns are stored in index-table
-  bool interrupt_ = false;    // reader interrupted
+  bool all_in_index_ = true;      // if all columns are stored in index-table
+  bool interrupt_ = false;        // reader interrupted
+  bool use_mmap_ = false;         // read blob data from the memory-mapped shard files
+  bool use_binary_index_ = true;  // query the binary index files instead of the meta files if they are available
+
+  std::vector<BLOB_VIEW> mapped_shards_;  // address and length of the memory-mapped shard files
+
+  uint64_t prefetch_size_ = 0;                // max bytes read ahead and not consumed yet
+  int io_thread_num_ = kDefaultIoThreadNum;   // number of threads issuing the prefetching reads
+  std::unique_ptr<ShardIoEngine> io_engine_;  // the prefetching engine, nullptr if prefetching is disabled
 
   int64_t num_padded_;  // number of padding samples
 
@@ -80,6 +80,13 @@ class MINDRECORD_API ShardWriter {
   /// \return MSRStatus the status of MSRStatus
   Status SetPageSize(const uint64_t &page_size);
 
+  /// \brief Set the layout of raw page
+  /// \param[in] raw_page_format "row" stores the rows one after another, "columnar" stores the rows of a row group
+  ///        column by column so that the reader could only read the projected columns
+  ///        WARNING, only called before setting shard header
+  /// \return MSRStatus the status of MSRStatus
+  Status SetRawPageFormat(const std::string &raw_page_format);
+
   /// \brief Set shard header
   /// \param[in] header_data the info of header
   ///        WARNING, only called when file is empty
@@ -141,11 +148,15 @@ class MINDRECORD_API ShardWriter {
 
   /// \brief write all data parallel
   Status ParallelWriteData(const std::vector<std::vector<uint8_t>> &blob_data,
-                           const std::vector<std::vector<uint8_t>> &bin_raw_data);
+                           const std::vector<std::vector<uint8_t>> &bin_raw_data, const std::vector<json> &raw_rows);
 
   /// \brief write data shard by shard
   Status WriteByShard(int shard_id, int start_row, int end_row, const std::vector<std::vector<uint8_t>> &blob_data,
-                      const std::vector<std::vector<uint8_t>> &bin_raw_data);
+                      const std::vector<std::vector<uint8_t>> &bin_raw_data, const std::vector<json> &raw_rows);
+
+  /// \brief encode the rows of every row group to a columnar chunk, the first row of a row group takes the chunk size
+  Status EncodeRawChunks(const std::vector<std::pair<int, int>> &rows_in_group, const std::vector<json> &raw_rows,
+                         uint64_t first_row_id, std::vector<std::vector<uint8_t>> *raw_chunks);
 
   /// \brief break image data up into multiple row groups
   Status CutRowGroup(int start_row, int end_row, const std::vector<std::vector<uint8_t>> &blob_data,
@@ -183,7 +194,7 @@ class MINDRECORD_API ShardWriter {
   Status FlushBlobChunk(const std::shared_ptr<std::fstream> &out, const std::vector<std::vector<uint8_t>> &blob_data,
                         const std::pair<int, int> &blob_row);
 
-  /// \brief write raw chunk to disk
+  /// \brief write raw chunk to disk, the 'bin_raw_data' is the columnar chunks of row groups in columnar layout
   Status FlushRawChunk(const std::shared_ptr<std::fstream> &out, const std::vector<std::pair<int, int>> &rows_in_group,
                        const int &chunk_id, const std::vector<std::vector<uint8_t>> &bin_raw_data);
 
@@ -244,6 +255,8 @@ class MINDRECORD_API ShardWriter {
   uint32_t row_count_;     // count of rows
   uint32_t schema_count_;  // count of schemas
 
+  std::string raw_page_format_;  // layout of raw page
+
   std::vector<uint64_t> raw_data_size_;   // Raw data size
   std::vector<uint64_t> blob_data_size_;  // Blob data size
 
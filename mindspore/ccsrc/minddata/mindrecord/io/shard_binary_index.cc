@@ -0,0 +1,570 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_binary_index.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <set>
+#include <sstream>
+
+#include "utils/file_utils.h"
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+// blob page id, first row and row count of a row group summary
+const uint64_t kPageSummaryLen = 3;
+
+uint64_t WordCount(uint64_t bytes) { return (bytes + kInt64Len - 1) / kInt64Len; }
+
+void AppendString(const std::string &str, std::vector<uint64_t> *words) {
+  words->push_back(str.size());
+  auto start = words->size();
+  words->resize(start + WordCount(str.size()), 0);
+  if (!str.empty()) {
+    (void)memcpy(words->data() + start, str.data(), str.size());
+  }
+}
+
+// convert the whole string to number like the numeric affinity of sqlite
+bool ToNumber(const std::string &str, double *number) {
+  if (str.empty()) {
+    return false;
+  }
+  char *end = nullptr;
+  *number = std::strtod(str.c_str(), &end);
+  return end == str.c_str() + str.size();
+}
+
+// write the number in one form like sqlite, so that the forms of a number like "1" and "1.0" are one value
+std::string NormalizeNumber(const std::string &str) {
+  double number = 0;
+  if (!ToNumber(str, &number)) {
+    return str;
+  }
+  char *end = nullptr;
+  errno = 0;
+  auto integer = std::strtoll(str.c_str(), &end, 10);
+  if (end == str.c_str() + str.size() && errno != ERANGE) {
+    return std::to_string(integer);
+  }
+  // the integral value out of the range of int64 is kept as a real number
+  const double kInt64Bound = 9223372036854775808.0;
+  if (std::floor(number) == number && number >= -kInt64Bound && number < kInt64Bound) {
+    return std::to_string(static_cast<int64_t>(number));
+  }
+  // the shortest precision which keeps the value, like the text of real numbers in sqlite
+  const int kShortPrecision = 15;
+  const int kFullPrecision = 17;
+  std::ostringstream out;
+  out << std::setprecision(kShortPrecision) << number;
+  double short_number = 0;
+  if (ToNumber(out.str(), &short_number) && short_number == number) {
+    return out.str();
+  }
+  out.str("");
+  out << std::setprecision(kFullPrecision) << number;
+  return out.str();
+}
+
+// the numbers are compared by value and placed before the other strings in a numeric field
+bool LessValue(bool numeric, const std::string &a, const std::string &b) {
+  if (!numeric) {
+    return a < b;
+  }
+  double number_a = 0;
+  double number_b = 0;
+  bool is_number_a = ToNumber(a, &number_a);
+  bool is_number_b = ToNumber(b, &number_b);
+  if (is_number_a && is_number_b) {
+    return number_a < number_b;
+  }
+  if (is_number_a != is_number_b) {
+    return is_number_a;
+  }
+  return a < b;
+}
+
+Status GetFileSize(const std::string &file, uint64_t *size) {
+  struct stat file_stat;
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(stat(file.c_str(), &file_stat) == 0,
+                                  "Invalid file, failed to get the size of mindrecord file: " + file);
+  *size = static_cast<uint64_t>(file_stat.st_size);
+  return Status::OK();
+}
+}  // namespace
+
+ShardBinaryIndex::~ShardBinaryIndex() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  if (mapped_ && munmap(const_cast<uint8_t *>(data_), size_) != 0) {
+    MS_LOG(ERROR) << "[Internal ERROR] Failed to unmap mindrecord index file, errno: " << errno;
+  }
+#endif
+}
+
+Status ShardBinaryIndex::Load(const std::string &file, const std::string &shard_name,
+                              std::unique_ptr<ShardBinaryIndex> *index) {
+  RETURN_UNEXPECTED_IF_NULL_MR(index);
+  auto realpath = FileUtils::GetRealPath((file + kBinaryIndexSuffix).c_str());
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(realpath.has_value(),
+                                  "Invalid file, failed to get the realpath of mindrecord index file: " + file +
+                                    kBinaryIndexSuffix);
+  uint64_t shard_size = 0;
+  RETURN_IF_NOT_OK_MR(GetFileSize(file, &shard_size));
+  auto result = std::make_unique<ShardBinaryIndex>();
+#if !defined(_WIN32) && !defined(_WIN64)
+  int fd = open(realpath.value().c_str(), O_RDONLY);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(fd >= 0, "Invalid file, failed to open mindrecord index file, errno: " +
+                                             std::to_string(errno) + ". Please check file: " + realpath.value());
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size < static_cast<off_t>(kInt64Len)) {
+    (void)close(fd);
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, the mindrecord index file is empty: " + realpath.value());
+  }
+  auto length = static_cast<uint64_t>(file_stat.st_size);
+  void *addr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+  (void)close(fd);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(addr != MAP_FAILED, "[Internal ERROR] Failed to map mindrecord index file, errno: " +
+                                                        std::to_string(errno) + ". Please check file: " +
+                                                        realpath.value());
+  result->data_ = reinterpret_cast<const uint8_t *>(addr);
+  result->size_ = length;
+  result->mapped_ = true;
+#else
+  std::ifstream in(realpath.value(), std::ios::in | std::ios::binary | std::ios::ate);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(in.good(), "Invalid file, failed to open mindrecord index file: " + realpath.value());
+  auto length = static_cast<uint64_t>(in.tellg());
+  result->buffer_.resize(WordCount(length));
+  (void)in.seekg(0, std::ios::beg);
+  (void)in.read(reinterpret_cast<char *>(result->buffer_.data()), static_cast<std::streamsize>(length));
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(in.good(), "Invalid file, failed to read mindrecord index file: " + realpath.value());
+  result->data_ = reinterpret_cast<const uint8_t *>(result->buffer_.data());
+  result->size_ = length;
+#endif
+  RETURN_IF_NOT_OK_MR(result->Parse(shard_name, shard_size));
+  *index = std::move(result);
+  return Status::OK();
+}
+
+Status ShardBinaryIndex::Parse(const std::string &shard_name, uint64_t shard_size) {
+  const auto *words = reinterpret_cast<const uint64_t *>(data_);
+  uint64_t word_count = size_ / kInt64Len;
+  uint64_t offset = 0;
+  auto read_words = [&](uint64_t count, const uint64_t **ptr) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(count <= word_count - offset,
+                                    "Invalid file, the mindrecord index file is truncated, please generate it again.");
+    *ptr = words + offset;
+    offset += count;
+    return Status::OK();
+  };
+  const uint64_t *head = nullptr;
+  const uint64_t kHeadLen = 6;
+  RETURN_IF_NOT_OK_MR(read_words(kHeadLen, &head));
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(memcmp(head, kBinaryIndexMagic, kInt64Len) == 0,
+                                  "Invalid file, the magic number of mindrecord index file is not matched.");
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(head[1] == shard_size,
+                                  "Invalid file, the mindrecord index file is outdated since mindrecord file: " +
+                                    shard_name + " is modified.");
+  row_count_ = head[2];
+  page_count_ = head[3];
+  uint64_t field_count = head[4];
+  uint64_t name_size = head[5];
+  const uint64_t *name = nullptr;
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(name_size <= size_, "Invalid file, the shard name of mindrecord index is corrupted.");
+  RETURN_IF_NOT_OK_MR(read_words(WordCount(name_size), &name));
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(std::string(reinterpret_cast<const char *>(name), name_size) == shard_name,
+                                  "Invalid file, mindrecord index file and mindrecord file: " + shard_name +
+                                    " can not match. Please do not rename the mindrecord file or index file.");
+
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(row_count_ <= word_count / kIndexColumnNum && page_count_ <= row_count_ &&
+                                    field_count <= kMaxFieldCount,
+                                  "Invalid file, the head of mindrecord index file is corrupted.");
+  RETURN_IF_NOT_OK_MR(read_words(row_count_ * kIndexColumnNum, &rows_));
+  for (uint64_t i = 1; i < row_count_; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(GetRowColumn(i - 1, kIndexRowId) < GetRowColumn(i, kIndexRowId),
+                                    "Invalid file, the rows of mindrecord index file are not sorted by row id.");
+  }
+  RETURN_IF_NOT_OK_MR(read_words(page_count_ * kPageSummaryLen, &pages_));
+  for (uint64_t i = 0; i < page_count_; ++i) {
+    const uint64_t *page = pages_ + i * kPageSummaryLen;
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(page[1] <= row_count_ && page[kInt2] <= row_count_ - page[1] &&
+                                      (i == 0 || *(page - kPageSummaryLen) <= page[0]),
+                                    "Invalid file, the row group summaries of mindrecord index file are corrupted.");
+  }
+
+  fields_.clear();
+  field_ids_.clear();
+  for (uint64_t i = 0; i < field_count; ++i) {
+    BinaryIndexField field;
+    RETURN_IF_NOT_OK_MR(ParseField(&offset, &field));
+    field_ids_[field.name] = fields_.size();
+    fields_.push_back(std::move(field));
+  }
+  return Status::OK();
+}
+
+Status ShardBinaryIndex::ParseField(uint64_t *offset, BinaryIndexField *field) {
+  const auto *words = reinterpret_cast<const uint64_t *>(data_);
+  uint64_t word_count = size_ / kInt64Len;
+  auto read_words = [&](uint64_t count, const uint64_t **ptr) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(count <= word_count - *offset,
+                                    "Invalid file, the mindrecord index file is truncated, please generate it again.");
+    *ptr = words + *offset;
+    *offset += count;
+    return Status::OK();
+  };
+  const uint64_t *value = nullptr;
+  RETURN_IF_NOT_OK_MR(read_words(1, &value));
+  uint64_t name_size = *value;
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(name_size <= size_, "Invalid file, the field name of mindrecord index is corrupted.");
+  RETURN_IF_NOT_OK_MR(read_words(WordCount(name_size), &value));
+  field->name = std::string(reinterpret_cast<const char *>(value), name_size);
+  RETURN_IF_NOT_OK_MR(read_words(kInt2, &value));
+  field->numeric = value[0] != 0;
+  field->value_count = value[1];
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(field->value_count <= row_count_,
+                                  "Invalid file, the value count of field: " + field->name +
+                                    " in mindrecord index file is corrupted.");
+
+  RETURN_IF_NOT_OK_MR(read_words(field->value_count + 1, &field->value_offsets));
+  RETURN_IF_NOT_OK_MR(read_words(1, &value));
+  uint64_t value_size = *value;
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(value_size <= size_, "Invalid file, the values of field: " + field->name +
+                                                         " in mindrecord index file are corrupted.");
+  RETURN_IF_NOT_OK_MR(read_words(WordCount(value_size), &value));
+  field->values = reinterpret_cast<const char *>(value);
+  for (uint64_t i = 0; i < field->value_count; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(
+      field->value_offsets[i] <= field->value_offsets[i + 1] && field->value_offsets[i + 1] <= value_size,
+      "Invalid file, the value offsets of field: " + field->name + " in mindrecord index file are corrupted.");
+  }
+
+  RETURN_IF_NOT_OK_MR(read_words(row_count_, &field->value_ids));
+  RETURN_IF_NOT_OK_MR(read_words(field->value_count + 1, &field->posting_offsets));
+  RETURN_IF_NOT_OK_MR(read_words(row_count_, &field->postings));
+  for (uint64_t i = 0; i < row_count_; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(field->value_ids[i] < field->value_count && field->postings[i] < row_count_,
+                                    "Invalid file, the rows of field: " + field->name +
+                                      " in mindrecord index file are corrupted.");
+  }
+  for (uint64_t i = 0; i < field->value_count; ++i) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(field->posting_offsets[i] <= field->posting_offsets[i + 1] &&
+                                      field->posting_offsets[i + 1] <= row_count_,
+                                    "Invalid file, the posting lists of field: " + field->name +
+                                      " in mindrecord index file are corrupted.");
+  }
+  return Status::OK();
+}
+
+bool ShardBinaryIndex::FindRow(uint64_t row_id, uint64_t *pos) const {
+  uint64_t low = 0;
+  uint64_t high = row_count_;
+  while (low < high) {
+    uint64_t mid = low + (high - low) / kInt2;
+    if (GetRowColumn(mid, kIndexRowId) < row_id) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low < row_count_ && GetRowColumn(low, kIndexRowId) == row_id) {
+    *pos = low;
+    return true;
+  }
+  return false;
+}
+
+Status ShardBinaryIndex::GetRowsInPage(uint64_t page_id, const std::pair<std::string, std::string> &criteria,
+                                       std::vector<uint64_t> *positions) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(positions);
+  positions->clear();
+  const uint64_t *postings_begin = nullptr;
+  const uint64_t *postings_end = nullptr;
+  if (!criteria.first.empty()) {
+    const BinaryIndexField *field = nullptr;
+    RETURN_IF_NOT_OK_MR(GetField(criteria.first, &field));
+    uint64_t value_id = 0;
+    if (!FindValue(*field, criteria.second, &value_id)) {
+      return Status::OK();
+    }
+    postings_begin = field->postings + field->posting_offsets[value_id];
+    postings_end = field->postings + field->posting_offsets[value_id + 1];
+  }
+
+  // the row group summaries of the page, there is usually only one
+  uint64_t low = 0;
+  uint64_t high = page_count_;
+  while (low < high) {
+    uint64_t mid = low + (high - low) / kInt2;
+    if (pages_[mid * kPageSummaryLen] < page_id) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  for (uint64_t i = low; i < page_count_ && pages_[i * kPageSummaryLen] == page_id; ++i) {
+    uint64_t first = pages_[i * kPageSummaryLen + 1];
+    uint64_t end = first + pages_[i * kPageSummaryLen + kInt2];
+    if (criteria.first.empty()) {
+      for (uint64_t pos = first; pos < end; ++pos) {
+        positions->push_back(pos);
+      }
+      continue;
+    }
+    for (auto iter = std::lower_bound(postings_begin, postings_end, first); iter != postings_end && *iter < end;
+         ++iter) {
+      positions->push_back(*iter);
+    }
+  }
+  return Status::OK();
+}
+
+Status ShardBinaryIndex::GetPagesByCategory(const std::pair<std::string, std::string> &criteria,
+                                            std::vector<uint64_t> *page_ids) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(page_ids);
+  std::set<uint64_t> pages;
+  if (criteria.first.empty()) {
+    for (uint64_t i = 0; i < page_count_; ++i) {
+      (void)pages.insert(pages_[i * kPageSummaryLen]);
+    }
+  } else {
+    const BinaryIndexField *field = nullptr;
+    RETURN_IF_NOT_OK_MR(GetField(criteria.first, &field));
+    uint64_t value_id = 0;
+    if (FindValue(*field, criteria.second, &value_id)) {
+      for (uint64_t i = field->posting_offsets[value_id]; i < field->posting_offsets[value_id + 1]; ++i) {
+        (void)pages.insert(GetRowColumn(field->postings[i], kIndexPageIdBlob));
+      }
+    }
+  }
+  page_ids->assign(pages.begin(), pages.end());
+  return Status::OK();
+}
+
+Status ShardBinaryIndex::GetDistinctValues(const std::string &field, std::vector<std::string> *values) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(values);
+  const BinaryIndexField *index_field = nullptr;
+  RETURN_IF_NOT_OK_MR(GetField(field, &index_field));
+  values->clear();
+  for (uint64_t i = 0; i < index_field->value_count; ++i) {
+    values->push_back(GetValue(*index_field, i));
+  }
+  return Status::OK();
+}
+
+Status ShardBinaryIndex::SelectRows(const std::vector<uint64_t> &positions, const std::vector<std::string> &fields,
+                                    std::vector<std::vector<std::string>> *rows) const {
+  RETURN_UNEXPECTED_IF_NULL_MR(rows);
+  // the fixed column, or the index field if it is not a fixed column
+  std::vector<std::pair<int, const BinaryIndexField *>> selected;
+  for (const auto &name : fields) {
+    auto iter = std::find(kBinaryIndexColumnNames.begin(), kBinaryIndexColumnNames.end(), name);
+    if (iter != kBinaryIndexColumnNames.end()) {
+      selected.emplace_back(static_cast<int>(iter - kBinaryIndexColumnNames.begin()), nullptr);
+      continue;
+    }
+    const BinaryIndexField *field = nullptr;
+    RETURN_IF_NOT_OK_MR(GetField(name, &field));
+    selected.emplace_back(kIndexColumnNum, field);
+  }
+  rows->reserve(rows->size() + positions.size());
+  for (auto pos : positions) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(pos < row_count_, "[Internal ERROR] the position: " + std::to_string(pos) +
+                                                        " exceeds the rows of mindrecord index.");
+    std::vector<std::string> row;
+    row.reserve(selected.size());
+    for (const auto &column : selected) {
+      if (column.second == nullptr) {
+        row.push_back(std::to_string(GetRowColumn(pos, static_cast<BinaryIndexColumn>(column.first))));
+      } else {
+        row.push_back(GetValue(*column.second, column.second->value_ids[pos]));
+      }
+    }
+    rows->push_back(std::move(row));
+  }
+  return Status::OK();
+}
+
+Status ShardBinaryIndex::GetField(const std::string &name, const BinaryIndexField **field) const {
+  auto iter = field_ids_.find(name);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(iter != field_ids_.end(),
+                                  "Invalid data, field: " + name + " can not found in mindrecord index file.");
+  *field = &fields_[iter->second];
+  return Status::OK();
+}
+
+std::string ShardBinaryIndex::GetValue(const BinaryIndexField &field, uint64_t value_id) const {
+  uint64_t begin = field.value_offsets[value_id];
+  return std::string(field.values + begin, field.value_offsets[value_id + 1] - begin);
+}
+
+bool ShardBinaryIndex::FindValue(const BinaryIndexField &field, const std::string &value, uint64_t *value_id) const {
+  uint64_t low = 0;
+  uint64_t high = field.value_count;
+  while (low < high) {
+    uint64_t mid = low + (high - low) / kInt2;
+    if (LessValue(field.numeric, GetValue(field, mid), value)) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  if (low < field.value_count && !LessValue(field.numeric, value, GetValue(field, low))) {
+    *value_id = low;
+    return true;
+  }
+  return false;
+}
+
+Status ShardBinaryIndexBuilder::AddRows(
+  const std::vector<std::vector<std::tuple<std::string, std::string, std::string>>> &rows) {
+  for (const auto &row : rows) {
+    std::array<uint64_t, kIndexColumnNum> columns{};
+    size_t field_no = 0;
+    for (const auto &item : row) {
+      const auto &placeholder = std::get<0>(item);
+      const auto &value = std::get<2>(item);
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(!placeholder.empty() && placeholder[0] == ':',
+                                      "[Internal ERROR] invalid placeholder: " + placeholder + " of index row.");
+      auto name = placeholder.substr(1);
+      auto iter = std::find(kBinaryIndexColumnNames.begin(), kBinaryIndexColumnNames.end(), name);
+      if (iter != kBinaryIndexColumnNames.end()) {
+        columns[iter - kBinaryIndexColumnNames.begin()] = std::strtoull(value.c_str(), nullptr, 10);
+        continue;
+      }
+      // the INC_ columns are only used to build the primary key of sqlite
+      if (name.compare(0, strlen("INC_"), "INC_") == 0) {
+        continue;
+      }
+      if (field_no == field_names_.size()) {
+        CHECK_FAIL_RETURN_UNEXPECTED_MR(rows_.empty(), "[Internal ERROR] the index fields of rows are different.");
+        field_names_.push_back(name);
+        field_numeric_.push_back(std::get<1>(item) != "TEXT");
+        field_values_.emplace_back();
+        row_values_.emplace_back();
+      }
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(field_names_[field_no] == name,
+                                      "[Internal ERROR] the index fields of rows are different.");
+      auto &values = field_values_[field_no];
+      auto value_iter =
+        values.emplace(field_numeric_[field_no] ? NormalizeNumber(value) : value, values.size()).first;
+      row_values_[field_no].push_back(value_iter->second);
+      ++field_no;
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(field_no == field_names_.size(),
+                                    "[Internal ERROR] the index fields of rows are different.");
+    rows_.push_back(columns);
+  }
+  return Status::OK();
+}
+
+Status ShardBinaryIndexBuilder::Write(const std::string &file) {
+  uint64_t shard_size = 0;
+  RETURN_IF_NOT_OK_MR(GetFileSize(file, &shard_size));
+  std::vector<uint64_t> order(rows_.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [this](uint64_t a, uint64_t b) { return rows_[a][kIndexRowId] < rows_[b][kIndexRowId]; });
+
+  // the row group summaries, the rows of a blob page are adjacent after sorting by row id
+  std::vector<std::array<uint64_t, kPageSummaryLen>> pages;
+  for (uint64_t pos = 0; pos < order.size(); ++pos) {
+    uint64_t page_id = rows_[order[pos]][kIndexPageIdBlob];
+    if (pages.empty() || pages.back()[0] != page_id || pages.back()[1] + pages.back()[kInt2] != pos) {
+      pages.push_back({page_id, pos, 0});
+    }
+    ++pages.back()[kInt2];
+  }
+  std::sort(pages.begin(), pages.end());
+
+  std::vector<uint64_t> words(1, 0);
+  (void)memcpy(words.data(), kBinaryIndexMagic, kInt64Len);
+  words.push_back(shard_size);
+  words.push_back(rows_.size());
+  words.push_back(pages.size());
+  words.push_back(field_names_.size());
+  AppendString(shard_name_, &words);
+  for (auto row : order) {
+    words.insert(words.end(), rows_[row].begin(), rows_[row].end());
+  }
+  for (const auto &page : pages) {
+    words.insert(words.end(), page.begin(), page.end());
+  }
+
+  for (size_t i = 0; i < field_names_.size(); ++i) {
+    bool numeric = field_numeric_[i];
+    std::vector<std::pair<std::string, uint64_t>> values(field_values_[i].begin(), field_values_[i].end());
+    std::sort(values.begin(), values.end(),
+              [numeric](const std::pair<std::string, uint64_t> &a, const std::pair<std::string, uint64_t> &b) {
+                return LessValue(numeric, a.first, b.first);
+              });
+    std::vector<uint64_t> sorted_ids(values.size());
+    std::string value_bytes;
+    std::vector<uint64_t> value_offsets(1, 0);
+    for (size_t id = 0; id < values.size(); ++id) {
+      sorted_ids[values[id].second] = id;
+      value_bytes += values[id].first;
+      value_offsets.push_back(value_bytes.size());
+    }
+
+    // the postings are filled by counting sort, so the rows of a value are in the order of row id
+    std::vector<uint64_t> value_ids;
+    value_ids.reserve(order.size());
+    std::vector<uint64_t> posting_offsets(values.size() + 1, 0);
+    for (auto row : order) {
+      value_ids.push_back(sorted_ids[row_values_[i][row]]);
+      ++posting_offsets[value_ids.back() + 1];
+    }
+    std::partial_sum(posting_offsets.begin(), posting_offsets.end(), posting_offsets.begin());
+    std::vector<uint64_t> postings(order.size());
+    std::vector<uint64_t> next(posting_offsets.begin(), posting_offsets.end() - 1);
+    for (uint64_t pos = 0; pos < value_ids.size(); ++pos) {
+      postings[next[value_ids[pos]]++] = pos;
+    }
+
+    AppendString(field_names_[i], &words);
+    words.push_back(numeric ? 1 : 0);
+    words.push_back(values.size());
+    words.insert(words.end(), value_offsets.begin(), value_offsets.end());
+    AppendString(value_bytes, &words);
+    words.insert(words.end(), value_ids.begin(), value_ids.end());
+    words.insert(words.end(), posting_offsets.begin(), posting_offsets.end());
+    words.insert(words.end(), postings.begin(), postings.end());
+  }
+
+  std::string index_file = file + kBinaryIndexSuffix;
+  std::ofstream out(index_file, std::ios::out | std::ios::binary | std::ios::trunc);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(out.good(), "Invalid file, failed to open mindrecord index file for writing: " +
+                                                index_file + ". Please check file path and permission.");
+  (void)out.write(reinterpret_cast<const char *>(words.data()), static_cast<std::streamsize>(words.size() * kInt64Len));
+  out.close();
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(!out.fail(), "[Internal ERROR] Failed to write mindrecord index file: " + index_file);
+  MS_LOG(INFO) << "Succeed to write " << rows_.size() << " rows to index file: " << index_file;
+  return Status::OK();
+}
+}  // namespace mindrecord
+}  // namespace mindspore
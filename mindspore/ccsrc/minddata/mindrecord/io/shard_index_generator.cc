@@ -15,6 +15,8 @@
  */
 #include "minddata/mindrecord/include/shard_index_generator.h"
 
+#include "minddata/mindrecord/include/shard_binary_index.h"
+#include "minddata/mindrecord/include/shard_raw_chunk.h"
 #include "utils/file_utils.h"
 #include "utils/ms_utils.h"
 
@@ -413,6 +415,7 @@ Status ShardIndexGenerator::GenerateRowData(int shard_no, const std::map<int, in
   RETURN_IF_NOT_OK_MR(shard_header_.GetPage(shard_no, raw_page_id, &page_ptr));
   // related blob page
   vector<pair<int, uint64_t>> row_group_list = page_ptr->GetRowGroupIds();
+  bool columnar = shard_header_.GetRawPageFormat() == kRawPageFormatColumnar;
 
   // pair: row_group id, offset in raw data page
   for (pair<int, int> blob_ids : row_group_list) {
@@ -425,12 +428,38 @@ Status ShardIndexGenerator::GenerateRowData(int shard_no, const std::map<int, in
     // offset in current raw data page
     auto cur_raw_page_offset = static_cast<uint64_t>(blob_ids.second);
     uint64_t cur_blob_page_offset = 0;
+    // the decoded rows of current chunk in columnar layout
+    std::vector<json> chunk_rows;
+    uint64_t chunk_first_row_id = 0;
+    uint64_t chunk_offset = 0;
     for (unsigned int i = blob_page_ptr->GetStartRowID(); i < blob_page_ptr->GetEndRowID(); ++i) {
       std::vector<std::tuple<std::string, std::string, std::string>> row_data;
       row_data.emplace_back(":ROW_ID", "INTEGER", std::to_string(i));
       row_data.emplace_back(":ROW_GROUP_ID", "INTEGER", std::to_string(blob_page_ptr->GetPageTypeID()));
       row_data.emplace_back(":PAGE_ID_RAW", "INTEGER", std::to_string(page_ptr->GetPageID()));
 
+      if (columnar) {
+        if (i >= chunk_first_row_id + chunk_rows.size()) {
+          chunk_offset = cur_raw_page_offset;
+          uint64_t chunk_size = 0;
+          RETURN_IF_NOT_OK_MR(ShardRawChunk::Read(&in, page_size_ * page_ptr->GetPageID() + header_size_ + chunk_offset,
+                                                  {}, &chunk_rows, &chunk_first_row_id, &chunk_size));
+          CHECK_FAIL_RETURN_UNEXPECTED_MR(chunk_first_row_id == i && !chunk_rows.empty(),
+                                          "Invalid file, the first row id: " + std::to_string(chunk_first_row_id) +
+                                            " of columnar raw chunk is not equal to the row id: " + std::to_string(i) +
+                                            " in blob page, please check correction of MindRecord File.");
+          cur_raw_page_offset += kInt64Len + chunk_size;
+        }
+        // all the rows of a chunk share the location of the chunk
+        row_data.emplace_back(":PAGE_OFFSET_RAW", "INTEGER", std::to_string(chunk_offset));
+        row_data.emplace_back(":PAGE_OFFSET_RAW_END", "INTEGER", std::to_string(cur_raw_page_offset));
+        auto detail_ptr = std::make_shared<std::vector<json>>(1, chunk_rows[i - chunk_first_row_id]);
+        RETURN_IF_NOT_OK_MR(AddBlobPageInfo(row_data, blob_page_ptr, cur_blob_page_offset, in));
+        AddIndexFieldByRawData(*detail_ptr, row_data);
+        (*row_data_ptr)->push_back(std::move(row_data));
+        continue;
+      }
+
       // raw data start
       row_data.emplace_back(":PAGE_OFFSET_RAW", "INTEGER", std::to_string(cur_raw_page_offset));
 
@@ -511,6 +540,11 @@ Status ShardIndexGenerator::ExecuteTransaction(const int &shard_no, sqlite3 *db,
       "-a): " +
       shard_address);
   }
+  std::shared_ptr<std::string> fn_ptr;
+  RELEASE_AND_RETURN_IF_NOT_OK_MR(GetFileName(shard_address, &fn_ptr), db, in);
+  // the binary index is built from the same rows as the meta file
+  ShardBinaryIndexBuilder index_builder(*fn_ptr);
+  bool build_index = true;
   (void)sqlite3_exec(db, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr);
   for (int raw_page_id : raw_page_ids) {
     std::shared_ptr<std::string> sql_ptr;
@@ -520,10 +554,28 @@ Status ShardIndexGenerator::ExecuteTransaction(const int &shard_no, sqlite3 *db,
                                     in);
     RELEASE_AND_RETURN_IF_NOT_OK_MR(BindParameterExecuteSQL(db, *sql_ptr, *row_data_ptr), db, in);
     MS_LOG(INFO) << "Insert " << row_data_ptr->size() << " rows to index db.";
+    if (build_index) {
+      auto status = index_builder.AddRows(*row_data_ptr);
+      if (status.IsError()) {
+        MS_LOG(WARNING) << "Failed to build the index file of shard: " << shard_no << ", " << status.ToString();
+        build_index = false;
+      }
+    }
   }
   (void)sqlite3_exec(db, "END TRANSACTION;", nullptr, nullptr, nullptr);
   in.close();
 
+  // the reader queries the meta file by sqlite if the index file is absent
+  std::string index_file = realpath.value() + kBinaryIndexSuffix;
+  (void)std::remove(index_file.c_str());
+  if (build_index) {
+    auto status = index_builder.Write(realpath.value());
+    if (status.IsError()) {
+      MS_LOG(WARNING) << "Failed to write the index file of shard: " << shard_no << ", " << status.ToString();
+      (void)std::remove(index_file.c_str());
+    }
+  }
+
   // Close database
   sqlite3_close(db);
   db = nullptr;
@@ -0,0 +1,358 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_io_engine.h"
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
+
+#include "utils/file_utils.h"
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace mindrecord {
+ShardIoEngine::ShardIoEngine(uint64_t max_inflight_bytes, int io_thread_num)
+    : max_inflight_bytes_(max_inflight_bytes), io_thread_num_(std::min(std::max(io_thread_num, 1), kMaxIoThreadNum)) {}
+
+ShardIoEngine::~ShardIoEngine() { Close(); }
+
+Status ShardIoEngine::Open(const std::vector<std::string> &file_paths) {
+  Close();
+#if defined(_WIN32) || defined(_WIN64)
+  RETURN_STATUS_UNEXPECTED_MR("The prefetching of mindrecord files is not supported on windows.");
+#else
+  for (const auto &file : file_paths) {
+    auto realpath = FileUtils::GetRealPath(common::SafeCStr(file));
+    if (!realpath.has_value()) {
+      Close();
+      RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to get the realpath of mindrecord files. Please check file: " +
+                                  file);
+    }
+    int fd = open(realpath.value().c_str(), O_RDONLY);
+    if (fd < 0) {
+      Close();
+      RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to open mindrecord file for prefetching, errno: " +
+                                  std::to_string(errno) + ". Please check file: " + file);
+    }
+    fds_.push_back(fd);
+  }
+  return Status::OK();
+#endif
+}
+
+void ShardIoEngine::Close() {
+  Stop();
+#if !defined(_WIN32) && !defined(_WIN64)
+  for (int fd : fds_) {
+    (void)close(fd);
+  }
+#endif
+  fds_.clear();
+}
+
+Status ShardIoEngine::Start(const Locator &locator, const std::vector<int64_t> &task_ids) {
+  Stop();
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(!fds_.empty(),
+                                  "[Internal ERROR] The mindrecord files are not opened for prefetching.");
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(max_inflight_bytes_ > 0, "[Internal ERROR] The prefetch size should be positive.");
+  locator_ = locator;
+  task_ids_ = task_ids;
+  running_ = true;
+  blocked_size_ = 0;
+  schedule_done_ = false;
+  schedule_thread_ = std::thread(&ShardIoEngine::ScheduleLoop, this);
+  for (int i = 0; i < io_thread_num_; ++i) {
+    (void)io_threads_.emplace_back(&ShardIoEngine::IoLoop, this);
+  }
+  MS_LOG(INFO) << "Start prefetching " << task_ids_.size() << " tasks of mindrecord files with " << io_thread_num_
+               << " io threads, the prefetch size is " << max_inflight_bytes_ << " bytes.";
+  return Status::OK();
+}
+
+void ShardIoEngine::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+  }
+  cv_schedule_.notify_all();
+  cv_io_.notify_all();
+  cv_ready_.notify_all();
+  if (schedule_thread_.joinable()) {
+    schedule_thread_.join();
+  }
+  for (auto &io_thread : io_threads_) {
+    if (io_thread.joinable()) {
+      io_thread.join();
+    }
+  }
+  io_threads_.clear();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  io_queue_.clear();
+  pending_.clear();
+  ready_.clear();
+  missed_.clear();
+  inflight_bytes_ = 0;
+  task_ids_.clear();
+  locator_ = nullptr;
+}
+
+bool ShardIoEngine::Take(int64_t task_id, std::vector<uint8_t> *blob, BlobLocation *location) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!running_) {
+    return false;
+  }
+  // Wait for the schedule thread if it is catching up with the consumers.
+  cv_ready_.wait(lock, [this, task_id]() {
+    return !running_ || pending_.count(task_id) > 0 || ScheduleBlocked() || schedule_done_;
+  });
+  if (!running_) {
+    return false;
+  }
+  if (pending_.count(task_id) == 0) {
+    // The task is out of the prefetching window, skip it when it is scheduled later.
+    if (!schedule_done_) {
+      ++missed_[task_id];
+    }
+    return false;
+  }
+  cv_ready_.wait(lock, [this, task_id]() {
+    auto iter = ready_.find(task_id);
+    return !running_ || (iter != ready_.end() && !iter->second.empty());
+  });
+  if (!running_) {
+    return false;
+  }
+
+  auto ready_iter = ready_.find(task_id);
+  auto item = std::move(ready_iter->second.front());
+  ready_iter->second.pop_front();
+  if (ready_iter->second.empty()) {
+    (void)ready_.erase(ready_iter);
+  }
+  if (--pending_[task_id] == 0) {
+    (void)pending_.erase(task_id);
+  }
+  if (!item.has_value()) {
+    return false;
+  }
+  inflight_bytes_ -= item->second.blob_size;
+  ++hit_count_;
+  lock.unlock();
+  cv_schedule_.notify_one();
+
+  *blob = std::move(item->first);
+  *location = std::move(item->second);
+  return true;
+}
+
+void ShardIoEngine::ScheduleLoop() {
+  size_t pos = 0;
+  // The located tasks which are not issued yet.
+  std::deque<BlobRequest> located;
+  // The tasks passed without prefetching.
+  std::vector<int64_t> skipped;
+  for (;;) {
+    // Locate the upcoming tasks out of the lock, it may query the index in lazy load mode.
+    while (located.size() < kMaxIoBatchSize && pos < task_ids_.size()) {
+      int64_t task_id = task_ids_[pos++];
+      BlobLocation location;
+      if (locator_(task_id, &location).IsError()) {
+        MS_LOG(WARNING) << "Failed to locate the blob of task: " << task_id << ", skip prefetching it.";
+        skipped.push_back(task_id);
+        continue;
+      }
+      if (location.task_type == TaskType::kPaddedTask) {
+        skipped.push_back(task_id);
+        continue;
+      }
+      located.push_back({task_id, std::move(location)});
+    }
+    if (!skipped.empty()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto task_id : skipped) {
+        (void)ConsumeMissed(task_id);
+      }
+      skipped.clear();
+    }
+    if (located.empty()) {
+      break;
+    }
+
+    std::vector<BlobRequest> blobs;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      uint64_t first_size = located.front().location.blob_size;
+      auto can_issue = [this, first_size]() {
+        return !running_ || inflight_bytes_ == 0 || inflight_bytes_ + first_size <= max_inflight_bytes_;
+      };
+      if (!can_issue()) {
+        // The consumers waiting for the tasks not scheduled should read them by themselves.
+        blocked_size_ = first_size;
+        cv_ready_.notify_all();
+        cv_schedule_.wait(lock, can_issue);
+        blocked_size_ = 0;
+      }
+      if (!running_) {
+        return;
+      }
+      while (!located.empty()) {
+        auto &blob = located.front();
+        if (ConsumeMissed(blob.task_id)) {
+          // The task has been read by the consumer itself.
+          located.pop_front();
+          continue;
+        }
+        // A blob larger than the whole budget is read alone.
+        if (inflight_bytes_ != 0 && inflight_bytes_ + blob.location.blob_size > max_inflight_bytes_) {
+          break;
+        }
+        inflight_bytes_ += blob.location.blob_size;
+        ++pending_[blob.task_id];
+        blobs.push_back(std::move(blob));
+        located.pop_front();
+      }
+      auto requests = Coalesce(&blobs);
+      for (auto &request : requests) {
+        io_queue_.push_back(std::move(request));
+      }
+    }
+    cv_io_.notify_all();
+    cv_ready_.notify_all();
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    schedule_done_ = true;
+    missed_.clear();
+  }
+  cv_ready_.notify_all();
+  MS_LOG(DEBUG) << "All tasks of mindrecord files are scheduled for prefetching.";
+}
+
+bool ShardIoEngine::ConsumeMissed(int64_t task_id) {
+  auto missed_iter = missed_.find(task_id);
+  if (missed_iter == missed_.end()) {
+    return false;
+  }
+  if (--missed_iter->second == 0) {
+    (void)missed_.erase(missed_iter);
+  }
+  return true;
+}
+
+bool ShardIoEngine::ScheduleBlocked() const {
+  return blocked_size_ != 0 && inflight_bytes_ != 0 && inflight_bytes_ + blocked_size_ > max_inflight_bytes_;
+}
+
+std::vector<ShardIoEngine::IoRequest> ShardIoEngine::Coalesce(std::vector<BlobRequest> *blobs) {
+  std::sort(blobs->begin(), blobs->end(), [](const BlobRequest &lhs, const BlobRequest &rhs) {
+    return std::make_pair(lhs.location.shard_id, lhs.location.file_offset) <
+           std::make_pair(rhs.location.shard_id, rhs.location.file_offset);
+  });
+  std::vector<IoRequest> requests;
+  for (auto &blob : *blobs) {
+    const auto &location = blob.location;
+    uint64_t blob_end = location.file_offset + location.blob_size;
+    if (!requests.empty()) {
+      auto &last = requests.back();
+      uint64_t last_end = last.file_offset + last.length;
+      if (last.shard_id == location.shard_id && location.file_offset <= last_end + kMaxCoalesceGap &&
+          std::max(last_end, blob_end) - last.file_offset <= kMaxCoalesceLength) {
+        last.length = std::max(last_end, blob_end) - last.file_offset;
+        last.blobs.push_back(std::move(blob));
+        continue;
+      }
+    }
+    IoRequest request{location.shard_id, location.file_offset, location.blob_size, {}};
+    request.blobs.push_back(std::move(blob));
+    requests.push_back(std::move(request));
+  }
+  return requests;
+}
+
+void ShardIoEngine::IoLoop() {
+  for (;;) {
+    IoRequest request;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_io_.wait(lock, [this]() { return !running_ || !io_queue_.empty(); });
+      if (!running_) {
+        return;
+      }
+      request = std::move(io_queue_.front());
+      io_queue_.pop_front();
+    }
+
+    std::vector<std::vector<uint8_t>> blob_data;
+    auto status = Read(request, &blob_data);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (size_t i = 0; i < request.blobs.size(); ++i) {
+        auto &blob = request.blobs[i];
+        if (status.IsError()) {
+          // Release the budget at once, the consumer reads the blob by itself.
+          inflight_bytes_ -= blob.location.blob_size;
+          ready_[blob.task_id].emplace_back(std::nullopt);
+        } else {
+          ready_[blob.task_id].emplace_back(std::make_pair(std::move(blob_data[i]), std::move(blob.location)));
+        }
+      }
+    }
+    if (status.IsError()) {
+      MS_LOG(WARNING) << "Failed to prefetch mindrecord file, " << status.ToString();
+      cv_schedule_.notify_one();
+    }
+    cv_ready_.notify_all();
+  }
+}
+
+Status ShardIoEngine::Read(const IoRequest &request, std::vector<std::vector<uint8_t>> *blobs) {
+#if defined(_WIN32) || defined(_WIN64)
+  RETURN_STATUS_UNEXPECTED_MR("The prefetching of mindrecord files is not supported on windows.");
+#else
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(request.shard_id < fds_.size(),
+                                  "[Internal ERROR] 'shard_id': " + std::to_string(request.shard_id) +
+                                    " is out of bound: " + std::to_string(fds_.size()));
+  int fd = fds_[request.shard_id];
+  std::vector<uint8_t> buffer(request.length);
+  uint64_t done = 0;
+  while (done < request.length) {
+    auto ret = pread(fd, buffer.data() + done, request.length - done, static_cast<off_t>(request.file_offset + done));
+    if (ret < 0 && errno == EINTR) {
+      continue;
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(ret > 0, "Invalid file, failed to read mindrecord file at offset: " +
+                                               std::to_string(request.file_offset + done) +
+                                               ", errno: " + std::to_string(errno));
+    done += static_cast<uint64_t>(ret);
+  }
+  // The single blob is returned without copying, the coalesced read is split into blobs.
+  if (request.blobs.size() == 1) {
+    blobs->push_back(std::move(buffer));
+    return Status::OK();
+  }
+  for (const auto &blob : request.blobs) {
+    auto begin = buffer.begin() + static_cast<ptrdiff_t>(blob.location.file_offset - request.file_offset);
+    (void)blobs->emplace_back(begin, begin + static_cast<ptrdiff_t>(blob.location.blob_size));
+  }
+  return Status::OK();
+#endif
+}
+}  // namespace mindrecord
+}  // namespace mindspore
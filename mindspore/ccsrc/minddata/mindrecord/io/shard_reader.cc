@@ -16,15 +16,37 @@
 
 #include "minddata/mindrecord/include/shard_reader.h"
 
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 #include <algorithm>
+#include <numeric>
 #include <thread>
 
 #include "utils/file_utils.h"
 #include "minddata/mindrecord/include/shard_distributed_sample.h"
+#include "minddata/mindrecord/include/shard_raw_chunk.h"
 #include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace mindrecord {
+// the position of ROW_ID in the selected fields of a row, it follows the offsets of raw data in columnar layout
+const int kColumnarRowIdIndex = 6;
+
+// join the fields of index for the sql
+std::string JoinFields(const std::vector<std::string> &fields) {
+  std::string result;
+  for (const auto &field : fields) {
+    if (!result.empty()) {
+      result += ", ";
+    }
+    result += field;
+  }
+  return result;
+}
+
 template <class Type>
 // convert the string to exactly number type (int32_t/int64_t/float/double)
 Type StringToNum(const std::string &str) {
@@ -45,7 +67,18 @@ ShardReader::ShardReader()
       sample_id_position_(0),
       deliver_id_(0),
       lazy_load_(false),
-      shard_sample_count_() {}
+      shard_sample_count_() {
+  use_mmap_ = common::GetEnv(kEnvMindRecordMmap) == "1";
+  use_binary_index_ = common::GetEnv(kEnvMindRecordBinaryIndex) != "0";
+  std::string prefetch_size = common::GetEnv(kEnvMindRecordPrefetchSize);
+  if (!prefetch_size.empty()) {
+    prefetch_size_ = std::strtoull(prefetch_size.c_str(), nullptr, 10);
+  }
+  std::string io_thread_num = common::GetEnv(kEnvMindRecordIoThreads);
+  if (!io_thread_num.empty()) {
+    io_thread_num_ = static_cast<int>(std::strtol(io_thread_num.c_str(), nullptr, 10));
+  }
+}
 
 Status ShardReader::GetMeta(const std::string &file_path, std::shared_ptr<json> meta_data_ptr,
                             std::shared_ptr<std::vector<std::string>> *addresses_ptr) {
@@ -83,9 +116,24 @@ Status ShardReader::Init(const std::vector<std::string> &file_paths, bool load_d
       *meta_data_ptr == *first_meta_data_ptr,
       "Invalid file, the metadata of mindrecord file: " + file +
         " is different from others, please make sure all the mindrecord files generated by the same script.");
+    std::unique_ptr<ShardBinaryIndex> index = nullptr;
+    if (use_binary_index_) {
+      std::shared_ptr<std::string> fn_ptr;
+      RETURN_IF_NOT_OK_MR(GetFileName(file, &fn_ptr));
+      auto status = ShardBinaryIndex::Load(file, *fn_ptr, &index);
+      if (status.IsError()) {
+        MS_LOG(INFO) << "The index file of mindrecord file: " << file
+                     << " is unavailable, query the meta file instead. " << status.ToString();
+        index = nullptr;
+      }
+    }
+    // the meta file is opened lazily if the binary index is loaded, which saves the time of opening thousands of shards
     sqlite3 *db = nullptr;
-    RETURN_IF_NOT_OK_MR(VerifyDataset(&db, file));
+    if (index == nullptr) {
+      RETURN_IF_NOT_OK_MR(VerifyDataset(&db, file));
+    }
     database_paths_.push_back(db);
+    binary_indexes_.push_back(std::move(index));
   }
   ShardHeader sh = ShardHeader();
   RETURN_IF_NOT_OK_MR(sh.BuildDataset(file_paths_, load_dataset));
@@ -169,6 +217,20 @@ Status ShardReader::VerifyDataset(sqlite3 **db, const string &file) {
   return Status::OK();
 }
 
+Status ShardReader::GetDatabase(int shard_id, sqlite3 **db) {
+  RETURN_UNEXPECTED_IF_NULL_MR(db);
+  std::lock_guard<std::mutex> lck(database_mutex_);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(shard_id >= 0 && shard_id < static_cast<int>(database_paths_.size()),
+                                  "[Internal ERROR] 'shard_id': " + std::to_string(shard_id) + " is out of range.");
+  if (database_paths_[shard_id] == nullptr) {
+    sqlite3 *handle = nullptr;
+    RETURN_IF_NOT_OK_MR(VerifyDataset(&handle, file_paths_[shard_id]));
+    database_paths_[shard_id] = handle;
+  }
+  *db = database_paths_[shard_id];
+  return Status::OK();
+}
+
 Status ShardReader::CheckColumnList(const std::vector<std::string> &selected_columns) {
   auto schema_ptr = GetShardHeader()->GetSchemas()[0];
   auto schema = schema_ptr->GetSchema()["schema"];
@@ -212,7 +274,85 @@ Status ShardReader::Open(int n_consumer) {
     }
     MS_LOG(INFO) << "Succeed to open file, path: " << file;
   }
+  if (use_mmap_) {
+    RETURN_IF_NOT_OK_MR(MapShardFiles());
+  }
+  io_engine_ = nullptr;
+  if (prefetch_size_ > 0 && !IsMmapMode()) {
+    io_engine_ = std::make_unique<ShardIoEngine>(prefetch_size_, io_thread_num_);
+    auto status = io_engine_->Open(file_paths_);
+    if (status.IsError()) {
+      MS_LOG(WARNING) << "Failed to open mindrecord files for prefetching, read them without prefetching. "
+                      << status.ToString();
+      io_engine_ = nullptr;
+    }
+  }
+  return Status::OK();
+}
+
+Status ShardReader::MapShardFiles() {
+  UnmapShardFiles();
+#if defined(_WIN32) || defined(_WIN64)
+  MS_LOG(WARNING) << "The memory-mapped mindrecord file is not supported on windows, read by file stream instead.";
+  return Status::OK();
+#else
+  for (const auto &file : file_paths_) {
+    auto realpath = FileUtils::GetRealPath(common::SafeCStr(file));
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(
+      realpath.has_value(), "Invalid file, failed to get the realpath of mindrecord files. Please check file: " + file);
+    int fd = open(realpath.value().c_str(), O_RDONLY);
+    if (fd < 0) {
+      UnmapShardFiles();
+      RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to open mindrecord file for mapping, errno: " +
+                                  std::to_string(errno) + ". Please check file: " + file);
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+      (void)close(fd);
+      UnmapShardFiles();
+      RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to get the size of mindrecord file: " + file);
+    }
+    auto length = static_cast<uint64_t>(file_stat.st_size);
+    void *addr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps a reference to the file, so the descriptor could be closed at once.
+    (void)close(fd);
+    if (addr == MAP_FAILED) {
+      UnmapShardFiles();
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to map mindrecord file, errno: " + std::to_string(errno) +
+                                  ". Please check file: " + file);
+    }
+    (void)mapped_shards_.emplace_back(reinterpret_cast<const uint8_t *>(addr), length);
+  }
+  MS_LOG(INFO) << "Succeed to map " << mapped_shards_.size() << " mindrecord files.";
   return Status::OK();
+#endif
+}
+
+void ShardReader::StartPrefetch() {
+  if (io_engine_ == nullptr) {
+    return;
+  }
+  auto locator = [this](int64_t task_id, BlobLocation *location) {
+    RETURN_UNEXPECTED_IF_NULL_MR(location);
+    return GetTaskLocation(task_id, &location->task_type, &location->shard_id, &location->file_offset,
+                           &location->blob_size, &location->var_fields);
+  };
+  auto status = io_engine_->Start(locator, tasks_.sample_ids_);
+  if (status.IsError()) {
+    MS_LOG(WARNING) << "Failed to start prefetching mindrecord files, read them without prefetching. "
+                    << status.ToString();
+  }
+}
+
+void ShardReader::UnmapShardFiles() {
+#if !defined(_WIN32) && !defined(_WIN64)
+  for (const auto &mapped_shard : mapped_shards_) {
+    if (munmap(const_cast<uint8_t *>(mapped_shard.first), mapped_shard.second) != 0) {
+      MS_LOG(ERROR) << "[Internal ERROR] Failed to unmap mindrecord file, errno: " << errno;
+    }
+  }
+#endif
+  mapped_shards_.clear();
 }
 
 Status ShardReader::ExtendRandomFileStreams(const int n_new_consumers) {
@@ -316,6 +456,7 @@ void ShardReader::FileStreamsOperator() {
       database_paths_[i] = nullptr;
     }
   }
+  UnmapShardFiles();
 }
 
 ShardReader::~ShardReader() { Close(); }
@@ -334,6 +475,9 @@ void ShardReader::Close() {
     }
   }
 
+  if (io_engine_ != nullptr) {
+    io_engine_->Close();
+  }
   FileStreamsOperator();
 }
 
@@ -391,6 +535,8 @@ Status ShardReader::ConvertLabelToJson(const std::vector<std::vector<std::string
                                        int shard_id, const std::vector<std::string> &columns,
                                        std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr) {
   auto schema = shard_header_->GetSchemas()[0]->GetSchema()["schema"];
+  bool columnar = shard_header_->GetRawPageFormat() == kRawPageFormatColumnar;
+  RawChunkCache chunk_cache;
   for (int i = 0; i < static_cast<int>(labels.size()); ++i) {
     try {
       uint64_t group_id = std::stoull(labels[i][0]);
@@ -400,6 +546,16 @@ Status ShardReader::ConvertLabelToJson(const std::vector<std::vector<std::string
         std::vector<uint64_t>{static_cast<uint64_t>(shard_id), group_id, offset_start, offset_end});
       if (!all_in_index_) {
         int raw_page_id = std::stoi(labels[i][3]);
+        if (columnar) {
+          // only the selected columns of the chunk are read, and the rows of the chunk are decoded once
+          json label_json;
+          uint64_t chunk_offset = page_size_ * raw_page_id + header_size_ + std::stoull(labels[i][4]);
+          uint64_t row_id = std::stoull(labels[i][kColumnarRowIdIndex]);
+          RETURN_IF_NOT_OK_MR(
+            ShardRawChunk::ReadRow(fs.get(), chunk_offset, row_id, columns, &chunk_cache, &label_json));
+          (*col_val_ptr)[shard_id].emplace_back(std::move(label_json));
+          continue;
+        }
         uint64_t label_start = std::stoull(labels[i][4]) + kInt64Len;
         uint64_t label_end = std::stoull(labels[i][5]);
         auto len = label_end - label_start;
@@ -466,45 +622,55 @@ Status ShardReader::ConvertJsonValue(const std::vector<std::string> &label, cons
   }
   return Status::OK();
 }
-Status ShardReader::ReadAllRowsInShard(int shard_id, const std::string &sql, const std::vector<std::string> &columns,
+Status ShardReader::ReadAllRowsInShard(int shard_id, const std::vector<std::string> &fields, int64_t row_id,
+                                       const std::vector<std::string> &columns,
                                        std::shared_ptr<std::vector<std::vector<std::vector<uint64_t>>>> offset_ptr,
                                        std::shared_ptr<std::vector<std::vector<json>>> col_val_ptr) {
-  auto db = database_paths_[shard_id];
   std::vector<std::vector<std::string>> labels;
-  char *errmsg = nullptr;
-  int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &labels, &errmsg);
-  if (rc != SQLITE_OK) {
-    std::ostringstream oss;
-    oss << "[Internal ERROR] Failed to execute the sql [ " << sql << " ] while reading meta file, " << errmsg;
+  if (HasBinaryIndex(shard_id)) {
+    const auto &index = binary_indexes_[shard_id];
+    std::vector<uint64_t> positions;
+    uint64_t pos = 0;
+    if (row_id < 0) {
+      positions.resize(index->GetRowCount());
+      std::iota(positions.begin(), positions.end(), 0);
+    } else if (index->FindRow(static_cast<uint64_t>(row_id), &pos)) {
+      positions.push_back(pos);
+    }
+    RETURN_IF_NOT_OK_MR(index->SelectRows(positions, fields, &labels));
+  } else {
+    std::string sql = "SELECT " + JoinFields(fields) + " FROM INDEXES ";
+    sql += row_id < 0 ? "ORDER BY ROW_ID ;" : "WHERE ROW_ID = " + std::to_string(row_id);
+    sqlite3 *db = nullptr;
+    RETURN_IF_NOT_OK_MR(GetDatabase(shard_id, &db));
+    char *errmsg = nullptr;
+    int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &labels, &errmsg);
+    if (rc != SQLITE_OK) {
+      std::ostringstream oss;
+      oss << "[Internal ERROR] Failed to execute the sql [ " << sql << " ] while reading meta file, " << errmsg;
+      sqlite3_free(errmsg);
+      RETURN_STATUS_UNEXPECTED_MR(oss.str());
+    }
     sqlite3_free(errmsg);
-    sqlite3_close(db);
-    db = nullptr;
-    RETURN_STATUS_UNEXPECTED_MR(oss.str());
   }
   MS_LOG(INFO) << "Succeed to get " << labels.size() << " records from shard " << std::to_string(shard_id) << " index.";
 
   std::string file_name = file_paths_[shard_id];
   auto realpath = FileUtils::GetRealPath(file_name.c_str());
-  if (!realpath.has_value()) {
-    sqlite3_free(errmsg);
-    sqlite3_close(db);
-    RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to get the realpath of mindrecord files. Please check file: " +
-                                file_name);
-  }
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(
+    realpath.has_value(),
+    "Invalid file, failed to get the realpath of mindrecord files. Please check file: " + file_name);
 
   std::shared_ptr<std::fstream> fs = std::make_shared<std::fstream>();
   if (!all_in_index_) {
     fs->open(realpath.value(), std::ios::in | std::ios::binary);
     if (!fs->good()) {
-      sqlite3_free(errmsg);
-      sqlite3_close(db);
       RETURN_STATUS_UNEXPECTED_MR(
         "Invalid file, failed to open files for reading mindrecord files. Please check file path, permission and open "
         "files limit(ulimit -a): " +
         file_name);
     }
   }
-  sqlite3_free(errmsg);
   return ConvertLabelToJson(labels, fs, offset_ptr, shard_id, columns, col_val_ptr);
 }
 
@@ -521,10 +687,9 @@ Status ShardReader::GetAllClasses(const std::string &category_field,
   std::shared_ptr<std::string> fn_ptr;
   RETURN_IF_NOT_OK_MR(
     ShardIndexGenerator::GenerateFieldName(std::make_pair(index_columns[category_field], category_field), &fn_ptr));
-  std::string sql = "SELECT DISTINCT " + *fn_ptr + " FROM INDEXES";
   std::vector<std::thread> threads = std::vector<std::thread>(shard_count_);
   for (int x = 0; x < shard_count_; x++) {
-    threads[x] = std::thread(&ShardReader::GetClassesInShard, this, database_paths_[x], x, sql, category_ptr);
+    threads[x] = std::thread(&ShardReader::GetClassesInShard, this, x, *fn_ptr, category_ptr);
   }
 
   for (int x = 0; x < shard_count_; x++) {
@@ -533,56 +698,78 @@ Status ShardReader::GetAllClasses(const std::string &category_field,
   return Status::OK();
 }
 
-void ShardReader::GetClassesInShard(sqlite3 *db, int shard_id, const std::string &sql,
+void ShardReader::GetClassesInShard(int shard_id, const std::string &field,
                                     std::shared_ptr<std::set<std::string>> category_ptr) {
-  if (db == nullptr) {
-    return;
-  }
-  std::vector<std::vector<std::string>> columns;
-  char *errmsg = nullptr;
-  int ret = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &columns, &errmsg);
-  if (ret != SQLITE_OK) {
+  std::vector<std::string> classes;
+  if (HasBinaryIndex(shard_id)) {
+    auto status = binary_indexes_[shard_id]->GetDistinctValues(field, &classes);
+    if (status.IsError()) {
+      MS_LOG(ERROR) << "[Internal ERROR] Failed to get the classes of shard " << shard_id << ", " << status.ToString();
+      return;
+    }
+  } else {
+    sqlite3 *db = nullptr;
+    auto status = GetDatabase(shard_id, &db);
+    if (status.IsError()) {
+      MS_LOG(ERROR) << status.ToString();
+      return;
+    }
+    std::string sql = "SELECT DISTINCT " + field + " FROM INDEXES";
+    std::vector<std::vector<std::string>> columns;
+    char *errmsg = nullptr;
+    int ret = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &columns, &errmsg);
+    if (ret != SQLITE_OK) {
+      MS_LOG(ERROR) << "[Internal ERROR] Failed to execute the sql [ " << common::SafeCStr(sql)
+                    << " ] while reading meta file, " << errmsg;
+      sqlite3_free(errmsg);
+      return;
+    }
     sqlite3_free(errmsg);
-    sqlite3_close(db);
-    db = nullptr;
-    MS_LOG(ERROR) << "[Internal ERROR] Failed to execute the sql [ " << common::SafeCStr(sql)
-                  << " ] while reading meta file, " << errmsg;
-    return;
+    for (const auto &column : columns) {
+      classes.push_back(column[0]);
+    }
   }
-  MS_LOG(INFO) << "Succeed to get " << columns.size() << " records from shard " << std::to_string(shard_id)
+  MS_LOG(INFO) << "Succeed to get " << classes.size() << " records from shard " << std::to_string(shard_id)
                << " index.";
   std::lock_guard<std::mutex> lck(shard_locker_);
-  for (int i = 0; i < static_cast<int>(columns.size()); ++i) {
-    category_ptr->emplace(columns[i][0]);
+  for (const auto &category : classes) {
+    category_ptr->emplace(category);
   }
-  sqlite3_free(errmsg);
 }
 
-Status ShardReader::ReadAllRowGroup(const std::vector<std::string> &columns,
-                                    std::shared_ptr<ROW_GROUPS> *row_group_ptr) {
-  RETURN_UNEXPECTED_IF_NULL_MR(row_group_ptr);
-  std::string fields = "ROW_GROUP_ID, PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END";
-  auto offset_ptr = std::make_shared<std::vector<std::vector<std::vector<uint64_t>>>>(
-    shard_count_, std::vector<std::vector<uint64_t>>{});
-  auto col_val_ptr = std::make_shared<std::vector<std::vector<json>>>(shard_count_, std::vector<json>{});
-
+Status ShardReader::GenerateRowFields(const std::vector<std::string> &columns, std::vector<std::string> *fields) {
+  RETURN_UNEXPECTED_IF_NULL_MR(fields);
+  *fields = {"ROW_GROUP_ID", "PAGE_OFFSET_BLOB", "PAGE_OFFSET_BLOB_END"};
   if (all_in_index_) {
     for (unsigned int i = 0; i < columns.size(); ++i) {
-      fields += ',';
       std::shared_ptr<std::string> fn_ptr;
       RETURN_IF_NOT_OK_MR(
         ShardIndexGenerator::GenerateFieldName(std::make_pair(column_schema_id_[columns[i]], columns[i]), &fn_ptr));
-      fields += *fn_ptr;
+      fields->push_back(*fn_ptr);
     }
   } else {  // fetch raw data from Raw page while some field is not index.
-    fields += ", PAGE_ID_RAW, PAGE_OFFSET_RAW, PAGE_OFFSET_RAW_END ";
+    fields->insert(fields->end(), {"PAGE_ID_RAW", "PAGE_OFFSET_RAW", "PAGE_OFFSET_RAW_END"});
+    // the row id locates the row in the columnar raw chunk
+    if (shard_header_->GetRawPageFormat() == kRawPageFormatColumnar) {
+      fields->push_back("ROW_ID");
+    }
   }
+  return Status::OK();
+}
 
-  std::string sql = "SELECT " + fields + " FROM INDEXES ORDER BY ROW_ID ;";
+Status ShardReader::ReadAllRowGroup(const std::vector<std::string> &columns,
+                                    std::shared_ptr<ROW_GROUPS> *row_group_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(row_group_ptr);
+  auto offset_ptr = std::make_shared<std::vector<std::vector<std::vector<uint64_t>>>>(
+    shard_count_, std::vector<std::vector<uint64_t>>{});
+  auto col_val_ptr = std::make_shared<std::vector<std::vector<json>>>(shard_count_, std::vector<json>{});
+  std::vector<std::string> fields;
+  RETURN_IF_NOT_OK_MR(GenerateRowFields(columns, &fields));
 
   std::vector<std::thread> thread_read_db = std::vector<std::thread>(shard_count_);
   for (int x = 0; x < shard_count_; x++) {
-    thread_read_db[x] = std::thread(&ShardReader::ReadAllRowsInShard, this, x, sql, columns, offset_ptr, col_val_ptr);
+    thread_read_db[x] =
+      std::thread(&ShardReader::ReadAllRowsInShard, this, x, fields, -1, columns, offset_ptr, col_val_ptr);
   }
 
   for (int x = 0; x < shard_count_; x++) {
@@ -596,25 +783,13 @@ Status ShardReader::ReadRowGroupByShardIDAndSampleID(const std::vector<std::stri
                                                      const uint32_t &sample_id,
                                                      std::shared_ptr<ROW_GROUPS> *row_group_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(row_group_ptr);
-  std::string fields = "ROW_GROUP_ID, PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END";
   auto offset_ptr = std::make_shared<std::vector<std::vector<std::vector<uint64_t>>>>(
     shard_count_, std::vector<std::vector<uint64_t>>{});
   auto col_val_ptr = std::make_shared<std::vector<std::vector<json>>>(shard_count_, std::vector<json>{});
-  if (all_in_index_) {
-    for (unsigned int i = 0; i < columns.size(); ++i) {
-      fields += ',';
-      std::shared_ptr<std::string> fn_ptr;
-      RETURN_IF_NOT_OK_MR(
-        ShardIndexGenerator::GenerateFieldName(std::make_pair(column_schema_id_[columns[i]], columns[i]), &fn_ptr));
-      fields += *fn_ptr;
-    }
-  } else {  // fetch raw data from Raw page while some field is not index.
-    fields += ", PAGE_ID_RAW, PAGE_OFFSET_RAW, PAGE_OFFSET_RAW_END ";
-  }
-
-  std::string sql = "SELECT " + fields + " FROM INDEXES WHERE ROW_ID = " + std::to_string(sample_id);
+  std::vector<std::string> fields;
+  RETURN_IF_NOT_OK_MR(GenerateRowFields(columns, &fields));
 
-  RETURN_IF_NOT_OK_MR(ReadAllRowsInShard(shard_id, sql, columns, offset_ptr, col_val_ptr));
+  RETURN_IF_NOT_OK_MR(ReadAllRowsInShard(shard_id, fields, sample_id, columns, offset_ptr, col_val_ptr));
   *row_group_ptr = std::make_shared<ROW_GROUPS>(std::move(*offset_ptr), std::move(*col_val_ptr));
   return Status::OK();
 }
@@ -671,9 +846,36 @@ int ShardReader::SelectCallback(void *p_data, int num_fields, char **p_fields, c
   return 0;
 }
 
+std::pair<std::string, std::string> ShardReader::GetIndexCriteria(const std::pair<std::string, std::string> &criteria) {
+  if (criteria.first.empty()) {
+    return criteria;
+  }
+  return std::make_pair(criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]), criteria.second);
+}
+
 std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int shard_id,
                                                                const std::pair<std::string, std::string> &criteria) {
-  auto db = database_paths_[shard_id];
+  std::vector<std::vector<std::string>> image_offsets;
+  if (HasBinaryIndex(shard_id)) {
+    std::vector<uint64_t> positions;
+    auto status = binary_indexes_[shard_id]->GetRowsInPage(page_id, GetIndexCriteria(criteria), &positions);
+    if (status.IsOk()) {
+      status = binary_indexes_[shard_id]->SelectRows(positions, {"PAGE_OFFSET_BLOB", "PAGE_OFFSET_BLOB_END"},
+                                                     &image_offsets);
+    }
+    if (status.IsError()) {
+      MS_LOG(ERROR) << "[Internal ERROR] Failed to get the blob offsets of page " << page_id << " in shard "
+                    << shard_id << ", " << status.ToString();
+      return std::vector<std::vector<uint64_t>>();
+    }
+    return ConvertImageOffsets(image_offsets);
+  }
+  sqlite3 *db = nullptr;
+  auto status = GetDatabase(shard_id, &db);
+  if (status.IsError()) {
+    MS_LOG(ERROR) << status.ToString();
+    return std::vector<std::vector<uint64_t>>();
+  }
 
   std::string sql =
     "SELECT PAGE_OFFSET_BLOB, PAGE_OFFSET_BLOB_END FROM INDEXES WHERE PAGE_ID_BLOB = " + std::to_string(page_id);
@@ -692,19 +894,22 @@ std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int
     }
   }
   sql += ";";
-  std::vector<std::vector<std::string>> image_offsets;
   char *errmsg = nullptr;
   int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &image_offsets, &errmsg);
   if (rc != SQLITE_OK) {
     MS_LOG(ERROR) << "[Internal ERROR] Failed to execute the sql [ " << common::SafeCStr(sql)
                   << " ] while reading meta file, " << errmsg;
     sqlite3_free(errmsg);
-    sqlite3_close(db);
-    db = nullptr;
     return std::vector<std::vector<uint64_t>>();
   } else {
     MS_LOG(DEBUG) << "Succeed to get " << image_offsets.size() << " records from index.";
   }
+  sqlite3_free(errmsg);
+  return ConvertImageOffsets(image_offsets);
+}
+
+std::vector<std::vector<uint64_t>> ShardReader::ConvertImageOffsets(
+  const std::vector<std::vector<std::string>> &image_offsets) {
   std::vector<std::vector<uint64_t>> res;
   for (int i = static_cast<int>(image_offsets.size()) - 1; i >= 0; i--) {
     res.emplace_back(std::vector<uint64_t>{0, 0});
@@ -714,14 +919,20 @@ std::vector<std::vector<uint64_t>> ShardReader::GetImageOffset(int page_id, int
     res[i][0] = std::stoull(image_offset[0]) + kInt64Len;
     res[i][1] = std::stoull(image_offset[1]);
   }
-  sqlite3_free(errmsg);
   return res;
 }
 
 Status ShardReader::GetPagesByCategory(int shard_id, const std::pair<std::string, std::string> &criteria,
                                        std::shared_ptr<std::vector<uint64_t>> *pages_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(pages_ptr);
-  auto db = database_paths_[shard_id];
+  if (HasBinaryIndex(shard_id)) {
+    std::vector<uint64_t> page_ids;
+    RETURN_IF_NOT_OK_MR(binary_indexes_[shard_id]->GetPagesByCategory(GetIndexCriteria(criteria), &page_ids));
+    (*pages_ptr)->insert((*pages_ptr)->end(), page_ids.begin(), page_ids.end());
+    return Status::OK();
+  }
+  sqlite3 *db = nullptr;
+  RETURN_IF_NOT_OK_MR(GetDatabase(shard_id, &db));
 
   std::string sql = "SELECT DISTINCT PAGE_ID_BLOB FROM INDEXES WHERE 1 = 1 ";
 
@@ -742,8 +953,6 @@ Status ShardReader::GetPagesByCategory(int shard_id, const std::pair<std::string
   if (rc != SQLITE_OK) {
     string ss(errmsg);
     sqlite3_free(errmsg);
-    sqlite3_close(db);
-    db = nullptr;
     RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to execute the sql [ " + sql + " ] while reading meta file, " +
                                 ss);
   } else {
@@ -830,6 +1039,8 @@ Status ShardReader::GetLabelsFromBinaryFile(int shard_id, const std::vector<std:
     (*labels_ptr)->emplace_back(json{});
   }
 
+  bool columnar = shard_header_->GetRawPageFormat() == kRawPageFormatColumnar;
+  RawChunkCache chunk_cache;
   for (unsigned int i = 0; i < label_offsets.size(); ++i) {
     const auto &labelOffset = label_offsets[i];
     if (labelOffset.size() < 3) {
@@ -837,6 +1048,14 @@ Status ShardReader::GetLabelsFromBinaryFile(int shard_id, const std::vector<std:
       RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] 'labelOffset' size should be less than 3 but got: " +
                                   std::to_string(labelOffset.size()) + ".");
     }
+    if (columnar) {
+      // the whole labels are returned as the row layout does
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(labelOffset.size() > kInt3, "[Internal ERROR] the row id of label is missing.");
+      uint64_t chunk_offset = page_size_ * std::stoull(labelOffset[0]) + header_size_ + std::stoull(labelOffset[1]);
+      RETURN_IF_NOT_OK_MR(ShardRawChunk::ReadRow(fs.get(), chunk_offset, std::stoull(labelOffset[kInt3]), {},
+                                                 &chunk_cache, &(*(*labels_ptr))[i]));
+      continue;
+    }
     uint64_t label_start = std::stoull(labelOffset[1]) + kInt64Len;
     uint64_t label_end = std::stoull(labelOffset[2]);
     int raw_page_id = std::stoi(labelOffset[0]);
@@ -869,11 +1088,21 @@ Status ShardReader::GetLabelsFromPage(int page_id, int shard_id, const std::vect
                                       const std::pair<std::string, std::string> &criteria,
                                       std::shared_ptr<std::vector<json>> *labels_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(labels_ptr);
-  // get page info from sqlite
-  auto db = database_paths_[shard_id];
-  std::string sql = "SELECT PAGE_ID_RAW, PAGE_OFFSET_RAW,PAGE_OFFSET_RAW_END FROM INDEXES WHERE PAGE_ID_BLOB = " +
-                    std::to_string(page_id);
+  std::vector<std::string> fields = {"PAGE_ID_RAW", "PAGE_OFFSET_RAW", "PAGE_OFFSET_RAW_END"};
+  if (shard_header_->GetRawPageFormat() == kRawPageFormatColumnar) {
+    fields.push_back("ROW_ID");
+  }
   auto label_offset_ptr = std::make_shared<std::vector<std::vector<std::string>>>();
+  if (HasBinaryIndex(shard_id)) {
+    std::vector<uint64_t> positions;
+    RETURN_IF_NOT_OK_MR(binary_indexes_[shard_id]->GetRowsInPage(page_id, GetIndexCriteria(criteria), &positions));
+    RETURN_IF_NOT_OK_MR(binary_indexes_[shard_id]->SelectRows(positions, fields, label_offset_ptr.get()));
+    return GetLabelsFromBinaryFile(shard_id, columns, *label_offset_ptr, labels_ptr);
+  }
+  // get page info from sqlite
+  sqlite3 *db = nullptr;
+  RETURN_IF_NOT_OK_MR(GetDatabase(shard_id, &db));
+  std::string sql = "SELECT " + JoinFields(fields) + " FROM INDEXES WHERE PAGE_ID_BLOB = " + std::to_string(page_id);
   if (!criteria.first.empty()) {
     sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = :criteria";
     RETURN_IF_NOT_OK_MR(QueryWithCriteria(db, sql, criteria.second, label_offset_ptr));
@@ -886,8 +1115,6 @@ Status ShardReader::GetLabelsFromPage(int page_id, int shard_id, const std::vect
       oss << "[Internal ERROR] Failed to execute the sql [ " << common::SafeCStr(sql) << " ] while reading meta file, "
           << errmsg;
       sqlite3_free(errmsg);
-      sqlite3_close(db);
-      db = nullptr;
       RETURN_STATUS_UNEXPECTED_MR(oss.str());
     }
     MS_LOG(DEBUG) << "Succeed to get " << label_offset_ptr->size() << " records from index.";
@@ -902,39 +1129,39 @@ Status ShardReader::GetLabels(int page_id, int shard_id, const std::vector<std::
                               std::shared_ptr<std::vector<json>> *labels_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(labels_ptr);
   if (all_in_index_) {
-    auto db = database_paths_[shard_id];
-    std::string fields;
+    std::vector<std::string> fields;
     for (unsigned int i = 0; i < columns.size(); ++i) {
-      if (i > 0) {
-        fields += ',';
-      }
       uint64_t schema_id = column_schema_id_[columns[i]];
-      fields += columns[i] + "_" + std::to_string(schema_id);
-    }
-    if (fields.empty()) {
-      fields = "*";
+      fields.push_back(columns[i] + "_" + std::to_string(schema_id));
     }
     auto labels = std::make_shared<std::vector<std::vector<std::string>>>();
-    std::string sql = "SELECT " + fields + " FROM INDEXES WHERE PAGE_ID_BLOB = " + std::to_string(page_id);
-    if (!criteria.first.empty()) {
-      sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = " + ":criteria";
-      RETURN_IF_NOT_OK_MR(QueryWithCriteria(db, sql, criteria.second, labels));
+    if (HasBinaryIndex(shard_id) && !fields.empty()) {
+      std::vector<uint64_t> positions;
+      RETURN_IF_NOT_OK_MR(binary_indexes_[shard_id]->GetRowsInPage(page_id, GetIndexCriteria(criteria), &positions));
+      RETURN_IF_NOT_OK_MR(binary_indexes_[shard_id]->SelectRows(positions, fields, labels.get()));
     } else {
-      sql += ";";
-      char *errmsg = nullptr;
-      int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, labels.get(), &errmsg);
-      if (rc != SQLITE_OK) {
-        std::ostringstream oss;
-        oss << "[Internal ERROR] Failed to execute the sql [ " << common::SafeCStr(sql)
-            << " ] while reading meta file, " << errmsg;
-        sqlite3_free(errmsg);
-        sqlite3_close(db);
-        db = nullptr;
-        RETURN_STATUS_UNEXPECTED_MR(oss.str());
+      sqlite3 *db = nullptr;
+      RETURN_IF_NOT_OK_MR(GetDatabase(shard_id, &db));
+      std::string sql = "SELECT " + (fields.empty() ? std::string("*") : JoinFields(fields)) +
+                        " FROM INDEXES WHERE PAGE_ID_BLOB = " + std::to_string(page_id);
+      if (!criteria.first.empty()) {
+        sql += " AND " + criteria.first + "_" + std::to_string(column_schema_id_[criteria.first]) + " = " + ":criteria";
+        RETURN_IF_NOT_OK_MR(QueryWithCriteria(db, sql, criteria.second, labels));
       } else {
-        MS_LOG(DEBUG) << "Succeed to get " << labels->size() << " records from index.";
+        sql += ";";
+        char *errmsg = nullptr;
+        int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, labels.get(), &errmsg);
+        if (rc != SQLITE_OK) {
+          std::ostringstream oss;
+          oss << "[Internal ERROR] Failed to execute the sql [ " << common::SafeCStr(sql)
+              << " ] while reading meta file, " << errmsg;
+          sqlite3_free(errmsg);
+          RETURN_STATUS_UNEXPECTED_MR(oss.str());
+        } else {
+          MS_LOG(DEBUG) << "Succeed to get " << labels->size() << " records from index.";
+        }
+        sqlite3_free(errmsg);
       }
-      sqlite3_free(errmsg);
     }
     for (unsigned int i = 0; i < labels->size(); ++i) {
       (*labels_ptr)->emplace_back(json{});
@@ -986,31 +1213,15 @@ int64_t ShardReader::GetNumClasses(const std::string &category_field) {
   std::shared_ptr<std::string> fn_ptr;
   (void)ShardIndexGenerator::GenerateFieldName(std::make_pair(map_schema_id_fields[category_field], category_field),
                                                &fn_ptr);
-  std::string sql = "SELECT DISTINCT " + *fn_ptr + " FROM INDEXES";
   std::vector<std::thread> threads = std::vector<std::thread>(shard_count);
   auto category_ptr = std::make_shared<std::set<std::string>>();
-  sqlite3 *db = nullptr;
   for (int x = 0; x < shard_count; x++) {
-    std::string path_utf8 = "";
-#if defined(_WIN32) || defined(_WIN64)
-    path_utf8 = FileUtils::GB2312ToUTF_8((file_paths_[x] + ".db").data());
-#endif
-    if (path_utf8.empty()) {
-      path_utf8 = file_paths_[x] + ".db";
-    }
-
-    int rc = sqlite3_open_v2(path_utf8.data(), &db, SQLITE_OPEN_READONLY, nullptr);
-    if (SQLITE_OK != rc) {
-      MS_LOG(ERROR) << "[Internal ERROR] Failed to open meta file: " << file_paths_[x] + ".db, " << sqlite3_errmsg(db);
-      return -1;
-    }
-    threads[x] = std::thread(&ShardReader::GetClassesInShard, this, db, x, sql, category_ptr);
+    threads[x] = std::thread(&ShardReader::GetClassesInShard, this, x, *fn_ptr, category_ptr);
   }
 
   for (int x = 0; x < shard_count; x++) {
     threads[x].join();
   }
-  sqlite3_close(db);
   return category_ptr->size();
 }
 
@@ -1115,6 +1326,7 @@ Status ShardReader::Launch(bool is_sample_read) {
     interrupt_ = true;
     return status;
   }
+  StartPrefetch();
   if (is_sample_read) {
     return Status::OK();
   }
@@ -1332,35 +1544,35 @@ Status ShardReader::CreateTasks(const std::vector<std::tuple<int, int, int, uint
   return Status::OK();
 }
 
-Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
-                                    std::shared_ptr<TASK_CONTENT> *task_content_ptr) {
-  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+Status ShardReader::GetTaskLocation(int64_t task_id, TaskType *task_type, uint32_t *shard_id, uint64_t *file_offset,
+                                    uint64_t *blob_size, json *var_fields) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_type);
+  RETURN_UNEXPECTED_IF_NULL_MR(shard_id);
+  RETURN_UNEXPECTED_IF_NULL_MR(file_offset);
+  RETURN_UNEXPECTED_IF_NULL_MR(blob_size);
+  RETURN_UNEXPECTED_IF_NULL_MR(var_fields);
   // All tasks are done
   CHECK_FAIL_RETURN_UNEXPECTED_MR(task_id < tasks_.Size(), "[Internal ERROR] 'task_id': " + std::to_string(task_id) +
                                                              " is out of bound: " + std::to_string(tasks_.Size()));
-  uint32_t shard_id = 0;
   uint32_t group_id = 0;
   uint32_t blob_start = 0;
   uint32_t blob_end = 0;
-  json var_fields;
   // Pick up task from task list
   ShardTask task = tasks_.GetTaskByID(task_id);
 
   // check task type
-  auto task_type = std::get<0>(task);
-  if (task_type == TaskType::kPaddedTask) {
-    *task_content_ptr =
-      std::make_shared<TASK_CONTENT>(TaskType::kPaddedTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
+  *task_type = std::get<0>(task);
+  if (*task_type == TaskType::kPaddedTask) {
     return Status::OK();
   }
 
-  shard_id = std::get<0>(std::get<1>(task));  // shard id
+  *shard_id = std::get<0>(std::get<1>(task));  // shard id
 
   if (lazy_load_ == false) {
     group_id = std::get<1>(std::get<1>(task));  // group id
     blob_start = std::get<2>(task)[0];          // blob start
     blob_end = std::get<2>(task)[1];            // blob end
-    var_fields = std::get<3>(task);             // scalar variable field
+    *var_fields = std::get<3>(task);            // scalar variable field
   } else {
     // get scalar variable fields by sample id
     uint32_t sample_id_in_shard = std::get<1>(std::get<1>(task));
@@ -1368,35 +1580,85 @@ Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
     // read the meta from index
     std::shared_ptr<ROW_GROUPS> row_group_ptr;
     RETURN_IF_NOT_OK_MR(
-      ReadRowGroupByShardIDAndSampleID(selected_columns_, shard_id, sample_id_in_shard, &row_group_ptr));
+      ReadRowGroupByShardIDAndSampleID(selected_columns_, *shard_id, sample_id_in_shard, &row_group_ptr));
     auto &offsets = std::get<0>(*row_group_ptr);
     auto &local_columns = std::get<1>(*row_group_ptr);
 
-    group_id = offsets[shard_id][0][1];       // group_id
-    blob_start = offsets[shard_id][0][2];     // blob start
-    blob_end = offsets[shard_id][0][3];       // blob end
-    var_fields = local_columns[shard_id][0];  // scalar variable field
+    group_id = offsets[*shard_id][0][1];        // group_id
+    blob_start = offsets[*shard_id][0][2];      // blob start
+    blob_end = offsets[*shard_id][0][3];        // blob end
+    *var_fields = local_columns[*shard_id][0];  // scalar variable field
   }
 
-  // read the blob from data file
+  // locate the blob in data file
   std::shared_ptr<Page> page_ptr;
-  RETURN_IF_NOT_OK_MR(shard_header_->GetPageByGroupId(group_id, shard_id, &page_ptr));
+  RETURN_IF_NOT_OK_MR(shard_header_->GetPageByGroupId(group_id, *shard_id, &page_ptr));
   MS_LOG(DEBUG) << "[Internal ERROR] Success to get page by group id: " << group_id;
+  *file_offset = header_size_ + page_size_ * (page_ptr->GetPageID()) + blob_start;
+  *blob_size = blob_end - blob_start;
+  return Status::OK();
+}
 
-  // Pack image list
-  std::vector<uint8_t> images(blob_end - blob_start);
-  auto file_offset = header_size_ + page_size_ * (page_ptr->GetPageID()) + blob_start;
+Status ShardReader::GetBlobView(uint32_t shard_id, uint64_t file_offset, uint64_t blob_size, BLOB_VIEW *blob_view) {
+  RETURN_UNEXPECTED_IF_NULL_MR(blob_view);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(shard_id < mapped_shards_.size(),
+                                  "[Internal ERROR] 'shard_id': " + std::to_string(shard_id) +
+                                    " is out of bound of mapped files: " + std::to_string(mapped_shards_.size()));
+  const auto &mapped_shard = mapped_shards_[shard_id];
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(
+    file_offset <= mapped_shard.second && blob_size <= mapped_shard.second - file_offset,
+    "Invalid file, the blob data is out of the range of mindrecord file: " + file_paths_[shard_id] +
+      ". Please check whether the file is truncated.");
+  *blob_view = std::make_pair(mapped_shard.first + file_offset, blob_size);
+  return Status::OK();
+}
 
-  auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
-  if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
-    file_streams_random_[consumer_id][shard_id]->close();
-    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
+Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
+                                    std::shared_ptr<TASK_CONTENT> *task_content_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+  // Take the prefetched blob if any, the padded task is never prefetched.
+  if (io_engine_ != nullptr && task_id < tasks_.Size() &&
+      std::get<0>(tasks_.GetTaskByID(task_id)) == TaskType::kCommonTask) {
+    std::vector<uint8_t> images;
+    BlobLocation location;
+    if (io_engine_->Take(task_id, &images, &location)) {
+      std::vector<std::tuple<std::vector<uint8_t>, json>> batch;
+      batch.emplace_back(std::move(images), std::move(location.var_fields));
+      *task_content_ptr = std::make_shared<TASK_CONTENT>(TaskType::kCommonTask, std::move(batch));
+      return Status::OK();
+    }
   }
-  auto &io_read =
-    file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(&images[0]), blob_end - blob_start);
-  if (!io_read.good() || io_read.fail() || io_read.bad()) {
-    file_streams_random_[consumer_id][shard_id]->close();
-    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+
+  TaskType task_type = TaskType::kCommonTask;
+  uint32_t shard_id = 0;
+  uint64_t file_offset = 0;
+  uint64_t blob_size = 0;
+  json var_fields;
+  RETURN_IF_NOT_OK_MR(GetTaskLocation(task_id, &task_type, &shard_id, &file_offset, &blob_size, &var_fields));
+  if (task_type == TaskType::kPaddedTask) {
+    *task_content_ptr =
+      std::make_shared<TASK_CONTENT>(TaskType::kPaddedTask, std::vector<std::tuple<std::vector<uint8_t>, json>>());
+    return Status::OK();
+  }
+
+  // Pack image list
+  std::vector<uint8_t> images;
+  if (IsMmapMode()) {
+    BLOB_VIEW blob_view;
+    RETURN_IF_NOT_OK_MR(GetBlobView(shard_id, file_offset, blob_size, &blob_view));
+    images.assign(blob_view.first, blob_view.first + blob_view.second);
+  } else {
+    images.resize(blob_size);
+    auto &io_seekg = file_streams_random_[consumer_id][shard_id]->seekg(file_offset, std::ios::beg);
+    if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
+      file_streams_random_[consumer_id][shard_id]->close();
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
+    }
+    auto &io_read = file_streams_random_[consumer_id][shard_id]->read(reinterpret_cast<char *>(&images[0]), blob_size);
+    if (!io_read.good() || io_read.fail() || io_read.bad()) {
+      file_streams_random_[consumer_id][shard_id]->close();
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+    }
   }
 
   // Deliver batch data to output map
@@ -1407,6 +1669,29 @@ Status ShardReader::ConsumerOneTask(int64_t task_id, uint32_t consumer_id,
   return Status::OK();
 }
 
+Status ShardReader::ConsumerOneTaskView(int64_t task_id, std::shared_ptr<TASK_VIEW_CONTENT> *task_content_ptr) {
+  RETURN_UNEXPECTED_IF_NULL_MR(task_content_ptr);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(IsMmapMode(), "[Internal ERROR] The mindrecord files are not memory-mapped.");
+  TaskType task_type = TaskType::kCommonTask;
+  uint32_t shard_id = 0;
+  uint64_t file_offset = 0;
+  uint64_t blob_size = 0;
+  json var_fields;
+  RETURN_IF_NOT_OK_MR(GetTaskLocation(task_id, &task_type, &shard_id, &file_offset, &blob_size, &var_fields));
+  if (task_type == TaskType::kPaddedTask) {
+    *task_content_ptr =
+      std::make_shared<TASK_VIEW_CONTENT>(TaskType::kPaddedTask, std::vector<std::tuple<BLOB_VIEW, json>>());
+    return Status::OK();
+  }
+
+  BLOB_VIEW blob_view;
+  RETURN_IF_NOT_OK_MR(GetBlobView(shard_id, file_offset, blob_size, &blob_view));
+  std::vector<std::tuple<BLOB_VIEW, json>> batch;
+  batch.emplace_back(blob_view, std::move(var_fields));
+  *task_content_ptr = std::make_shared<TASK_VIEW_CONTENT>(TaskType::kCommonTask, std::move(batch));
+  return Status::OK();
+}
+
 void ShardReader::ConsumerByRow(int consumer_id) {
   // Set thread name
 #if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
@@ -1481,6 +1766,16 @@ TASK_CONTENT ShardReader::GetNextById(const int64_t &task_id, const int32_t &con
   return std::move(*task_content_ptr);
 }
 
+TASK_VIEW_CONTENT ShardReader::GetNextViewById(const int64_t &task_id) {
+  auto task_content_ptr =
+    std::make_shared<TASK_VIEW_CONTENT>(TaskType::kCommonTask, std::vector<std::tuple<BLOB_VIEW, json>>());
+  if (interrupt_) {
+    return *task_content_ptr;
+  }
+  (void)ConsumerOneTaskView(task_id, &task_content_ptr);
+  return std::move(*task_content_ptr);
+}
+
 Status ShardReader::UnCompressBlob(const std::vector<uint8_t> &raw_blob_data,
                                    std::shared_ptr<std::vector<std::vector<uint8_t>>> *blob_data_ptr) {
   RETURN_UNEXPECTED_IF_NULL_MR(blob_data_ptr);
@@ -1515,10 +1810,16 @@ void ShardReader::Reset() {
     sample_id_position_ = 0;
     deliver_id_ = 0;
   }
+  // The tasks are consumed from the beginning again.
+  StartPrefetch();
   cv_delivery_.notify_all();
 }
 
 void ShardReader::ShuffleTask() {
+  // The task list is shuffled below, stop prefetching with the order of last epoch.
+  if (io_engine_ != nullptr) {
+    io_engine_->Stop();
+  }
   // exist shuffle and distributed sampler in ops, skip shuffle
   bool has_sharding = false;
   for (const auto &op : operators_) {
@@ -1542,6 +1843,7 @@ void ShardReader::ShuffleTask() {
   if (tasks_.permutation_.empty()) {
     tasks_.MakePerm();
   }
+  StartPrefetch();
 }
 
 const std::vector<int64_t> *ShardReader::GetSampleIds() {
@@ -36,14 +36,14 @@ Status ShardSegment::GetCategoryFields(std::shared_ptr<vector<std::string>> *fie
   std::string sql = "PRAGMA table_info(INDEXES);";
   std::vector<std::vector<std::string>> field_names;
 
+  sqlite3 *db = nullptr;
+  RETURN_IF_NOT_OK_MR(GetDatabase(0, &db));
   char *errmsg = nullptr;
-  int rc = sqlite3_exec(database_paths_[0], common::SafeCStr(sql), SelectCallback, &field_names, &errmsg);
+  int rc = sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &field_names, &errmsg);
   if (rc != SQLITE_OK) {
     std::ostringstream oss;
     oss << "Failed to execute sql [ " << common::SafeCStr(sql) << " ], " << errmsg;
     sqlite3_free(errmsg);
-    sqlite3_close(database_paths_[0]);
-    database_paths_[0] = nullptr;
     RETURN_STATUS_UNEXPECTED_MR(oss.str());
   } else {
     MS_LOG(INFO) << "Succeed to get " << static_cast<int>(field_names.size()) << " records from index.";
@@ -53,8 +53,6 @@ Status ShardSegment::GetCategoryFields(std::shared_ptr<vector<std::string>> *fie
   while (idx < field_names.size()) {
     if (field_names[idx].size() < 2) {
       sqlite3_free(errmsg);
-      sqlite3_close(database_paths_[0]);
-      database_paths_[0] = nullptr;
       RETURN_STATUS_UNEXPECTED_MR("Invalid data, field_names size must be greater than 1, but got: " +
                                   std::to_string(field_names[idx].size()));
     }
@@ -96,16 +94,16 @@ Status ShardSegment::WrapCategoryInfo(std::shared_ptr<CATEGORY_INFO> *category_i
   std::string sql = "SELECT " + current_category_field_ + ", COUNT(" + current_category_field_ +
                     ") AS `value_occurrence` FROM indexes GROUP BY " + current_category_field_ + ";";
 
-  for (auto &db : database_paths_) {
+  for (int shard_id = 0; shard_id < static_cast<int>(database_paths_.size()); ++shard_id) {
     std::vector<std::vector<std::string>> field_count;
 
+    sqlite3 *db = nullptr;
+    RETURN_IF_NOT_OK_MR(GetDatabase(shard_id, &db));
     char *errmsg = nullptr;
     if (sqlite3_exec(db, common::SafeCStr(sql), SelectCallback, &field_count, &errmsg) != SQLITE_OK) {
       std::ostringstream oss;
       oss << "Failed to execute sql [ " << common::SafeCStr(sql) << " ], " << errmsg;
       sqlite3_free(errmsg);
-      sqlite3_close(db);
-      db = nullptr;
       RETURN_STATUS_UNEXPECTED_MR(oss.str());
     } else {
       MS_LOG(INFO) << "Succeed to get " << static_cast<int>(field_count.size()) << " records from index.";
@@ -18,12 +18,19 @@
 #include "utils/file_utils.h"
 #include "utils/ms_utils.h"
 #include "minddata/mindrecord/include/common/shard_utils.h"
+#include "minddata/mindrecord/include/shard_binary_index.h"
+#include "minddata/mindrecord/include/shard_raw_chunk.h"
 #include "./securec.h"
 
 namespace mindspore {
 namespace mindrecord {
 ShardWriter::ShardWriter()
-    : shard_count_(1), header_size_(kDefaultHeaderSize), page_size_(kDefaultPageSize), row_count_(0), schema_count_(1) {
+    : shard_count_(1),
+      header_size_(kDefaultHeaderSize),
+      page_size_(kDefaultPageSize),
+      row_count_(0),
+      schema_count_(1),
+      raw_page_format_(kRawPageFormatRow) {
   compression_size_ = 0;
 }
 
@@ -103,6 +110,8 @@ Status ShardWriter::OpenDataFiles(bool append, bool overwrite) {
           if (res2 == 0) {
             MS_LOG(WARNING) << "Succeed to remove the old mindrecord metadata files, path: " << file + ".db";
           }
+          // the index file is generated again with the meta file
+          (void)std::remove((whole_path.value() + kBinaryIndexSuffix).c_str());
         } else {
           RETURN_STATUS_UNEXPECTED_MR(
             "Invalid file, mindrecord files already exist. Please check file path: " + file +
@@ -187,6 +196,7 @@ Status ShardWriter::OpenForAppend(const std::string &path) {
   RETURN_IF_NOT_OK_MR(SetHeaderSize(shard_header_->GetHeaderSize()));
   RETURN_IF_NOT_OK_MR(SetPageSize(shard_header_->GetPageSize()));
   compression_size_ = shard_header_->GetCompressionSize();
+  raw_page_format_ = shard_header_->GetRawPageFormat();
   RETURN_IF_NOT_OK_MR(Open(*ds, true));
   shard_column_ = std::make_shared<ShardColumn>(shard_header_);
   return Status::OK();
@@ -238,6 +248,7 @@ Status ShardWriter::SetShardHeader(std::shared_ptr<ShardHeader> header_data) {
   shard_header_ = header_data;
   shard_header_->SetHeaderSize(header_size_);
   shard_header_->SetPageSize(page_size_);
+  shard_header_->SetRawPageFormat(raw_page_format_);
   shard_column_ = std::make_shared<ShardColumn>(shard_header_);
   return Status::OK();
 }
@@ -265,6 +276,18 @@ Status ShardWriter::SetPageSize(const uint64_t &page_size) {
   return Status::OK();
 }
 
+Status ShardWriter::SetRawPageFormat(const std::string &raw_page_format) {
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(raw_page_format == kRawPageFormatRow || raw_page_format == kRawPageFormatColumnar,
+                                  "Invalid data, raw page format: " + raw_page_format + " should be '" +
+                                    kRawPageFormatRow + "' or '" + kRawPageFormatColumnar + "'.");
+  // the pages of existing files can not be converted
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(
+    shard_header_ == nullptr || shard_header_->GetRawPageFormat() == raw_page_format,
+    "Invalid data, raw page format can not be changed after the shard header is set or the file is opened for append.");
+  raw_page_format_ = raw_page_format;
+  return Status::OK();
+}
+
 void ShardWriter::DeleteErrorData(std::map<uint64_t, std::vector<json>> &raw_data,
                                   std::vector<std::vector<uint8_t>> &blob_data) {
   // get wrong data location
@@ -646,7 +669,7 @@ Status ShardWriter::WriteRawData(std::map<uint64_t, std::vector<json>> &raw_data
   // Set row size of blob data
   RETURN_IF_NOT_OK_MR(SetBlobDataSize(blob_data));
   // Write data to disk with multi threads
-  RETURN_IF_NOT_OK_MR(ParallelWriteData(blob_data, bin_raw_data));
+  RETURN_IF_NOT_OK_MR(ParallelWriteData(blob_data, bin_raw_data, raw_data.begin()->second));
   MS_LOG(INFO) << "Succeed to write " << bin_raw_data.size() << " records.";
 
   RETURN_IF_NOT_OK_MR(UnlockWriter(*fd_ptr, parallel_writer));
@@ -691,7 +714,8 @@ Status ShardWriter::WriteRawData(std::map<uint64_t, std::vector<py::handle>> &ra
 }
 
 Status ShardWriter::ParallelWriteData(const std::vector<std::vector<uint8_t>> &blob_data,
-                                      const std::vector<std::vector<uint8_t>> &bin_raw_data) {
+                                      const std::vector<std::vector<uint8_t>> &bin_raw_data,
+                                      const std::vector<json> &raw_rows) {
   auto shards = BreakIntoShards();
   // define the number of thread
   int thread_num = static_cast<int>(shard_count_);
@@ -712,7 +736,7 @@ Status ShardWriter::ParallelWriteData(const std::vector<std::vector<uint8_t>> &b
         int start_row = shards[current_thread + x].first;
         int end_row = shards[current_thread + x].second;
         thread_set[x] = std::thread(&ShardWriter::WriteByShard, this, current_thread + x, start_row, end_row,
-                                    std::ref(blob_data), std::ref(bin_raw_data));
+                                    std::ref(blob_data), std::ref(bin_raw_data), std::ref(raw_rows));
       }
       // Wait for threads done
       for (int x = 0; x < thread_num; ++x) {
@@ -727,7 +751,8 @@ Status ShardWriter::ParallelWriteData(const std::vector<std::vector<uint8_t>> &b
 
 Status ShardWriter::WriteByShard(int shard_id, int start_row, int end_row,
                                  const std::vector<std::vector<uint8_t>> &blob_data,
-                                 const std::vector<std::vector<uint8_t>> &bin_raw_data) {
+                                 const std::vector<std::vector<uint8_t>> &bin_raw_data,
+                                 const std::vector<json> &raw_rows) {
   MS_LOG(DEBUG) << "Shard: " << shard_id << ", start: " << start_row << ", end: " << end_row
                 << ", schema size: " << schema_count_;
   if (start_row == end_row) {
@@ -740,14 +765,55 @@ Status ShardWriter::WriteByShard(int shard_id, int start_row, int end_row,
   SetLastBlobPage(shard_id, last_blob_page);
 
   RETURN_IF_NOT_OK_MR(CutRowGroup(start_row, end_row, blob_data, rows_in_group, last_raw_page, last_blob_page));
+  // the first row group is appended to the last blob page
+  uint64_t first_row_id = last_blob_page ? last_blob_page->GetEndRowID() : 0;
   RETURN_IF_NOT_OK_MR(AppendBlobPage(shard_id, blob_data, rows_in_group, last_blob_page));
   RETURN_IF_NOT_OK_MR(NewBlobPage(shard_id, blob_data, rows_in_group, last_blob_page));
+  if (raw_page_format_ == kRawPageFormatColumnar) {
+    std::vector<std::vector<uint8_t>> raw_chunks;
+    RETURN_IF_NOT_OK_MR(EncodeRawChunks(rows_in_group, raw_rows, first_row_id, &raw_chunks));
+    RETURN_IF_NOT_OK_MR(ShiftRawPage(shard_id, rows_in_group, last_raw_page));
+    RETURN_IF_NOT_OK_MR(WriteRawPage(shard_id, rows_in_group, last_raw_page, raw_chunks));
+    return Status::OK();
+  }
   RETURN_IF_NOT_OK_MR(ShiftRawPage(shard_id, rows_in_group, last_raw_page));
   RETURN_IF_NOT_OK_MR(WriteRawPage(shard_id, rows_in_group, last_raw_page, bin_raw_data));
 
   return Status::OK();
 }
 
+Status ShardWriter::EncodeRawChunks(const std::vector<std::pair<int, int>> &rows_in_group,
+                                    const std::vector<json> &raw_rows, uint64_t first_row_id,
+                                    std::vector<std::vector<uint8_t>> *raw_chunks) {
+  RETURN_UNEXPECTED_IF_NULL_MR(raw_chunks);
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(schema_count_ == kMaxSchemaCount,
+                                  "[Internal ERROR] columnar raw page only supports one schema, but got: " +
+                                    std::to_string(schema_count_) + ".");
+  raw_chunks->resize(rows_in_group.size());
+  for (size_t i = 0; i < rows_in_group.size(); ++i) {
+    const auto &rows = rows_in_group[i];
+    if (rows.first == rows.second) {
+      continue;
+    }
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(rows.second <= static_cast<int>(raw_rows.size()),
+                                    "[Internal ERROR] 'end_row': " + std::to_string(rows.second) +
+                                      " should be less than the size of raw data: " + std::to_string(raw_rows.size()));
+    RETURN_IF_NOT_OK_MR(ShardRawChunk::Encode(raw_rows.begin() + rows.first, raw_rows.begin() + rows.second,
+                                              first_row_id, &(*raw_chunks)[i]));
+    first_row_id += rows.second - rows.first;
+
+    // The rows of a row group are replaced by the chunk, so the size of the row group is the size of the chunk.
+    uint64_t chunk_size = kInt64Len + (*raw_chunks)[i].size();
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(chunk_size <= page_size_,
+                                    "Invalid data, Page size: " + std::to_string(page_size_) +
+                                      " is too small to save a columnar raw chunk. Please try to use the mindrecord "
+                                      "api 'set_page_size(1<<25)' to enable 64MB page size.");
+    std::fill(raw_data_size_.begin() + rows.first, raw_data_size_.begin() + rows.second, 0);
+    raw_data_size_[rows.first] = chunk_size;
+  }
+  return Status::OK();
+}
+
 Status ShardWriter::CutRowGroup(int start_row, int end_row, const std::vector<std::vector<uint8_t>> &blob_data,
                                 std::vector<std::pair<int, int>> &rows_in_group,
                                 const std::shared_ptr<Page> &last_raw_page,
@@ -1002,6 +1068,23 @@ Status ShardWriter::FlushBlobChunk(const std::shared_ptr<std::fstream> &out,
 Status ShardWriter::FlushRawChunk(const std::shared_ptr<std::fstream> &out,
                                   const std::vector<std::pair<int, int>> &rows_in_group, const int &chunk_id,
                                   const std::vector<std::vector<uint8_t>> &bin_raw_data) {
+  if (raw_page_format_ == kRawPageFormatColumnar) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(chunk_id >= 0 && chunk_id < static_cast<int>(bin_raw_data.size()),
+                                    "[Internal ERROR] 'chunk_id': " + std::to_string(chunk_id) + " is invalid.");
+    const auto &chunk = bin_raw_data[chunk_id];
+    uint64_t chunk_len = chunk.size();
+    auto &io_handle = out->write(reinterpret_cast<char *>(&chunk_len), kInt64Len);
+    if (!io_handle.good() || io_handle.fail() || io_handle.bad()) {
+      out->close();
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to write file.");
+    }
+    auto &io_handle_data = out->write(reinterpret_cast<const char *>(chunk.data()), chunk_len);
+    if (!io_handle_data.good() || io_handle_data.fail() || io_handle_data.bad()) {
+      out->close();
+      RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to write file.");
+    }
+    return Status::OK();
+  }
   for (int i = rows_in_group[chunk_id].first; i < rows_in_group[chunk_id].second; i++) {
     // Write the size of multi schemas
     for (uint32_t j = 0; j < schema_count_; ++j) {
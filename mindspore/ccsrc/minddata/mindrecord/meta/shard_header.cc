@@ -30,7 +30,8 @@
 namespace mindspore {
 namespace mindrecord {
 std::atomic<bool> thread_status(false);
-ShardHeader::ShardHeader() : shard_count_(0), header_size_(0), page_size_(0), compression_size_(0) {
+ShardHeader::ShardHeader()
+    : shard_count_(0), header_size_(0), page_size_(0), compression_size_(0), raw_page_format_(kRawPageFormatRow) {
   index_ = std::make_shared<Index>();
 }
 
@@ -48,6 +49,11 @@ Status ShardHeader::InitializeHeader(const std::vector<json> &headers, bool load
       header_size_ = header["header_size"].get<uint64_t>();
       page_size_ = header["page_size"].get<uint64_t>();
       compression_size_ = header.contains("compression_size") ? header["compression_size"].get<uint64_t>() : 0;
+      raw_page_format_ =
+        header.contains("raw_page_format") ? header["raw_page_format"].get<std::string>() : kRawPageFormatRow;
+      CHECK_FAIL_RETURN_UNEXPECTED_MR(
+        raw_page_format_ == kRawPageFormatRow || raw_page_format_ == kRawPageFormatColumnar,
+        "Invalid file, the raw page format: " + raw_page_format_ + " of mindrecord files is not supported.");
     }
     RETURN_IF_NOT_OK_MR(ParsePage(header["page"], shard_index, load_dataset));
     shard_index++;
@@ -327,11 +333,15 @@ std::vector<std::string> ShardHeader::SerializeHeader() {
       s += "\"page\":" + pages[shardId] + ",";
       s += "\"page_size\":" + std::to_string(page_size_) + ",";
       s += "\"compression_size\":" + std::to_string(compression_size_) + ",";
+      // the field is omitted for the row layout, so that the header of row layout files is unchanged
+      if (raw_page_format_ != kRawPageFormatRow) {
+        s += "\"raw_page_format\":\"" + raw_page_format_ + "\",";
+      }
       s += "\"schema\":" + schema + ",";
       s += "\"shard_addresses\":" + address + ",";
       s += "\"shard_id\":" + std::to_string(shardId) + ",";
       s += "\"statistics\":" + stats + ",";
-      s += "\"version\":\"" + std::string(kVersion) + "\"";
+      s += "\"version\":\"" + std::string(raw_page_format_ == kRawPageFormatRow ? kVersion : kVersionColumnar) + "\"";
       s += "}";
       header.emplace_back(s);
     }
@@ -0,0 +1,267 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "minddata/mindrecord/include/shard_raw_chunk.h"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <set>
+#include <utility>
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+void AppendUInt64(uint64_t value, std::vector<uint8_t> *buffer) {
+  auto bytes = reinterpret_cast<const uint8_t *>(&value);
+  buffer->insert(buffer->end(), bytes, bytes + kInt64Len);
+}
+
+Status ReadBytes(std::fstream *fs, uint64_t offset, uint8_t *data, uint64_t size) {
+  auto &io_seekg = fs->seekg(offset, std::ios::beg);
+  if (!io_seekg.good() || io_seekg.fail() || io_seekg.bad()) {
+    fs->close();
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to seekg file.");
+  }
+  auto &io_read = fs->read(reinterpret_cast<char *>(data), size);
+  if (!io_read.good() || io_read.fail() || io_read.bad()) {
+    fs->close();
+    RETURN_STATUS_UNEXPECTED_MR("[Internal ERROR] Failed to read file.");
+  }
+  return Status::OK();
+}
+}  // namespace
+
+Status ShardRawChunk::Encode(std::vector<json>::const_iterator begin, std::vector<json>::const_iterator end,
+                             uint64_t first_row_id, std::vector<uint8_t> *chunk) {
+  RETURN_UNEXPECTED_IF_NULL_MR(chunk);
+  auto row_count = static_cast<uint64_t>(std::distance(begin, end));
+  // the columns are kept in the order of their first appearance
+  std::vector<std::string> names;
+  std::set<std::string> name_set;
+  for (auto row = begin; row != end; ++row) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(row->is_object(), "[Internal ERROR] the raw data of a row should be json object.");
+    for (const auto &item : row->items()) {
+      if (name_set.insert(item.key()).second) {
+        names.push_back(item.key());
+      }
+    }
+  }
+
+  json directory = json::array();
+  std::vector<uint8_t> payloads;
+  for (const auto &name : names) {
+    // the missing value is null, and it is skipped while decoding
+    std::vector<json> values;
+    values.reserve(row_count);
+    for (auto row = begin; row != end; ++row) {
+      auto iter = row->find(name);
+      values.push_back(iter != row->end() ? *iter : json());
+    }
+    auto encoding = ChooseEncoding(values);
+    auto payload = EncodeColumn(values, encoding);
+    directory.push_back(json::array({name, static_cast<int>(encoding), payloads.size(), payload.size()}));
+    payloads.insert(payloads.end(), payload.begin(), payload.end());
+  }
+
+  auto bin_directory = json::to_msgpack(directory);
+  chunk->clear();
+  chunk->reserve(kRawChunkHeadLen - kInt64Len + bin_directory.size() + payloads.size());
+  AppendUInt64(first_row_id, chunk);
+  AppendUInt64(row_count, chunk);
+  AppendUInt64(bin_directory.size(), chunk);
+  chunk->insert(chunk->end(), bin_directory.begin(), bin_directory.end());
+  chunk->insert(chunk->end(), payloads.begin(), payloads.end());
+  return Status::OK();
+}
+
+Status ShardRawChunk::Read(std::fstream *fs, uint64_t offset, const std::vector<std::string> &columns,
+                           std::vector<json> *rows, uint64_t *first_row_id, uint64_t *chunk_size) {
+  RETURN_UNEXPECTED_IF_NULL_MR(fs);
+  RETURN_UNEXPECTED_IF_NULL_MR(rows);
+  RETURN_UNEXPECTED_IF_NULL_MR(first_row_id);
+  RETURN_UNEXPECTED_IF_NULL_MR(chunk_size);
+  uint64_t head[kRawChunkHeadLen / kInt64Len] = {0};
+  RETURN_IF_NOT_OK_MR(ReadBytes(fs, offset, reinterpret_cast<uint8_t *>(head), kRawChunkHeadLen));
+  *chunk_size = head[0];
+  *first_row_id = head[1];
+  uint64_t row_count = head[2];
+  uint64_t directory_size = head[3];
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(*chunk_size >= kRawChunkHeadLen - kInt64Len &&
+                                    directory_size <= *chunk_size - (kRawChunkHeadLen - kInt64Len),
+                                  "Invalid file, the columnar raw chunk at offset " + std::to_string(offset) +
+                                    " is corrupted, please check correction of MindRecord File.");
+  uint64_t payload_size = *chunk_size - (kRawChunkHeadLen - kInt64Len) - directory_size;
+
+  std::vector<uint8_t> bin_directory(directory_size);
+  RETURN_IF_NOT_OK_MR(ReadBytes(fs, offset + kRawChunkHeadLen, bin_directory.data(), directory_size));
+  std::vector<RawChunkColumn> selected;
+  try {
+    auto directory = json::from_msgpack(bin_directory);
+    for (const auto &item : directory) {
+      auto name = item.at(0).get<std::string>();
+      if (!columns.empty() && std::find(columns.begin(), columns.end(), name) == columns.end()) {
+        continue;
+      }
+      RawChunkColumn column;
+      column.name = name;
+      column.encoding = static_cast<RawColumnEncoding>(item.at(1).get<int>());
+      column.offset = item.at(2).get<uint64_t>();
+      column.size = item.at(3).get<uint64_t>();
+      selected.push_back(column);
+    }
+  } catch (const std::exception &e) {
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to parse the directory of columnar raw chunk, " +
+                                std::string(e.what()));
+  }
+
+  *rows = std::vector<json>(row_count, json::object());
+  uint64_t payload_offset = offset + kRawChunkHeadLen + directory_size;
+  std::vector<uint8_t> payload;
+  std::vector<json> values;
+  for (const auto &column : selected) {
+    CHECK_FAIL_RETURN_UNEXPECTED_MR(column.offset <= payload_size && column.size <= payload_size - column.offset,
+                                    "Invalid file, the column: " + column.name +
+                                      " exceeds the columnar raw chunk, please check correction of MindRecord File.");
+    payload.resize(column.size);
+    RETURN_IF_NOT_OK_MR(ReadBytes(fs, payload_offset + column.offset, payload.data(), column.size));
+    RETURN_IF_NOT_OK_MR(DecodeColumn(payload.data(), column.size, column.encoding, row_count, &values));
+    for (uint64_t i = 0; i < row_count; ++i) {
+      if (!values[i].is_null()) {
+        (*rows)[i][column.name] = std::move(values[i]);
+      }
+    }
+  }
+  return Status::OK();
+}
+
+Status ShardRawChunk::ReadRow(std::fstream *fs, uint64_t offset, uint64_t row_id,
+                              const std::vector<std::string> &columns, RawChunkCache *cache, json *row) {
+  RETURN_UNEXPECTED_IF_NULL_MR(cache);
+  RETURN_UNEXPECTED_IF_NULL_MR(row);
+  if (cache->rows.empty() || cache->offset != offset) {
+    uint64_t chunk_size = 0;
+    RETURN_IF_NOT_OK_MR(Read(fs, offset, columns, &cache->rows, &cache->first_row_id, &chunk_size));
+    cache->offset = offset;
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(row_id >= cache->first_row_id && row_id - cache->first_row_id < cache->rows.size(),
+                                  "Invalid file, the row id: " + std::to_string(row_id) +
+                                    " is not in the columnar raw chunk at offset " + std::to_string(offset) +
+                                    ", please check correction of MindRecord File.");
+  *row = cache->rows[row_id - cache->first_row_id];
+  return Status::OK();
+}
+
+RawColumnEncoding ShardRawChunk::ChooseEncoding(const std::vector<json> &values) {
+  if (values.size() < kInt2) {
+    return kRawColumnPlain;
+  }
+  // only the scalar values are worth encoding, the arrays seldom repeat
+  uint64_t runs = 1;
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (values[i].is_structured() || values[i].is_binary()) {
+      return kRawColumnPlain;
+    }
+    if (i > 0 && values[i] != values[i - 1]) {
+      ++runs;
+    }
+  }
+  if (runs * kInt2 <= values.size()) {
+    return kRawColumnRunLength;
+  }
+  std::set<json> distinct;
+  for (const auto &value : values) {
+    (void)distinct.insert(value);
+    if (distinct.size() * kInt2 > values.size()) {
+      return kRawColumnPlain;
+    }
+  }
+  return kRawColumnDictionary;
+}
+
+std::vector<uint8_t> ShardRawChunk::EncodeColumn(const std::vector<json> &values, RawColumnEncoding encoding) {
+  json encoded = json::array();
+  if (encoding == kRawColumnRunLength) {
+    // [value 0, run length 0, value 1, run length 1, ...]
+    size_t start = 0;
+    for (size_t i = 1; i <= values.size(); ++i) {
+      if (i == values.size() || values[i] != values[start]) {
+        encoded.push_back(values[start]);
+        encoded.push_back(i - start);
+        start = i;
+      }
+    }
+  } else if (encoding == kRawColumnDictionary) {
+    // [[distinct values], [ids of values]]
+    std::map<json, uint64_t> ids;
+    json dictionary = json::array();
+    json indexes = json::array();
+    for (const auto &value : values) {
+      auto iter = ids.find(value);
+      if (iter == ids.end()) {
+        iter = ids.emplace(value, dictionary.size()).first;
+        dictionary.push_back(value);
+      }
+      indexes.push_back(iter->second);
+    }
+    encoded.push_back(std::move(dictionary));
+    encoded.push_back(std::move(indexes));
+  } else {
+    encoded = json(values);
+  }
+  return json::to_msgpack(encoded);
+}
+
+Status ShardRawChunk::DecodeColumn(const uint8_t *payload, uint64_t size, RawColumnEncoding encoding,
+                                   uint64_t row_count, std::vector<json> *values) {
+  RETURN_UNEXPECTED_IF_NULL_MR(payload);
+  RETURN_UNEXPECTED_IF_NULL_MR(values);
+  values->clear();
+  try {
+    auto encoded = json::from_msgpack(payload, payload + size);
+    if (encoding == kRawColumnRunLength) {
+      for (size_t i = 0; i + 1 < encoded.size(); i += kInt2) {
+        auto run = encoded[i + 1].get<uint64_t>();
+        CHECK_FAIL_RETURN_UNEXPECTED_MR(run <= row_count - values->size(),
+                                        "Invalid file, the run length exceeds the row count of columnar raw chunk.");
+        values->insert(values->end(), run, encoded[i]);
+      }
+    } else if (encoding == kRawColumnDictionary) {
+      const auto &dictionary = encoded.at(0);
+      for (const auto &id : encoded.at(1)) {
+        auto index = id.get<uint64_t>();
+        CHECK_FAIL_RETURN_UNEXPECTED_MR(index < dictionary.size(),
+                                        "Invalid file, the dictionary id exceeds the columnar raw chunk.");
+        values->push_back(dictionary[index]);
+      }
+    } else if (encoding == kRawColumnPlain) {
+      *values = encoded.get<std::vector<json>>();
+    } else {
+      RETURN_STATUS_UNEXPECTED_MR("Invalid file, unknown column encoding: " + std::to_string(encoding) +
+                                  " of columnar raw chunk.");
+    }
+  } catch (const std::exception &e) {
+    RETURN_STATUS_UNEXPECTED_MR("Invalid file, failed to decode the column of columnar raw chunk, " +
+                                std::string(e.what()));
+  }
+  CHECK_FAIL_RETURN_UNEXPECTED_MR(values->size() == row_count,
+                                  "Invalid file, the value count: " + std::to_string(values->size()) +
+                                    " of column is not equal to the row count: " + std::to_string(row_count) +
+                                    " of columnar raw chunk.");
+  return Status::OK();
+}
+}  // namespace mindrecord
+}  // namespace mindspore
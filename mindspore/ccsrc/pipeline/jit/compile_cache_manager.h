@@ -37,6 +37,8 @@ class CompileCacheManager {
   void InitCompileCacheHash(const py::list &compile_cache_dep_files);
   // Init group checkpoint file path for parallel mode.
   static void InitParallelGroupCkptSaveFile();
+  // Init the cache of the kernels selected by backend, which is reused even if the dependency files are changed.
+  static void InitKernelSelectCache();
   // Compare the dependency files hash.
   bool CheckDepFilesHashConsistency();
   // Load the cached func_graph from mindir file.
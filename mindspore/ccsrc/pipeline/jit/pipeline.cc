@@ -75,6 +75,7 @@
 #include "ps/ps_cache/ps_data/ps_data_prefetch.h"
 #include "distributed/cluster/cluster_context.h"
 #include "runtime/graph_scheduler/embedding_cache_scheduler.h"
+#include "runtime/graph_scheduler/kernel_select_cache.h"
 #include "ps/scheduler.h"
 #endif
 #ifdef ENABLE_DUMP_IR
@@ -801,6 +802,8 @@ void GraphExecutorPy::InitCompileCacheInfo(const ResourcePtr &resource, const st
   // The compilation cache only support for training cell or functions decorated with 'jit' currently.
   // If enable compilation cache, it will get a non-empty dependent files list from python.
   if (compile_cache_dep_files_.empty()) {
+    // Do not reuse the kernel selections of the graphs compiled with the compilation cache before.
+    runtime::KernelSelectCache::GetInstance().Close();
     return;
   }
 #ifdef ENABLE_PROFILE
@@ -17,6 +17,9 @@
 #include "pipeline/pynative/forward/forward.h"
 #include <set>
 #include <algorithm>
+#include <string>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include "pipeline/pynative/pynative_utils.h"
 #include "pipeline/pynative/grad/grad.h"
@@ -24,6 +27,7 @@
 #include "include/common/utils/scoped_long_running.h"
 #include "backend/graph_compiler/transform.h"
 #include "utils/ms_context.h"
+#include "utils/ms_utils.h"
 
 namespace mindspore {
 namespace pynative {
@@ -83,7 +87,25 @@ MsBackendPolicy GetBackendPolicy(const std::string &device_target) {
   return backend_policy;
 }
 
-void GetSingleOpGraphInfo(const FrontendOpRunInfoPtr &op_run_info, const std::string &cur_target) {
+// The key of single op graph is built from the raw bytes of the values instead of their text, since it is built for
+// every op launched. The strings and shapes are prefixed by their sizes, so that the key is not ambiguous.
+template <typename T>
+void AppendToGraphInfo(const T &value, std::string *graph_info) {
+  static_assert(std::is_trivially_copyable<T>::value, "Only the values of trivially copyable types can be appended.");
+  (void)graph_info->append(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+void AppendToGraphInfo(const std::string &value, std::string *graph_info) {
+  AppendToGraphInfo(value.size(), graph_info);
+  (void)graph_info->append(value);
+}
+
+void AppendToGraphInfo(const ShapeVector &shape, std::string *graph_info) {
+  AppendToGraphInfo(shape.size(), graph_info);
+  (void)graph_info->append(reinterpret_cast<const char *>(shape.data()), shape.size() * sizeof(int64_t));
+}
+
+void GetSingleOpGraphInfo(const FrontendOpRunInfoPtr &op_run_info, const std::string &cur_target, size_t attrs_id) {
   MS_EXCEPTION_IF_NULL(op_run_info);
   const std::vector<tensor::TensorPtr> &input_tensors = op_run_info->base_op_run_info.input_tensor;
   const std::vector<int64_t> &tensors_mask = op_run_info->base_op_run_info.input_mask;
@@ -91,62 +113,63 @@ void GetSingleOpGraphInfo(const FrontendOpRunInfoPtr &op_run_info, const std::st
     MS_LOG(EXCEPTION) << "Input tensors size " << input_tensors.size() << " should be equal to tensors mask size "
                       << tensors_mask.size();
   }
-  std::ostringstream buf;
-  buf << cur_target << "_";
-  buf << op_run_info->base_op_run_info.op_name;
+  constexpr size_t kReservedGraphInfoSize = 256;
+  std::string graph_info;
+  graph_info.reserve(kReservedGraphInfoSize);
+  AppendToGraphInfo(cur_target, &graph_info);
+  AppendToGraphInfo(op_run_info->base_op_run_info.op_name, &graph_info);
   bool has_const_input = false;
   const auto &op_prim = op_run_info->op_prim;
   MS_EXCEPTION_IF_NULL(op_prim);
   bool has_hidden_side_effect = op_prim->HasAttr(GRAPH_FLAG_SIDE_EFFECT_HIDDEN);
+  AppendToGraphInfo(input_tensors.size(), &graph_info);
   for (size_t index = 0; index < input_tensors.size(); ++index) {
     const auto &input_tensor = input_tensors[index];
     MS_EXCEPTION_IF_NULL(input_tensor);
     if (input_tensor->base_shape_ptr() != nullptr) {
-      buf << input_tensor->base_shape_ptr()->ToString();
+      AppendToGraphInfo(input_tensor->base_shape_ptr()->ToString(), &graph_info);
     } else {
-      buf << input_tensor->shape();
+      AppendToGraphInfo(input_tensor->shape(), &graph_info);
     }
-    buf << input_tensor->data_type();
-    buf << input_tensor->padding_type();
+    AppendToGraphInfo(input_tensor->data_type(), &graph_info);
+    AppendToGraphInfo(input_tensor->padding_type(), &graph_info);
     // In the case of the same shape, but dtype and format are inconsistent
     auto tensor_addr = input_tensor->device_address();
     if (tensor_addr != nullptr && !has_hidden_side_effect) {
       auto p_address = std::dynamic_pointer_cast<device::DeviceAddress>(tensor_addr);
       MS_EXCEPTION_IF_NULL(p_address);
-      buf << p_address->type_id();
-      buf << p_address->format();
+      AppendToGraphInfo(p_address->type_id(), &graph_info);
+      AppendToGraphInfo(p_address->format(), &graph_info);
+    } else {
+      AppendToGraphInfo(kTypeUnknown, &graph_info);
     }
     // For constant input
     if (tensors_mask[index] == kValueNodeTensorMask) {
       has_const_input = true;
-      buf << common::AnfAlgo::GetTensorValueString(input_tensor);
+      AppendToGraphInfo(common::AnfAlgo::GetTensorValueString(input_tensor), &graph_info);
     }
-    buf << "_";
   }
-  // The value of the attribute affects the operator selection
-  const auto &attr_map = op_prim->attrs();
-  (void)std::for_each(attr_map.begin(), attr_map.end(),
-                      [&buf](const auto &element) { buf << element.second->ToString(); });
+  // The value of the attribute affects the operator selection, the equal attributes share the same id.
+  AppendToGraphInfo(attrs_id, &graph_info);
 
   // Constant input affects output, operators like DropoutGenMask whose output is related to values of input when input
   // shapes are the same but values are different
   if (has_const_input) {
-    buf << "_";
     auto abstr = op_run_info->base_op_run_info.abstract;
     MS_EXCEPTION_IF_NULL(abstr);
     auto build_shape = abstr->BuildShape();
     MS_EXCEPTION_IF_NULL(build_shape);
-    buf << build_shape->ToString();
+    AppendToGraphInfo(build_shape->ToString(), &graph_info);
     auto build_type = abstr->BuildType();
     MS_EXCEPTION_IF_NULL(build_type);
-    buf << build_type->type_id();
+    AppendToGraphInfo(build_type->type_id(), &graph_info);
   }
 
   // Operator with hidden side effect.
   if (has_hidden_side_effect) {
-    buf << "_" << std::to_string(op_prim->id());
+    AppendToGraphInfo(op_prim->id(), &graph_info);
   }
-  op_run_info->base_op_run_info.graph_info = buf.str();
+  op_run_info->base_op_run_info.graph_info = std::move(graph_info);
 }
 }  // namespace
 
@@ -442,7 +465,7 @@ ValuePtr ForwardExecutor::RunOpInMs(const FrontendOpRunInfoPtr &op_run_info) {
   CheckIfNeedSyncForHeterogeneous(cur_target);
   PyNativeAlgo::DataConvert::GetInputTensor(op_run_info, cur_target);
   // get graph info for checking it whether existing in the cache
-  GetSingleOpGraphInfo(op_run_info, cur_target);
+  GetSingleOpGraphInfo(op_run_info, cur_target, GetAttrsId(op_run_info->op_prim));
   auto backend_op_run_info =
     std::make_shared<BackendOpRunInfo>(op_run_info->base_op_run_info, op_run_info->op_prim.get(), true, false);
 #if defined(__APPLE__)
@@ -459,6 +482,19 @@ ValuePtr ForwardExecutor::RunOpInMs(const FrontendOpRunInfoPtr &op_run_info) {
   return result_v;
 }
 
+size_t ForwardExecutor::GetAttrsId(const PrimitivePtr &op_prim) {
+  MS_EXCEPTION_IF_NULL(op_prim);
+  const auto &attrs = op_prim->attrs();
+  auto &attrs_with_hash = attrs_ids_[op_prim->attrs_hash()];
+  for (const auto &item : attrs_with_hash) {
+    if (common::IsAttrsEqual(item.first, attrs)) {
+      return item.second;
+    }
+  }
+  (void)attrs_with_hash.emplace_back(attrs, next_attrs_id_);
+  return next_attrs_id_++;
+}
+
 void ForwardExecutor::ClearRes() {
   MS_LOG(DEBUG) << "Clear forward res";
   for (const auto &item : mindrt_backends_) {
@@ -472,6 +508,7 @@ void ForwardExecutor::ClearRes() {
   infer_operation()->ClearConstFlagPrimCache();
   std::stack<CellPtr>().swap(forward_cell_stack_);
   mindrt_backends_.clear();
+  attrs_ids_.clear();
 }
 }  // namespace pynative
 }  // namespace mindspore
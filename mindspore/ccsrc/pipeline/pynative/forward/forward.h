@@ -22,6 +22,7 @@
 #include <map>
 #include <utility>
 #include <stack>
+#include <vector>
 #include "pipeline/pynative/forward/do_cast.h"
 #include "pipeline/pynative/forward/do_infer.h"
 #include "pipeline/pynative/dynamic_shape.h"
@@ -100,6 +101,8 @@ class ForwardExecutor {
   ValuePtr InferOutputAbstract(const FrontendOpRunInfoPtr &op_run_info) const;
   // Check sync condition in heterogeneous
   void CheckIfNeedSyncForHeterogeneous(const std::string &cur_target);
+  // Get the id of the attributes of primitive for the single op key, the equal attributes get the same id
+  size_t GetAttrsId(const PrimitivePtr &op_prim);
 
  private:
   bool init_{false};
@@ -114,6 +117,11 @@ class ForwardExecutor {
   DynamicShapePtr dynamic_shape_;
   MindrtBackendMap mindrt_backends_;
   bool is_ms_function_compiling_{false};
+  // The hash of attributes -> the attributes seen with the hash and their ids. The attributes are looked up by the
+  // hash and then compared, so that the attributes whose hashes collide do not share a single op key.
+  mindspore::HashMap<size_t, std::vector<std::pair<mindspore::HashMap<std::string, ValuePtr>, size_t>>> attrs_ids_;
+  // The ids are not reused after attrs_ids_ is cleared, so the keys of the single ops compiled before stay unique.
+  size_t next_attrs_id_{0};
 };
 }  // namespace pynative
 }  // namespace mindspore
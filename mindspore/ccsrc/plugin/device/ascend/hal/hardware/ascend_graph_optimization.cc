@@ -28,6 +28,7 @@
 #include "common/graph_kernel/graph_kernel_flags.h"
 #include "plugin/device/ascend/hal/device/kernel_select_ascend.h"
 #include "plugin/device/ascend/hal/device/kernel_adjust.h"
+#include "runtime/graph_scheduler/kernel_select_cache.h"
 
 #ifndef ENABLE_SECURITY
 #include "include/common/debug/anf_ir_dump.h"
@@ -357,11 +358,21 @@ void AscendGraphOptimization::SetOperatorInfo(const KernelGraphPtr &graph) {
   }
   bool do_expand = false;
   auto &node_list = graph->execution_order();
+  auto &kernel_select_cache = runtime::KernelSelectCache::GetInstance();
+  // The kernels supported and their formats differ between the SoC versions.
+  std::string device_key = kernel_select_cache.enabled() ? device::ascend::GetSocVersion() : "";
   for (auto &node : node_list) {
+    std::string signature;
+    if (kernel_select_cache.Restore(node, device_key, &signature)) {
+      common::AnfAlgo::EraseNodeAttr(kAttrPynativeNextOpName, node);
+      common::AnfAlgo::EraseNodeAttr(kAttrPynativeNextIndex, node);
+      continue;
+    }
     auto [status, msg, etype] = device::ascend::SelectKernelInfoWithMsg(node);
     common::AnfAlgo::EraseNodeAttr(kAttrPynativeNextOpName, node);
     common::AnfAlgo::EraseNodeAttr(kAttrPynativeNextIndex, node);
     if (status != device::ascend::kNoMatched) {
+      kernel_select_cache.Record(node, signature);
       if (status == device::ascend::kStatusRaisePrecision) {
         raise_precision_count_++;
       } else if (status == device::ascend::kStatusReducePrecision) {
@@ -0,0 +1,484 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/hal/device/cpu_hash_table.h"
+
+#include <thread>
+#include <algorithm>
+
+#include "include/common/thread_pool.h"
+#include "utils/log_adapter.h"
+#include "utils/convert_utils_base.h"
+#include "utils/ms_context.h"
+#include "runtime/device/hash_table_factory.h"
+
+namespace mindspore {
+namespace device {
+namespace cpu {
+namespace {
+// The number of keys whose hashes are calculated and first probe positions are prefetched together.
+constexpr size_t kProbeBatchSize = 16;
+// The min number of items processed by one thread, avoid the cost of thread switching for small batch.
+constexpr size_t kMinParallelItemNum = 4096;
+
+// The finalizer of MurmurHash3, mixes all bits of the key so that linear probing works well for sequential ids.
+inline size_t HashKey(uint64_t key) {
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  key *= 0xc4ceb9fe1a85ec53ULL;
+  key ^= key >> 33;
+  return static_cast<size_t>(key);
+}
+
+inline size_t RoundUpPowerOfTwo(size_t num) {
+  size_t ret = 1;
+  while (ret < num) {
+    ret <<= 1;
+  }
+  return ret;
+}
+}  // namespace
+
+template <typename Key, typename Value>
+CPUHashTable<Key, Value>::CPUHashTable(int32_t value_dim, const std::string &initializer, size_t thread_num)
+    : value_dim_(IntToSize(value_dim)), initializer_(initializer), default_value_(0) {
+  size_t pool_thread_num = common::ThreadPool::GetInstance().GetSyncRunThreadNum();
+  thread_num_ = (thread_num == 0 || thread_num > pool_thread_num) ? pool_thread_num : thread_num;
+  random_seed_ = std::random_device()();
+  (void)Rehash(kCPUHashTableInitialCapacity);
+}
+
+template <typename Key, typename Value>
+CPUHashTable<Key, Value>::CPUHashTable(int32_t value_dim, const Value &default_value, size_t thread_num)
+    : value_dim_(IntToSize(value_dim)), initializer_(""), default_value_(default_value) {
+  size_t pool_thread_num = common::ThreadPool::GetInstance().GetSyncRunThreadNum();
+  thread_num_ = (thread_num == 0 || thread_num > pool_thread_num) ? pool_thread_num : thread_num;
+  random_seed_ = std::random_device()();
+  (void)Rehash(kCPUHashTableInitialCapacity);
+}
+
+template <typename Key, typename Value>
+bool CPUHashTable<Key, Value>::Find(const Key *keys, size_t key_num, Value *outputs, void *) {
+  MS_ERROR_IF_NULL(keys);
+  MS_ERROR_IF_NULL(outputs);
+  if (initializer_ == kCPUNormalDistribution) {
+    // Each batch uses a new random sequence, and each thread owns its random generator.
+    (void)random_seq_.fetch_add(1);
+  } else if (!initializer_.empty() && initializer_ != kCPUZerosDistribution &&
+             initializer_ != kCPUOnesDistribution) {
+    MS_LOG(ERROR) << "Unsupported initializer: " << initializer_;
+    return false;
+  }
+  RETURN_IF_FALSE_WITH_LOG(ReserveForKeys(keys, key_num), "Reserve for " << key_num << " keys failed.");
+
+  const uint64_t seq = random_seq_.load();
+  auto task = [this, keys, outputs, seq](size_t begin, size_t end, size_t task_id) {
+    std::mt19937 rng(random_seed_ + seq * thread_num_ + task_id);
+    size_t slots[kProbeBatchSize];
+    // Initialize the value of the missing keys inserted by this thread.
+    auto init_func = [this, &rng](size_t, size_t slot) {
+      InitializeValue(values_.data() + slot * value_dim_, &rng);
+      status_[slot].store(static_cast<uint8_t>(Status::kModified), std::memory_order_relaxed);
+    };
+    for (size_t i = begin; i < end; i += kProbeBatchSize) {
+      size_t num = std::min(kProbeBatchSize, end - i);
+      if (!GetSlots(keys + i, num, true, slots, init_func)) {
+        return false;
+      }
+      for (size_t j = 0; j < num; ++j) {
+        const Value *value = values_.data() + slots[j] * value_dim_;
+        (void)std::copy(value, value + value_dim_, outputs + (i + j) * value_dim_);
+      }
+    }
+    return true;
+  };
+  return ParallelRun(key_num, task);
+}
+
+template <typename Key, typename Value>
+bool CPUHashTable<Key, Value>::Insert(const Key *keys, size_t key_num, const Value *value, void *) {
+  MS_ERROR_IF_NULL(keys);
+  MS_ERROR_IF_NULL(value);
+  RETURN_IF_FALSE_WITH_LOG(ReserveForKeys(keys, key_num), "Reserve for " << key_num << " keys failed.");
+
+  auto task = [this, keys, value](size_t begin, size_t end, size_t) {
+    size_t slots[kProbeBatchSize];
+    bool inserted[kProbeBatchSize];
+    size_t i = begin;
+    // The value of missing key is written before the slot is published.
+    auto init_func = [this, value, &i, &inserted](size_t index, size_t slot) {
+      const Value *src = value + (i + index) * value_dim_;
+      (void)std::copy(src, src + value_dim_, values_.data() + slot * value_dim_);
+      status_[slot].store(static_cast<uint8_t>(Status::kModified), std::memory_order_relaxed);
+      inserted[index] = true;
+    };
+    for (; i < end; i += kProbeBatchSize) {
+      size_t num = std::min(kProbeBatchSize, end - i);
+      std::fill(inserted, inserted + num, false);
+      if (!GetSlots(keys + i, num, true, slots, init_func)) {
+        return false;
+      }
+      // Update the value of existing keys.
+      for (size_t j = 0; j < num; ++j) {
+        if (inserted[j]) {
+          continue;
+        }
+        const Value *src = value + (i + j) * value_dim_;
+        (void)std::copy(src, src + value_dim_, values_.data() + slots[j] * value_dim_);
+        status_[slots[j]].store(static_cast<uint8_t>(Status::kModified), std::memory_order_relaxed);
+      }
+    }
+    return true;
+  };
+  return ParallelRun(key_num, task);
+}
+
+template <typename Key, typename Value>
+bool CPUHashTable<Key, Value>::Erase(const Key *keys, size_t key_num, void *) {
+  MS_ERROR_IF_NULL(keys);
+  auto task = [this, keys](size_t begin, size_t end, size_t) {
+    size_t slots[kProbeBatchSize];
+    auto init_func = [](size_t, size_t) {};
+    for (size_t i = begin; i < end; i += kProbeBatchSize) {
+      size_t num = std::min(kProbeBatchSize, end - i);
+      if (!GetSlots(keys + i, num, false, slots, init_func)) {
+        return false;
+      }
+      for (size_t j = 0; j < num; ++j) {
+        if (slots[j] == capacity_) {
+          continue;
+        }
+        // The erased slot is kept in the probe sequence as tombstone and reclaimed at next rehash, duplicate keys in
+        // one batch are erased only once.
+        uint8_t expected = kSlotOccupied;
+        if (states_[slots[j]].compare_exchange_strong(expected, kSlotErased, std::memory_order_acq_rel)) {
+          (void)size_.fetch_sub(1);
+          (void)erased_num_.fetch_add(1);
+        }
+      }
+    }
+    return true;
+  };
+  return ParallelRun(key_num, task);
+}
+
+template <typename Key, typename Value>
+bool CPUHashTable<Key, Value>::Reserve(size_t count) {
+  size_t need_capacity = RoundUpPowerOfTwo(static_cast<size_t>(count / kCPUHashTableMaxLoadFactor) + 1);
+  if (need_capacity <= capacity_) {
+    return true;
+  }
+  return Rehash(need_capacity);
+}
+
+template <typename Key, typename Value>
+bool CPUHashTable<Key, Value>::ReserveForInsert(size_t count) {
+  size_t used_slot_num = size_.load() + erased_num_.load() + count;
+  if (used_slot_num <= static_cast<size_t>(capacity_ * kCPUHashTableMaxLoadFactor)) {
+    return true;
+  }
+  // Reclaim the erased slots first, and grow the capacity only if the live elements need it.
+  size_t need_capacity =
+    RoundUpPowerOfTwo(static_cast<size_t>((size_.load() + count) / kCPUHashTableMaxLoadFactor) + 1);
+  return Rehash(std::max(need_capacity, capacity_));
+}
+
+template <typename Key, typename Value>
+bool CPUHashTable<Key, Value>::ReserveForKeys(const Key *keys, size_t key_num) {
+  if (size_.load() + erased_num_.load() + key_num <= static_cast<size_t>(capacity_ * kCPUHashTableMaxLoadFactor)) {
+    return true;
+  }
+  // Most keys of a batch usually exist, reserving for all of them would grow the table needlessly, so only reserve for
+  // the missing keys. The duplicate missing keys are counted more than once, which only reserves more.
+  std::atomic<size_t> miss_num{0};
+  auto task = [this, keys, &miss_num](size_t begin, size_t end, size_t) {
+    size_t slots[kProbeBatchSize];
+    size_t task_miss_num = 0;
+    for (size_t i = begin; i < end; i += kProbeBatchSize) {
+      size_t num = std::min(kProbeBatchSize, end - i);
+      (void)GetSlots(keys + i, num, false, slots, [](size_t, size_t) {});
+      task_miss_num += static_cast<size_t>(std::count(slots, slots + num, capacity_));
+    }
+    (void)miss_num.fetch_add(task_miss_num);
+    return true;
+  };
+  RETURN_IF_FALSE_WITH_LOG(ParallelRun(key_num, task), "Count the missing keys failed.");
+  return ReserveForInsert(miss_num.load());
+}
+
+template <typename Key, typename Value>
+bool CPUHashTable<Key, Value>::GetKeysAndValues(Key *keys, Value *values, void *) {
+  MS_ERROR_IF_NULL(keys);
+  MS_ERROR_IF_NULL(values);
+  return ExportSlots(keys, values, nullptr);
+}
+
+template <typename Key, typename Value>
+bool CPUHashTable<Key, Value>::Import(const DataLenPair &input_data) {
+  // 1. Store input tensor data until receiving kCPUHashTableImportTensorNum(3) input tensor.
+  // Really import input data to hash table when receive kCPUHashTableImportTensorNum(3) input tensor.
+  if (import_data_list_.size() < kCPUHashTableImportTensorNum) {
+    import_data_list_.emplace_back(input_data);
+  }
+  if (import_data_list_.size() != kCPUHashTableImportTensorNum) {
+    return true;
+  }
+
+  const auto &input_keys = import_data_list_[0];
+  const auto &input_values = import_data_list_[1];
+  MS_ERROR_IF_NULL(input_keys.first);
+  MS_ERROR_IF_NULL(input_values.first);
+  size_t key_num = input_keys.second / sizeof(Key);
+  if (key_num * value_dim_ * sizeof(Value) != input_values.second) {
+    MS_LOG(ERROR) << "The length of values[" << input_values.second << "] does not match the key number[" << key_num
+                  << "] and value dim[" << value_dim_ << "].";
+    import_data_list_.clear();
+    return false;
+  }
+
+  // 2. Insert input keys and values to hash table, the host data is used directly.
+  bool ret = Insert(reinterpret_cast<Key *>(input_keys.first), key_num, reinterpret_cast<Value *>(input_values.first),
+                    nullptr);
+  import_data_list_.clear();
+  return ret;
+}
+
+template <typename Key, typename Value>
+bool CPUHashTable<Key, Value>::Export(const DataLenPair &keys, const DataLenPair &values, const DataLenPair &status) {
+  MS_ERROR_IF_NULL(keys.first);
+  MS_ERROR_IF_NULL(values.first);
+  MS_ERROR_IF_NULL(status.first);
+
+  size_t element_num = size_.load();
+  size_t keys_len = element_num * sizeof(Key);
+  size_t values_len = element_num * value_dim_ * sizeof(Value);
+  size_t status_len = element_num * sizeof(Status);
+  // 1. Check length for output tensor.
+  if (keys_len != keys.second || values_len != values.second || status_len != status.second) {
+    MS_LOG(ERROR) << "Need keys len[" << keys_len << "], values len[" << values_len << "], status len[" << status_len
+                  << "], but got:[" << keys.second << "], [" << values.second << "], [" << status.second << "].";
+    return false;
+  }
+
+  // 2. Export all keys, values and status to the host buffer directly.
+  return ExportSlots(reinterpret_cast<Key *>(keys.first), reinterpret_cast<Value *>(values.first),
+                     reinterpret_cast<Status *>(status.first));
+}
+
+template <typename Key, typename Value>
+size_t CPUHashTable<Key, Value>::GetSlot(const Key &key, size_t hash, bool insert_miss_key, bool *inserted) {
+  *inserted = false;
+  const size_t mask = capacity_ - 1;
+  size_t slot = hash & mask;
+  // The capacity is always larger than the element number, so an empty slot will be reached.
+  for (size_t probe = 0; probe < capacity_; ++probe, slot = (slot + 1) & mask) {
+    uint8_t state = states_[slot].load(std::memory_order_acquire);
+    if (state == kSlotEmpty) {
+      if (!insert_miss_key) {
+        return capacity_;
+      }
+      // Try to claim the empty slot, if another thread claims it first, check the key of that thread.
+      if (states_[slot].compare_exchange_strong(state, kSlotBusy, std::memory_order_acq_rel)) {
+        keys_[slot] = key;
+        (void)size_.fetch_add(1);
+        *inserted = true;
+        return slot;
+      }
+    }
+    // Wait for the claiming thread to publish the key and value.
+    while (state == kSlotBusy) {
+      std::this_thread::yield();
+      state = states_[slot].load(std::memory_order_acquire);
+    }
+    if (state == kSlotOccupied && keys_[slot] == key) {
+      return slot;
+    }
+  }
+  return capacity_;
+}
+
+template <typename Key, typename Value>
+template <typename InitFunc>
+bool CPUHashTable<Key, Value>::GetSlots(const Key *keys, size_t key_num, bool insert_miss_key, size_t *slots,
+                                        const InitFunc &init_func) {
+  size_t hashes[kProbeBatchSize];
+  const size_t mask = capacity_ - 1;
+  // Calculate hashes of the batch without any branch and prefetch the first probe position of every key, so that the
+  // memory latency of the batch is overlapped.
+  for (size_t i = 0; i < key_num; ++i) {
+    hashes[i] = HashKey(static_cast<uint64_t>(keys[i]));
+  }
+  for (size_t i = 0; i < key_num; ++i) {
+    __builtin_prefetch(&states_[hashes[i] & mask]);
+    __builtin_prefetch(&keys_[hashes[i] & mask]);
+  }
+  for (size_t i = 0; i < key_num; ++i) {
+    bool inserted = false;
+    slots[i] = GetSlot(keys[i], hashes[i], insert_miss_key, &inserted);
+    if (insert_miss_key && slots[i] == capacity_) {
+      MS_LOG(ERROR) << "The hash table is full, capacity: " << capacity_;
+      return false;
+    }
+    // Publish the new slot before probing the next key, otherwise two threads may wait for each other.
+    if (inserted) {
+      init_func(i, slots[i]);
+      states_[slots[i]].store(kSlotOccupied, std::memory_order_release);
+    }
+  }
+  return true;
+}
+
+template <typename Key, typename Value>
+bool CPUHashTable<Key, Value>::Rehash(size_t new_capacity) {
+  auto old_states = std::move(states_);
+  auto old_keys = std::move(keys_);
+  auto old_status = std::move(status_);
+  auto old_values = std::move(values_);
+  size_t old_capacity = capacity_;
+
+  // 1. Allocate new storage.
+  capacity_ = RoundUpPowerOfTwo(new_capacity);
+  states_ = std::make_unique<std::atomic<uint8_t>[]>(capacity_);
+  keys_ = std::make_unique<Key[]>(capacity_);
+  status_ = std::make_unique<std::atomic<uint8_t>[]>(capacity_);
+  values_.resize(capacity_ * value_dim_);
+  for (size_t i = 0; i < capacity_; ++i) {
+    states_[i].store(kSlotEmpty, std::memory_order_relaxed);
+  }
+  size_.store(0);
+  erased_num_.store(0);
+
+  // 2. Move all occupied slots of the old storage into the new storage by multiple threads.
+  auto task = [&](size_t begin, size_t end, size_t) {
+    for (size_t i = begin; i < end; ++i) {
+      if (old_states[i].load(std::memory_order_relaxed) != kSlotOccupied) {
+        continue;
+      }
+      bool inserted = false;
+      size_t slot = GetSlot(old_keys[i], HashKey(static_cast<uint64_t>(old_keys[i])), true, &inserted);
+      if (slot == capacity_) {
+        return false;
+      }
+      auto src = old_values.begin() + i * value_dim_;
+      (void)std::copy(src, src + value_dim_, values_.begin() + slot * value_dim_);
+      status_[slot].store(old_status[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+      states_[slot].store(kSlotOccupied, std::memory_order_release);
+    }
+    return true;
+  };
+  return ParallelRun(old_capacity, task);
+}
+
+template <typename Key, typename Value>
+void CPUHashTable<Key, Value>::InitializeValue(Value *value, std::mt19937 *rng) const {
+  if (initializer_.empty()) {
+    std::fill(value, value + value_dim_, default_value_);
+  } else if (initializer_ == kCPUNormalDistribution) {
+    constexpr float kMean = 0.0;
+    constexpr float kStddev = 0.01;
+    std::normal_distribution<float> dist(kMean, kStddev);
+    for (size_t i = 0; i < value_dim_; ++i) {
+      value[i] = static_cast<Value>(dist(*rng));
+    }
+  } else if (initializer_ == kCPUOnesDistribution) {
+    std::fill(value, value + value_dim_, static_cast<Value>(1.0));
+  } else {
+    std::fill(value, value + value_dim_, static_cast<Value>(0));
+  }
+}
+
+template <typename Key, typename Value>
+bool CPUHashTable<Key, Value>::ExportSlots(Key *keys, Value *values, Status *status) {
+  // 1. Count the occupied slots in every range, the ranges are same in the two passes.
+  size_t task_num = GetTaskNum(capacity_);
+  std::vector<size_t> counts(task_num + 1, 0);
+  auto count_task = [this, &counts](size_t begin, size_t end, size_t task_id) {
+    size_t count = 0;
+    for (size_t i = begin; i < end; ++i) {
+      count += (states_[i].load(std::memory_order_relaxed) == kSlotOccupied) ? 1 : 0;
+    }
+    counts[task_id + 1] = count;
+    return true;
+  };
+  RETURN_IF_FALSE_WITH_LOG(ParallelRun(capacity_, count_task), "Count the elements of hash table failed.");
+  for (size_t i = 1; i <= task_num; ++i) {
+    counts[i] += counts[i - 1];
+  }
+
+  // 2. Every thread writes its range to the output from the offset given by the prefix sum, so the order of exported
+  // elements is stable.
+  auto export_task = [this, &counts, keys, values, status](size_t begin, size_t end, size_t task_id) {
+    size_t offset = counts[task_id];
+    for (size_t i = begin; i < end; ++i) {
+      if (states_[i].load(std::memory_order_relaxed) != kSlotOccupied) {
+        continue;
+      }
+      keys[offset] = keys_[i];
+      auto src = values_.begin() + i * value_dim_;
+      (void)std::copy(src, src + value_dim_, values + offset * value_dim_);
+      if (status != nullptr) {
+        status[offset] = static_cast<Status>(status_[i].load(std::memory_order_relaxed));
+      }
+      ++offset;
+    }
+    return true;
+  };
+  return ParallelRun(capacity_, export_task);
+}
+
+template <typename Key, typename Value>
+size_t CPUHashTable<Key, Value>::GetTaskNum(size_t total) const {
+  return std::max<size_t>(1, std::min(thread_num_, (total + kMinParallelItemNum - 1) / kMinParallelItemNum));
+}
+
+template <typename Key, typename Value>
+bool CPUHashTable<Key, Value>::ParallelRun(size_t total,
+                                           const std::function<bool(size_t, size_t, size_t)> &func) const {
+  if (total == 0) {
+    return true;
+  }
+  size_t task_num = GetTaskNum(total);
+  if (task_num == 1) {
+    return func(0, total, 0);
+  }
+
+  size_t per_task_num = (total + task_num - 1) / task_num;
+  std::atomic_bool success{true};
+  std::vector<common::Task> tasks;
+  for (size_t i = 0; i < task_num; ++i) {
+    size_t begin = i * per_task_num;
+    size_t end = std::min(begin + per_task_num, total);
+    tasks.emplace_back([&func, &success, begin, end, i]() {
+      if (begin < end && !func(begin, end, i)) {
+        success = false;
+        return common::FAIL;
+      }
+      return common::SUCCESS;
+    });
+  }
+  (void)common::ThreadPool::GetInstance().SyncRun(tasks);
+  return success.load();
+}
+
+template class CPUHashTable<int32_t, float>;
+template class CPUHashTable<int64_t, float>;
+
+MS_REGISTER_HASH_TABLE(kCPUDevice, int32_t, float, CPUHashTable);
+MS_REGISTER_HASH_TABLE(kCPUDevice, int64_t, float, CPUHashTable);
+}  // namespace cpu
+}  // namespace device
+}  // namespace mindspore
@@ -0,0 +1,165 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_HAL_DEVICE_CPU_HASH_TABLE_H_
+#define MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_HAL_DEVICE_CPU_HASH_TABLE_H_
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <functional>
+#include <random>
+
+#include "runtime/device/hash_table.h"
+
+namespace mindspore {
+namespace device {
+namespace cpu {
+constexpr static size_t kCPUHashTableInitialCapacity = 1024;
+constexpr static float kCPUHashTableMaxLoadFactor = 0.75;
+constexpr static size_t kCPUHashTableImportTensorNum = 3;
+constexpr static char kCPUNormalDistribution[] = "normal";
+constexpr static char kCPUZerosDistribution[] = "zeros";
+constexpr static char kCPUOnesDistribution[] = "ones";
+
+// A concurrent hash table base on CPU, it uses open addressing with linear probing over a contiguous key array, so
+// probing for a batch of keys is cache friendly and could be prefetched ahead. The slot of a new key is claimed by a
+// compare-and-swap on the slot state, so a batch of keys is processed by multiple threads without any lock.
+// Note: the batch interfaces(Find/Insert/Erase/Export...) must not be called concurrently with each other, the
+// parallelism is inside a batch.
+template <typename Key, typename Value>
+class CPUHashTable : public HashTable<Key, Value> {
+ public:
+  using Status = typename HashTable<Key, Value>::Status;
+
+  // The 'thread_num' limits the parallelism of the batch interfaces, 0 means using all threads of the common thread
+  // pool.
+  CPUHashTable(int32_t value_dim, const std::string &initializer, size_t thread_num = 0);
+  CPUHashTable(int32_t value_dim, const Value &default_value, size_t thread_num = 0);
+  ~CPUHashTable() override = default;
+
+  // Find elements with specific keys, if a key does not exist, initialize the value for the key based on the
+  // initialzer and insert the key-value pair into map. The initializer can be 'normal', 'zeros' or 'ones', and also
+  // could be a specific 'Value' type scalar.
+  bool Find(const Key *keys, size_t key_num, Value *outputs, void *stream) override;
+
+  // Insert elements with specific keys. If key exists, update the value of the key. If there are duplicate keys in
+  // one batch, which of the values is kept is unspecified.
+  bool Insert(const Key *keys, size_t key_num, const Value *value, void *stream) override;
+
+  // Erase elements with specific keys.
+  bool Erase(const Key *keys, size_t key_num, void *stream) override;
+
+  // Reserves space for at least the specified number of elements.
+  bool Reserve(size_t count) override;
+
+  // Export all keys and values in hash map, the order of each element of keys and values is consistent.
+  bool GetKeysAndValues(Key *keys, Value *values, void *stream) override;
+
+  // Import keys, values into the hash map.
+  bool Import(const DataLenPair &input_data) override;
+
+  // Export all keys, values and status.
+  bool Export(const DataLenPair &keys, const DataLenPair &values, const DataLenPair &status) override;
+
+  // Get the number of elements that can be held in currently allocated storage.
+  size_t capacity() const override { return capacity_; }
+
+  // Get the number of elements.
+  size_t size() const override { return size_.load(); }
+
+  // Get the ratio of used slots(including erased ones which are reclaimed at next rehash) to the capacity.
+  float load_factor() const {
+    return capacity_ == 0 ? 0 : static_cast<float>(size_.load() + erased_num_.load()) / capacity_;
+  }
+
+ private:
+  // The state of one slot, a slot is claimed by the transition from kSlotEmpty to kSlotBusy, and it is visible to other
+  // threads after the key and value have been written and the state is kSlotOccupied.
+  enum SlotState : uint8_t { kSlotEmpty = 0, kSlotBusy = 1, kSlotOccupied = 2, kSlotErased = 3 };
+
+  // Get the slot index of the key, insert the key if it does not exist and 'insert_miss_key' is true.
+  // Return capacity_ if the key is not found and not inserted.
+  size_t GetSlot(const Key &key, size_t hash, bool insert_miss_key, bool *inserted);
+
+  // Get the slot indices of a batch of keys, the hashes of the batch are calculated first and the first probe
+  // position of the batch are prefetched before probing. The 'init_func(index, slot)' is called at once a missing key
+  // is inserted to initialize its value, then the slot is published, other threads probing the same slot wait for it.
+  template <typename InitFunc>
+  bool GetSlots(const Key *keys, size_t key_num, bool insert_miss_key, size_t *slots, const InitFunc &init_func);
+
+  // Rebuild the table with new capacity, all erased slots are reclaimed.
+  bool Rehash(size_t new_capacity);
+
+  // Initialize the value of a new key according to initializer or default value.
+  void InitializeValue(Value *value, std::mt19937 *rng) const;
+
+  // Export keys, values and status of all occupied slots by multiple threads, the 'status' could be nullptr.
+  bool ExportSlots(Key *keys, Value *values, Status *status);
+
+  // Get the number of ranges which [0, total) is split into by ParallelRun.
+  size_t GetTaskNum(size_t total) const;
+
+  // Split [0, total) into ranges and run 'func(begin, end, task_id)' for each range in the common thread pool.
+  bool ParallelRun(size_t total, const std::function<bool(size_t, size_t, size_t)> &func) const;
+
+  // Make sure the table could hold 'count' more elements without exceeding the max load factor.
+  bool ReserveForInsert(size_t count);
+
+  // Make sure the table could hold the missing ones of the keys without exceeding the max load factor.
+  bool ReserveForKeys(const Key *keys, size_t key_num);
+
+  // Record the state of every slot.
+  std::unique_ptr<std::atomic<uint8_t>[]> states_;
+  // Record the key of every slot.
+  std::unique_ptr<Key[]> keys_;
+  // Record the status(Unchanged/Modified) of every slot.
+  std::unique_ptr<std::atomic<uint8_t>[]> status_;
+  // Record the values of every slot, the values of one slot are contiguous and 'value_dim_' long.
+  std::vector<Value> values_;
+
+  // The value dimension for each key.
+  size_t value_dim_;
+
+  // The initializer used to initialize the values for missing keys, the initializer could be 'normal', 'zeros' or
+  // 'ones'.
+  std::string initializer_;
+  // The default value used to initialize the values for missing keys.
+  Value default_value_;
+
+  // Record the number of elements in the map.
+  std::atomic<size_t> size_{0};
+  // Record the number of erased slots which still occupy the probe sequence.
+  std::atomic<size_t> erased_num_{0};
+
+  // Record the number of slots, which is always power of two.
+  size_t capacity_{0};
+
+  // The max number of threads used by batch interfaces.
+  size_t thread_num_{1};
+
+  // The seed of random generators used to generate normal distribution for every thread.
+  uint64_t random_seed_{0};
+  // The random sequence number which makes each batch generate different random values.
+  mutable std::atomic<uint64_t> random_seq_{0};
+
+  // Store input data of Import until receiving kCPUHashTableImportTensorNum(3) input tensor.
+  std::vector<DataLenPair> import_data_list_;
+};
+}  // namespace cpu
+}  // namespace device
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_PLUGIN_DEVICE_CPU_HAL_DEVICE_CPU_HASH_TABLE_H_
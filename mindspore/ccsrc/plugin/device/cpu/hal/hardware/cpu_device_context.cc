@@ -47,6 +47,7 @@
 #include "backend/common/session/anf_runtime_algorithm.h"
 #include "include/common/utils/anfalgo.h"
 #include "plugin/device/cpu/hal/profiler/cpu_profiling.h"
+#include "runtime/graph_scheduler/kernel_select_cache.h"
 #if defined(__linux__) && defined(WITH_BACKEND)
 #include "plugin/device/cpu/hal/hardware/ms_collective_comm_lib.h"
 #endif
@@ -255,10 +256,16 @@ void CPUKernelExecutor::SetOperatorInfo(const KernelGraphPtr &graph) const {
   }
 #endif
   auto &node_list = graph->execution_order();
+  auto &kernel_select_cache = runtime::KernelSelectCache::GetInstance();
   for (auto &node : node_list) {
     if (!common::AnfAlgo::IsControlOpExecInBackend(node)) {
+      std::string signature;
+      if (kernel_select_cache.Restore(node, "", &signature)) {
+        continue;
+      }
       auto [msg, etype] = SetKernelInfoWithMsg(node);
       if (msg.empty()) {
+        kernel_select_cache.Record(node, signature);
         continue;
       }
 #ifdef ENABLE_AKG
@@ -34,6 +34,7 @@
 #include "plugin/device/gpu/kernel/cuda_impl/cuda_ops/cuda_common.h"
 #include "plugin/device/gpu/hal/hardware/optimizer.h"
 #include "runtime/device/ms_device_shape_transfer.h"
+#include "runtime/graph_scheduler/kernel_select_cache.h"
 #include "common/graph_kernel/graph_kernel_flags.h"
 #include "plugin/device/gpu/hal/profiler/gpu_profiling.h"
 #include "plugin/device/gpu/hal/profiler/gpu_profiling_utils.h"
@@ -551,9 +552,21 @@ void GPUKernelExecutor::SetOperatorInfo(const KernelGraphPtr &graph) const {
   bool do_expand = false;
 #endif
   auto &node_list = graph->execution_order();
+  auto &kernel_select_cache = runtime::KernelSelectCache::GetInstance();
+  // The selection depends on the compute capability and on whether the formats of this graph are transformed.
+  std::string device_key;
+  if (kernel_select_cache.enabled()) {
+    device_key = "sm" + std::to_string(GET_CUDA_CAP) + ";format_transform" +
+                 std::to_string(FormatTransformChecker::GetInstance().format_transform());
+  }
   for (auto &node : node_list) {
+    std::string signature;
+    if (kernel_select_cache.Restore(node, device_key, &signature)) {
+      continue;
+    }
     auto [msg, etype] = SetKernelInfoWithMsg(node);
     if (msg.empty()) {
+      kernel_select_cache.Record(node, signature);
       continue;
     }
 #if (defined(ENABLE_AKG) && !defined(_WIN32))
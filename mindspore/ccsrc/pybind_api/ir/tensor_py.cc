@@ -230,8 +230,9 @@ class PersistentTensorDataNumpy : public TensorDataNumpy {
 
     size_t first_dim = (size_t)SliceDataShape()[0];
     size_t start_key = slice_index * first_dim;
-    std::vector<size_t> keys(first_dim);
-    std::iota(keys.begin(), keys.end(), start_key);
+    // The key type of embedding store is int32_t.
+    std::vector<int32_t> keys(first_dim);
+    std::iota(keys.begin(), keys.end(), SizeToInt(start_key));
     if (!emb_store->Get(first_dim, keys.data(), this->data())) {
       MS_LOG(EXCEPTION) << "Failed to get data from embedding store!";
     }
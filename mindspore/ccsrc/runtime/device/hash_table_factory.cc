@@ -0,0 +1,43 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/device/hash_table_factory.h"
+
+namespace mindspore {
+namespace device {
+HashTableFactory &HashTableFactory::GetInstance() {
+  static HashTableFactory instance{};
+  return instance;
+}
+
+void HashTableFactory::Register(const std::string &device_name, const std::type_index &key_type,
+                                const std::type_index &value_type, HashTableCreator &&hash_table_creator) {
+  auto key = std::make_tuple(device_name, key_type, value_type);
+  if (hash_table_creators_.find(key) == hash_table_creators_.end()) {
+    (void)hash_table_creators_.emplace(key, std::move(hash_table_creator));
+  }
+}
+
+HashTableCreator HashTableFactory::GetCreator(const std::string &device_name, const std::type_index &key_type,
+                                              const std::type_index &value_type) const {
+  auto iter = hash_table_creators_.find(std::make_tuple(device_name, key_type, value_type));
+  if (iter == hash_table_creators_.end()) {
+    return nullptr;
+  }
+  return iter->second;
+}
+}  // namespace device
+}  // namespace mindspore
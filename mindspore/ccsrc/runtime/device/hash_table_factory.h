@@ -0,0 +1,83 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_DEVICE_HASH_TABLE_FACTORY_H_
+#define MINDSPORE_CCSRC_RUNTIME_DEVICE_HASH_TABLE_FACTORY_H_
+
+#include <map>
+#include <string>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <functional>
+#include <typeindex>
+#include "runtime/device/hash_table.h"
+#include "utils/ms_utils.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace device {
+// Create a hash table with the value dimension and the initializer of the values of missing keys, the created hash
+// table is a HashTable<Key, Value> of the registered key and value types.
+using HashTableCreator = std::function<std::shared_ptr<void>(int32_t value_dim, const std::string &initializer)>;
+
+// The hash tables registered by the devices, the key is the name of device, the key type and the value type.
+class BACKEND_EXPORT HashTableFactory {
+ public:
+  static HashTableFactory &GetInstance();
+  void Register(const std::string &device_name, const std::type_index &key_type, const std::type_index &value_type,
+                HashTableCreator &&hash_table_creator);
+
+  // Create the hash table on the device, return nullptr if the device has no hash table of the key and value types.
+  template <typename Key, typename Value>
+  std::shared_ptr<HashTable<Key, Value>> Create(const std::string &device_name, int32_t value_dim,
+                                                const std::string &initializer) const {
+    const auto &creator = GetCreator(device_name, typeid(Key), typeid(Value));
+    if (creator == nullptr) {
+      return nullptr;
+    }
+    return std::static_pointer_cast<HashTable<Key, Value>>(creator(value_dim, initializer));
+  }
+
+ private:
+  HashTableFactory() = default;
+  ~HashTableFactory() = default;
+  DISABLE_COPY_AND_ASSIGN(HashTableFactory);
+  HashTableCreator GetCreator(const std::string &device_name, const std::type_index &key_type,
+                              const std::type_index &value_type) const;
+
+  std::map<std::tuple<std::string, std::type_index, std::type_index>, HashTableCreator> hash_table_creators_;
+};
+
+class BACKEND_EXPORT HashTableRegister {
+ public:
+  HashTableRegister(const std::string &device_name, const std::type_index &key_type, const std::type_index &value_type,
+                    HashTableCreator &&hash_table_creator) {
+    HashTableFactory::GetInstance().Register(device_name, key_type, value_type, std::move(hash_table_creator));
+  }
+  ~HashTableRegister() = default;
+};
+
+#define MS_REGISTER_HASH_TABLE(DEVICE_NAME, KEY_TYPE, VALUE_TYPE, HASH_TABLE_CLASS)                                  \
+  static const HashTableRegister g_hash_table_##DEVICE_NAME##_##KEY_TYPE##_##VALUE_TYPE##_reg(                       \
+    DEVICE_NAME, typeid(KEY_TYPE), typeid(VALUE_TYPE), [](int32_t value_dim, const std::string &initializer) {      \
+      std::shared_ptr<HashTable<KEY_TYPE, VALUE_TYPE>> hash_table =                                                  \
+        std::make_shared<HASH_TABLE_CLASS<KEY_TYPE, VALUE_TYPE>>(value_dim, initializer);                            \
+      return std::static_pointer_cast<void>(hash_table);                                                             \
+    });
+}  // namespace device
+}  // namespace mindspore
+#endif  // MINDSPORE_CCSRC_RUNTIME_DEVICE_HASH_TABLE_FACTORY_H_
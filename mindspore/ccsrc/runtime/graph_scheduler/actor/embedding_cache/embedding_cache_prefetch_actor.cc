@@ -520,6 +520,20 @@ void EmbeddingCachePrefetchActor::Run() {
   MS_LOG(INFO) << "End prefetching cache.";
 }
 
+EmbeddingHashMapCounter EmbeddingCachePrefetchActor::device_cache_counter() const {
+  if (embedding_device_cache_ == nullptr || embedding_device_cache_->device_hash_map_ == nullptr) {
+    return EmbeddingHashMapCounter();
+  }
+  return embedding_device_cache_->device_hash_map_->counter();
+}
+
+EmbeddingHashMapCounter EmbeddingCachePrefetchActor::host_cache_counter() const {
+  if (embedding_host_cache_ == nullptr || embedding_host_cache_->host_hash_map_ == nullptr) {
+    return EmbeddingHashMapCounter();
+  }
+  return embedding_host_cache_->host_hash_map_->counter();
+}
+
 bool EmbeddingCachePrefetchActor::PrefetchCache() {
   // 1. Acquire batch ids
   void *data = nullptr;
@@ -655,6 +669,7 @@ bool EmbeddingCachePrefetchActor::ParseDeviceData(int id, bool *need_swap_device
       statistics_info_.hash_hit_count_++;
       device_hash_map->set_hash_step(index, data_step_);
     }
+    device_hash_map->RecordAccess(index, data_step_);
   } else {
     int *device_to_host_index = embedding_device_cache_->device_to_host_index.get();
     int *device_to_host_ids = embedding_device_cache_->device_to_host_ids.get();
@@ -699,6 +714,7 @@ bool EmbeddingCachePrefetchActor::ParseHostDataHostToDevice(int id) {
     if (host_hash_map->hash_step(index) != data_step_) {
       host_hash_map->set_hash_step(index, data_step_);
     }
+    host_hash_map->RecordAccess(index, data_step_);
     host_to_device_index[statistics_info_.host_to_device_size_ - 1] = index;
   } else {
     int *host_to_server_index = embedding_host_cache_->host_to_server_index.get();
@@ -845,6 +861,16 @@ bool EmbeddingCachePrefetchActor::CheckCacheHitOrOutRange(const int *batch_ids,
   for (size_t j = 0; j < i; j++) {
     statistics_info_.hash_hit_count_ += hash_hit_count[j];
   }
+
+  // Record the hits for the eviction policy of device cache, the policy is not thread safe, so record them serially.
+  MS_ERROR_IF_NULL(embedding_device_cache_);
+  auto &device_hash_map = embedding_device_cache_->device_hash_map_;
+  MS_ERROR_IF_NULL(device_hash_map);
+  for (size_t j = 0; j < batch_ids_num; ++j) {
+    if (in_device[j]) {
+      device_hash_map->RecordAccess(hash_index[j] - local_device_cache_bounds_.first, data_step_);
+    }
+  }
   return true;
 }
 
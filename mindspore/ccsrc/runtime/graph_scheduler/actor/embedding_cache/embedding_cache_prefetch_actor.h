@@ -57,6 +57,7 @@ using SendRecvPairList = std::vector<SendRecvPair>;
 
 using distributed::EmbeddingCacheStatisticsInfo;
 using distributed::EmbeddingDeviceCache;
+using distributed::EmbeddingHashMapCounter;
 using distributed::EmbeddingHostCache;
 using distributed::HashTableInfo;
 using distributed::INVALID_INDEX_VALUE;
@@ -100,6 +101,10 @@ class EmbeddingCachePrefetchActor : public ActorBase {
   // Finalize embedding cache prefetch actor and push latest embedding from local cache to remote cache.
   void Finalize();
 
+  // Get the cumulative hit and swap statistics of the device cache and the local host cache.
+  EmbeddingHashMapCounter device_cache_counter() const;
+  EmbeddingHashMapCounter host_cache_counter() const;
+
  private:
   // Perform Local and Device Cache hit/miss analysis and prefetch cache for missing embeddings.
   bool PrefetchCache();
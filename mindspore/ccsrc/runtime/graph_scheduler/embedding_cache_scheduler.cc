@@ -403,6 +403,12 @@ void EmbeddingCacheScheduler::Finalize() {
   }
 
   MS_EXCEPTION_IF_NULL(embedding_cache_prefetch_actor_);
+  const auto &device_counter = embedding_cache_prefetch_actor_->device_cache_counter();
+  const auto &host_counter = embedding_cache_prefetch_actor_->host_cache_counter();
+  MS_LOG(INFO) << "Embedding cache statistics, device cache hit rate: " << device_counter.hit_rate()
+               << ", swap out count: " << device_counter.swap_out_count_
+               << ", local host cache hit rate: " << host_counter.hit_rate()
+               << ", swap out count: " << host_counter.swap_out_count_;
   // Stop the embedding cache prefetch_actor.
   embedding_cache_prefetch_actor_->Finalize();
   // Note:SyncEmbeddingTable
@@ -412,5 +418,19 @@ void EmbeddingCacheScheduler::Finalize() {
   initialized_ = false;
   finalized_ = true;
 }
+
+distributed::EmbeddingHashMapCounter EmbeddingCacheScheduler::GetDeviceCacheCounter() const {
+  if (embedding_cache_prefetch_actor_ == nullptr) {
+    return distributed::EmbeddingHashMapCounter();
+  }
+  return embedding_cache_prefetch_actor_->device_cache_counter();
+}
+
+distributed::EmbeddingHashMapCounter EmbeddingCacheScheduler::GetHostCacheCounter() const {
+  if (embedding_cache_prefetch_actor_ == nullptr) {
+    return distributed::EmbeddingHashMapCounter();
+  }
+  return embedding_cache_prefetch_actor_->host_cache_counter();
+}
 }  // namespace runtime
 }  // namespace mindspore
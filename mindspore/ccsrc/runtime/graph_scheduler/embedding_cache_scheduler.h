@@ -23,6 +23,7 @@
 #include "utils/ms_utils.h"
 #include "backend/common/session/kernel_graph.h"
 #include "runtime/hardware/device_context.h"
+#include "distributed/embedding_cache/embedding_hash_map.h"
 #include "include/backend/visible.h"
 
 namespace mindspore {
@@ -61,6 +62,11 @@ class BACKEND_EXPORT EmbeddingCacheScheduler {
   // Finalize embedding cache prefetch actor.
   void Finalize();
 
+  // Get the cumulative hit and swap statistics of the device cache and the local host cache, which are used to
+  // evaluate the eviction policy specified by environment variable 'MS_EMBEDDING_CACHE_POLICY'.
+  distributed::EmbeddingHashMapCounter GetDeviceCacheCounter() const;
+  distributed::EmbeddingHashMapCounter GetHostCacheCounter() const;
+
  private:
   EmbeddingCacheScheduler() = default;
   ~EmbeddingCacheScheduler() = default;
@@ -21,6 +21,7 @@
 #include <algorithm>
 #include <functional>
 #include "runtime/graph_scheduler/graph_scheduler.h"
+#include "runtime/graph_scheduler/kernel_select_cache.h"
 #include "runtime/device/device_address_utils.h"
 #include "runtime/pynative/op_executor.h"
 #include "runtime/device/device_address.h"
@@ -484,6 +485,8 @@ GraphId GraphCompiler::CompileGraphImpl(const KernelGraphPtr &graph, const Devic
   MS_EXCEPTION_IF_NULL(device_context->kernel_executor_);
   // Execute optimization pass.
   device_context->kernel_executor_->OptimizeGraph(graph);
+  // Persist the kernels selected by the optimization for the next process compiling the graph.
+  KernelSelectCache::GetInstance().Save();
 
   // Generate 'KernelMod' for all kernels and set 'KernelMod' into kernel,
   // 'KernelMod' is real executive object of kernel.
@@ -80,6 +80,9 @@ using distributed::recovery::RecoveryContext;
 namespace {
 constexpr char kNumaEnableEnv[] = "MS_ENABLE_NUMA";
 constexpr char kNumaEnableEnv2[] = "DATASET_ENABLE_NUMA";
+constexpr char kWorkStealingEnableEnv[] = "MS_ENABLE_WORK_STEALING";
+constexpr char kPrioritySchedulingEnableEnv[] = "MS_ENABLE_PRIORITY_SCHEDULING";
+constexpr char kLockFreeMailboxEnableEnv[] = "MS_ENABLE_LOCK_FREE_MAILBOX";
 
 // For the transform state synchronization.
 constexpr char kTransformFinishPrefix[] = "TRANSFORM_FINISH_";
@@ -404,6 +407,20 @@ void GraphScheduler::Initialize() {
   if (ret != MINDRT_OK) {
     MS_LOG(EXCEPTION) << "Actor manager init failed.";
   }
+  if (common::GetEnv(kWorkStealingEnableEnv) == "1") {
+    auto thread_pool = actor_manager->GetActorThreadPool();
+    MS_EXCEPTION_IF_NULL(thread_pool);
+    if (thread_pool->EnableWorkStealing() != THREAD_OK) {
+      MS_LOG(EXCEPTION) << "Enable work stealing of actor thread pool failed.";
+    }
+  }
+  if (common::GetEnv(kPrioritySchedulingEnableEnv) == "1") {
+    auto thread_pool = actor_manager->GetActorThreadPool();
+    MS_EXCEPTION_IF_NULL(thread_pool);
+    if (thread_pool->EnablePriorityScheduling() != THREAD_OK) {
+      MS_LOG(EXCEPTION) << "Enable priority scheduling of actor thread pool failed.";
+    }
+  }
   common::SetOMPThreadNum();
   MS_LOG(INFO) << "The actor thread number: " << actor_thread_num
                << ", the kernel thread number: " << (actor_and_kernel_thread_num - actor_thread_num);
@@ -509,6 +526,10 @@ ActorSet *GraphScheduler::Transform(const GraphCompilerInfo &graph_compiler_info
   CacheGraphOutputToActor(graph_compiler_info);
   UpdateDeviceAddressByRefInternalParameter(graph_compiler_info);
   Link(actor_set.get(), graph_compiler_info);
+  auto thread_pool = ActorMgr::GetActorMgrRef()->GetActorThreadPool();
+  if ((thread_pool != nullptr) && thread_pool->priority_scheduling()) {
+    SchedulerHelper::SetKernelActorPriority(actor_set.get());
+  }
 
   DumpActor(actor_set.get(), graph_compiler_info);
   if (graph_compiler_info.strategy_ == GraphExecutionStrategy::kPipeline) {
@@ -542,10 +563,16 @@ void GraphScheduler::Schedule(const ActorSet *actor_set) {
   // Schedule actors.
   auto actor_manager = ActorMgr::GetActorMgrRef();
   MS_EXCEPTION_IF_NULL(actor_manager);
+  // The kernel actors are the majority of actors and receive messages from many threads, so they can use the
+  // lock-free mailbox to avoid the lock contention.
+  bool enable_lock_free_mailbox = (common::GetEnv(kLockFreeMailboxEnableEnv) == "1");
   for (auto actor : actors) {
     MS_EXCEPTION_IF_NULL(actor);
     // The sub actors in the fusion actor do not participate in message interaction.
     if (actor->parent_fusion_actor_ == nullptr) {
+      if (enable_lock_free_mailbox && actor->type() == KernelTransformType::kKernelActor) {
+        actor->set_mailbox_type(MailBoxType::kLockFree);
+      }
       (void)actor_manager->Spawn(actor);
     } else {
       actor->Init();
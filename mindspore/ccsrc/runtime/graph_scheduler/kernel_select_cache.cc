@@ -0,0 +1,326 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "runtime/graph_scheduler/kernel_select_cache.h"
+#include <fstream>
+#include <sstream>
+#include <utility>
+#include <vector>
+#include "backend/common/session/anf_runtime_algorithm.h"
+#include "include/common/utils/anfalgo.h"
+#include "include/common/debug/common.h"
+#include "kernel/kernel_build_info.h"
+#include "utils/ms_context.h"
+#include "utils/convert_utils_base.h"
+#include "utils/system/sha256.h"
+#include "mindspore/core/utils/file_utils.h"
+
+namespace mindspore {
+namespace runtime {
+namespace {
+constexpr char kConfig[] = "config";
+constexpr char kSelections[] = "selections";
+constexpr char kSignature[] = "signature";
+constexpr char kBuildInfo[] = "build_info";
+constexpr char kInputs[] = "inputs";
+constexpr char kInputIndex[] = "index";
+
+// The kernels which are not selected only by their signature are not cached: the graph kernels, the Custom kernels
+// which register their kernel mods while being selected, and the control kernels.
+bool IsCacheable(const CNodePtr &kernel) {
+  MS_EXCEPTION_IF_NULL(kernel);
+  if (!IsValueNode<Primitive>(kernel->input(0)) || IsPrimitiveCNode(kernel, prim::kPrimCustom)) {
+    return false;
+  }
+  return !common::AnfAlgo::IsControlOpExecInBackend(kernel);
+}
+
+std::string GetCompileConfig() {
+  const auto &ms_context = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(ms_context);
+  std::ostringstream buffer;
+#ifdef MSVERSION
+  buffer << MSVERSION << ";";
+#endif
+  buffer << ms_context->get_param<std::string>(MS_CTX_DEVICE_TARGET) << ";"
+         << ms_context->get_param<bool>(MS_CTX_ENABLE_GRAPH_KERNEL) << ";"
+         << ms_context->get_param<std::string>(MS_CTX_GRAPH_KERNEL_FLAGS) << ";"
+         << ms_context->get_param<bool>(MS_CTX_ENABLE_REDUCE_PRECISION) << ";"
+         << ms_context->get_param<bool>(MS_CTX_DISABLE_FORMAT_TRANSFORM) << ";"
+         << ms_context->get_param<std::string>(MS_CTX_INFER_PRECISION_MODE);
+  return system::sha256::GetHashFromString(buffer.str());
+}
+
+// The input of kernel whose build info is selected along with the kernel.
+AnfNodePtr GetSelectedWithKernelInput(const CNodePtr &kernel, size_t input_index) {
+  auto input = common::AnfAlgo::GetPrevNodeOutput(kernel, input_index).first;
+  MS_EXCEPTION_IF_NULL(input);
+  if ((!input->isa<Parameter>() && !input->isa<ValueNode>()) || input->kernel_info() == nullptr) {
+    return nullptr;
+  }
+  return input;
+}
+
+std::string GetSignature(const CNodePtr &kernel, const std::string &device_key) {
+  auto prim = common::AnfAlgo::GetCNodePrimitive(kernel);
+  MS_EXCEPTION_IF_NULL(prim);
+  std::ostringstream buffer;
+  buffer << device_key << "|" << prim->name();
+  // Sort the attributes, since the order of a hash map differs between processes.
+  std::map<std::string, std::string> attrs;
+  for (const auto &attr : prim->attrs()) {
+    attrs[attr.first] = (attr.second == nullptr) ? "" : attr.second->ToString();
+  }
+  for (const auto &attr : attrs) {
+    buffer << ";" << attr.first << "=" << attr.second;
+  }
+  size_t input_num = common::AnfAlgo::GetInputTensorNum(kernel);
+  for (size_t i = 0; i < input_num; ++i) {
+    auto input_with_index = common::AnfAlgo::GetPrevNodeOutput(kernel, i);
+    const auto &input = input_with_index.first;
+    MS_EXCEPTION_IF_NULL(input);
+    buffer << "|" << TypeIdToString(common::AnfAlgo::GetOutputInferDataType(input, input_with_index.second))
+           << ShapeVectorToStr(common::AnfAlgo::GetOutputInferShape(input, input_with_index.second));
+    // The selection of a kernel depends on the formats and types selected for its inputs.
+    if (input->kernel_info() == nullptr) {
+      continue;
+    }
+    auto input_build_info = AnfAlgo::GetSelectKernelBuildInfo(input);
+    if (input_build_info != nullptr && input_with_index.second < input_build_info->GetOutputNum()) {
+      buffer << input_build_info->GetOutputFormat(input_with_index.second)
+             << TypeIdToString(input_build_info->GetOutputDeviceType(input_with_index.second));
+    }
+  }
+  size_t output_num = common::AnfAlgo::GetOutputTensorNum(kernel);
+  for (size_t i = 0; i < output_num; ++i) {
+    buffer << "|" << TypeIdToString(common::AnfAlgo::GetOutputInferDataType(kernel, i))
+           << ShapeVectorToStr(common::AnfAlgo::GetOutputInferShape(kernel, i));
+  }
+  return system::sha256::GetHashFromString(buffer.str());
+}
+
+nlohmann::json BuildInfoToJson(const kernel::KernelBuildInfo &build_info) {
+  nlohmann::json build_info_json;
+  build_info_json["kernel_type"] = static_cast<int>(build_info.kernel_type());
+  build_info_json["op_pattern"] = static_cast<int>(build_info.op_pattern());
+  build_info_json["fusion_type"] = static_cast<int>(build_info.fusion_type());
+  build_info_json["processor"] = static_cast<int>(build_info.processor());
+  build_info_json["core_type"] = build_info.core_type();
+  build_info_json["origin_format"] = build_info.GetOriginDataFormat();
+  build_info_json["inputs_format"] = build_info.GetAllInputFormats();
+  build_info_json["outputs_format"] = build_info.GetAllOutputFormats();
+  build_info_json["inputs_device_type"] = build_info.GetAllInputDeviceTypes();
+  build_info_json["outputs_device_type"] = build_info.GetAllOutputDeviceTypes();
+  build_info_json["inputs_reshape_type"] = build_info.GetAllInputReshapeType();
+  build_info_json["outputs_reshape_type"] = build_info.GetAllOutputReshapeType();
+  build_info_json["inputs_value_depend"] = build_info.GetAllInputValueDepend();
+  build_info_json["output_data_desc"] = build_info.output_data_desc();
+  return build_info_json;
+}
+
+kernel::KernelBuildInfoPtr BuildInfoFromJson(const nlohmann::json &build_info_json) {
+  kernel::KernelBuildInfo::KernelBuildInfoBuilder builder;
+  builder.SetKernelType(static_cast<KernelType>(build_info_json.at("kernel_type").get<int>()));
+  builder.SetOpPattern(static_cast<kernel::OpPattern>(build_info_json.at("op_pattern").get<int>()));
+  builder.SetFusionType(static_cast<kernel::FusionType>(build_info_json.at("fusion_type").get<int>()));
+  builder.SetProcessor(static_cast<kernel::Processor>(build_info_json.at("processor").get<int>()));
+  builder.SetCoreType(build_info_json.at("core_type").get<std::string>());
+  builder.SetOriginDataFormat(build_info_json.at("origin_format").get<std::string>());
+  builder.SetInputsFormat(build_info_json.at("inputs_format").get<std::vector<std::string>>());
+  builder.SetOutputsFormat(build_info_json.at("outputs_format").get<std::vector<std::string>>());
+  builder.SetInputsDeviceType(build_info_json.at("inputs_device_type").get<std::vector<TypeId>>());
+  builder.SetOutputsDeviceType(build_info_json.at("outputs_device_type").get<std::vector<TypeId>>());
+  builder.SetInputsReshapeType(build_info_json.at("inputs_reshape_type").get<std::vector<std::string>>());
+  builder.SetOutputsReshapeType(build_info_json.at("outputs_reshape_type").get<std::vector<std::string>>());
+  builder.SetInputsValueDepend(build_info_json.at("inputs_value_depend").get<std::vector<std::string>>());
+  builder.SetOutputDataDesc(build_info_json.at("output_data_desc").get<std::vector<nlohmann::json>>());
+  return builder.Build();
+}
+}  // namespace
+
+KernelSelectCache &KernelSelectCache::GetInstance() {
+  static KernelSelectCache instance;
+  return instance;
+}
+
+void KernelSelectCache::Open(const std::string &file_path) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (enabled_ && file_path == file_path_) {
+    return;
+  }
+  file_path_ = file_path;
+  config_ = GetCompileConfig();
+  selections_.clear();
+  modified_ = false;
+  enabled_ = true;
+
+  auto realpath = Common::CreatePrefixPath(file_path_, true);
+  if (!realpath.has_value()) {
+    MS_LOG(WARNING) << "Get real path of file " << file_path_ << " failed.";
+    return;
+  }
+  std::ifstream input(realpath.value());
+  if (!input.good()) {
+    MS_LOG(INFO) << "The kernel select cache file " << realpath.value() << " does not exist.";
+    return;
+  }
+  try {
+    auto cache_json = nlohmann::json::parse(input);
+    if (cache_json.at(kConfig).get<std::string>() != config_) {
+      MS_LOG(WARNING) << "The kernel select cache file " << realpath.value()
+                      << " is generated with another version, device target or compile options, ignore it.";
+      return;
+    }
+    for (const auto &selection : cache_json.at(kSelections)) {
+      selections_[selection.at(kSignature).get<std::string>()] = selection;
+    }
+  } catch (const std::exception &e) {
+    selections_.clear();
+    MS_LOG(WARNING) << "Parse the kernel select cache file " << realpath.value() << " failed, ignore it: " << e.what();
+    return;
+  }
+  MS_LOG(INFO) << "Load " << selections_.size() << " kernel selections from " << realpath.value();
+}
+
+bool KernelSelectCache::Restore(const CNodePtr &kernel, const std::string &device_key, std::string *signature) {
+  MS_EXCEPTION_IF_NULL(signature);
+  signature->clear();
+  if (!enabled_ || !IsCacheable(kernel)) {
+    return false;
+  }
+  *signature = GetSignature(kernel, device_key);
+  nlohmann::json selection;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = selections_.find(*signature);
+    if (iter == selections_.end()) {
+      return false;
+    }
+    selection = iter->second;
+  }
+
+  // Parse the whole selection before any build info is set, so that a broken one is ignored as a missed one.
+  kernel::KernelBuildInfoPtr build_info = nullptr;
+  std::vector<std::pair<AnfNodePtr, kernel::KernelBuildInfoPtr>> input_build_infos;
+  size_t input_num = common::AnfAlgo::GetInputTensorNum(kernel);
+  try {
+    build_info = BuildInfoFromJson(selection.at(kBuildInfo));
+    for (const auto &input_json : selection.at(kInputs)) {
+      auto input_index = input_json.at(kInputIndex).get<size_t>();
+      auto input = (input_index < input_num) ? GetSelectedWithKernelInput(kernel, input_index) : nullptr;
+      if (input == nullptr) {
+        return false;
+      }
+      (void)input_build_infos.emplace_back(input, BuildInfoFromJson(input_json.at(kBuildInfo)));
+    }
+  } catch (const std::exception &e) {
+    MS_LOG(WARNING) << "Parse the cached kernel select of " << kernel->fullname_with_scope()
+                    << " failed, select it again: " << e.what();
+    return false;
+  }
+  if (build_info->GetInputNum() != input_num) {
+    return false;
+  }
+
+  AnfAlgo::SetSelectKernelBuildInfo(build_info, kernel.get());
+  for (const auto &input_build_info : input_build_infos) {
+    AnfAlgo::SetSelectKernelBuildInfo(input_build_info.second, input_build_info.first.get());
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++restored_count_;
+  return true;
+}
+
+void KernelSelectCache::Record(const CNodePtr &kernel, const std::string &signature) {
+  MS_EXCEPTION_IF_NULL(kernel);
+  if (!enabled_ || signature.empty()) {
+    return;
+  }
+  auto build_info = AnfAlgo::GetSelectKernelBuildInfo(kernel);
+  if (build_info == nullptr) {
+    return;
+  }
+  nlohmann::json selection;
+  selection[kSignature] = signature;
+  selection[kBuildInfo] = BuildInfoToJson(*build_info);
+  selection[kInputs] = nlohmann::json::array();
+  size_t input_num = common::AnfAlgo::GetInputTensorNum(kernel);
+  for (size_t i = 0; i < input_num; ++i) {
+    auto input = GetSelectedWithKernelInput(kernel, i);
+    if (input == nullptr) {
+      continue;
+    }
+    auto input_build_info = AnfAlgo::GetSelectKernelBuildInfo(input);
+    if (input_build_info == nullptr) {
+      continue;
+    }
+    nlohmann::json input_json;
+    input_json[kInputIndex] = i;
+    input_json[kBuildInfo] = BuildInfoToJson(*input_build_info);
+    selection[kInputs].push_back(input_json);
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (selections_.count(signature) == 0) {
+    selections_[signature] = selection;
+    modified_ = true;
+  }
+}
+
+void KernelSelectCache::Save() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!enabled_) {
+    return;
+  }
+  MS_LOG(INFO) << "Restore " << restored_count_ << " kernel selections from the kernel select cache.";
+  restored_count_ = 0;
+  if (!modified_) {
+    return;
+  }
+  nlohmann::json cache_json;
+  cache_json[kConfig] = config_;
+  cache_json[kSelections] = nlohmann::json::array();
+  for (const auto &selection : selections_) {
+    cache_json[kSelections].push_back(selection.second);
+  }
+
+  auto realpath = Common::CreatePrefixPath(file_path_, true);
+  if (!realpath.has_value()) {
+    MS_LOG(ERROR) << "Get real path of file " << file_path_ << " failed.";
+    return;
+  }
+  ChangeFileMode(realpath.value(), S_IWUSR);
+  std::ofstream output(realpath.value());
+  if (!output.is_open()) {
+    MS_LOG(ERROR) << "Open cache file '" << realpath.value() << "' failed!" << ErrnoToString(errno);
+    return;
+  }
+  output << cache_json.dump();
+  output.close();
+  ChangeFileMode(realpath.value(), S_IRUSR);
+  modified_ = false;
+}
+
+void KernelSelectCache::Close() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  enabled_ = false;
+  modified_ = false;
+  file_path_.clear();
+  selections_.clear();
+  restored_count_ = 0;
+}
+}  // namespace runtime
+}  // namespace mindspore
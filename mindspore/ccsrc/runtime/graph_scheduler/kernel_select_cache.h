@@ -0,0 +1,79 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CCSRC_RUNTIME_GRAPH_SCHEDULER_KERNEL_SELECT_CACHE_H_
+#define MINDSPORE_CCSRC_RUNTIME_GRAPH_SCHEDULER_KERNEL_SELECT_CACHE_H_
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include "nlohmann/json.hpp"
+#include "utils/ms_utils.h"
+#include "ir/anf.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+namespace runtime {
+// KernelSelectCache persists the kernel build info selected for the kernels of the compiled graphs to the compilation
+// cache directory, so that a restarted process restores the selection of a kernel instead of running it again. The
+// selections are keyed by the signature of the kernel: the device key given by the device, the primitive with its
+// attributes, the shapes and types of the inputs and outputs, and the build info already selected for the inputs. The
+// cache file is only reused with the same version, device target and compile options.
+class BACKEND_EXPORT KernelSelectCache {
+ public:
+  static KernelSelectCache &GetInstance();
+
+  // Enable the cache and load the selections cached in the file, the file is created by Save if it does not exist.
+  void Open(const std::string &file_path);
+
+  bool enabled() const { return enabled_; }
+
+  // Set the cached kernel build info to the kernel and its parameter and value node inputs, and return false if the
+  // kernel is missed in the cache. The device key describes the device and the per-graph state the selection depends
+  // on besides the kernel itself, e.g. the compute capability of the device and whether the formats are transformed.
+  // The signature is computed before the kernel is selected, since the selection sets the build info of the inputs,
+  // and it is left empty if the kernel can not be cached.
+  bool Restore(const CNodePtr &kernel, const std::string &device_key, std::string *signature);
+
+  // Record the kernel build info selected for the kernel and its parameter and value node inputs.
+  void Record(const CNodePtr &kernel, const std::string &signature);
+
+  // Write the selections to the file if there are new ones recorded.
+  void Save();
+
+  // Disable the cache and drop the selections loaded, the selections not saved are discarded.
+  void Close();
+
+ private:
+  KernelSelectCache() = default;
+  ~KernelSelectCache() = default;
+  DISABLE_COPY_AND_ASSIGN(KernelSelectCache);
+
+  std::mutex mutex_;
+  std::atomic<bool> enabled_{false};
+  bool modified_{false};
+  std::string file_path_;
+  // The hash of the version, device target and compile options the selections are made with.
+  std::string config_;
+  // The signature of kernel -> the selected kernel build info of the kernel and its inputs.
+  std::map<std::string, nlohmann::json> selections_;
+  size_t restored_count_{0};
+};
+}  // namespace runtime
+}  // namespace mindspore
+
+#endif  // MINDSPORE_CCSRC_RUNTIME_GRAPH_SCHEDULER_KERNEL_SELECT_CACHE_H_
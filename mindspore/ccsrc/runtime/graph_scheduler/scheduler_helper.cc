@@ -624,6 +624,96 @@ void SchedulerHelper::AddSomasInfo(AbstractActor *const actor) {
   kernel_actor->somas_info_ = somas_info;
 }
 
+namespace {
+// The bytes of the kernel inputs and outputs which count as one unit of the kernel cost.
+constexpr size_t kKernelCostBytesUnit = 4096;
+
+// Estimate the launch cost of kernel by the launch overhead and the memory the kernel reads and writes.
+int64_t EstimateKernelCost(const KernelActor *kernel_actor) {
+  MS_EXCEPTION_IF_NULL(kernel_actor);
+  int64_t cost = 1;
+  auto kernel_mod = AnfAlgo::GetKernelMod(kernel_actor->kernel());
+  if (kernel_mod == nullptr) {
+    return cost;
+  }
+  size_t total_size = 0;
+  for (auto size : kernel_mod->GetInputSizeList()) {
+    total_size += size;
+  }
+  for (auto size : kernel_mod->GetOutputSizeList()) {
+    total_size += size;
+  }
+  return cost + SizeToLong(total_size / kKernelCostBytesUnit);
+}
+}  // namespace
+
+void SchedulerHelper::SetKernelActorPriority(const ActorSet *actor_set) {
+  MS_EXCEPTION_IF_NULL(actor_set);
+  mindspore::HashMap<std::string, KernelActor *> kernel_actors;
+  for (const auto &kernel_actor : actor_set->kernel_actors_) {
+    MS_EXCEPTION_IF_NULL(kernel_actor);
+    kernel_actors[kernel_actor->GetAID().Name()] = kernel_actor.get();
+  }
+  auto fetch_output_kernel_actors = [&kernel_actors](const KernelActor *actor) {
+    std::vector<KernelActor *> output_actors;
+    for (const auto &data_arrow : actor->output_data_arrows()) {
+      MS_EXCEPTION_IF_NULL(data_arrow);
+      auto iter = kernel_actors.find(data_arrow->to_op_id_.Name());
+      if (iter != kernel_actors.end()) {
+        (void)output_actors.emplace_back(iter->second);
+      }
+    }
+    for (const auto &control_arrow : actor->output_control_arrows()) {
+      MS_EXCEPTION_IF_NULL(control_arrow);
+      auto iter = kernel_actors.find(control_arrow->to_op_id_.Name());
+      if (iter != kernel_actors.end()) {
+        (void)output_actors.emplace_back(iter->second);
+      }
+    }
+    return output_actors;
+  };
+
+  // The priority of kernel actor is the cost of the longest path from the actor to the end through the kernel actors,
+  // it is computed by the depth first search in post order. The kernel actors are linked without cycle, and the
+  // visited set avoids looping forever if there is one.
+  mindspore::HashMap<KernelActor *, int64_t> priorities;
+  mindspore::HashSet<KernelActor *> visited;
+  std::vector<std::pair<KernelActor *, bool>> stack;
+  for (const auto &kernel_actor : actor_set->kernel_actors_) {
+    stack.emplace_back(kernel_actor.get(), false);
+    while (!stack.empty()) {
+      auto [actor, expanded] = stack.back();
+      if (expanded) {
+        stack.pop_back();
+        int64_t output_priority = 0;
+        for (auto output_actor : fetch_output_kernel_actors(actor)) {
+          auto iter = priorities.find(output_actor);
+          if (iter != priorities.end()) {
+            output_priority = std::max(output_priority, iter->second);
+          }
+        }
+        priorities[actor] = EstimateKernelCost(actor) + output_priority;
+        continue;
+      }
+      if (!visited.insert(actor).second) {
+        stack.pop_back();
+        continue;
+      }
+      stack.back().second = true;
+      for (auto output_actor : fetch_output_kernel_actors(actor)) {
+        if (visited.count(output_actor) == 0) {
+          stack.emplace_back(output_actor, false);
+        }
+      }
+    }
+  }
+
+  for (const auto &[actor, priority] : priorities) {
+    actor->set_priority(priority);
+    MS_LOG(DEBUG) << "The priority of " << actor->GetAID().Name() << " is " << priority;
+  }
+}
+
 namespace {
 void CheckKernelActorValid(const std::vector<KernelActorPtr> &kernel_actors) {
   for (const auto &kernel_actor : kernel_actors) {
@@ -91,6 +91,9 @@ class SchedulerHelper {
                                 const KernelGraphPtr &from_graph);
   static void AddSomasInfo(AbstractActor *const actor);
 
+  // Set the priority of the kernel actors by the critical path for the priority scheduling of the actor thread pool.
+  static void SetKernelActorPriority(const ActorSet *actor_set);
+
   // Check whether the actor set is valid.
   static void CheckActorValid(const ActorSet *actor_set);
 
@@ -61,7 +61,7 @@ OpCompilerInfoPtr OpCompiler::Compile(const session::BackendOpRunInfoPtr &op_run
                                       device::DeviceContext *device_context) {
   MS_EXCEPTION_IF_NULL(op_run_info);
   MS_EXCEPTION_IF_NULL(device_context);
-  auto graph_info = op_run_info->base_op_run_info.graph_info;
+  const auto &graph_info = op_run_info->base_op_run_info.graph_info;
   auto iter = op_compiler_infos_.find(graph_info);
   // Check if the graph cache exists.
   auto &op_executor = runtime::OpExecutor::GetInstance();
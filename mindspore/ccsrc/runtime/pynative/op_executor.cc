@@ -15,6 +15,7 @@
  */
 
 #include "runtime/pynative/op_executor.h"
+#include <algorithm>
 #if !defined(_WIN32) && !defined(_WIN64) && !defined(__APPLE__)
 #include "include/common/utils/signal_util.h"
 #endif
@@ -91,7 +92,7 @@ void OpExecutor::PushOpBuildTask(const std::shared_ptr<OpBuildTask> &op_build_ta
 
 void OpExecutor::PushOpRunTask(const std::shared_ptr<OpTask> &op_run_task) {
   std::lock_guard<std::mutex> lock(task_mutex_);
-  op_run_tasks_.push(op_run_task);
+  op_run_tasks_.push_back(op_run_task);
   (void)actor_in_queue_.insert(op_run_task->context()->graph_id());
   task_cond_var_.notify_all();
 }
@@ -127,11 +128,28 @@ bool OpExecutor::ActorInQueue(GraphId graph_id) {
 }
 
 void OpExecutor::ClearRunOpTasks() {
+  ++clear_generation_;
   actor_in_queue_.clear();
-  std::queue<std::shared_ptr<OpTask>> empty;
   // No need to worry about ExitOpTask.
   // ClearRunOpTasks is executed before ~OpExecutor
-  std::swap(op_run_tasks_, empty);
+  op_run_tasks_.clear();
+}
+
+void OpExecutor::FetchRunOpTasks(std::vector<std::shared_ptr<OpTask>> *tasks) {
+  MS_EXCEPTION_IF_NULL(tasks);
+  auto window_size = std::min(op_run_tasks_.size(), kMaxQueueSize);
+  tasks->assign(op_run_tasks_.begin(), op_run_tasks_.begin() + SizeToLong(window_size));
+}
+
+bool OpExecutor::PopRunOpTask(const std::shared_ptr<OpTask> &task, size_t generation) {
+  if (clear_generation_ != generation) {
+    return false;
+  }
+  if (!op_run_tasks_.empty() && op_run_tasks_.front() == task) {
+    op_run_tasks_.pop_front();
+    (void)actor_in_queue_.erase(task->context()->graph_id());
+  }
+  return true;
 }
 
 void OpExecutor::WorkerLoop() {
@@ -143,37 +161,47 @@ void OpExecutor::WorkerLoop() {
   });
 #endif
 
+  std::vector<std::shared_ptr<OpTask>> tasks;
   while (true) {
-    std::shared_ptr<OpTask> task;
+    size_t generation = 0;
     {
       MS_LOG(DEBUG) << "Wait task in queue";
       std::unique_lock<std::mutex> lock(task_mutex_);
       task_cond_var_.wait(lock, [this]() { return !op_run_tasks_.empty(); });
-      task = op_run_tasks_.front();
+      // Fetch the queued tasks by windows, so that the lock is taken once for a window instead of twice for each task.
+      FetchRunOpTasks(&tasks);
+      generation = clear_generation_;
     }
 
-    MS_LOG(DEBUG) << "Get task";
-    MS_EXCEPTION_IF_NULL(task);
-    if (task->task_type() == kExitTask) {
-      MS_LOG(DEBUG) << "Thread exit";
-      return;
-    }
+    MS_LOG(DEBUG) << "Get " << tasks.size() << " tasks";
     try {
-      task->Run();
-      std::unique_lock<std::mutex> lock(task_mutex_);
-      if (!op_run_tasks_.empty()) {
-        op_run_tasks_.pop();
-        (void)actor_in_queue_.erase(task->context()->graph_id());
-      }
-
-      if (op_run_tasks_.empty()) {
-        MS_LOG(DEBUG) << "Task queue empty";
-        task_cond_var_.notify_all();
+      for (const auto &task : tasks) {
+        MS_EXCEPTION_IF_NULL(task);
+        if (task->task_type() == kExitTask) {
+          MS_LOG(DEBUG) << "Thread exit";
+          return;
+        }
+        // The tasks have been cleared by Reset, drop the rest of the window.
+        if (clear_generation_ != generation) {
+          break;
+        }
+        task->Run();
+        // Pop each task once it finishes, so that Wait and ActorInQueue do not wait for the whole window.
+        std::unique_lock<std::mutex> lock(task_mutex_);
+        if (!PopRunOpTask(task, generation)) {
+          break;
+        }
+        if (op_run_tasks_.empty()) {
+          MS_LOG(DEBUG) << "Task queue empty";
+          task_cond_var_.notify_all();
+        }
       }
+      tasks.clear();
     } catch (const std::exception &e) {
       MS_LOG(ERROR) << "Run lazy task failed, error message:" << e.what();
       {
         std::unique_lock<std::mutex> lock(task_mutex_);
+        tasks.clear();
         ClearRunOpTasks();
         MsException::Instance().SetException();
         task_cond_var_.notify_all();
@@ -189,7 +217,7 @@ void OpExecutor::WorkerJoin() {
       {
         std::lock_guard<std::mutex> lock(task_mutex_);
         auto task = std::make_shared<ExitOpTask>();
-        op_run_tasks_.push(task);
+        op_run_tasks_.push_back(task);
         task_cond_var_.notify_all();
         MS_LOG(DEBUG) << "Push exit task and notify all";
       }
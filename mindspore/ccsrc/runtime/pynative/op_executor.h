@@ -19,11 +19,12 @@
 
 #include <vector>
 #include <memory>
-#include <queue>
+#include <deque>
 #include <map>
 #include <string>
 #include <set>
 #include <utility>
+#include <atomic>
 #include "backend/common/session/kernel_graph.h"
 #include "backend/common/session/anf_runtime_algorithm.h"
 #include "include/common/utils/anfalgo.h"
@@ -83,12 +84,19 @@ class BACKEND_EXPORT OpExecutor {
   void WaitForBuild();
   void WaitForRun();
   void WorkerLoop();
+  // Take a window of the queued run tasks from the front of the queue, the tasks stay in the queue until they finish.
+  void FetchRunOpTasks(std::vector<std::shared_ptr<OpTask>> *tasks);
+  // Pop the finished run task from the front of the queue, return false if the queue was cleared since the window was
+  // fetched.
+  bool PopRunOpTask(const std::shared_ptr<OpTask> &task, size_t generation);
   void ClearRunOpTasks();
   void ClearResources();
 
   std::vector<std::shared_ptr<OpBuildTask>> op_build_tasks_;
-  std::queue<std::shared_ptr<OpTask>> op_run_tasks_;
+  std::deque<std::shared_ptr<OpTask>> op_run_tasks_;
   std::set<GraphId> actor_in_queue_;
+  // Increased each time the run tasks are cleared, so that the worker drops the rest of the window it fetched.
+  std::atomic<size_t> clear_generation_{0};
   std::function<void()> batch_build_callback_{nullptr};
   inline static size_t kMaxQueueSize = 20;
   bool executing_{false};
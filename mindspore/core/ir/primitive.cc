@@ -19,6 +19,7 @@
 #include <utility>
 #include "abstract/abstract_function.h"
 #include "utils/ms_utils.h"
+#include "utils/hashing.h"
 
 namespace mindspore {
 static uint64_t MakeId() {
@@ -65,6 +66,7 @@ Primitive &Primitive::operator=(const Primitive &other) {
   }
   Named::operator=(other);
   attrs_ = other.attrs_;
+  attrs_hash_ = 0;
   evaluate_added_attrs_ = other.evaluate_added_attrs_;
   instance_name_ = other.instance_name_;
   is_base_ = other.is_base_;
@@ -97,6 +99,24 @@ bool Primitive::operator==(const Primitive &other) const {
   return common::IsAttrsEqual(attrs_, other.attrs_);
 }
 
+std::size_t Primitive::attrs_hash() const {
+  std::size_t hash = attrs_hash_;
+  if (hash != 0) {
+    return hash;
+  }
+  // The hashes of the attributes are summed, since the order of the attributes differs between primitives.
+  for (const auto &attr : attrs_) {
+    auto value_hash = attr.second == nullptr ? 0 : std::hash<std::string>{}(attr.second->ToString());
+    hash += hash_combine(std::hash<std::string>{}(attr.first), value_hash);
+  }
+  // 0 is left for the hash not computed.
+  if (hash == 0) {
+    hash = 1;
+  }
+  attrs_hash_ = hash;
+  return hash;
+}
+
 std::string Primitive::GetAttrsText() const {
   if (attrs_.empty()) {
     return "";
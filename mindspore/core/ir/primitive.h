@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CORE_IR_PRIMITIVE_H_
 #define MINDSPORE_CORE_IR_PRIMITIVE_H_
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <string>
@@ -76,6 +77,7 @@ class MS_CORE_API Primitive : public Named {
   /// \return The primitive to which attribute has been added.
   Primitive &AddAttr(const std::string &name, const ValuePtr &attr) {
     attrs_[name] = attr;
+    attrs_hash_ = 0;
     if (record_evaluate_add_attr_) {
       evaluate_added_attrs_[name] = attr;
     }
@@ -87,6 +89,7 @@ class MS_CORE_API Primitive : public Named {
   /// \return The primitive to which attribute has been added.
   Primitive &DelAttr(const std::string &name) {
     (void)attrs_.erase(name);
+    attrs_hash_ = 0;
     return *this;
   }
   /// \brief Use add attribute by using a map,all elements of the map will be added in the primitive's attribute map.
@@ -97,12 +100,19 @@ class MS_CORE_API Primitive : public Named {
     for (auto &attr : attrs) {
       attrs_[attr.first] = attr.second;
     }
+    attrs_hash_ = 0;
     return *this;
   }
   /// \brief Set attribute to the primitive attribute map.
-  void set_attr(const std::string &attrName, const ValuePtr &attr) { attrs_[attrName] = attr; }
+  void set_attr(const std::string &attrName, const ValuePtr &attr) {
+    attrs_[attrName] = attr;
+    attrs_hash_ = 0;
+  }
   /// \brief Erase attribute to the primitive attribute map.
-  void EraseAttr(const std::string &attrName) { (void)attrs_.erase(attrName); }
+  void EraseAttr(const std::string &attrName) {
+    (void)attrs_.erase(attrName);
+    attrs_hash_ = 0;
+  }
   /// \brief Run Primitive's compute function if the compute function has been implemented.
   ///
   /// \param[in] args The arguments of primitive need to compute.
@@ -120,6 +130,11 @@ class MS_CORE_API Primitive : public Named {
   ///
   /// \return The Primitive's all attribute.
   const mindspore::HashMap<std::string, ValuePtr> &attrs() const { return attrs_; }
+  /// \brief Get the hash of Primitive's attributes, which is computed from the names and values of the attributes
+  /// and kept until the attributes are changed.
+  ///
+  /// \return The hash of the attributes.
+  std::size_t attrs_hash() const;
   /// \brief Get the attributes added in MindSpore renormalize stage.
   ///
   /// \return Attributes which have been added in MindSpore renormalize stage.
@@ -131,6 +146,7 @@ class MS_CORE_API Primitive : public Named {
     for (auto &attr : attrs) {
       (void)attrs_.insert_or_assign(attr.first, attr.second);
     }
+    attrs_hash_ = 0;
     evaluate_added_attrs_ = attrs;
   }
   /// \brief Check if Primitive has any attribute.
@@ -237,6 +253,8 @@ class MS_CORE_API Primitive : public Named {
   bool is_const_prim_;
   std::vector<size_t> const_input_indexes_;
   uint64_t id_{0};
+  // The hash of attrs_, 0 if it is not computed since attrs_ is changed.
+  mutable std::atomic<std::size_t> attrs_hash_{0};
 };
 
 inline std::ostream &operator<<(std::ostream &os, const PrimitivePtr &p) {
@@ -80,6 +80,15 @@ class MS_CORE_API ActorBase {
 
   void set_thread_pool(ActorThreadPool *pool) { pool_ = pool; }
 
+  // Set the mailbox type used when the actor is spawned on the shared threads, it should be set before spawning.
+  void set_mailbox_type(MailBoxType type) { mailbox_type_ = type; }
+  MailBoxType mailbox_type() const { return mailbox_type_; }
+
+  // Set the priority of dispatching the actor in the priority scheduling mode of the thread pool, the actor with the
+  // higher priority runs first and 0 means no priority.
+  void set_priority(int64_t priority) { priority_ = priority; }
+  int64_t priority() const { return priority_; }
+
   // Judge if actor running by the received message number, the default is true.
   virtual bool IsActive(int msg_num) { return true; }
 
@@ -215,6 +224,8 @@ class MS_CORE_API ActorBase {
 
   ActorThreadPool *pool_{nullptr};
   std::shared_ptr<ActorMgr> actor_mgr_;
+  MailBoxType mailbox_type_{MailBoxType::kNonblocking};
+  int64_t priority_{0};
 };
 using ActorReference = std::shared_ptr<ActorBase>;
 };  // namespace mindspore
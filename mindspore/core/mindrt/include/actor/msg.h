@@ -85,6 +85,9 @@ class MessageBase {
   size_t size;
 
   Type type;
+
+  // The next message in the intrusive linked list of LockFreeMailBox.
+  MessageBase *next{nullptr};
 };
 }  // namespace mindspore
 
@@ -85,4 +85,57 @@ std::unique_ptr<MessageBase> HQueMailBox::GetMsg() {
   std::unique_ptr<MessageBase> msg(mailbox.Dequeue());
   return msg;
 }
+
+MessageBase LockFreeMailBox::releasedTag;
+
+LockFreeMailBox::~LockFreeMailBox() {
+  MessageBase *msgs[] = {dequeHead, head.load()};
+  for (auto msg : msgs) {
+    while (msg != nullptr && msg != &releasedTag) {
+      auto next = msg->next;
+      delete msg;
+      msg = next;
+    }
+  }
+}
+
+int LockFreeMailBox::EnqueueMessage(std::unique_ptr<mindspore::MessageBase> msg) {
+  MessageBase *msgPtr = msg.release();
+  MessageBase *oldHead = head.load(std::memory_order_relaxed);
+  do {
+    msgPtr->next = (oldHead == &releasedTag) ? nullptr : oldHead;
+  } while (!head.compare_exchange_weak(oldHead, msgPtr, std::memory_order_release, std::memory_order_relaxed));
+  if (oldHead == &releasedTag && notifyHook) {
+    (*notifyHook.get())();
+  }
+  return 0;
+}
+
+std::unique_ptr<MessageBase> LockFreeMailBox::GetMsg() {
+  if (dequeHead == nullptr) {
+    MessageBase *msgs = head.exchange(nullptr, std::memory_order_acquire);
+    if (msgs == &releasedTag) {
+      msgs = nullptr;
+    }
+    if (msgs == nullptr) {
+      // release the consumer, the next enqueue will notify it again.
+      MessageBase *expected = nullptr;
+      if (head.compare_exchange_strong(expected, &releasedTag, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return nullptr;
+      }
+      msgs = head.exchange(nullptr, std::memory_order_acquire);
+    }
+    // reverse the pushed messages to the arrival order.
+    while (msgs != nullptr) {
+      auto next = msgs->next;
+      msgs->next = dequeHead;
+      dequeHead = msgs;
+      msgs = next;
+    }
+  }
+  std::unique_ptr<MessageBase> msg(dequeHead);
+  dequeHead = dequeHead->next;
+  msg->next = nullptr;
+  return msg;
+}
 }  // namespace mindspore
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_MAILBOX_H
 #define MINDSPORE_MAILBOX_H
 #include <list>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <condition_variable>
@@ -26,6 +27,9 @@
 #include "thread/hqueue.h"
 
 namespace mindspore {
+// The mailbox type of the actor spawned on the shared threads.
+enum class MailBoxType { kNonblocking = 0, kLockFree };
+
 class MailBox {
  public:
   virtual ~MailBox() = default;
@@ -94,6 +98,27 @@ class HQueMailBox : public MailBox {
   HQueue<MessageBase> mailbox;
   static const int32_t MAX_MSG_QUE_SIZE = 4096;
 };
+
+// Unbounded lock-free multi-producer/single-consumer mailbox. The producers push messages to the head of an intrusive
+// linked list by CAS, and the consumer takes all pushed messages at once and reverses them to the arrival order, so no
+// lock and memory allocation is needed. Like NonblockingMailBox, the notify hook is invoked only when the first message
+// comes after the consumer found the mailbox empty.
+class LockFreeMailBox : public MailBox {
+ public:
+  LockFreeMailBox() : head(&releasedTag), dequeHead(nullptr) { takeAllMsgsEachTime = false; }
+  ~LockFreeMailBox() override;
+  int EnqueueMessage(std::unique_ptr<MessageBase> msg) override;
+  std::list<std::unique_ptr<MessageBase>> *GetMsgs() override { return nullptr; }
+  std::unique_ptr<MessageBase> GetMsg() override;
+
+ private:
+  // The messages pushed by producers in the reverse order, it points to the 'releasedTag' if the mailbox is empty and
+  // the consumer is released.
+  std::atomic<MessageBase *> head;
+  // The messages taken by the consumer in the arrival order.
+  MessageBase *dequeHead;
+  static MessageBase releasedTag;
+};
 }  // namespace mindspore
 
 #endif  // MINDSPORE_MAILBOX_H
@@ -43,9 +43,10 @@ void ActorWorker::RunWithSpin() {
     } else {
       YieldAndDeactive();
     }
-    if (spin_count_ > max_spin_count_) {
+    if (NeedPark()) {
       WaitUntilActive();
       spin_count_ = 1;
+      spin_start_ = std::chrono::steady_clock::now();
     }
   }
 }
@@ -88,6 +89,7 @@ ActorThreadPool::~ActorThreadPool() {
       std::lock_guard<std::mutex> _l(actor_mutex_);
       terminate = actor_queue_.empty();
 #endif
+      terminate = terminate && priority_actor_num_ == 0;
     }
     if (!terminate) {
       for (auto &worker : workers_) {
@@ -107,24 +109,31 @@ ActorThreadPool::~ActorThreadPool() {
 }
 
 ActorBase *ActorThreadPool::PopActorFromQueue() {
+  ActorBase *actor = nullptr;
 #ifdef USE_HQUEUE
-  return actor_queue_.Dequeue();
+  actor = actor_queue_.Dequeue();
 #else
-  std::lock_guard<std::mutex> _l(actor_mutex_);
-  if (actor_queue_.empty()) {
-    return nullptr;
+  {
+    std::lock_guard<std::mutex> _l(actor_mutex_);
+    if (!actor_queue_.empty()) {
+      actor = actor_queue_.front();
+      actor_queue_.pop();
+    }
   }
-  auto actor = actor_queue_.front();
-  actor_queue_.pop();
-  return actor;
 #endif
+  if (actor == nullptr && priority_actor_num_ > 0) {
+    actor = PopActorFromPriorityQueue();
+  }
+  return actor;
 }
 
 void ActorThreadPool::PushActorToQueue(ActorBase *actor) {
   if (!actor) {
     return;
   }
-  {
+  if (priority_scheduling_ && actor->priority() > 0) {
+    PushActorToPriorityQueue(actor);
+  } else {
 #ifdef USE_HQUEUE
     while (!actor_queue_.Enqueue(actor)) {
     }
@@ -143,6 +152,29 @@ void ActorThreadPool::PushActorToQueue(ActorBase *actor) {
   }
 }
 
+int ActorThreadPool::EnablePriorityScheduling() {
+  priority_scheduling_ = true;
+  THREAD_INFO("enable priority scheduling of actor thread pool");
+  return THREAD_OK;
+}
+
+void ActorThreadPool::PushActorToPriorityQueue(ActorBase *actor) {
+  std::lock_guard<std::mutex> _l(priority_mutex_);
+  priority_actor_queue_.push({actor->priority(), priority_sequence_++, actor});
+  ++priority_actor_num_;
+}
+
+ActorBase *ActorThreadPool::PopActorFromPriorityQueue() {
+  std::lock_guard<std::mutex> _l(priority_mutex_);
+  if (priority_actor_queue_.empty()) {
+    return nullptr;
+  }
+  auto actor = priority_actor_queue_.top().actor_;
+  priority_actor_queue_.pop();
+  --priority_actor_num_;
+  return actor;
+}
+
 int ActorThreadPool::ActorQueueInit() {
 #ifdef USE_HQUEUE
   if (actor_queue_.Init(static_cast<int32_t>(actor_queue_size_)) != true) {
@@ -63,6 +63,11 @@ class ActorThreadPool : public ThreadPool {
   virtual void PushActorToQueue(ActorBase *actor);
   virtual ActorBase *PopActorFromQueue();
 
+  // In priority scheduling mode, the actors with priority are dispatched by their priority instead of the arrival
+  // order, and they run after the actors without priority in the queue.
+  virtual int EnablePriorityScheduling();
+  bool priority_scheduling() const { return priority_scheduling_; }
+
  protected:
   ActorThreadPool() = default;
 
@@ -75,10 +80,29 @@ class ActorThreadPool : public ThreadPool {
 #endif
 
  private:
+  struct PriorityActor {
+    int64_t priority_;
+    // The arrival sequence keeps the actors with the same priority in arrival order.
+    uint64_t sequence_;
+    ActorBase *actor_;
+    bool operator<(const PriorityActor &other) const {
+      return priority_ < other.priority_ || (priority_ == other.priority_ && sequence_ > other.sequence_);
+    }
+  };
+  void PushActorToPriorityQueue(ActorBase *actor);
+  ActorBase *PopActorFromPriorityQueue();
+
   int CreateThreads(size_t actor_thread_num, size_t all_thread_num, const std::vector<int> &core_list);
 
   // Support to set the size of actor queue.
   static size_t actor_queue_size_;
+
+  bool priority_scheduling_{false};
+  std::mutex priority_mutex_;
+  std::priority_queue<PriorityActor> priority_actor_queue_;
+  uint64_t priority_sequence_{0};
+  // The size of priority_actor_queue_, read without the lock to skip the empty queue.
+  std::atomic<size_t> priority_actor_num_{0};
 };
 }  // namespace mindspore
 #endif  // MINDSPORE_CORE_MINDRT_RUNTIME_ACTOR_THREADPOOL_H_
@@ -103,6 +103,16 @@ class ParallelThreadPool : public ActorThreadPool {
 
   int ParallelLaunch(const Func &func, Content content, int task_num) override;
 
+  int EnableWorkStealing() override {
+    THREAD_ERROR("work stealing is not supported by parallel thread pool.");
+    return THREAD_ERROR;
+  }
+
+  int EnablePriorityScheduling() override {
+    THREAD_ERROR("priority scheduling is not supported by parallel thread pool.");
+    return THREAD_ERROR;
+  }
+
   void PushActorToQueue(ActorBase *actor) override {
     if (!actor) {
       return;
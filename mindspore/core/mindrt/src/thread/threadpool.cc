@@ -43,12 +43,32 @@ Worker::~Worker() {
   if (thread_.joinable()) {
     thread_.join();
   }
+
+  // run the splits left in the local deque after the worker thread exits, then this thread is the only owner of the
+  // deque and the task duration statistics, the other workers may still steal from the deque
+  count = 0;
+  while (local_task_deque_.IsInit() && count++ < kMaxCount) {
+    if (!RunTaskSplit(local_task_deque_.Pop())) {
+      break;
+    }
+  }
   pool_ = nullptr;
   local_task_queue_ = nullptr;
 }
 
 void Worker::CreateThread() { thread_ = std::thread(&Worker::Run, this); }
 
+int Worker::InitLocalTaskDeque() {
+  if (local_task_deque_.IsInit()) {
+    return THREAD_OK;
+  }
+  if (local_task_deque_.Init(static_cast<int64_t>(kMaxHqueueSize)) != true) {
+    THREAD_ERROR("init task deque failed.");
+    return THREAD_ERROR;
+  }
+  return THREAD_OK;
+}
+
 void Worker::SetAffinity() {
 #ifdef _WIN32
   SetWindowsSelfAffinity(core_id_);
@@ -101,15 +121,16 @@ void Worker::Run() {
   _MM_SET_DENORMALS_ZERO_MODE(_MM_DENORMALS_ZERO_ON);
 #endif
   while (alive_) {
-    if (RunLocalKernelTask()) {
+    if (RunLocalKernelTask() || StealKernelTask()) {
       spin_count_ = 0;
     } else {
       RunOtherKernelTask();
       YieldAndDeactive();
     }
-    if (spin_count_ > max_spin_count_) {
+    if (NeedPark()) {
       WaitUntilActive();
       spin_count_ = 1;
+      spin_start_ = std::chrono::steady_clock::now();
     }
   }
 }
@@ -125,7 +146,56 @@ bool Worker::TryRunTask(TaskSplit *task_split) {
   return true;
 }
 
+bool Worker::RunTaskSplit(TaskSplit *task_split) {
+  if (task_split == nullptr) {
+    return false;
+  }
+  auto task = task_split->task_;
+  auto start = std::chrono::steady_clock::now();
+  task->status |= task->func(task->content, task_split->task_id_, task_split->lhs_scale_, task_split->rhs_scale_);
+  auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  average_task_ns_ += (static_cast<int64_t>(duration.count()) - average_task_ns_) / kTaskDurationAverageWeight;
+  // the task may be released once all splits finished, do not access it after this
+  (void)++task->finished;
+  return true;
+}
+
+bool Worker::RunLocalDequeTask() {
+  bool res = false;
+  do {
+    if (has_assigned_.load(std::memory_order_acquire)) {
+      std::lock_guard<std::mutex> _l(mutex_);
+      auto iter = assigned_ranges_.begin();
+      while (iter != assigned_ranges_.end()) {
+        while (iter->start_ < iter->end_ && local_task_deque_.Push(&(*iter->task_list_)[iter->start_])) {
+          ++iter->start_;
+        }
+        if (iter->start_ < iter->end_) {
+          // the deque is full, push the rest after running some splits
+          break;
+        }
+        iter = assigned_ranges_.erase(iter);
+      }
+      has_assigned_.store(!assigned_ranges_.empty(), std::memory_order_release);
+    }
+    while (RunTaskSplit(local_task_deque_.Pop())) {
+      res = true;
+    }
+  } while (has_assigned_.load(std::memory_order_acquire));
+  return res;
+}
+
+bool Worker::StealKernelTask() {
+  if (pool_ == nullptr || !pool_->work_stealing()) {
+    return false;
+  }
+  return pool_->RunStolenTask(worker_id_ + 1, this);
+}
+
 bool Worker::RunLocalKernelTask() {
+  if (pool_ != nullptr && pool_->work_stealing()) {
+    return RunLocalDequeTask();
+  }
   bool res = false;
   Task *task = task_.load(std::memory_order_consume);
   if (task != nullptr) {
@@ -144,7 +214,8 @@ bool Worker::RunLocalKernelTask() {
 }
 
 void Worker::RunOtherKernelTask() {
-  if (pool_ == nullptr || pool_->actor_thread_num() <= kMinActorRunOther) {
+  // the other tasks are stolen by StealKernelTask in work stealing mode
+  if (pool_ == nullptr || pool_->work_stealing() || pool_->actor_thread_num() <= kMinActorRunOther) {
     return;
   }
   auto queues_length = pool_->task_queues().size();
@@ -163,16 +234,40 @@ void Worker::YieldAndDeactive() {
   // deactivate this worker only on the first entry
   if (spin_count_ == 0) {
     std::lock_guard<std::mutex> _l(mutex_);
-    if (local_task_queue_->Empty()) {
+    if (!HasLocalTask()) {
       status_.store(kThreadIdle);
     } else {
       return;
     }
+    spin_start_ = std::chrono::steady_clock::now();
   }
   spin_count_++;
   std::this_thread::yield();
 }
 
+bool Worker::HasLocalTask() {
+  if (pool_ != nullptr && pool_->work_stealing()) {
+    return has_assigned_.load(std::memory_order_acquire) || !local_task_deque_.Empty();
+  }
+  return !local_task_queue_->Empty();
+}
+
+bool Worker::NeedPark() const {
+  // keep the spin count mode if the worker is set to park at once
+  if (pool_ == nullptr || !pool_->work_stealing() || max_spin_count_ <= kMinSpinCount) {
+    return spin_count_ > max_spin_count_;
+  }
+  if (spin_count_ == 0) {
+    return false;
+  }
+  // the next task is likely to come soon if the tasks are short, so spin longer to avoid the cost of waking up
+  int64_t spin_time = average_task_ns_ * kSpinTaskDurationRatio;
+  spin_time = spin_time < kMinSpinTimeNs ? kMinSpinTimeNs : spin_time;
+  spin_time = spin_time > kMaxSpinTimeNs ? kMaxSpinTimeNs : spin_time;
+  auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - spin_start_);
+  return static_cast<int64_t>(duration.count()) > spin_time;
+}
+
 void Worker::WaitUntilActive() {
   std::unique_lock<std::mutex> _l(mutex_);
   cond_var_.wait(_l, [&] { return status_ == kThreadBusy || active_num_ > 0 || !alive_; });
@@ -189,16 +284,23 @@ void Worker::set_scale(float lhs_scale, float rhs_scale) {
 void Worker::Active(std::vector<TaskSplit> *task_list, int task_id_start, int task_id_end) {
   {
     std::lock_guard<std::mutex> _l(mutex_);
-    // add the first to task_, and others to queue.
-    status_ = kThreadBusy;
-    task_id_.store(task_id_start, std::memory_order_relaxed);
-    THREAD_TEST_TRUE(task_ == nullptr);
-    task_.store((*task_list)[0].task_, std::memory_order_release);
-    for (int i = task_id_start + 1; i < task_id_end; ++i) {
-      while (!local_task_queue_->Enqueue(&(*task_list)[i])) {
+    if (pool_ != nullptr && pool_->work_stealing()) {
+      // the worker pushes the splits to its own deque, since only the owner can push.
+      status_ = kThreadBusy;
+      (void)assigned_ranges_.emplace_back(TaskRange{task_list, task_id_start, task_id_end});
+      has_assigned_.store(true, std::memory_order_release);
+    } else {
+      // add the first to task_, and others to queue.
+      status_ = kThreadBusy;
+      task_id_.store(task_id_start, std::memory_order_relaxed);
+      THREAD_TEST_TRUE(task_ == nullptr);
+      task_.store((*task_list)[0].task_, std::memory_order_release);
+      for (int i = task_id_start + 1; i < task_id_end; ++i) {
+        while (!local_task_queue_->Enqueue(&(*task_list)[i])) {
+        }
       }
+      status_ = kThreadBusy;
     }
-    status_ = kThreadBusy;
   }
   cond_var_.notify_one();
 }
@@ -264,8 +366,18 @@ int ThreadPool::ParallelLaunch(const Func &func, Content content, int task_num)
   THREAD_DEBUG("launch: %d", task_num);
   Task task = {func, content};
   std::vector<TaskSplit> task_list;
-  for (int i = 0; i < task_num; ++i) {
-    (void)task_list.emplace_back(TaskSplit{&task, i});
+  bool work_stealing = this->work_stealing();
+  if (work_stealing) {
+    // the split may be stolen by any worker, so the scales are bound to the split rather than the worker
+    float per_scale = kMaxScale / task_num;
+    for (int i = 0; i < task_num; ++i) {
+      float rhs_scale = i == task_num - 1 ? kMaxScale : (i + 1) * per_scale;
+      (void)task_list.emplace_back(TaskSplit{&task, i, i * per_scale, rhs_scale});
+    }
+  } else {
+    for (int i = 0; i < task_num; ++i) {
+      (void)task_list.emplace_back(TaskSplit{&task, i});
+    }
   }
   Worker *curr = CurrentWorker();
   DistributeTask(&task_list, &task, task_num, curr);
@@ -275,7 +387,10 @@ int ThreadPool::ParallelLaunch(const Func &func, Content content, int task_num)
     if (curr != nullptr) {
       (void)curr->RunLocalKernelTask();
     }
-    std::this_thread::yield();
+    // help the straggler rather than waiting
+    if (!work_stealing || !RunStolenTask(0, curr)) {
+      std::this_thread::yield();
+    }
   }
   // check the return value of task
   if (task.status != THREAD_OK) {
@@ -284,6 +399,37 @@ int ThreadPool::ParallelLaunch(const Func &func, Content content, int task_num)
   return THREAD_OK;
 }
 
+int ThreadPool::EnableWorkStealing() {
+  std::lock_guard<std::mutex> _l(pool_mutex_);
+  for (auto worker : workers_) {
+    THREAD_ERROR_IF_NULL(worker);
+    if (worker->InitLocalTaskDeque() != THREAD_OK) {
+      return THREAD_ERROR;
+    }
+  }
+  work_stealing_ = true;
+  THREAD_INFO("enable work stealing, thread num: [%zu]", workers_.size());
+  return THREAD_OK;
+}
+
+bool ThreadPool::RunStolenTask(size_t start_index, Worker *curr) const {
+  size_t worker_num = workers_.size();
+  for (size_t i = 0; i < worker_num; ++i) {
+    auto task_split = workers_[(start_index + i) % worker_num]->local_task_deque()->Steal();
+    if (task_split == nullptr) {
+      continue;
+    }
+    if (curr != nullptr) {
+      return curr->RunTaskSplit(task_split);
+    }
+    auto task = task_split->task_;
+    task->status |= task->func(task->content, task_split->task_id_, task_split->lhs_scale_, task_split->rhs_scale_);
+    (void)++task->finished;
+    return true;
+  }
+  return false;
+}
+
 void ThreadPool::SyncRunTask(Task *task, int start_num, int task_num) const {
   // run task sequentially
   // if the current thread is not the actor thread
@@ -336,6 +482,11 @@ void ThreadPool::DistributeTask(std::vector<TaskSplit> *task_list, Task *task, i
     sum_frequency += curr->frequency();
   } else if (assigned.size() != static_cast<size_t>(task_num)) {
     CalculateScales(assigned, sum_frequency);
+    if (work_stealing() && !assigned.empty()) {
+      // distribute all splits to the assigned workers, and the current thread steals the splits while waiting
+      ActiveWorkers(assigned, task_list, task_num, curr);
+      return;
+    }
     ActiveWorkers(assigned, task_list, assigned.size(), curr);
     SyncRunTask(task, assigned.size(), task_num);
     return;
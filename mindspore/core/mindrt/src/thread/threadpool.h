@@ -27,6 +27,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <functional>
+#include <chrono>
 #include "thread/threadlog.h"
 #include "thread/core_affinity.h"
 #ifndef _WIN32
@@ -37,6 +38,7 @@
 #endif
 #include "utils/macros.h"
 #include "thread/hqueue.h"
+#include "thread/ws_deque.h"
 
 #define USE_HQUEUE
 namespace mindspore {
@@ -48,6 +50,13 @@ constexpr int kDefaultFrequency = 1;
 constexpr float kMaxScale = 1.;
 constexpr size_t kMaxHqueueSize = 8192;
 constexpr size_t kMinActorRunOther = 2;
+// in work stealing mode, the idle worker spins kSpinTaskDurationRatio times of the average task duration before
+// parking, and the spin time is limited in [kMinSpinTimeNs, kMaxSpinTimeNs]
+constexpr int64_t kSpinTaskDurationRatio = 2;
+constexpr int64_t kMinSpinTimeNs = 20000;
+constexpr int64_t kMaxSpinTimeNs = 1000000;
+// the weight of the latest task duration in the moving average is 1 / kTaskDurationAverageWeight
+constexpr int64_t kTaskDurationAverageWeight = 8;
 /* Thread status */
 constexpr int kThreadBusy = 0;  // busy, the thread is running task
 constexpr int kThreadHeld = 1;  // held, the thread has been marked as occupied
@@ -70,10 +79,22 @@ typedef struct Task {
 
 typedef struct TaskSplit {
   TaskSplit(Task *task, int task_id) : task_(task), task_id_(task_id) {}
+  TaskSplit(Task *task, int task_id, float lhs_scale, float rhs_scale)
+      : task_(task), task_id_(task_id), lhs_scale_(lhs_scale), rhs_scale_(rhs_scale) {}
   Task *task_;
   int task_id_;
+  // the scales of the split itself, used in work stealing mode since the split may be run by any worker
+  float lhs_scale_{0.};
+  float rhs_scale_{kMaxScale};
 } TaskSplit;
 
+// the continuous task splits assigned to a worker, [start, end) in task list
+typedef struct TaskRange {
+  std::vector<TaskSplit> *task_list_;
+  int start_;
+  int end_;
+} TaskRange;
+
 class ThreadPool;
 class Worker {
  public:
@@ -93,10 +114,16 @@ class Worker {
   virtual void RunOtherKernelTask();
   // try to run a single task
   bool TryRunTask(TaskSplit *task_split);
+  // steal a task from the other workers and run it, only used in work stealing mode
+  bool StealKernelTask();
+  // run the task split with its own scales and record the duration, only used in work stealing mode
+  bool RunTaskSplit(TaskSplit *task_split);
   // set max spin count before running
   void SetMaxSpinCount(int max_spin_count) { max_spin_count_ = max_spin_count; }
   void InitWorkerMask(const std::vector<int> &core_list, const size_t workers_size);
   void InitLocalTaskQueue(HQueue<TaskSplit> *task_queue) { local_task_queue_ = task_queue; }
+  int InitLocalTaskDeque();
+  WSDeque<TaskSplit> *local_task_deque() { return &local_task_deque_; }
 
   void set_frequency(int frequency) { frequency_ = frequency; }
   int frequency() const { return frequency_; }
@@ -121,6 +148,11 @@ class Worker {
   void SetAffinity();
   void YieldAndDeactive();
   virtual void WaitUntilActive();
+  // whether to park the worker after spinning
+  bool NeedPark() const;
+  bool HasLocalTask();
+  // push the assigned task splits to the local deque, and run the splits of the local deque
+  bool RunLocalDequeTask();
 
   bool alive_{true};
   std::thread thread_;
@@ -146,6 +178,14 @@ class Worker {
   HQueue<TaskSplit> *local_task_queue_;
   size_t worker_id_{0};
 
+  // the task splits assigned in work stealing mode, which are pushed to the local deque by the worker itself
+  std::vector<TaskRange> assigned_ranges_;
+  std::atomic_bool has_assigned_{false};
+  WSDeque<TaskSplit> local_task_deque_;
+  // the moving average of task duration and the start time of spinning, used to decide when to park
+  int64_t average_task_ns_{0};
+  std::chrono::steady_clock::time_point spin_start_;
+
  private:
   void Run();
 };
@@ -166,6 +206,14 @@ class MS_CORE_API ThreadPool {
 
   virtual int ParallelLaunch(const Func &func, Content content, int task_num);
 
+  // In work stealing mode, every worker owns a deque of task splits, the idle workers and the thread waiting for
+  // ParallelLaunch steal splits from the other workers, and the idle worker parks after spinning for a time adapted to
+  // the observed task duration. It should be enabled before any ParallelLaunch.
+  virtual int EnableWorkStealing();
+  bool work_stealing() const { return work_stealing_.load(std::memory_order_relaxed); }
+  // steal a task split from the deques of workers begin with the start index, and run it by the current worker
+  bool RunStolenTask(size_t start_index, Worker *curr) const;
+
   void DisableOccupiedActorThread() { occupied_actor_thread_ = false; }
   void SetActorThreadNum(size_t actor_thread_num) { actor_thread_num_ = actor_thread_num; }
   void SetKernelThreadNum(size_t kernel_thread_num) { kernel_thread_num_ = kernel_thread_num; }
@@ -204,6 +252,10 @@ class MS_CORE_API ThreadPool {
         return THREAD_ERROR;
       }
       worker->InitLocalTaskQueue(task_queues_[queues_idx].get());
+      if (work_stealing_ && worker->InitLocalTaskDeque() != THREAD_OK) {
+        delete worker;
+        return THREAD_ERROR;
+      }
       workers_.push_back(worker);
     }
     for (size_t i = 0; i < thread_num; ++i) {
@@ -234,6 +286,7 @@ class MS_CORE_API ThreadPool {
   size_t actor_thread_num_{0};
   size_t kernel_thread_num_{0};
   bool occupied_actor_thread_{true};
+  std::atomic_bool work_stealing_{false};
   int max_spin_count_{kDefaultSpinCount};
   int min_spin_count_{kMinSpinCount};
   float server_cpu_frequence = -1.0f;  // Unit : GHz
@@ -914,7 +914,9 @@ def set_context(**kwargs):
             After enable_compile_cache is set to True, during the first execution, a hardware-independent
             compilation cache is generated and exported to a MINDIR file. When the network is executed again,
             if enable_compile_cache is still set to True and the network scripts are not changed,
-            the compile cache is loaded. Note that only limited automatic detection for the changes of
+            the compile cache is loaded. The kernels selected by back-end are cached as well and reused by the
+            graphs with the same operators, shapes and types, even if the network scripts are changed.
+            Note that only limited automatic detection for the changes of
             python scripts is supported by now, which means that there is a correctness risk. Default: False.
             This is an experimental prototype that is subject to change and/or deletion.
         compile_cache_path (str): Path to save the cache of the graph compiled by front-end. Default: ".".
@@ -43,9 +43,14 @@ __all__ = ['set_sending_batches', 'load', '_init_device_info',
            'set_enable_shared_mem', 'get_enable_shared_mem',
            'set_enable_autotune', 'get_enable_autotune',
            'set_autotune_interval', 'get_autotune_interval',
+           'set_autotune_cpu_budget', 'get_autotune_cpu_budget',
+           'set_autotune_memory_budget', 'get_autotune_memory_budget',
            'set_auto_offload', 'get_auto_offload',
            'set_enable_watchdog', 'get_enable_watchdog',
            'set_fast_recovery', 'get_fast_recovery',
+           'set_shuffle_max_rows_in_memory', 'get_shuffle_max_rows_in_memory',
+           'set_shuffle_spill_dir', 'get_shuffle_spill_dir',
+           'set_batch_recycle_memory', 'get_batch_recycle_memory',
            'set_multiprocessing_timeout_interval', 'get_multiprocessing_timeout_interval']
 
 INT32_MAX = 2147483647
@@ -586,6 +591,88 @@ def get_autotune_interval():
     return _config.get_autotune_interval()
 
 
+def set_autotune_cpu_budget(num_cores):
+    """
+    Set the number of CPU cores AutoTune may give to the workers of the data pipeline.
+
+    The default setting is 0, which does not limit the cores. Otherwise, AutoTune models the cores each
+    operation needs from its CPU utilization and shares the budget among the operations, so that the data
+    pipeline does not take the cores of the training process on a shared host.
+
+    Args:
+        num_cores (int): Number of CPU cores for the workers of the data pipeline.
+
+    Raises:
+        TypeError: If `num_cores` is not of type int.
+        ValueError: If `num_cores` is not non-negative.
+
+    Examples:
+        >>> # let AutoTune use at most 8 cores for the data pipeline
+        >>> ds.config.set_autotune_cpu_budget(8)
+    """
+    if not isinstance(num_cores, int) or isinstance(num_cores, bool):
+        raise TypeError("num_cores must be of type int.")
+    if num_cores < 0 or num_cores > INT32_MAX:
+        raise ValueError(
+            "num_cores given is not within the required range [0, INT32_MAX(2147483647)].")
+    _config.set_autotune_cpu_budget(num_cores)
+
+
+def get_autotune_cpu_budget():
+    """
+    Get the number of CPU cores AutoTune may give to the workers of the data pipeline.
+
+    Returns:
+        int, the number of CPU cores for the data pipeline, 0 if not limited.
+
+    Examples:
+        >>> # get the global configuration of the CPU budget of AutoTune
+        >>> autotune_cpu_budget = ds.config.get_autotune_cpu_budget()
+    """
+    return _config.get_autotune_cpu_budget()
+
+
+def set_autotune_memory_budget(size):
+    """
+    Set the memory (in MB) AutoTune may give to the data pipeline.
+
+    The default setting is 0, which does not limit the memory. Otherwise, AutoTune models the memory of
+    the process against the rows queued in the connectors and sets the prefetch sizes of the operations
+    within the budget.
+
+    Args:
+        size (int): Memory in MB for the main process of the data pipeline.
+
+    Raises:
+        TypeError: If `size` is not of type int.
+        ValueError: If `size` is not non-negative.
+
+    Examples:
+        >>> # let AutoTune use at most 4096 MB for the data pipeline
+        >>> ds.config.set_autotune_memory_budget(4096)
+    """
+    if not isinstance(size, int) or isinstance(size, bool):
+        raise TypeError("size must be of type int.")
+    if size < 0 or size > INT32_MAX:
+        raise ValueError(
+            "size given is not within the required range [0, INT32_MAX(2147483647)].")
+    _config.set_autotune_memory_budget(size)
+
+
+def get_autotune_memory_budget():
+    """
+    Get the memory (in MB) AutoTune may give to the data pipeline.
+
+    Returns:
+        int, the memory in MB for the data pipeline, 0 if not limited.
+
+    Examples:
+        >>> # get the global configuration of the memory budget of AutoTune
+        >>> autotune_memory_budget = ds.config.get_autotune_memory_budget()
+    """
+    return _config.get_autotune_memory_budget()
+
+
 def get_enable_shared_mem():
     """
     Get the default state of shared mem enabled variable.
@@ -832,3 +919,117 @@ def get_fast_recovery():
         >>> is_fast_recovery = ds.config.get_fast_recovery()
     """
     return _config.get_fast_recovery()
+
+
+def set_shuffle_max_rows_in_memory(rows):
+    """
+    Set the maximum number of rows of a shuffle buffer kept in memory.
+
+    The other rows of the shuffle buffer are spilled to a scratch file in the directory set by
+    :func:`mindspore.dataset.config.set_shuffle_spill_dir` and read back when they are sent out, so a
+    large `buffer_size` of :func:`mindspore.dataset.Dataset.shuffle` does not need a large memory.
+    The default setting is 0, which keeps all the rows of the shuffle buffer in memory.
+
+    Args:
+        rows (int): The maximum number of rows of a shuffle buffer kept in memory, 0 means no limit.
+
+    Raises:
+        TypeError: If `rows` is not of type int.
+        ValueError: If `rows` is not within the range of [0, INT32_MAX].
+
+    Examples:
+        >>> # keep at most 1000 rows of each shuffle buffer in memory
+        >>> ds.config.set_shuffle_max_rows_in_memory(1000)
+    """
+    if not isinstance(rows, int) or isinstance(rows, bool):
+        raise TypeError("rows must be of type int.")
+    if rows < 0 or rows > INT32_MAX:
+        raise ValueError("rows given is not within the required range [0, INT32_MAX(2147483647)].")
+    _config.set_shuffle_max_rows_in_memory(rows)
+
+
+def get_shuffle_max_rows_in_memory():
+    """
+    Get the maximum number of rows of a shuffle buffer kept in memory.
+
+    Returns:
+        int, the maximum number of rows of a shuffle buffer kept in memory, 0 means no limit.
+
+    Examples:
+        >>> rows = ds.config.get_shuffle_max_rows_in_memory()
+    """
+    return _config.get_shuffle_max_rows_in_memory()
+
+
+def set_shuffle_spill_dir(spill_dir):
+    """
+    Set the directory of the scratch files of the spilled shuffle buffer rows. Default: "/tmp".
+
+    Args:
+        spill_dir (str): The directory of the scratch files, which must exist and be writable.
+
+    Raises:
+        TypeError: If `spill_dir` is not of type str.
+        ValueError: If `spill_dir` is not an existing directory.
+
+    Examples:
+        >>> ds.config.set_shuffle_spill_dir("/tmp")
+    """
+    if not isinstance(spill_dir, str):
+        raise TypeError("spill_dir must be of type str.")
+    if not os.path.isdir(spill_dir):
+        raise ValueError("spill_dir is not a directory or does not exist: {}.".format(spill_dir))
+    _config.set_shuffle_spill_dir(os.path.realpath(spill_dir))
+
+
+def get_shuffle_spill_dir():
+    """
+    Get the directory of the scratch files of the spilled shuffle buffer rows.
+
+    Returns:
+        str, the directory of the scratch files.
+
+    Examples:
+        >>> spill_dir = ds.config.get_shuffle_spill_dir()
+    """
+    return _config.get_shuffle_spill_dir()
+
+
+def set_batch_recycle_memory(size):
+    """
+    Set the memory in MB of the released batch buffers kept by each batch operation.
+
+    The buffers of the released batches are kept and handed out again to the next batches of the same size,
+    so that large batch buffers are not returned to the system and allocated again every step. When the
+    kept buffers exceed the memory, the least recently released ones are freed first.
+    The default setting is 0, which disables the recycling.
+
+    Args:
+        size (int): The memory in MB of the released batch buffers kept by each batch operation, 0 means disabled.
+
+    Raises:
+        TypeError: If `size` is not of type int.
+        ValueError: If `size` is not within the range of [0, INT32_MAX].
+
+    Examples:
+        >>> # keep at most 512MB of the released batch buffers
+        >>> ds.config.set_batch_recycle_memory(512)
+    """
+    if not isinstance(size, int) or isinstance(size, bool):
+        raise TypeError("size must be of type int.")
+    if size < 0 or size > INT32_MAX:
+        raise ValueError("size given is not within the required range [0, INT32_MAX(2147483647)].")
+    _config.set_batch_recycle_memory(size)
+
+
+def get_batch_recycle_memory():
+    """
+    Get the memory in MB of the released batch buffers kept by each batch operation.
+
+    Returns:
+        int, the memory in MB of the released batch buffers kept by each batch operation, 0 means disabled.
+
+    Examples:
+        >>> size = ds.config.get_batch_recycle_memory()
+    """
+    return _config.get_batch_recycle_memory()
@@ -29,6 +29,7 @@ import atexit
 import glob
 import json
 import os
+import pickle
 import signal
 import stat
 
@@ -115,16 +116,34 @@ def _get_training_dataset():
     return _train_dataset
 
 
-def _reset_training_dataset(step):
+def _reset_training_dataset(step, checkpoint=None):
     """
     Reset the training dataset to the given step number.
 
     Args:
         step (int): Global step number.
+        checkpoint (str, optional): Path of the checkpoint file saved by `_save_training_dataset_checkpoint` in the
+            epoch of the step. The state of the pipeline is restored from it instead of being replayed from the first
+            epoch. Only supported when fast recovery is enabled (default=None, no checkpoint).
     """
     dataset = _get_training_dataset()
     if dataset is not None:
-        dataset._reset(step)  # pylint: disable=W0212
+        dataset._reset(step, checkpoint)  # pylint: disable=W0212
+    else:
+        raise RuntimeError("Training dataset is not set.")
+
+
+def _save_training_dataset_checkpoint(step, file_name):
+    """
+    Save the state the training dataset starts the epoch of the given step with into a checkpoint file.
+
+    Args:
+        step (int): Global step number.
+        file_name (str): Path of the checkpoint file.
+    """
+    dataset = _get_training_dataset()
+    if dataset is not None:
+        dataset._save_checkpoint(step, file_name)  # pylint: disable=W0212
     else:
         raise RuntimeError("Training dataset is not set.")
 
@@ -857,6 +876,10 @@ class Dataset:
 
                 - offload (bool, optional): Flag to indicate whether offload is used (Default=None).
 
+                - batched (bool, optional): Whether the rows are batches output by `batch`, whose columns are the
+                  samples stacked along the first dimension. The operations are applied to each sample, while
+                  Rescale, Normalize, TypeCast and HWC2CHW process the whole batch in one call (Default=False).
+
         Note:
             - Input `operations` accepts TensorOperations defined in mindspore.dataset part, plus user-defined
               Python functions (PyFuncs).
@@ -2806,6 +2829,15 @@ class _PythonCallable:
     def to_json(self):
         return self.py_callable.to_json()
 
+    def native_pipe(self):
+        """
+        Get the pipe to the worker process of the current thread if its rows are shipped through a shared row channel,
+        so that the C++ op can ship the numeric rows by itself. Otherwise, return None.
+        """
+        if self.pool.is_running() and check_iterator_cleanup() is False:
+            return self.pool.get_native_pipe()
+        return None
+
 
 class Pipe:
     """
@@ -2815,7 +2847,14 @@ class Pipe:
     def __init__(self, warning_ctl, shared_memory=False, max_rowsize=16):
         self.shared_memory = shared_memory
         self.eof = multiprocessing.Event()
-        if self.shared_memory:
+        self.channel = None
+        if self.shared_memory and cde.SharedRowChannel.is_supported() and multiprocessing.get_start_method() == "fork":
+            # The rows are shipped through a channel in shared memory which the forked worker inherits, the queues
+            # only carry the rows which are larger than max_rowsize.
+            self.channel = cde.SharedRowChannel(max_rowsize * 1024 * 1024)
+            self.in_queue = _Queue(1)
+            self.res_queue = _Queue(1)
+        elif self.shared_memory:
             self.in_queue = _SharedQueue(1, warning_ctl, max_rowsize=max_rowsize)
             self.res_queue = _SharedQueue(1, warning_ctl, max_rowsize=max_rowsize)
         else:
@@ -2825,14 +2864,30 @@ class Pipe:
         self.res_queue._joincancelled = True  # pylint: disable=W0212
 
     def master_send(self, func_index, data):
+        if self.channel is not None:
+            self._channel_put(cde.SharedRowChannel.REQUEST, func_index, data, self.in_queue)
+            return
         self.in_queue.put_nowait((func_index, *data))
 
     def master_receive(self):
+        if self.channel is not None:
+            result = self._channel_get(cde.SharedRowChannel.RESPONSE, self.res_queue)
+            return None if result is None else result[1]
         return self.res_queue.get_until(timeout=1, exit_signal=self.eof)
 
+    def take_response(self):
+        """Take the response which the C++ op has waited for from the channel, and raise the error of the worker."""
+        _, result = self._channel_read(cde.SharedRowChannel.RESPONSE, self.res_queue)
+        if isinstance(result, ExceptionHandler):
+            result.reraise()
+        return result
+
     def master_close(self):
         self.eof.set()
-        self.send_finish_signal()
+        if self.channel is not None:
+            self.channel.close()
+        else:
+            self.send_finish_signal()
         self.res_queue.cancel_join_thread()
         self.in_queue.cancel_join_thread()
 
@@ -2840,9 +2895,14 @@ class Pipe:
         self.worker_send(None)
 
     def worker_send(self, data):
+        if self.channel is not None:
+            self._channel_put(cde.SharedRowChannel.RESPONSE, 0, data, self.res_queue)
+            return
         self.res_queue.put_until(data, timeout=1, exit_signal=self.eof)
 
     def worker_receive(self):
+        if self.channel is not None:
+            return self._channel_get(cde.SharedRowChannel.REQUEST, self.in_queue)
         result = self.in_queue.get_until(timeout=1, exit_signal=self.eof)
         if result is None:
             return result
@@ -2855,6 +2915,36 @@ class Pipe:
         self.res_queue.cancel_join_thread()
         self.in_queue.cancel_join_thread()
 
+    def _channel_put(self, slot, func_index, data, overflow_queue):
+        """Put the numeric arrays into the channel, otherwise pickle the data, or send it by the queue if too large."""
+        if self.channel.put_arrays(slot, func_index, data):
+            return
+        payload = pickle.dumps(data, protocol=pickle.HIGHEST_PROTOCOL)
+        if self.channel.put_bytes(slot, func_index, payload):
+            return
+        overflow_queue.put(data)
+        self.channel.put_overflow(slot, func_index)
+
+    def _channel_get(self, slot, overflow_queue):
+        """Wait for the slot of the channel and read it. Return None if the pipe is closed."""
+        while not self.eof.is_set():
+            if self.channel.wait(slot, 1000):
+                return self._channel_read(slot, overflow_queue)
+            if self.channel.is_closed():
+                break
+        return None
+
+    def _channel_read(self, slot, overflow_queue):
+        """Read the slot of the channel which is ready. The arrays sent to the master are copied out of the slot."""
+        kind = self.channel.kind(slot)
+        if kind == cde.SharedRowChannel.ARRAYS:
+            data = self.channel.get_arrays(slot, slot == cde.SharedRowChannel.RESPONSE)
+        elif kind == cde.SharedRowChannel.BYTES:
+            data = pickle.loads(self.channel.get_bytes(slot))
+        else:
+            data = overflow_queue.get()
+        return self.channel.func_idx(slot), data
+
 
 def _main_process_already_exit():
     """
@@ -3224,11 +3314,7 @@ class _PythonMultiprocessing(cde.PythonMultiprocessingRuntime):
         """
         Execute
         """
-        t_id = threading.get_ident()
-        # get the worker_id from Python layer cache first, get from Cpp layer if not found.
-        worker_id = self.python_threads_to_workers.setdefault(t_id, self.get_thread_to_worker())
-        if worker_id >= len(self.workers):
-            raise RuntimeError("[Internal] worker_id value is greater than number of available workers!")
+        worker_id = self._get_worker_id()
 
         # todo check_iterator_cleanup
         if self.is_running() and check_iterator_cleanup() is False:
@@ -3236,6 +3322,21 @@ class _PythonMultiprocessing(cde.PythonMultiprocessingRuntime):
 
         return None
 
+    def get_native_pipe(self):
+        """
+        Get the pipe to the worker of the current thread if it has a shared row channel, otherwise return None.
+        """
+        pipe = self.workers[self._get_worker_id()].pipe
+        return pipe if pipe.channel is not None else None
+
+    def _get_worker_id(self):
+        t_id = threading.get_ident()
+        # get the worker_id from Python layer cache first, get from Cpp layer if not found.
+        worker_id = self.python_threads_to_workers.setdefault(t_id, self.get_thread_to_worker())
+        if worker_id >= len(self.workers):
+            raise RuntimeError("[Internal] worker_id value is greater than number of available workers!")
+        return worker_id
+
     def _launch_watch_dog(self):
         """
         We will launch a watchdog thread and a clean process to cleaning subprocess when there is process was killed.
@@ -3303,11 +3404,13 @@ class MapDataset(UnionBaseDataset):
         max_rowsize(int, optional): Maximum size of row in MB that is used for shared memory allocation to copy
             data between processes.  This is only used if python_multiprocessing is set to True (default=16).
         offload (bool, optional): Flag to indicate whether offload is used (Default=None).
+        batched (bool, optional): Whether the rows are batches, whose columns are the samples stacked along the first
+            dimension (Default=False).
     """
 
     def __init__(self, input_dataset, operations=None, input_columns=None, output_columns=None,
                  num_parallel_workers=None, python_multiprocessing=False, cache=None, callbacks=None, max_rowsize=16,
-                 offload=None):
+                 offload=None, batched=False):
         super().__init__(children=input_dataset, num_parallel_workers=num_parallel_workers, cache=cache)
         self.operations = to_list(operations)
         for op in self.operations:
@@ -3334,6 +3437,7 @@ class MapDataset(UnionBaseDataset):
         self.callbacks = to_list(callbacks)
         self.max_rowsize = max_rowsize
         self.offload = offload
+        self.batched = batched
 
     def parse(self, children=None):
         operations = self.__decompose_callable_operations()
@@ -3361,7 +3465,8 @@ class MapDataset(UnionBaseDataset):
 
         callbacks = [cb.create_runtime_obj() for cb in self.callbacks]
         return cde.MapNode(children[0], self.operations, self.input_columns, self.output_columns,
-                           callbacks, self.max_rowsize, OffloadToManualOffloadMode.get(self.offload), self.process_pool)
+                           callbacks, self.max_rowsize, OffloadToManualOffloadMode.get(self.offload), self.process_pool,
+                           self.batched)
 
     def __deepcopy__(self, memodict):
         return self.__safe_deepcopy__(memodict, exclude=("operations", "callbacks", "__transfer_dataset__"))
@@ -3752,8 +3857,11 @@ class _ToDevice:
     def send(self):
         self._to_device.Send()
 
-    def _reset(self, step):
-        self._to_device.Reset(step)
+    def _reset(self, step, checkpoint=None):
+        self._to_device.Reset(step, checkpoint if checkpoint else "")
+
+    def _save_checkpoint(self, step, file_name):
+        self._to_device.SaveCheckpoint(step, file_name)
 
     def stop_send(self):
         """
@@ -3863,10 +3971,15 @@ class TransferDataset(Dataset):
         if self._to_device is not None:
             self._to_device.continue_send()
 
-    def _reset(self, step):
+    def _reset(self, step, checkpoint=None):
         if self._to_device is not None:
             logger.info("Reset the dataset pipeline to step " + str(step))
-            self._to_device._reset(step)  # pylint: disable=W0212
+            self._to_device._reset(step, checkpoint)  # pylint: disable=W0212
+
+    def _save_checkpoint(self, step, file_name):
+        if self._to_device is not None:
+            logger.info("Save the checkpoint of the dataset pipeline at step " + str(step) + " to " + file_name)
+            self._to_device._save_checkpoint(step, file_name)  # pylint: disable=W0212
 
     def get_data_info(self):
         """
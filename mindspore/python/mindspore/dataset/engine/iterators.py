@@ -169,14 +169,26 @@ class Iterator:
             self._col_names = self.__ori_dataset.get_col_names()
         return self._col_names
 
-    def _reset(self, step):
+    def _reset(self, step, checkpoint=None):
         """
         Reset the iterator to the given step number.
 
         Args:
             step (int): Global step number.
+            checkpoint (str, optional): Path of the checkpoint file saved by `_save_checkpoint` in the epoch of the
+                step, whose state is restored instead of replaying the epochs before (default=None).
         """
-        self._iterator.Reset(step)
+        self._iterator.Reset(step, checkpoint if checkpoint else "")
+
+    def _save_checkpoint(self, step, file_name):
+        """
+        Save the state the iterator starts the epoch of the given step with into a checkpoint file.
+
+        Args:
+            step (int): Global step number.
+            file_name (str): Path of the checkpoint file.
+        """
+        self._iterator.SaveCheckpoint(step, file_name)
 
     def _transform_md_to_output(self, t):
         if self._output_numpy:
@@ -1356,7 +1356,8 @@ def get_map_kwargs_from_dict(param_dict):
         cache = param_dict.get("cache", None)
         callbacks = param_dict.get("callbacks", None)
         offload = param_dict.get("offload", None)
-    return python_multiprocessing, max_rowsize, cache, callbacks, offload
+        batched = param_dict.get("batched", False)
+    return python_multiprocessing, max_rowsize, cache, callbacks, offload, batched
 
 
 def check_map(method):
@@ -1382,7 +1383,8 @@ def check_map(method):
                              ">>                       output_columns=[\"column_b\", \"column_c\"])\n"
                              ">> dataset = dataset.project([\"column_b\", \"column_c\"])")
 
-        (python_multiprocessing, max_rowsize, cache, callbacks, offload) = get_map_kwargs_from_dict(param_dict)
+        (python_multiprocessing, max_rowsize, cache, callbacks, offload, batched) = \
+            get_map_kwargs_from_dict(param_dict)
 
         # check whether network computing operator exist in input operations(python function)
         # check used variable and function document whether contain computing operator
@@ -1418,6 +1420,7 @@ def check_map(method):
         check_pos_int32(max_rowsize, "max_rowsize")
         if offload is not None:
             type_check(offload, (bool,), "offload")
+        type_check(batched, (bool,), "batched")
 
         if callbacks is not None:
             if isinstance(callbacks, (list, tuple)):
@@ -24,7 +24,7 @@ import numpy as np
 import mindspore._c_dataengine as cde
 from .validators import check_vocab, check_from_file, check_from_list, check_from_dict, check_from_dataset, \
     check_from_dataset_sentencepiece, check_from_file_sentencepiece, check_save_model, \
-    check_from_file_vectors, check_tokens_to_ids, check_ids_to_tokens
+    check_from_file_vectors, check_convert_to_binary_vectors, check_tokens_to_ids, check_ids_to_tokens
 
 
 class CharNGram(cde.CharNGram):
@@ -333,7 +333,8 @@ class Vectors(cde.Vectors):
         Build a vector from a file.
 
         Args:
-            file_path (str): Path of the file that contains the vectors.
+            file_path (str): Path of the file that contains the vectors. The binary file generated by
+                `convert_to_binary` is mapped instead of parsed, in which case `max_vectors` is ignored.
             max_vectors (int, optional): This can be used to limit the number of pre-trained vectors loaded.
                 Most pre-trained vector sets are sorted in the descending order of word frequency. Thus, in
                 situations where the entire set doesn't fit in memory, or is not needed for another reason,
@@ -349,6 +350,28 @@ class Vectors(cde.Vectors):
         max_vectors = max_vectors if max_vectors is not None else 0
         return super().from_file(file_path, max_vectors)
 
+    @classmethod
+    @check_convert_to_binary_vectors
+    def convert_to_binary(cls, file_path, binary_path, max_vectors=None):
+        """
+        Convert a pre-trained vector file to the binary format. The binary file can be passed to `from_file` of
+        Vectors, GloVe and FastText, and it is mapped into memory instead of parsed, so the processes which load
+        the same file share the memory of the vectors.
+
+        Args:
+            file_path (str): Path of the file that contains the vectors.
+            binary_path (str): Path of the binary file to write.
+            max_vectors (int, optional): This can be used to limit the number of pre-trained vectors converted
+                (default=None, no limit).
+
+        Examples:
+            >>> text.Vectors.convert_to_binary("/path/to/vectors/file", "/path/to/vectors/binary/file")
+            >>> vector = text.Vectors.from_file("/path/to/vectors/binary/file")
+        """
+
+        max_vectors = max_vectors if max_vectors is not None else 0
+        super().convert_to_binary(file_path, binary_path, max_vectors)
+
 
 class Vocab:
     """
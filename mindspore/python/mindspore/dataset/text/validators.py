@@ -599,6 +599,26 @@ def check_from_file_vectors(method):
     return new_method
 
 
+def check_convert_to_binary_vectors(method):
+    """A wrapper that wraps a parameter checker to convert_to_binary of class Vectors."""
+
+    @wraps(method)
+    def new_method(self, *args, **kwargs):
+        [file_path, binary_path, max_vectors], _ = parse_user_args(method, *args, **kwargs)
+
+        type_check(file_path, (str,), "file_path")
+        check_filename(file_path)
+        type_check(binary_path, (str,), "binary_path")
+        check_filename(binary_path)
+        if max_vectors is not None:
+            type_check(max_vectors, (int,), "max_vectors")
+            check_non_negative_int32(max_vectors, "max_vectors")
+
+        return method(self, *args, **kwargs)
+
+    return new_method
+
+
 def check_to_vectors(method):
     """A wrapper that wraps a parameter checker to ToVectors."""
 
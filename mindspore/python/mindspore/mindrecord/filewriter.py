@@ -326,6 +326,27 @@ class FileWriter:
         """
         return self._writer.set_page_size(page_size)
 
+    def set_raw_page_format(self, raw_page_format):
+        """
+        Set the layout of raw page which stores the fields not in blob. The 'row' layout stores \
+        the samples one after another. The 'columnar' layout stores the samples of a row group \
+        column by column, and the repeated scalar values are encoded by run length or dictionary, \
+        so that reading a subset of columns only reads and decodes these columns. It should be \
+        called before writing data.
+
+        Args:
+            raw_page_format (str): Layout of raw page, 'row' or 'columnar'.
+
+        Returns:
+            MSRStatus, SUCCESS or FAILED.
+
+        Examples:
+            >>> from mindspore.mindrecord import FileWriter
+            >>> writer = FileWriter(file_name="test.mindrecord", shard_num=1)
+            >>> status = writer.set_raw_page_format("columnar")
+        """
+        return self._writer.set_raw_page_format(raw_page_format)
+
     def commit(self):
         """
         Flush data in memory to disk and generate the corresponding database files.
@@ -365,10 +386,10 @@ class FileWriter:
             if os.path.exists(item):
                 os.chmod(item, stat.S_IRUSR | stat.S_IWUSR)
                 mindrecord_files.append(item)
-            index_file = item + ".db"
-            if os.path.exists(index_file):
-                os.chmod(index_file, stat.S_IRUSR | stat.S_IWUSR)
-                index_files.append(index_file)
+            for index_file in (item + ".db", item + ".idx"):
+                if os.path.exists(index_file):
+                    os.chmod(index_file, stat.S_IRUSR | stat.S_IWUSR)
+                    index_files.append(index_file)
 
         logger.info("The list of mindrecord files created are: {}, and the list of index files are: {}".format(
             mindrecord_files, index_files))
@@ -126,6 +126,18 @@ class ShardWriter:
             raise MRMInvalidPageSizeError
         return ret
 
+    def set_raw_page_format(self, raw_page_format):
+        """
+        Set the layout of raw page.
+
+        Args:
+           raw_page_format (str): Layout of raw page, 'row' or 'columnar'.
+
+        Returns:
+            MSRStatus, SUCCESS or FAILED.
+        """
+        return self._writer.set_raw_page_format(raw_page_format)
+
     def set_shard_header(self, shard_header):
         """
         Set header which contains schema and index before write raw data.
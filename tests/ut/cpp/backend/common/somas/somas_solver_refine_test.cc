@@ -0,0 +1,213 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+#include "common/common_test.h"
+#include "backend/common/somas/somas_solver_refine.h"
+
+namespace mindspore {
+namespace somas {
+class SomasSolverRefinerTest : public UT::Common {
+ public:
+  SomasSolverRefinerTest() {}
+  void TearDown() override { ClearTensors(); }
+
+ protected:
+  // The contiguous tensors hold each other, so unlink them before they are released.
+  void ClearTensors() {
+    for (auto &tensor : tensors_) {
+      tensor.second->left_ = nullptr;
+      tensor.second->right_ = nullptr;
+    }
+    tensors_.clear();
+  }
+
+  // Create the tensors living in the given [begin, end) steps, two tensors conflict if their lifetimes overlap.
+  void CreateTensors(const std::vector<std::pair<size_t, size_t>> &lifetimes, const std::vector<size_t> &sizes,
+                     const std::vector<bool> &lifelong) {
+    auto num = lifetimes.size();
+    ClearTensors();
+    constraints_ = std::vector<DynamicBitSet>(num, DynamicBitSet(num));
+    for (size_t i = 0; i < num; ++i) {
+      tensors_[i] = std::make_shared<SomasSolverTensorDesc>(i, sizes[i], 0, lifelong[i]);
+      for (size_t j = 0; j < num; ++j) {
+        if (lifetimes[i].first >= lifetimes[j].second || lifetimes[j].first >= lifetimes[i].second) {
+          constraints_[i].SetBitTrue(j);
+        }
+      }
+    }
+  }
+
+  // Make the tensors [first, last] contiguous.
+  void LinkTensors(size_t first, size_t last) {
+    for (size_t i = first; i < last; ++i) {
+      tensors_[i]->right_ = tensors_[i + 1];
+      tensors_[i + 1]->left_ = tensors_[i];
+    }
+  }
+
+  // Stack all the tensors one over another, the lifelong ones at the top, and return the peak.
+  size_t StackTensors() {
+    size_t offset = 0;
+    for (bool lifelong : {false, true}) {
+      for (size_t i = 0; i < tensors_.size(); ++i) {
+        if (tensors_[i]->lifelong_ == lifelong) {
+          tensors_[i]->offset_ = offset;
+          offset += tensors_[i]->size_;
+        }
+      }
+    }
+    return offset;
+  }
+
+  // Check that the conflicting tensors do not overlap and the contiguous tensors stay contiguous, return the peak.
+  size_t CheckSolution() {
+    size_t peak = 0;
+    for (const auto &[index, tensor] : tensors_) {
+      peak = std::max(peak, tensor->offset_ + tensor->size_);
+      if (tensor->right_ != nullptr) {
+        EXPECT_EQ(tensor->right_->offset_, tensor->offset_ + tensor->size_) << "tensor " << index;
+      }
+      for (const auto &[other_index, other] : tensors_) {
+        if (index == other_index || tensor->size_ == 0 || other->size_ == 0) {
+          continue;
+        }
+        if (!tensor->lifelong_ && !other->lifelong_ && constraints_[index].IsBitTrue(other_index)) {
+          continue;
+        }
+        bool overlap =
+          tensor->offset_ < other->offset_ + other->size_ && other->offset_ < tensor->offset_ + tensor->size_;
+        EXPECT_FALSE(overlap) << "tensor " << index << " and " << other_index;
+      }
+    }
+    return peak;
+  }
+
+  TensorsDescMap tensors_;
+  std::vector<DynamicBitSet> constraints_;
+};
+
+/// Feature: SOMAS solver refinement.
+/// Description: Compute the lower bound of the tensors pairwise conflicting and a tensor free of them.
+/// Expectation: The lower bound is the size of the largest clique plus the lifelong memory.
+TEST_F(SomasSolverRefinerTest, TestLowerBound) {
+  CreateTensors({{0, 3}, {1, 4}, {2, 5}, {5, 6}, {0, 6}}, {100, 200, 300, 700, 50}, {false, false, false, false, true});
+  SomasSolverRefiner refiner(tensors_, &constraints_);
+  EXPECT_EQ(refiner.LowerBound(), 700 + 50);
+
+  CreateTensors({{0, 3}, {1, 4}, {2, 5}, {5, 6}, {0, 6}}, {100, 200, 300, 500, 50}, {false, false, false, false, true});
+  SomasSolverRefiner clique_refiner(tensors_, &constraints_);
+  EXPECT_EQ(clique_refiner.LowerBound(), 100 + 200 + 300 + 50);
+}
+
+/// Feature: SOMAS solver refinement.
+/// Description: Refine the stacked tensors of the random graphs, with lifelong and contiguous tensors.
+/// Expectation: The refined peak is not higher than the initial one nor lower than the lower bound, the conflicting
+///     tensors do not overlap and the contiguous tensors stay contiguous.
+TEST_F(SomasSolverRefinerTest, TestRefineRandomGraphs) {
+  std::mt19937 rng(1);
+  const size_t kTrialNum = 50;
+  size_t improved_num = 0;
+  for (size_t trial = 0; trial < kTrialNum; ++trial) {
+    size_t num = 10 + rng() % 60;
+    std::vector<std::pair<size_t, size_t>> lifetimes(num);
+    std::vector<size_t> sizes(num);
+    std::vector<bool> lifelong(num);
+    for (size_t i = 0; i < num; ++i) {
+      size_t begin = rng() % 50;
+      lifetimes[i] = {begin, begin + 1 + rng() % 15};
+      sizes[i] = 512 * (1 + rng() % 16);
+      lifelong[i] = i > 2 && rng() % 20 == 0;
+    }
+    CreateTensors(lifetimes, sizes, lifelong);
+    if (trial % 3 == 0) {
+      LinkTensors(0, 2);
+    }
+    auto initial_peak = StackTensors();
+    ASSERT_EQ(CheckSolution(), initial_peak);
+
+    SomasSolverRefiner refiner(tensors_, &constraints_);
+    auto lower_bound = refiner.LowerBound();
+    auto peak = refiner.Refine(50);
+    EXPECT_EQ(CheckSolution(), peak);
+    EXPECT_LE(peak, initial_peak);
+    EXPECT_LE(lower_bound, peak);
+    if (peak < initial_peak) {
+      ++improved_num;
+    }
+  }
+  EXPECT_GT(improved_num, 0);
+}
+
+/// Feature: SOMAS solver refinement.
+/// Description: Refine a solution whose peak reaches the lower bound.
+/// Expectation: The offsets are kept.
+TEST_F(SomasSolverRefinerTest, TestRefineOptimalSolution) {
+  CreateTensors({{0, 2}, {1, 3}, {2, 4}, {0, 4}}, {300, 200, 100, 64}, {false, false, false, true});
+  tensors_[0]->offset_ = 0;
+  tensors_[1]->offset_ = 300;
+  tensors_[2]->offset_ = 0;
+  tensors_[3]->offset_ = 500;
+
+  SomasSolverRefiner refiner(tensors_, &constraints_);
+  EXPECT_EQ(refiner.LowerBound(), 564);
+  EXPECT_EQ(refiner.Refine(50), 564);
+  std::vector<size_t> offsets = {0, 300, 0, 500};
+  for (size_t i = 0; i < offsets.size(); ++i) {
+    EXPECT_EQ(tensors_[i]->offset_, offsets[i]);
+  }
+}
+
+/// Feature: SOMAS solver refinement.
+/// Description: Refine a large graph within a short time limit, and with the refinement disabled.
+/// Expectation: The refinement stops near the time limit with a valid solution, and does nothing when disabled.
+TEST_F(SomasSolverRefinerTest, TestRefineTimeLimit) {
+  std::mt19937 rng(2);
+  const size_t num = 3000;
+  std::vector<std::pair<size_t, size_t>> lifetimes(num);
+  std::vector<size_t> sizes(num);
+  for (size_t i = 0; i < num; ++i) {
+    size_t begin = rng() % 1000;
+    lifetimes[i] = {begin, begin + 1 + rng() % 200};
+    sizes[i] = 512 * (1 + rng() % 64);
+  }
+  CreateTensors(lifetimes, sizes, std::vector<bool>(num, false));
+  auto initial_peak = StackTensors();
+
+  SomasSolverRefiner disabled_refiner(tensors_, &constraints_);
+  EXPECT_EQ(disabled_refiner.Refine(0), initial_peak);
+  EXPECT_EQ(disabled_refiner.searched_count(), 0);
+  EXPECT_EQ(CheckSolution(), initial_peak);
+
+  const int64_t kTimeLimitMs = 20;
+  // The lower bound is computed before the search starts and is not bounded by the time limit.
+  SomasSolverRefiner refiner(tensors_, &constraints_);
+  (void)refiner.LowerBound();
+  auto start = std::chrono::steady_clock::now();
+  auto peak = refiner.Refine(kTimeLimitMs);
+  auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+  EXPECT_LT(cost, kTimeLimitMs + 500);
+  EXPECT_GT(refiner.searched_count(), 0);
+  EXPECT_LE(peak, initial_peak);
+  EXPECT_EQ(CheckSolution(), peak);
+}
+}  // namespace somas
+}  // namespace mindspore
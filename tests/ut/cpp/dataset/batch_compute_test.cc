@@ -0,0 +1,226 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common.h"
+#include "minddata/dataset/engine/datasetops/map_op/cpu_map_job.h"
+#include "minddata/dataset/engine/ir/datasetops/map_node.h"
+#include "minddata/dataset/include/dataset/datasets.h"
+#include "minddata/dataset/include/dataset/vision.h"
+#include "minddata/dataset/kernels/image/hwc_to_chw_op.h"
+#include "minddata/dataset/kernels/image/rescale_op.h"
+#include "minddata/dataset/kernels/tensor_op.h"
+
+using namespace mindspore::dataset;
+
+namespace {
+// Take two int32 columns of the same shape, output their sum and the scalar sum of the first column.
+// It does not override BatchCompute(), so the default one of TensorOp is tested.
+class AddColumnsOp : public TensorOp {
+ public:
+  Status Compute(const TensorRow &input, TensorRow *output) override {
+    IO_CHECK_VECTOR(input, output);
+    CHECK_FAIL_RETURN_UNEXPECTED(input.size() == NumInput(), "AddColumns: input should be two columns.");
+    CHECK_FAIL_RETURN_UNEXPECTED(input[0]->shape() == input[1]->shape(), "AddColumns: shapes do not match.");
+    std::vector<int32_t> sum;
+    int32_t total = 0;
+    auto it = input[1]->begin<int32_t>();
+    for (auto value = input[0]->begin<int32_t>(); value != input[0]->end<int32_t>(); ++value, ++it) {
+      CHECK_FAIL_RETURN_UNEXPECTED(*value >= 0, "AddColumns: negative value.");
+      sum.push_back(*value + *it);
+      total += *value;
+    }
+    std::shared_ptr<Tensor> sum_tensor;
+    RETURN_IF_NOT_OK(Tensor::CreateFromVector(sum, input[0]->shape(), &sum_tensor));
+    std::shared_ptr<Tensor> total_tensor;
+    RETURN_IF_NOT_OK(Tensor::CreateScalar(total, &total_tensor));
+    output->push_back(sum_tensor);
+    output->push_back(total_tensor);
+    return Status::OK();
+  }
+
+  uint32_t NumInput() override { return 2; }
+
+  uint32_t NumOutput() override { return 2; }
+
+  std::string Name() const override { return "AddColumnsOp"; }
+};
+}  // namespace
+
+class MindDataTestBatchCompute : public UT::DatasetOpTesting {
+ public:
+  MindDataTestBatchCompute() = default;
+};
+
+/// Feature: TensorOp
+/// Description: Test the default BatchCompute of TensorOp, which unstacks the batches, calls Compute on each sample
+///     and stacks the results
+/// Expectation: The results are stacked along the first dimension, a scalar result of each sample is stacked into 1-D
+TEST_F(MindDataTestBatchCompute, TestDefaultBatchCompute) {
+  MS_LOG(INFO) << "Doing MindDataTestBatchCompute-TestDefaultBatchCompute.";
+  std::shared_ptr<Tensor> first;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{0, 1, 2, 3, 4, 5}, TensorShape({3, 2}), &first));
+  std::shared_ptr<Tensor> second;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{10, 20, 30, 40, 50, 60}, TensorShape({3, 2}), &second));
+
+  AddColumnsOp op;
+  TensorRow output;
+  ASSERT_OK(op.BatchCompute(TensorRow(0, {first, second}), &output));
+  ASSERT_EQ(output.size(), 2);
+
+  std::shared_ptr<Tensor> expect_sum;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{10, 21, 32, 43, 54, 65}, TensorShape({3, 2}), &expect_sum));
+  ASSERT_EQ(*output[0], *expect_sum);
+  std::shared_ptr<Tensor> expect_total;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{1, 5, 9}, TensorShape({3}), &expect_total));
+  ASSERT_EQ(*output[1], *expect_total);
+}
+
+/// Feature: TensorOp
+/// Description: Test the default BatchCompute of TensorOp with the input which can not be unstacked, and with an error
+///     from Compute of a sample
+/// Expectation: Return errors
+TEST_F(MindDataTestBatchCompute, TestDefaultBatchComputeFail) {
+  MS_LOG(INFO) << "Doing MindDataTestBatchCompute-TestDefaultBatchComputeFail.";
+  std::shared_ptr<Tensor> batch;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{0, 1, 2, 3, 4, 5}, TensorShape({3, 2}), &batch));
+  AddColumnsOp op;
+  TensorRow output;
+
+  // the batch sizes do not match
+  std::shared_ptr<Tensor> short_batch;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{0, 1, 2, 3}, TensorShape({2, 2}), &short_batch));
+  EXPECT_ERROR(op.BatchCompute(TensorRow(0, {batch, short_batch}), &output));
+
+  // a scalar is not a batch
+  std::shared_ptr<Tensor> scalar;
+  ASSERT_OK(Tensor::CreateScalar<int32_t>(1, &scalar));
+  output.clear();
+  EXPECT_ERROR(op.BatchCompute(TensorRow(0, {scalar, scalar}), &output));
+
+  // the strings can not be unstacked
+  std::shared_ptr<Tensor> strings;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<std::string>{"a", "b", "c"}, TensorShape({3}), &strings));
+  output.clear();
+  EXPECT_ERROR(op.BatchCompute(TensorRow(0, {strings, strings}), &output));
+
+  // Compute of the second sample fails
+  std::shared_ptr<Tensor> negative;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{0, 1, -2, 3, 4, 5}, TensorShape({3, 2}), &negative));
+  output.clear();
+  EXPECT_ERROR(op.BatchCompute(TensorRow(0, {negative, batch}), &output));
+}
+
+/// Feature: CpuMapJob
+/// Description: Test the batched CpuMapJob with a chain of the ops overriding BatchCompute and the default one
+/// Expectation: The results are the same as the ones of calling Compute on each sample, and the errors are reported
+///     with the name of the op
+TEST_F(MindDataTestBatchCompute, TestBatchedCpuMapJob) {
+  MS_LOG(INFO) << "Doing MindDataTestBatchCompute-TestBatchedCpuMapJob.";
+  const int64_t batch_size = 2;
+  std::vector<uint8_t> values(batch_size * 2 * 3 * 3);
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = static_cast<uint8_t>(i);
+  }
+  std::shared_ptr<Tensor> batch;
+  ASSERT_OK(Tensor::CreateFromVector(values, TensorShape({batch_size, 2, 3, 3}), &batch));
+
+  auto rescale = std::make_shared<RescaleOp>(0.5, 1.0);
+  auto hwc_to_chw = std::make_shared<HwcToChwOp>();
+  CpuMapJob job(true);
+  ASSERT_OK(job.AddOperation(rescale));
+  ASSERT_OK(job.AddOperation(hwc_to_chw));
+  std::vector<TensorRow> output;
+  ASSERT_OK(job.Run({TensorRow(0, {batch}), TensorRow(1, {batch})}, &output));
+  ASSERT_EQ(output.size(), 2);
+
+  for (const auto &row : output) {
+    ASSERT_EQ(row.size(), 1);
+    ASSERT_EQ(row[0]->shape(), TensorShape({batch_size, 3, 2, 3}));
+    for (int64_t i = 0; i < batch_size; i++) {
+      std::shared_ptr<Tensor> sample;
+      ASSERT_OK(batch->Slice(&sample, {SliceOption(Slice(i, i + 1))}));
+      sample->Squeeze();
+      std::shared_ptr<Tensor> rescaled;
+      ASSERT_OK(rescale->Compute(sample, &rescaled));
+      std::shared_ptr<Tensor> expect;
+      ASSERT_OK(hwc_to_chw->Compute(rescaled, &expect));
+      std::shared_ptr<Tensor> actual;
+      ASSERT_OK(row[0]->Slice(&actual, {SliceOption(Slice(i, i + 1))}));
+      actual->Squeeze();
+      EXPECT_EQ(*actual, *expect);
+    }
+  }
+
+  // the error of the default BatchCompute is reported by the job
+  CpuMapJob fail_job(true);
+  ASSERT_OK(fail_job.AddOperation(std::make_shared<AddColumnsOp>()));
+  output.clear();
+  Status rc = fail_job.Run({TensorRow(0, {batch})}, &output);
+  ASSERT_TRUE(rc.IsError());
+  EXPECT_NE(rc.GetErrDescription().find("map operation: [AddColumns] failed."), std::string::npos);
+}
+
+/// Feature: MapOp
+/// Description: Test the batched Map after Batch on images, against the Map before Batch
+/// Expectation: The output batches are the same
+TEST_F(MindDataTestBatchCompute, TestBatchedMapOp) {
+  MS_LOG(INFO) << "Doing MindDataTestBatchCompute-TestBatchedMapOp.";
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  const int32_t batch_size = 2;
+  auto create_dataset = [&folder_path](bool batched) -> std::shared_ptr<Dataset> {
+    std::shared_ptr<Dataset> ds = ImageFolder(folder_path, true, std::make_shared<SequentialSampler>(0, 6));
+    ds = ds->Map({std::make_shared<vision::Resize>(std::vector<int32_t>{32, 24})}, {"image"});
+    if (!batched) {
+      ds = ds->Map({std::make_shared<vision::Rescale>(1.0 / 255, 0.0), std::make_shared<vision::HWC2CHW>()}, {"image"});
+      return ds->Batch(batch_size);
+    }
+    ds = ds->Batch(batch_size);
+    ds = ds->Map({std::make_shared<vision::Rescale>(1.0 / 255, 0.0), std::make_shared<vision::HWC2CHW>()}, {"image"});
+    std::dynamic_pointer_cast<MapNode>(ds->IRNode())->SetBatched(true);
+    return ds;
+  };
+
+  std::shared_ptr<Iterator> expect_iter = create_dataset(false)->CreateIterator();
+  ASSERT_NE(expect_iter, nullptr);
+  std::shared_ptr<Iterator> iter = create_dataset(true)->CreateIterator();
+  ASSERT_NE(iter, nullptr);
+
+  std::unordered_map<std::string, mindspore::MSTensor> expect_row;
+  std::unordered_map<std::string, mindspore::MSTensor> row;
+  ASSERT_OK(expect_iter->GetNextRow(&expect_row));
+  ASSERT_OK(iter->GetNextRow(&row));
+  uint64_t i = 0;
+  while (row.size() != 0) {
+    ASSERT_EQ(expect_row.size(), row.size());
+    auto image = row["image"];
+    std::vector<int64_t> expect_shape = {batch_size, 3, 32, 24};
+    EXPECT_EQ(image.Shape(), expect_shape);
+    EXPECT_MSTENSOR_EQ(image, expect_row["image"]);
+    EXPECT_MSTENSOR_EQ(row["label"], expect_row["label"]);
+    ASSERT_OK(expect_iter->GetNextRow(&expect_row));
+    ASSERT_OK(iter->GetNextRow(&row));
+    i++;
+  }
+  EXPECT_EQ(expect_row.size(), 0);
+  EXPECT_EQ(i, 3);
+
+  expect_iter->Stop();
+  iter->Stop();
+}
@@ -1628,6 +1628,49 @@ TEST_F(MindDataTestPipeline, TestShuffleTFRecord) {
  TestShuffleTFRecord(100, datasets_root_path_);
 }
 
+/// Feature: Shuffle op
+/// Description: Test Shuffle op which keeps only a part of the shuffle buffer in memory and spills the other rows
+/// Expectation: All the rows are sent out once, the same as keeping the whole shuffle buffer in memory
+TEST_F(MindDataTestPipeline, TestShuffleSpillDataset) {
+  MS_LOG(INFO) << "Doing MindDataTestPipeline-TestShuffleSpillDataset.";
+  std::shared_ptr<ConfigManager> cfg = GlobalContext::config_manager();
+  int32_t original_rows = cfg->shuffle_max_rows_in_memory();
+  std::string original_dir = cfg->shuffle_spill_dir();
+  cfg->set_shuffle_max_rows_in_memory(3);
+  cfg->set_shuffle_spill_dir(".");
+
+  // Create an ImageFolder Dataset, the first 11 images have label 0 and the next 9 images have label 1
+  std::string folder_path = datasets_root_path_ + "/testPK/data/";
+  std::shared_ptr<Dataset> ds = ImageFolder(folder_path, true, std::make_shared<SequentialSampler>(0, 20));
+  EXPECT_NE(ds, nullptr);
+
+  // Create a Shuffle operation on ds, 7 rows of the shuffle buffer are spilled
+  ds = ds->Shuffle(10);
+  EXPECT_NE(ds, nullptr);
+
+  std::shared_ptr<Iterator> iter = ds->CreateIterator();
+  EXPECT_NE(iter, nullptr);
+
+  std::unordered_map<std::string, mindspore::MSTensor> row;
+  ASSERT_OK(iter->GetNextRow(&row));
+  uint64_t i = 0;
+  int32_t label_sum = 0;
+  while (row.size() != 0) {
+    i++;
+    auto label = row["label"];
+    label_sum += *reinterpret_cast<const int32_t *>(label.Data().get());
+    EXPECT_GT(row["image"].DataSize(), 0);
+    ASSERT_OK(iter->GetNextRow(&row));
+  }
+  EXPECT_EQ(i, 20);
+  EXPECT_EQ(label_sum, 9);
+
+  // Manually terminate the pipeline
+  iter->Stop();
+  cfg->set_shuffle_max_rows_in_memory(original_rows);
+  cfg->set_shuffle_spill_dir(original_dir);
+}
+
 TEST_F(MindDataTestPipeline, TestSkipDataset) {
   MS_LOG(INFO) << "Doing MindDataTestPipeline-TestSkipDataset.";
 
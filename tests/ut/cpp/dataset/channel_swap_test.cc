@@ -52,3 +52,58 @@ TEST_F(MindDataTestChannelSwap, TestOp) {
   EXPECT_EQ(success, true);
   MS_LOG(INFO) << "MindDataTestChannelSwap end.";
 }
+
+/// Feature: HwcToChw op
+/// Description: Test BatchCompute of HwcToChw op on batches of [H, W, C] and [H, W] images, and on invalid input
+/// Expectation: [H, W, C] images are transposed to [C, H, W], [H, W] images are kept, and the invalid input fails
+TEST_F(MindDataTestChannelSwap, TestBatchCompute) {
+  MS_LOG(INFO) << "Doing MindDataTestChannelSwap-TestBatchCompute.";
+  const int64_t num_images = 2;
+  const int64_t height = 2;
+  const int64_t width = 3;
+  const int64_t num_channels = 4;
+  std::vector<float> values(num_images * height * width * num_channels);
+  for (size_t i = 0; i < values.size(); i++) {
+    values[i] = static_cast<float>(i);
+  }
+  std::shared_ptr<Tensor> batch;
+  ASSERT_OK(Tensor::CreateFromVector(values, TensorShape({num_images, height, width, num_channels}), &batch));
+
+  HwcToChwOp op;
+  TensorRow output;
+  ASSERT_OK(op.BatchCompute(TensorRow(0, {batch}), &output));
+  ASSERT_EQ(output.size(), 1);
+  ASSERT_EQ(output[0]->shape(), TensorShape({num_images, num_channels, height, width}));
+  for (int64_t n = 0; n < num_images; n++) {
+    for (int64_t c = 0; c < num_channels; c++) {
+      for (int64_t h = 0; h < height; h++) {
+        for (int64_t w = 0; w < width; w++) {
+          float expect = 0;
+          float actual = 0;
+          ASSERT_OK(batch->GetItemAt(&expect, {n, h, w, c}));
+          ASSERT_OK(output[0]->GetItemAt(&actual, {n, c, h, w}));
+          EXPECT_EQ(actual, expect);
+        }
+      }
+    }
+  }
+
+  // a batch of [H, W] images is kept as it is
+  std::shared_ptr<Tensor> gray_batch;
+  ASSERT_OK(Tensor::CreateFromVector(values, TensorShape({num_images, height, width * num_channels}), &gray_batch));
+  output.clear();
+  ASSERT_OK(op.BatchCompute(TensorRow(0, {gray_batch}), &output));
+  ASSERT_EQ(output.size(), 1);
+  EXPECT_EQ(output[0]->shape(), gray_batch->shape());
+  EXPECT_EQ(memcmp(output[0]->GetBuffer(), gray_batch->GetBuffer(), gray_batch->SizeInBytes()), 0);
+
+  // more than one column
+  output.clear();
+  EXPECT_ERROR(op.BatchCompute(TensorRow(0, {batch, batch}), &output));
+
+  // a batch of 1-D tensors is not a batch of images
+  std::shared_ptr<Tensor> flat_batch;
+  ASSERT_OK(Tensor::CreateFromVector(values, TensorShape({num_images, height * width * num_channels}), &flat_batch));
+  output.clear();
+  EXPECT_ERROR(op.BatchCompute(TensorRow(0, {flat_batch}), &output));
+}
@@ -2059,6 +2059,49 @@ TEST_F(MindDataTestExecute, TestToVectorsWithInvalidParam) {
   EXPECT_FALSE(status02.IsOk());
 }
 
+/// Feature: Vectors
+/// Description: Test ToVectors with the Vectors and GloVe loaded from the binary vectors file converted from text
+/// Expectation: Get the same MSTensor as the Vectors loaded from text, and fail to load the truncated binary file
+TEST_F(MindDataTestExecute, TestToVectorsWithBinaryVectors) {
+  MS_LOG(INFO) << "Doing MindDataTestExecute-TestToVectorsWithBinaryVectors.";
+  std::shared_ptr<Tensor> de_tensor;
+  std::vector<std::string> words = {"ok", "this", "OK", "none"};
+  ASSERT_OK(Tensor::CreateFromVector(words, TensorShape({static_cast<dsize_t>(words.size())}), &de_tensor));
+  auto tokens = mindspore::MSTensor(std::make_shared<mindspore::dataset::DETensor>(de_tensor));
+  std::vector<float> unknown_init = {-1, -1, -1, -1, -1, -1};
+
+  std::string vectors_dir = "data/dataset/testVectors/vectors.txt";
+  std::string binary_dir = "./vectors_binary_test.bin";
+  std::shared_ptr<Vectors> text_vectors;
+  ASSERT_OK(Vectors::BuildFromFile(&text_vectors, vectors_dir));
+  ASSERT_OK(Vectors::ConvertToBinary(vectors_dir, binary_dir));
+  std::shared_ptr<Vectors> binary_vectors;
+  ASSERT_OK(Vectors::BuildFromFile(&binary_vectors, binary_dir));
+  EXPECT_EQ(binary_vectors->Dim(), text_vectors->Dim());
+  std::shared_ptr<GloVe> binary_glove;
+  ASSERT_OK(GloVe::BuildFromFile(&binary_glove, binary_dir));
+
+  mindspore::MSTensor expected;
+  auto transform = Execute({std::make_shared<text::ToVectors>(text_vectors, unknown_init, true)});
+  ASSERT_OK(transform(tokens, &expected));
+  for (const std::shared_ptr<Vectors> &vectors : {binary_vectors, std::shared_ptr<Vectors>(binary_glove)}) {
+    mindspore::MSTensor lookup_result;
+    auto binary_transform = Execute({std::make_shared<text::ToVectors>(vectors, unknown_init, true)});
+    ASSERT_OK(binary_transform(tokens, &lookup_result));
+    EXPECT_MSTENSOR_EQ(lookup_result, expected);
+  }
+
+  // the binary file is verified when it is loaded
+  std::ifstream in(binary_dir, std::ios::in | std::ios::binary);
+  std::vector<char> content(std::istreambuf_iterator<char>(in), {});
+  in.close();
+  std::ofstream out(binary_dir, std::ios::out | std::ios::binary | std::ios::trunc);
+  out.write(content.data(), static_cast<std::streamsize>(content.size() / 2));
+  out.close();
+  EXPECT_FALSE(Vectors::BuildFromFile(&binary_vectors, binary_dir).IsOk());
+  (void)std::remove(binary_dir.c_str());
+}
+
 /// Feature: FastText
 /// Description: Test basic usage of FastText and the ToVectors with default parameter
 /// Expectation: Get correct MSTensor
@@ -21,8 +21,10 @@
 
 #include "common/common.h"
 #include "gtest/gtest.h"
+#include "minddata/dataset/core/global_context.h"
 #include "minddata/dataset/util/status.h"
 #include "minddata/dataset/engine/gnn/node.h"
+#include "minddata/dataset/engine/gnn/graph_csr.h"
 #include "minddata/dataset/engine/gnn/graph_data_impl.h"
 #include "minddata/dataset/engine/gnn/graph_loader.h"
 
@@ -429,3 +431,93 @@ TEST_F(MindDataTestGNNGraph, TestRandomWalkDefaults) {
   EXPECT_TRUE(s.IsOk());
   EXPECT_TRUE(walk_path->shape().ToString() == "<33,60>");
 }
+
+/// Feature: GNNGraph
+/// Description: Test GetSampledNeighbors and RandomWalk of nodes in more than one block with different num_workers
+/// Expectation: The results only depend on the seed
+TEST_F(MindDataTestGNNGraph, TestParallelSampling) {
+  uint32_t original_seed = GlobalContext::config_manager()->seed();
+  std::string path = "data/mindrecord/testGraphData/sns";
+  std::vector<int32_t> num_workers = {1, 4};
+  std::vector<std::shared_ptr<Tensor>> neighbors(num_workers.size());
+  std::vector<std::shared_ptr<Tensor>> walks(num_workers.size());
+  size_t node_num = 0;
+  for (size_t i = 0; i < num_workers.size(); ++i) {
+    GlobalContext::config_manager()->set_seed(1234);
+    GraphDataImpl graph("mindrecord", path, num_workers[i]);
+    ASSERT_TRUE(graph.Init().IsOk());
+    MetaInfo meta_info;
+    ASSERT_TRUE(graph.GetMetaInfo(&meta_info).IsOk());
+    std::shared_ptr<Tensor> nodes;
+    ASSERT_TRUE(graph.GetAllNodes(meta_info.node_type[0], &nodes).IsOk());
+
+    // repeat the nodes, so that they are sampled in more than one block
+    std::vector<NodeIdType> node_list;
+    while (node_list.size() <= kSampleBlockSize * 2) {
+      node_list.insert(node_list.end(), nodes->begin<NodeIdType>(), nodes->end<NodeIdType>());
+    }
+    node_num = node_list.size();
+    NodeType node_type = meta_info.node_type[0];
+    ASSERT_TRUE(graph
+                  .GetSampledNeighbors(node_list, {2, 3}, {node_type, node_type}, SamplingStrategy::kRandom,
+                                       &neighbors[i])
+                  .IsOk());
+    ASSERT_TRUE(graph.RandomWalk(node_list, {node_type, node_type, node_type}, 2.0, 0.5, -1, &walks[i]).IsOk());
+  }
+  GlobalContext::config_manager()->set_seed(original_seed);
+
+  EXPECT_EQ(neighbors[0]->shape().ToString(), "<" + std::to_string(node_num) + ",9>");
+  EXPECT_EQ(walks[0]->shape().ToString(), "<" + std::to_string(node_num) + ",4>");
+  EXPECT_TRUE(*neighbors[0] == *neighbors[1]);
+  EXPECT_TRUE(*walks[0] == *walks[1]);
+}
+
+/// Feature: GNNGraph
+/// Description: Test the csr adjacency with neighbors of different types, edge weights and nodes without neighbors
+/// Expectation: Neighbors keep the order of edges, and the sampled neighbors follow the sampling strategy
+TEST_F(MindDataTestGNNGraph, TestGraphCsr) {
+  GraphCsr csr;
+  csr.AddEdge(1, 10, 1, 1.0);
+  csr.AddEdge(2, 12, 1, 5.0);
+  csr.AddEdge(1, 20, 2, 1.0);
+  csr.AddEdge(1, 11, 1, 2.0);
+  csr.AddEdge(1, 12, 1, 7.0);
+  ASSERT_TRUE(csr.Build().IsOk());
+  EXPECT_EQ(csr.EdgeCount(), 5);
+
+  std::vector<NodeIdType> neighbors;
+  ASSERT_TRUE(csr.GetAllNeighbors(1, 1, &neighbors).IsOk());
+  EXPECT_EQ(neighbors, std::vector<NodeIdType>({1, 10, 11, 12}));
+  ASSERT_TRUE(csr.GetAllNeighbors(1, 2, &neighbors, true).IsOk());
+  EXPECT_EQ(neighbors, std::vector<NodeIdType>({20}));
+  ASSERT_TRUE(csr.GetAllNeighbors(3, 1, &neighbors, true).IsOk());
+  EXPECT_TRUE(neighbors.empty());
+
+  // the neighbors are sampled by the weights 1:2:7
+  std::mt19937 rnd(0);
+  std::map<NodeIdType, int32_t> counts;
+  const int32_t kSampleTimes = 10000;
+  for (int32_t i = 0; i < kSampleTimes; ++i) {
+    ASSERT_TRUE(csr.GetSampledNeighbors(1, 1, 1, SamplingStrategy::kEdgeWeight, &rnd, &neighbors).IsOk());
+    counts[neighbors[0]]++;
+  }
+  EXPECT_NEAR(counts[10] / static_cast<float>(kSampleTimes), 0.1, 0.02);
+  EXPECT_NEAR(counts[11] / static_cast<float>(kSampleTimes), 0.2, 0.02);
+  EXPECT_NEAR(counts[12] / static_cast<float>(kSampleTimes), 0.7, 0.02);
+
+  // every neighbor is sampled once before any of them is sampled again
+  ASSERT_TRUE(csr.GetSampledNeighbors(1, 1, 6, SamplingStrategy::kRandom, &rnd, &neighbors).IsOk());
+  ASSERT_EQ(neighbors.size(), 6);
+  for (size_t round = 0; round < 2; ++round) {
+    std::vector<NodeIdType> sampled(neighbors.begin() + round * 3, neighbors.begin() + round * 3 + 3);
+    std::sort(sampled.begin(), sampled.end());
+    EXPECT_EQ(sampled, std::vector<NodeIdType>({10, 11, 12}));
+  }
+
+  ASSERT_TRUE(csr.GetSampledNeighbors(3, 1, 2, SamplingStrategy::kRandom, &rnd, &neighbors).IsOk());
+  EXPECT_EQ(neighbors, std::vector<NodeIdType>({kDefaultNodeId, kDefaultNodeId}));
+
+  GraphCsr invalid_csr;
+  invalid_csr.AddEdge(1, 2, 1, -1.0);
+  EXPECT_FALSE(invalid_csr.Build().IsOk());
+}
@@ -16,7 +16,9 @@
 
 #include "minddata/dataset/util/memory_pool.h"
 #include "minddata/dataset/util/circular_pool.h"
+#include "minddata/dataset/util/recycle_pool.h"
 #include "minddata/dataset/util/allocator.h"
+#include "minddata/dataset/core/tensor.h"
 #include "common/common.h"
 #include "gtest/gtest.h"
 
@@ -100,3 +102,68 @@ TEST_F(MindDataTestMemoryPool, TestMemGuard) {
     p[sz / 2] = 'a';
   }
 }
+
+/// Feature: RecyclePool
+/// Description: Test that the freed blocks are handed out again to the allocations of the same size, and that the
+///     least recently freed blocks are released when the kept blocks exceed max_cached_bytes
+/// Expectation: Blocks of the same size are recycled and at most max_cached_bytes of freed blocks are kept
+TEST_F(MindDataTestMemoryPool, TestRecyclePool) {
+  auto pool = std::make_shared<RecyclePool>(256);
+  void *p1 = nullptr;
+  void *p2 = nullptr;
+  void *p3 = nullptr;
+  void *p4 = nullptr;
+  ASSERT_OK(pool->Allocate(64, &p1));
+  ASSERT_OK(pool->Allocate(64, &p2));
+  ASSERT_OK(pool->Allocate(128, &p3));
+  ASSERT_OK(pool->Allocate(512, &p4));
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(p1) % alignof(std::max_align_t), 0);
+  pool->Deallocate(p1);
+  pool->Deallocate(p2);
+  pool->Deallocate(p3);
+  ASSERT_EQ(pool->CachedBlocks(), 3);
+  ASSERT_EQ(pool->CachedBytes(), 256);
+  // the block larger than max_cached_bytes is released at once
+  pool->Deallocate(p4);
+  ASSERT_EQ(pool->CachedBytes(), 256);
+
+  void *q1 = nullptr;
+  void *q2 = nullptr;
+  ASSERT_OK(pool->Allocate(64, &q1));
+  ASSERT_OK(pool->Allocate(128, &q2));
+  ASSERT_EQ(q1, p2);
+  ASSERT_EQ(q2, p3);
+  ASSERT_EQ(pool->RecycledCount(), 2);
+  ASSERT_EQ(pool->CachedBlocks(), 1);
+  ASSERT_EQ(pool->CachedBytes(), 64);
+
+  // the blocks of another size evict the least recently freed block p1
+  void *r1 = nullptr;
+  void *r2 = nullptr;
+  ASSERT_OK(pool->Allocate(96, &r1));
+  ASSERT_OK(pool->Allocate(96, &r2));
+  pool->Deallocate(q1);
+  pool->Deallocate(r1);
+  pool->Deallocate(r2);
+  ASSERT_EQ(pool->CachedBlocks(), 3);
+  ASSERT_EQ(pool->CachedBytes(), 256);
+  void *s1 = nullptr;
+  void *s2 = nullptr;
+  ASSERT_OK(pool->Allocate(64, &s1));
+  ASSERT_OK(pool->Allocate(64, &s2));
+  ASSERT_EQ(s1, q1);
+  ASSERT_EQ(pool->RecycledCount(), 3);
+  pool->Deallocate(s1);
+  pool->Deallocate(s2);
+  pool->Deallocate(q2);
+
+  // the buffer of a tensor is returned to its pool when the tensor is destroyed
+  auto tensor_pool = std::make_shared<RecyclePool>(1024);
+  std::shared_ptr<Tensor> t1;
+  ASSERT_OK(Tensor::CreateEmpty(TensorShape({4, 4}), DataType(DataType::DE_FLOAT32), tensor_pool, &t1));
+  const uchar *buffer = t1->GetBuffer();
+  t1.reset();
+  std::shared_ptr<Tensor> t2;
+  ASSERT_OK(Tensor::CreateEmpty(TensorShape({8, 2}), DataType(DataType::DE_FLOAT32), tensor_pool, &t2));
+  ASSERT_EQ(t2->GetBuffer(), buffer);
+}
@@ -16,7 +16,9 @@
 #include "common/common.h"
 #include "common/cvop_common.h"
 #include "minddata/dataset/kernels/data/data_utils.h"
+#include "minddata/dataset/kernels/image/hwc_to_chw_op.h"
 #include "minddata/dataset/kernels/image/normalize_op.h"
+#include "minddata/dataset/kernels/image/resize_op.h"
 #include "minddata/dataset/core/cv_tensor.h"
 #include "utils/log_adapter.h"
 #include <opencv2/opencv.hpp>
@@ -93,3 +95,46 @@ TEST_F(MindDataTestNormalizeOP, TestOp4Dim) {
   cv::FileStorage file(output_filename, cv::FileStorage::WRITE);
   file << "videoData" << cv_output_video;
 }
+
+/// Feature: Normalize
+/// Description: Test BatchCompute of Normalize, HWC2CHW and the default one of Resize on a batch of images
+/// Expectation: The results are the same as calling Compute on each image
+TEST_F(MindDataTestNormalizeOP, TestBatchCompute) {
+  MS_LOG(INFO) << "Doing TestNormalizeOp-TestBatchCompute.";
+  const int batch_size = 3;
+  std::vector<std::shared_ptr<Tensor>> images(batch_size, input_tensor_);
+  std::shared_ptr<Tensor> batch;
+  ASSERT_OK(TensorVectorToBatchTensor(images, &batch));
+
+  auto check_batch_compute = [&batch](TensorOp *op) {
+    TensorRow batch_output;
+    ASSERT_OK(op->BatchCompute(TensorRow(0, {batch}), &batch_output));
+    ASSERT_EQ(batch_output.size(), 1);
+    std::vector<std::shared_ptr<Tensor>> expect_images;
+    for (int i = 0; i < batch_size; i++) {
+      std::shared_ptr<Tensor> image;
+      std::shared_ptr<Tensor> expect;
+      ASSERT_OK(batch->Slice(&image, {SliceOption(Slice(i, i + 1))}));
+      image->Squeeze();
+      ASSERT_OK(op->Compute(image, &expect));
+      expect_images.push_back(expect);
+    }
+    std::shared_ptr<Tensor> expect_batch;
+    ASSERT_OK(TensorVectorToBatchTensor(expect_images, &expect_batch));
+    ASSERT_EQ(batch_output[0]->shape(), expect_batch->shape());
+    ASSERT_EQ(batch_output[0]->type(), expect_batch->type());
+    EXPECT_EQ(memcmp(batch_output[0]->GetBuffer(), expect_batch->GetBuffer(), expect_batch->SizeInBytes()), 0);
+  };
+
+  NormalizeOp normalize({121.0, 115.0, 100.0}, {70.0, 68.0, 71.0}, true);
+  check_batch_compute(&normalize);
+  HwcToChwOp hwc_to_chw;
+  check_batch_compute(&hwc_to_chw);
+  ResizeOp resize(32, 48);
+  check_batch_compute(&resize);
+
+  // the channels do not match the mean and std
+  TensorRow output;
+  NormalizeOp normalize_chw({121.0, 115.0, 100.0}, {70.0, 68.0, 71.0}, false);
+  EXPECT_ERROR(normalize_chw.BatchCompute(TensorRow(0, {batch}), &output));
+}
@@ -0,0 +1,92 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cmath>
+#include "common/common.h"
+#include "common/cvop_common.h"
+#include "minddata/dataset/core/config_manager.h"
+#include "minddata/dataset/kernels/image/image_utils.h"
+#include "minddata/dataset/kernels/image/random_crop_decode_resize_normalize_op.h"
+#include "minddata/dataset/kernels/image/random_crop_decode_resize_op.h"
+#include "utils/log_adapter.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestRandomCropDecodeResizeNormalizeOp : public UT::CVOP::CVOpCommon {
+ public:
+  MindDataTestRandomCropDecodeResizeNormalizeOp() : CVOpCommon() {}
+};
+
+/// Feature: RandomCropDecodeResizeNormalize op
+/// Description: Compare the fused op with RandomCropDecodeResize, Rescale, Normalize and HWC2CHW applied one by one
+/// Expectation: The outputs are in CHW format and close to each other, the jpeg is decoded at reduced scale
+TEST_F(MindDataTestRandomCropDecodeResizeNormalizeOp, TestOp) {
+  MS_LOG(INFO) << "Doing MindDataTestRandomCropDecodeResizeNormalizeOp-TestOp.";
+  constexpr int target_height = 112;
+  constexpr int target_width = 96;
+  constexpr float rescale = 1.0 / 255;
+  constexpr float shift = 0.0;
+  // the mean difference of a pixel is less than 2 in [0, 255]
+  constexpr float kMeanDiffThreshold = 2.0 / 255 / 0.225;
+  const std::vector<float> mean = {0.485, 0.456, 0.406};
+  const std::vector<float> std = {0.229, 0.224, 0.225};
+
+  GlobalContext::config_manager()->set_seed(42);
+  RandomCropDecodeResizeOp crop_decode_resize(target_height, target_width);
+  // the copy shares the same random state, so that the crop boxes are the same
+  RandomCropDecodeResizeNormalizeOp fused(crop_decode_resize, rescale, shift, mean, std, true);
+  EXPECT_EQ(fused.Name(), kRandomCropDecodeResizeNormalizeOp);
+
+  for (int k = 0; k < 5; k++) {
+    TensorRow input;
+    input.push_back(raw_input_tensor_);
+    TensorRow cropped;
+    TensorRow output;
+    ASSERT_TRUE(crop_decode_resize.Compute(input, &cropped).IsOk());
+    ASSERT_TRUE(fused.Compute(input, &output).IsOk());
+
+    std::shared_ptr<Tensor> rescaled;
+    std::shared_ptr<Tensor> normalized;
+    std::shared_ptr<Tensor> expected;
+    ASSERT_TRUE(Rescale(cropped[0], &rescaled, rescale, shift).IsOk());
+    ASSERT_TRUE(Normalize(rescaled, &normalized, mean, std, true).IsOk());
+    ASSERT_TRUE(HwcToChw(normalized, &expected).IsOk());
+    ASSERT_EQ(output[0]->shape(), TensorShape({kDefaultImageChannel, target_height, target_width}));
+    ASSERT_EQ(output[0]->type(), DataType(DataType::DE_FLOAT32));
+    ASSERT_EQ(output[0]->shape(), expected->shape());
+
+    double diff_sum = 0;
+    auto expected_itr = expected->begin<float>();
+    for (auto itr = output[0]->begin<float>(); itr != output[0]->end<float>(); ++itr, ++expected_itr) {
+      diff_sum += std::fabs(*itr - *expected_itr);
+    }
+    double mean_diff = diff_sum / output[0]->Size();
+    MS_LOG(INFO) << "mean diff: " << mean_diff;
+    EXPECT_LT(mean_diff, kMeanDiffThreshold);
+  }
+}
+
+/// Feature: RandomCropDecodeResizeNormalize op
+/// Description: Get the libjpeg scale denominator of different crop sizes
+/// Expectation: The scaled crop is never smaller than the target size
+TEST_F(MindDataTestRandomCropDecodeResizeNormalizeOp, TestGetScaleDenom) {
+  MS_LOG(INFO) << "Doing MindDataTestRandomCropDecodeResizeNormalizeOp-TestGetScaleDenom.";
+  EXPECT_EQ(RandomCropDecodeResizeNormalizeOp::GetScaleDenom(224, 224, 224, 224), 1);
+  EXPECT_EQ(RandomCropDecodeResizeNormalizeOp::GetScaleDenom(447, 1000, 224, 224), 1);
+  EXPECT_EQ(RandomCropDecodeResizeNormalizeOp::GetScaleDenom(448, 1000, 224, 224), 2);
+  EXPECT_EQ(RandomCropDecodeResizeNormalizeOp::GetScaleDenom(1000, 1000, 224, 224), 4);
+  EXPECT_EQ(RandomCropDecodeResizeNormalizeOp::GetScaleDenom(4000, 3000, 224, 224), 8);
+  EXPECT_EQ(RandomCropDecodeResizeNormalizeOp::GetScaleDenom(100, 100, 224, 224), 1);
+}
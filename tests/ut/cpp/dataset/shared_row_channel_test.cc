@@ -0,0 +1,133 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <thread>
+
+#include "common/common.h"
+#include "gtest/gtest.h"
+#include "minddata/dataset/core/tensor.h"
+#include "minddata/dataset/kernels/shared_row_channel.h"
+
+using namespace mindspore::dataset;
+
+class MindDataTestSharedRowChannel : public UT::Common {
+ public:
+  MindDataTestSharedRowChannel() {}
+};
+
+/// Feature: SharedRowChannel
+/// Description: Test a row is shipped to a worker and its numeric result comes back by Call
+/// Expectation: The worker gets the row and the function index, and the output is the result of the worker
+TEST_F(MindDataTestSharedRowChannel, TestCall) {
+  if (!SharedRowChannel::IsSupported()) {
+    GTEST_SKIP();
+  }
+  std::shared_ptr<SharedRowChannel> channel;
+  ASSERT_OK(SharedRowChannel::Create(1024, &channel));
+
+  // the worker doubles the elements of the first array and returns it with a scalar
+  std::thread worker([&channel]() {
+    bool ready = false;
+    while (!ready) {
+      ASSERT_OK(channel->Wait(SharedRowChannel::kRequest, 100, &ready));
+    }
+    ASSERT_EQ(channel->GetKind(SharedRowChannel::kRequest), SharedRowChannel::kArrays);
+    ASSERT_EQ(channel->GetFuncIdx(SharedRowChannel::kRequest), 3);
+    std::vector<SharedRowChannel::ArrayView> arrays;
+    ASSERT_OK(channel->GetArrays(SharedRowChannel::kRequest, &arrays));
+    ASSERT_EQ(arrays.size(), 2);
+    auto data = reinterpret_cast<const int32_t *>(arrays[0].data);
+    std::vector<int32_t> doubled;
+    for (int64_t i = 0; i < arrays[0].shape.NumOfElements(); ++i) {
+      doubled.push_back(data[i] * 2);
+    }
+    float scalar = 1.5;
+    std::vector<SharedRowChannel::ArrayView> results{
+      {arrays[0].type, arrays[0].shape, reinterpret_cast<const uchar *>(doubled.data())},
+      {DataType(DataType::DE_FLOAT32), TensorShape::CreateScalar(), reinterpret_cast<const uchar *>(&scalar)}};
+    bool put = false;
+    ASSERT_OK(channel->PutArrays(SharedRowChannel::kResponse, 0, results, true, &put));
+    ASSERT_TRUE(put);
+  });
+
+  std::shared_ptr<Tensor> t1;
+  std::shared_ptr<Tensor> t2;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{1, 2, 3, 4, 5, 6}, TensorShape({2, 3}), &t1));
+  ASSERT_OK(Tensor::CreateScalar<uint8_t>(7, &t2));
+  TensorRow output;
+  SharedRowChannel::Kind kind = SharedRowChannel::kEmpty;
+  ASSERT_OK(channel->Call(3, TensorRow({t1, t2}), &output, &kind));
+  worker.join();
+
+  ASSERT_EQ(kind, SharedRowChannel::kArrays);
+  ASSERT_EQ(output.size(), 2);
+  std::shared_ptr<Tensor> expected;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int32_t>{2, 4, 6, 8, 10, 12}, TensorShape({2, 3}), &expected));
+  ASSERT_EQ(*output[0], *expected);
+  float scalar = 0;
+  ASSERT_OK(output[1]->GetItemAt(&scalar, {}));
+  ASSERT_EQ(scalar, 1.5);
+}
+
+/// Feature: SharedRowChannel
+/// Description: Test the rows which are not numeric or larger than the slot
+/// Expectation: The rows are not put into the channel, and Call leaves them to the caller
+TEST_F(MindDataTestSharedRowChannel, TestNotShipped) {
+  if (!SharedRowChannel::IsSupported()) {
+    GTEST_SKIP();
+  }
+  std::shared_ptr<SharedRowChannel> channel;
+  ASSERT_OK(SharedRowChannel::Create(256, &channel));
+
+  std::shared_ptr<Tensor> large;
+  ASSERT_OK(Tensor::CreateFromVector(std::vector<int64_t>(64, 1), &large));
+  TensorRow output;
+  SharedRowChannel::Kind kind = SharedRowChannel::kArrays;
+  ASSERT_OK(channel->Call(0, TensorRow({large}), &output, &kind));
+  ASSERT_EQ(kind, SharedRowChannel::kEmpty);
+
+  std::shared_ptr<Tensor> str;
+  ASSERT_OK(Tensor::CreateScalar<std::string>("row", &str));
+  ASSERT_OK(channel->Call(0, TensorRow({str}), &output, &kind));
+  ASSERT_EQ(kind, SharedRowChannel::kEmpty);
+  ASSERT_TRUE(output.empty());
+
+  std::string bytes(300, 'a');
+  bool put = true;
+  ASSERT_OK(channel->PutBytes(SharedRowChannel::kRequest, 0, bytes.data(), bytes.size(), &put));
+  ASSERT_FALSE(put);
+
+  // nothing has been signalled
+  bool ready = true;
+  ASSERT_OK(channel->Wait(SharedRowChannel::kRequest, 10, &ready));
+  ASSERT_FALSE(ready);
+}
+
+/// Feature: SharedRowChannel
+/// Description: Test closing the channel while a worker waits for a request
+/// Expectation: The worker wakes up without a request
+TEST_F(MindDataTestSharedRowChannel, TestClose) {
+  if (!SharedRowChannel::IsSupported()) {
+    GTEST_SKIP();
+  }
+  std::shared_ptr<SharedRowChannel> channel;
+  ASSERT_OK(SharedRowChannel::Create(256, &channel));
+  bool ready = true;
+  std::thread worker([&channel, &ready]() { ASSERT_OK(channel->Wait(SharedRowChannel::kRequest, 60000, &ready)); });
+  channel->Close();
+  worker.join();
+  ASSERT_FALSE(ready);
+  ASSERT_TRUE(channel->IsClosed());
+}
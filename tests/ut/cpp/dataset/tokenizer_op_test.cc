@@ -26,6 +26,8 @@
 #include "minddata/dataset/text/kernels/unicode_char_tokenizer_op.h"
 #include "minddata/dataset/text/kernels/unicode_script_tokenizer_op.h"
 #include "minddata/dataset/text/kernels/whitespace_tokenizer_op.h"
+#include "minddata/dataset/text/kernels/wordpiece_tokenizer_op.h"
+#include "minddata/dataset/text/vocab_trie.h"
 #include "gtest/gtest.h"
 #include "utils/log_adapter.h"
 
@@ -382,4 +384,33 @@ std::shared_ptr<Tensor> input;
   TensorRow output;
   Status s = basic_tokenizer->Compute(TensorRow(0, {input}), &output);
   EXPECT_TRUE(s.IsOk());
-}
\ No newline at end of file
+}
+
+/// Feature: WordpieceTokenizer op
+/// Description: Test WordpieceTokenizerOp with the longest match on the trie of vocab, including multi-byte words
+/// Expectation: Output is equal to the expected output
+TEST_F(MindDataTestTokenizerOp, TestWordpieceTokenizer) {
+  MS_LOG(INFO) << "Doing TestWordpieceTokenizer.";
+  std::vector<std::string> words = {"i",   "am",    "fav", "favor", "##ite", "dur", "##ing",
+                                    "##s", "cat", "每",  "##日", "##日本", "[UNK]"};
+  std::shared_ptr<Vocab> vocab;
+  ASSERT_TRUE(Vocab::BuildFromVector(words, {}, true, &vocab).IsOk());
+  VocabTrie trie(*vocab);
+  EXPECT_EQ(trie.LongestMatch(VocabTrie::kRoot, "favorite"), 5);
+  EXPECT_EQ(trie.LongestMatch(trie.Walk(VocabTrie::kRoot, "##"), "ings"), 3);
+  EXPECT_EQ(trie.LongestMatch(VocabTrie::kRoot, "abc"), 0);
+  EXPECT_EQ(trie.Walk(VocabTrie::kRoot, "abc"), VocabTrie::kNoNode);
+
+  auto wordpiece_tokenizer = std::make_unique<WordpieceTokenizerOp>(vocab);
+  std::shared_ptr<Tensor> input;
+  std::vector<std::string> tokens = {"i", "am", "favorite", "durings", "cats", "每日", "abc"};
+  ASSERT_TRUE(Tensor::CreateFromVector(tokens, &input).IsOk());
+  TensorRow output;
+  ASSERT_TRUE(wordpiece_tokenizer->Compute(TensorRow(0, {input}), &output).IsOk());
+  std::vector<std::string> expect = {"i",   "am",  "favor", "##ite", "dur", "##ing",
+                                     "##s", "cat", "##s",   "每",   "##日", "[UNK]"};
+  ASSERT_EQ(output[0]->Size(), expect.size());
+  for (dsize_t i = 0; i < expect.size(); ++i) {
+    CheckEqual(output[0], {i}, expect[i]);
+  }
+}
@@ -21,9 +21,14 @@
 #include <vector>
 #include <string>
 #include <random>
+#include <cmath>
+#include <cstdio>
+#include <unistd.h>
 
 #include "include/common/random.h"
+#include "utils/ms_utils.h"
 #include "distributed/embedding_cache/embedding_cache_utils.h"
+#include "distributed/persistent/storage/constants.h"
 
 namespace mindspore {
 namespace distributed {
@@ -34,7 +39,21 @@ class TestEmbeddingCache : public UT::Common {
   virtual ~TestEmbeddingCache() = default;
 
   void SetUp() override {}
-  void TearDown() override {}
+  void TearDown() override {
+    // Remove the block files and folders left by the embedding store.
+    std::string store_path = std::string(kEmbeddingStoreTestPath) + "/" + kEmbeddingStoreTestName;
+    for (size_t i = 0;; ++i) {
+      std::string block_file = store_path + "/" + storage::kBlockFilePrefix + std::to_string(i);
+      if (remove(block_file.c_str()) != 0) {
+        break;
+      }
+    }
+    (void)rmdir(store_path.c_str());
+    (void)rmdir(kEmbeddingStoreTestPath);
+  }
+
+  static constexpr char kEmbeddingStoreTestPath[] = "./embedding_store_test";
+  static constexpr char kEmbeddingStoreTestName[] = "0";
 };
 
 /// Feature: test embedding cache.
@@ -94,6 +113,143 @@ TEST_F(TestEmbeddingCache, test_random_number_gen) {
   }
   ASSERT_TRUE(numbers.size() == count);
 }
+
+/// Feature: test embedding store.
+/// Description: put more rows than the in-memory cache capacity, then get and flush them.
+/// Expectation: the rows spilled to disk are read back correctly.
+TEST_F(TestEmbeddingCache, test_embedding_store) {
+  const size_t cache_capacity = 100;
+  const size_t emb_dim = 8;
+  const size_t key_num = 1000;
+  common::SetEnv(distributed::kEnvEmbeddingStorePath, kEmbeddingStoreTestPath);
+  distributed::EmbeddingStore<int32_t, float> emb_store(kEmbeddingStoreTestName, cache_capacity, emb_dim);
+  ASSERT_TRUE(emb_store.Initialize());
+
+  std::vector<int32_t> keys(key_num);
+  std::vector<float> values(key_num * emb_dim);
+  for (size_t i = 0; i < key_num; ++i) {
+    keys[i] = SizeToInt(i * 3);
+    for (size_t j = 0; j < emb_dim; ++j) {
+      values[i * emb_dim + j] = static_cast<float>(i + j);
+    }
+  }
+  ASSERT_TRUE(emb_store.Put(nullptr, key_num, keys.data(), values.data()));
+  EXPECT_EQ(emb_store.cache_size(), cache_capacity);
+  EXPECT_EQ(emb_store.storage_size(), key_num - cache_capacity);
+
+  std::vector<float> outputs(key_num * emb_dim);
+  ASSERT_TRUE(emb_store.Get(key_num, keys.data(), outputs.data()));
+  EXPECT_EQ(outputs, values);
+  ASSERT_TRUE(emb_store.Flush(nullptr));
+
+  // The key which has never been put is filled with zero.
+  int32_t missing_key = 1;
+  std::vector<float> missing_output(emb_dim, 1.0);
+  ASSERT_TRUE(emb_store.Get(1, &missing_key, missing_output.data()));
+  EXPECT_EQ(missing_output, std::vector<float>(emb_dim, 0));
+  ASSERT_TRUE(emb_store.Finalize());
+}
+
+namespace {
+// Simulate the cache prefetching of a skewed id distribution, return the cumulative statistics of the hash map.
+EmbeddingHashMapCounter RunSkewedWorkload(EmbeddingCachePolicyType policy_type) {
+  const size_t hash_capacity = 102;
+  const size_t batch_ids_num = 20;
+  const size_t step_num = 3000;
+  const double skew = 4.0;
+  const double id_range = 2000.0;
+  EmbeddingHashMap hash_map(0, hash_capacity, policy_type);
+  std::vector<int> swap_out_index(batch_ids_num);
+  std::vector<int> swap_out_ids(batch_ids_num);
+  std::mt19937 rng(0);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+  for (size_t step = 1; step <= step_num; ++step) {
+    hash_map.Reset();
+    size_t swap_out_size = 0;
+    bool need_wait_graph = false;
+    for (size_t i = 0; i < batch_ids_num; ++i) {
+      int id = static_cast<int>(std::pow(dist(rng), skew) * id_range);
+      const auto &hash_id_to_index = hash_map.hash_id_to_index();
+      auto iter = hash_id_to_index.find(id);
+      if (iter != hash_id_to_index.end()) {
+        hash_map.set_hash_step(iter->second, step);
+        hash_map.RecordAccess(iter->second, step);
+        continue;
+      }
+      int index = hash_map.ParseData(id, swap_out_index.data(), swap_out_ids.data(), step, step - 1, &swap_out_size,
+                                     &need_wait_graph);
+      EXPECT_NE(index, INVALID_INDEX_VALUE);
+      EXPECT_FALSE(need_wait_graph);
+    }
+  }
+  return hash_map.counter();
+}
+}  // namespace
+
+/// Feature: test eviction policies of embedding hash map.
+/// Description: prefetch ids of skewed distribution with step expiry, LFU and TinyLFU policies.
+/// Expectation: the frequency based policies get higher hit rate and fewer swaps than the step expiry policy.
+TEST_F(TestEmbeddingCache, test_embedding_cache_policy) {
+  auto step_counter = RunSkewedWorkload(EmbeddingCachePolicyType::kStepExpiry);
+  auto lfu_counter = RunSkewedWorkload(EmbeddingCachePolicyType::kLFU);
+  auto tiny_lfu_counter = RunSkewedWorkload(EmbeddingCachePolicyType::kTinyLFU);
+  EXPECT_GT(step_counter.hit_rate(), 0);
+  EXPECT_GT(lfu_counter.hit_rate(), step_counter.hit_rate());
+  EXPECT_GT(tiny_lfu_counter.hit_rate(), step_counter.hit_rate());
+  EXPECT_LT(lfu_counter.swap_out_count_, step_counter.swap_out_count_);
+  EXPECT_LT(tiny_lfu_counter.swap_out_count_, step_counter.swap_out_count_);
+}
+
+/// Feature: test eviction policies of embedding hash map.
+/// Description: access an id several times in one step with LFU policy, and another id once in each of more steps,
+///     then insert a new id into the full hash map.
+/// Expectation: the repeated accesses in one step are counted once, so the id accessed in fewer steps is evicted.
+TEST_F(TestEmbeddingCache, test_embedding_cache_policy_repeated_access) {
+  const int first_id = 1;
+  const int second_id = 2;
+  const int new_id = 3;
+  // The front and back positions are reserved, so the hash map holds two ids.
+  const size_t hash_capacity = 4;
+  EmbeddingHashMap hash_map(0, hash_capacity, EmbeddingCachePolicyType::kLFU);
+  std::vector<int> swap_out_index(1);
+  std::vector<int> swap_out_ids(1);
+  size_t swap_out_size = 0;
+  bool need_wait_graph = false;
+  auto access = [&hash_map](int id, size_t step) {
+    auto index = hash_map.hash_id_to_index().at(id);
+    hash_map.set_hash_step(index, step);
+    hash_map.RecordAccess(index, step);
+  };
+
+  size_t step = 1;
+  hash_map.Reset();
+  for (int id : {first_id, second_id}) {
+    ASSERT_NE(hash_map.ParseData(id, swap_out_index.data(), swap_out_ids.data(), step, step - 1, &swap_out_size,
+                                 &need_wait_graph),
+              INVALID_INDEX_VALUE);
+  }
+  // The first id is accessed 3 times in one step, the second id is accessed once in each of 2 steps.
+  ++step;
+  hash_map.Reset();
+  for (size_t i = 0; i < 3; ++i) {
+    access(first_id, step);
+  }
+  for (size_t i = 0; i < 2; ++i) {
+    ++step;
+    hash_map.Reset();
+    access(second_id, step);
+  }
+  EXPECT_EQ(hash_map.counter().hit_count_, 3);
+
+  hash_map.Reset();
+  ++step;
+  ASSERT_NE(hash_map.ParseData(new_id, swap_out_index.data(), swap_out_ids.data(), step, step, &swap_out_size,
+                               &need_wait_graph),
+            INVALID_INDEX_VALUE);
+  ASSERT_EQ(swap_out_size, 1);
+  EXPECT_EQ(swap_out_ids[0], first_id);
+}
 }  // namespace persistent
 }  // namespace distributed
 }  // namespace mindspore
@@ -0,0 +1,166 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "common/common_test.h"
+#include "minddata/mindrecord/include/shard_binary_index.h"
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+using IndexRow = std::vector<std::tuple<std::string, std::string, std::string>>;
+
+constexpr uint64_t kPageNum = 3;
+constexpr uint64_t kRowsPerPage = 10;
+const char kShardName[] = "binary_index_test.mindrecord";
+const char kShardFile[] = "./binary_index_test.mindrecord";
+
+// the row like the one generated by ShardIndexGenerator, row i is in blob page i / kRowsPerPage
+IndexRow MakeRow(uint64_t i) {
+  IndexRow row;
+  row.emplace_back(":ROW_ID", "INTEGER", std::to_string(i));
+  row.emplace_back(":ROW_GROUP_ID", "INTEGER", std::to_string(i / kRowsPerPage));
+  row.emplace_back(":PAGE_ID_RAW", "INTEGER", "0");
+  row.emplace_back(":PAGE_OFFSET_RAW", "INTEGER", std::to_string(i * 100));
+  row.emplace_back(":PAGE_OFFSET_RAW_END", "INTEGER", std::to_string(i * 100 + 100));
+  row.emplace_back(":PAGE_ID_BLOB", "INTEGER", std::to_string(i / kRowsPerPage + 1));
+  row.emplace_back(":PAGE_OFFSET_BLOB", "INTEGER", std::to_string(i % kRowsPerPage * 64));
+  row.emplace_back(":PAGE_OFFSET_BLOB_END", "INTEGER", std::to_string(i % kRowsPerPage * 64 + 64));
+  row.emplace_back(":INC_0", "INTEGER", "0");
+  // 2 and 10 are sorted by number rather than string
+  row.emplace_back(":label_0", "INTEGER", std::to_string(i % kInt3 == 0 ? 10 : i % kInt3));
+  row.emplace_back(":INC_1", "INTEGER", "0");
+  row.emplace_back(":file_name_0", "TEXT", "image_" + std::to_string(i % kInt2));
+  return row;
+}
+}  // namespace
+
+class TestShardBinaryIndex : public UT::Common {
+ public:
+  void SetUp() override {
+    std::ofstream out(kShardFile, std::ios::out | std::ios::binary | std::ios::trunc);
+    out << "mindrecord";
+    out.close();
+    // the rows of the raw pages are added in reverse order
+    ShardBinaryIndexBuilder builder(kShardName);
+    for (int64_t page = kPageNum - 1; page >= 0; --page) {
+      std::vector<IndexRow> rows;
+      for (uint64_t i = page * kRowsPerPage; i < (page + 1) * kRowsPerPage; ++i) {
+        rows.push_back(MakeRow(i));
+      }
+      ASSERT_TRUE(builder.AddRows(rows).IsOk());
+    }
+    ASSERT_TRUE(builder.Write(kShardFile).IsOk());
+  }
+
+  void TearDown() override {
+    (void)std::remove(kShardFile);
+    (void)std::remove((std::string(kShardFile) + kBinaryIndexSuffix).c_str());
+  }
+};
+
+/// Feature: binary index of mindrecord.
+/// Description: load the index, then find rows by row id, blob page and category.
+/// Expectation: the results are the same as the queries on the meta file.
+TEST_F(TestShardBinaryIndex, TestQuery) {
+  std::unique_ptr<ShardBinaryIndex> index;
+  ASSERT_TRUE(ShardBinaryIndex::Load(kShardFile, kShardName, &index).IsOk());
+  ASSERT_EQ(index->GetRowCount(), kPageNum * kRowsPerPage);
+  for (uint64_t i = 0; i < index->GetRowCount(); ++i) {
+    EXPECT_EQ(index->GetRowColumn(i, kIndexRowId), i);
+  }
+  uint64_t pos = 0;
+  ASSERT_TRUE(index->FindRow(12, &pos));
+  std::vector<std::vector<std::string>> rows;
+  ASSERT_TRUE(index->SelectRows({pos}, {"PAGE_ID_BLOB", "PAGE_OFFSET_BLOB", "label_0", "file_name_0"}, &rows).IsOk());
+  EXPECT_EQ(rows, std::vector<std::vector<std::string>>({{"2", "128", "10", "image_0"}}));
+  EXPECT_FALSE(index->FindRow(kPageNum * kRowsPerPage, &pos));
+  EXPECT_FALSE(index->SelectRows({pos}, {"label_1"}, &rows).IsOk());
+
+  std::vector<uint64_t> positions;
+  ASSERT_TRUE(index->GetRowsInPage(2, {"", ""}, &positions).IsOk());
+  EXPECT_EQ(positions, std::vector<uint64_t>({10, 11, 12, 13, 14, 15, 16, 17, 18, 19}));
+  // the numeric field is compared by number
+  ASSERT_TRUE(index->GetRowsInPage(2, {"label_0", "1.0"}, &positions).IsOk());
+  EXPECT_EQ(positions, std::vector<uint64_t>({10, 13, 16, 19}));
+  ASSERT_TRUE(index->GetRowsInPage(kPageNum + 1, {"label_0", "1"}, &positions).IsOk());
+  EXPECT_TRUE(positions.empty());
+
+  std::vector<uint64_t> page_ids;
+  ASSERT_TRUE(index->GetPagesByCategory({"file_name_0", "image_1"}, &page_ids).IsOk());
+  EXPECT_EQ(page_ids, std::vector<uint64_t>({1, 2, 3}));
+  ASSERT_TRUE(index->GetPagesByCategory({"file_name_0", "image_2"}, &page_ids).IsOk());
+  EXPECT_TRUE(page_ids.empty());
+
+  std::vector<std::string> values;
+  ASSERT_TRUE(index->GetDistinctValues("label_0", &values).IsOk());
+  EXPECT_EQ(values, std::vector<std::string>({"1", "2", "10"}));
+}
+
+/// Feature: binary index of mindrecord.
+/// Description: build the index with the numbers of a numeric field written in different forms, like 1 and 1.0.
+/// Expectation: the forms of a number are one value, and the rows of all the forms are found by any form.
+TEST_F(TestShardBinaryIndex, TestMixedNumberForms) {
+  const std::vector<std::string> labels = {"1", "1.0", "2.5", "1.00", "2.50", "1e1", "10"};
+  std::vector<IndexRow> rows;
+  for (uint64_t i = 0; i < labels.size(); ++i) {
+    rows.push_back(MakeRow(i));
+    for (auto &item : rows.back()) {
+      if (std::get<0>(item) == ":label_0") {
+        std::get<2>(item) = labels[i];
+      }
+    }
+  }
+  ShardBinaryIndexBuilder builder(kShardName);
+  ASSERT_TRUE(builder.AddRows(rows).IsOk());
+  ASSERT_TRUE(builder.Write(kShardFile).IsOk());
+
+  std::unique_ptr<ShardBinaryIndex> index;
+  ASSERT_TRUE(ShardBinaryIndex::Load(kShardFile, kShardName, &index).IsOk());
+  std::vector<std::string> values;
+  ASSERT_TRUE(index->GetDistinctValues("label_0", &values).IsOk());
+  EXPECT_EQ(values, std::vector<std::string>({"1", "2.5", "10"}));
+
+  std::vector<uint64_t> positions;
+  ASSERT_TRUE(index->GetRowsInPage(1, {"label_0", "1"}, &positions).IsOk());
+  EXPECT_EQ(positions, std::vector<uint64_t>({0, 1, 3}));
+  ASSERT_TRUE(index->GetRowsInPage(1, {"label_0", "1.0"}, &positions).IsOk());
+  EXPECT_EQ(positions, std::vector<uint64_t>({0, 1, 3}));
+  ASSERT_TRUE(index->GetRowsInPage(1, {"label_0", "2.5"}, &positions).IsOk());
+  EXPECT_EQ(positions, std::vector<uint64_t>({2, 4}));
+  ASSERT_TRUE(index->GetRowsInPage(1, {"label_0", "10.0"}, &positions).IsOk());
+  EXPECT_EQ(positions, std::vector<uint64_t>({5, 6}));
+}
+
+/// Feature: binary index of mindrecord.
+/// Description: load the index after the mindrecord file is modified, or with another shard name.
+/// Expectation: an error is returned, so that the reader queries the meta file instead.
+TEST_F(TestShardBinaryIndex, TestLoadOutdatedIndex) {
+  std::unique_ptr<ShardBinaryIndex> index;
+  EXPECT_FALSE(ShardBinaryIndex::Load(kShardFile, "another.mindrecord", &index).IsOk());
+  std::ofstream out(kShardFile, std::ios::out | std::ios::binary | std::ios::app);
+  out << "appended";
+  out.close();
+  EXPECT_FALSE(ShardBinaryIndex::Load(kShardFile, kShardName, &index).IsOk());
+}
+}  // namespace mindrecord
+}  // namespace mindspore
@@ -17,9 +17,11 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <cstring>
+#include <fstream>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -148,5 +150,57 @@ TEST_F(TestShardHeader, AddIndexFields) {
   EXPECT_TRUE(status.IsOk());
   ASSERT_EQ(header_data_new.GetFields().size(), 2);
 }
+
+/// Feature: columnar raw page layout of mindrecord.
+/// Description: serialize the header of the columnar and row layout, then load it with an unknown raw page format.
+/// Expectation: only the columnar header has the new version, which the readers predating the layout reject, and
+/// the unknown raw page format is rejected.
+TEST_F(TestShardHeader, RawPageFormatVersion) {
+  const std::string file_name = "./raw_page_format.mindrecord";
+  // the versions supported by the readers which only know the row layout
+  const std::vector<std::string> legacy_version = {"2.0", "3.0"};
+  auto write_header = [&file_name](const json &header) {
+    std::string content = header.dump();
+    uint64_t header_size = content.size();
+    std::ofstream out(file_name, std::ios::out | std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(&header_size), kInt64Len);
+    out.write(content.data(), static_cast<std::streamsize>(content.size()));
+  };
+
+  json schema_content = R"({"name": {"type": "string"}, "label": {"type": "int32"}})"_json;
+  std::shared_ptr<Schema> schema = Schema::Build("raw page format", schema_content);
+  ASSERT_NE(schema, nullptr);
+  mindrecord::ShardHeader header_data;
+  ASSERT_EQ(header_data.AddSchema(schema), 0);
+  ASSERT_TRUE(header_data.InitByFiles({file_name}).IsOk());
+
+  header_data.SetRawPageFormat(kRawPageFormatColumnar);
+  auto headers = header_data.SerializeHeader();
+  ASSERT_EQ(headers.size(), 1);
+  json columnar_header = json::parse(headers[0]);
+  EXPECT_EQ(columnar_header["raw_page_format"], kRawPageFormatColumnar);
+  EXPECT_EQ(columnar_header["version"], kVersionColumnar);
+  EXPECT_EQ(std::find(legacy_version.begin(), legacy_version.end(), columnar_header["version"]),
+            legacy_version.end());
+  write_header(columnar_header);
+  mindrecord::ShardHeader columnar_data;
+  ASSERT_TRUE(columnar_data.BuildDataset({file_name}, false).IsOk());
+  EXPECT_EQ(columnar_data.GetRawPageFormat(), kRawPageFormatColumnar);
+
+  header_data.SetRawPageFormat(kRawPageFormatRow);
+  headers = header_data.SerializeHeader();
+  ASSERT_EQ(headers.size(), 1);
+  json row_header = json::parse(headers[0]);
+  EXPECT_FALSE(row_header.contains("raw_page_format"));
+  EXPECT_EQ(row_header["version"], kVersion);
+
+  columnar_header["raw_page_format"] = "unknown";
+  write_header(columnar_header);
+  mindrecord::ShardHeader unknown_data;
+  auto status = unknown_data.BuildDataset({file_name}, false);
+  EXPECT_FALSE(status.IsOk());
+  EXPECT_NE(status.ToString().find("raw page format"), std::string::npos);
+  (void)remove(file_name.c_str());
+}
 }  // namespace mindrecord
 }  // namespace mindspore
@@ -0,0 +1,131 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "common/common_test.h"
+#include "minddata/mindrecord/include/shard_io_engine.h"
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+constexpr int64_t kTaskNum = 256;
+constexpr uint64_t kBlobSize = 4000;
+const std::vector<std::string> kFiles = {"./io_engine_test.shard0", "./io_engine_test.shard1"};
+
+// The byte of the blob of the task at position 'pos'.
+uint8_t BlobByte(int64_t task_id, uint64_t pos) { return static_cast<uint8_t>((task_id * 31 + pos) % 251); }
+
+Status LocateBlob(int64_t task_id, BlobLocation *location) {
+  location->task_type = task_id % 50 == 49 ? TaskType::kPaddedTask : TaskType::kCommonTask;
+  location->shard_id = static_cast<uint32_t>(task_id % kFiles.size());
+  location->file_offset = (task_id / kFiles.size()) * kBlobSize;
+  location->blob_size = kBlobSize;
+  location->var_fields = {{"id", task_id}};
+  return Status::OK();
+}
+}  // namespace
+
+class TestShardIoEngine : public UT::Common {
+ public:
+  void SetUp() override {
+    for (size_t shard_id = 0; shard_id < kFiles.size(); ++shard_id) {
+      std::vector<uint8_t> data;
+      for (int64_t task_id = static_cast<int64_t>(shard_id); task_id < kTaskNum; task_id += kFiles.size()) {
+        for (uint64_t pos = 0; pos < kBlobSize; ++pos) {
+          data.push_back(BlobByte(task_id, pos));
+        }
+      }
+      std::ofstream fs(kFiles[shard_id], std::ios::out | std::ios::binary | std::ios::trunc);
+      fs.write(reinterpret_cast<const char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+  }
+
+  void TearDown() override {
+    for (const auto &file : kFiles) {
+      (void)remove(file.c_str());
+    }
+  }
+};
+
+/// Feature: prefetching engine of mindrecord files.
+/// Description: prefetch the blobs of shuffled tasks with a bytes budget smaller than the whole data, and take them in
+/// the order of tasks.
+/// Expectation: all common tasks are taken from the prefetched blobs with the right data, padded tasks are skipped.
+TEST_F(TestShardIoEngine, TestPrefetchShuffledTasks) {
+  std::vector<int64_t> task_ids(kTaskNum);
+  std::iota(task_ids.begin(), task_ids.end(), 0);
+  std::shuffle(task_ids.begin(), task_ids.end(), std::mt19937(0));
+
+  ShardIoEngine engine(kBlobSize * 10, 3);
+  ASSERT_TRUE(engine.Open(kFiles).IsOk());
+  ASSERT_TRUE(engine.Start(LocateBlob, task_ids).IsOk());
+  uint64_t common_num = 0;
+  for (auto task_id : task_ids) {
+    std::vector<uint8_t> blob;
+    BlobLocation location;
+    bool hit = engine.Take(task_id, &blob, &location);
+    if (task_id % 50 == 49) {
+      EXPECT_FALSE(hit);
+      continue;
+    }
+    ++common_num;
+    ASSERT_TRUE(hit);
+    ASSERT_EQ(blob.size(), kBlobSize);
+    EXPECT_EQ(location.var_fields["id"], task_id);
+    for (uint64_t pos = 0; pos < kBlobSize; ++pos) {
+      ASSERT_EQ(blob[pos], BlobByte(task_id, pos));
+    }
+  }
+  EXPECT_EQ(engine.hit_count(), common_num);
+  engine.Close();
+}
+
+/// Feature: prefetching engine of mindrecord files.
+/// Description: take the tasks before they are scheduled, and restart prefetching with a new order.
+/// Expectation: the missed tasks are not prefetched, and the engine works after restarting.
+TEST_F(TestShardIoEngine, TestPrefetchMissAndRestart) {
+  std::vector<int64_t> task_ids = {0, 1, 2, 3, 4, 5};
+  ShardIoEngine engine(kBlobSize * 2, 1);
+  ASSERT_TRUE(engine.Open(kFiles).IsOk());
+  std::vector<uint8_t> blob;
+  BlobLocation location;
+  EXPECT_FALSE(engine.Take(0, &blob, &location));
+
+  ASSERT_TRUE(engine.Start(LocateBlob, task_ids).IsOk());
+  // The task 5 is taken by the consumer itself, it is skipped when scheduled.
+  (void)engine.Take(5, &blob, &location);
+  for (int64_t task_id = 0; task_id < 5; ++task_id) {
+    ASSERT_TRUE(engine.Take(task_id, &blob, &location));
+    EXPECT_EQ(blob[1], BlobByte(task_id, 1));
+  }
+
+  std::reverse(task_ids.begin(), task_ids.end());
+  ASSERT_TRUE(engine.Start(LocateBlob, task_ids).IsOk());
+  for (auto task_id : task_ids) {
+    ASSERT_TRUE(engine.Take(task_id, &blob, &location));
+    EXPECT_EQ(blob[kBlobSize - 1], BlobByte(task_id, kBlobSize - 1));
+  }
+  engine.Close();
+}
+}  // namespace mindrecord
+}  // namespace mindspore
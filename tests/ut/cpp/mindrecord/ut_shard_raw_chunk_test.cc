@@ -0,0 +1,138 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common/common_test.h"
+#include "minddata/mindrecord/include/shard_raw_chunk.h"
+
+namespace mindspore {
+namespace mindrecord {
+namespace {
+constexpr uint64_t kRowNum = 100;
+constexpr uint64_t kFirstRowId = 1000;
+// the chunk is written after some bytes, like a row group in the middle of raw page
+constexpr uint64_t kChunkOffset = 24;
+const char kChunkFile[] = "./raw_chunk_test.mindrecord";
+
+std::vector<json> MakeRows() {
+  std::vector<json> rows;
+  for (uint64_t i = 0; i < kRowNum; ++i) {
+    json row;
+    row["label"] = static_cast<int64_t>(i / 10);
+    row["class"] = "class_" + std::to_string(i % 3);
+    row["score"] = static_cast<double>(i) * 0.5;
+    row["bbox"] = json::array({i, i + 1, i + 2, i + 3});
+    if (i % 7 == 0) {
+      row["note"] = "note_" + std::to_string(i);
+    }
+    rows.push_back(row);
+  }
+  return rows;
+}
+}  // namespace
+
+class TestShardRawChunk : public UT::Common {
+ public:
+  void SetUp() override {
+    rows_ = MakeRows();
+    std::vector<uint8_t> chunk;
+    ASSERT_TRUE(ShardRawChunk::Encode(rows_.begin(), rows_.end(), kFirstRowId, &chunk).IsOk());
+    chunk_size_ = chunk.size();
+    std::ofstream out(kChunkFile, std::ios::out | std::ios::binary | std::ios::trunc);
+    std::vector<char> padding(kChunkOffset, 0);
+    out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+    out.write(reinterpret_cast<const char *>(&chunk_size_), kInt64Len);
+    out.write(reinterpret_cast<const char *>(chunk.data()), static_cast<std::streamsize>(chunk.size()));
+  }
+
+  void TearDown() override { (void)std::remove(kChunkFile); }
+
+ protected:
+  std::vector<json> rows_;
+  uint64_t chunk_size_ = 0;
+};
+
+/// Feature: columnar raw chunk of mindrecord.
+/// Description: encode rows with repeated, low cardinality, unique and array columns, then read all columns.
+/// Expectation: the decoded rows are equal to the encoded rows, and the chunk is smaller than the row layout.
+TEST_F(TestShardRawChunk, TestEncodeAndReadAll) {
+  std::fstream fs(kChunkFile, std::ios::in | std::ios::binary);
+  std::vector<json> rows;
+  uint64_t first_row_id = 0;
+  uint64_t chunk_size = 0;
+  ASSERT_TRUE(ShardRawChunk::Read(&fs, kChunkOffset, {}, &rows, &first_row_id, &chunk_size).IsOk());
+  EXPECT_EQ(first_row_id, kFirstRowId);
+  EXPECT_EQ(chunk_size, chunk_size_);
+  EXPECT_EQ(rows, rows_);
+
+  uint64_t row_size = 0;
+  for (const auto &row : rows_) {
+    row_size += kInt64Len + json::to_msgpack(row).size();
+  }
+  EXPECT_LT(chunk_size_, row_size);
+}
+
+/// Feature: columnar raw chunk of mindrecord.
+/// Description: read a subset of columns, and read rows one by one with the chunk cache.
+/// Expectation: only the projected columns are returned.
+TEST_F(TestShardRawChunk, TestReadProjection) {
+  std::fstream fs(kChunkFile, std::ios::in | std::ios::binary);
+  std::vector<json> rows;
+  uint64_t first_row_id = 0;
+  uint64_t chunk_size = 0;
+  ASSERT_TRUE(ShardRawChunk::Read(&fs, kChunkOffset, {"label", "note"}, &rows, &first_row_id, &chunk_size).IsOk());
+  ASSERT_EQ(rows.size(), kRowNum);
+  for (uint64_t i = 0; i < kRowNum; ++i) {
+    json expected;
+    expected["label"] = rows_[i]["label"];
+    if (rows_[i].contains("note")) {
+      expected["note"] = rows_[i]["note"];
+    }
+    EXPECT_EQ(rows[i], expected);
+  }
+
+  RawChunkCache cache;
+  for (uint64_t i = 0; i < kRowNum; ++i) {
+    json row;
+    ASSERT_TRUE(ShardRawChunk::ReadRow(&fs, kChunkOffset, kFirstRowId + i, {"class"}, &cache, &row).IsOk());
+    EXPECT_EQ(row, json({{"class", rows_[i]["class"]}}));
+  }
+  json row;
+  EXPECT_FALSE(ShardRawChunk::ReadRow(&fs, kChunkOffset, kFirstRowId + kRowNum, {"class"}, &cache, &row).IsOk());
+}
+
+/// Feature: columnar raw chunk of mindrecord.
+/// Description: read a chunk whose size field is corrupted.
+/// Expectation: an error is returned.
+TEST_F(TestShardRawChunk, TestReadCorruptedChunk) {
+  {
+    std::fstream out(kChunkFile, std::ios::in | std::ios::out | std::ios::binary);
+    uint64_t chunk_size = kInt64Len;
+    out.seekp(kChunkOffset, std::ios::beg);
+    out.write(reinterpret_cast<const char *>(&chunk_size), kInt64Len);
+  }
+  std::fstream fs(kChunkFile, std::ios::in | std::ios::binary);
+  std::vector<json> rows;
+  uint64_t first_row_id = 0;
+  uint64_t chunk_size = 0;
+  EXPECT_FALSE(ShardRawChunk::Read(&fs, kChunkOffset, {}, &rows, &first_row_id, &chunk_size).IsOk());
+}
+}  // namespace mindrecord
+}  // namespace mindspore
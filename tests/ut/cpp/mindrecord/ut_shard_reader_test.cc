@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <cstring>
 #include <functional>
 #include <iostream>
@@ -239,5 +240,48 @@ TEST_F(TestShardReader, TestShardReaderConsumer) {
   }
   dataset.Close();
 }
+
+/// Feature: read mindrecord files in mmap mode.
+/// Description: read all rows by file stream and by the views into the memory-mapped files.
+/// Expectation: the blob data and fields read in both modes are the same.
+TEST_F(TestShardReader, TestShardReaderMmap) {
+  MS_LOG(INFO) << FormatInfo("Test read imageNet in mmap mode");
+  std::string file_name = "./imagenet.shard01";
+  auto column_list = std::vector<std::string>{"file_name", "label"};
+
+  ShardReader stream_reader;
+  stream_reader.SetMmapMode(false);
+  ASSERT_TRUE(stream_reader.Open({file_name}, true, 4, column_list).IsOk());
+  ASSERT_FALSE(stream_reader.IsMmapMode());
+  ASSERT_TRUE(stream_reader.Launch(true).IsOk());
+
+  ShardReader mmap_reader;
+  mmap_reader.SetMmapMode(true);
+  ASSERT_TRUE(mmap_reader.Open({file_name}, true, 4, column_list).IsOk());
+  ASSERT_TRUE(mmap_reader.IsMmapMode());
+  ASSERT_TRUE(mmap_reader.Launch(true).IsOk());
+
+  int64_t num_rows = stream_reader.GetNumRows();
+  ASSERT_EQ(num_rows, mmap_reader.GetNumRows());
+  ASSERT_GT(num_rows, 0);
+  for (int64_t row_id = 0; row_id < num_rows; ++row_id) {
+    auto expect = stream_reader.GetNextById(row_id, 0);
+    auto copied = mmap_reader.GetNextById(row_id, 0);
+    auto viewed = mmap_reader.GetNextViewById(row_id);
+    ASSERT_EQ(expect.second.size(), 1U);
+    ASSERT_EQ(copied.second.size(), 1U);
+    ASSERT_EQ(viewed.second.size(), 1U);
+
+    const auto &expect_blob = std::get<0>(expect.second[0]);
+    const auto &blob_view = std::get<0>(viewed.second[0]);
+    EXPECT_EQ(std::get<0>(copied.second[0]), expect_blob);
+    ASSERT_EQ(blob_view.second, expect_blob.size());
+    EXPECT_TRUE(std::equal(expect_blob.begin(), expect_blob.end(), blob_view.first));
+    EXPECT_EQ(std::get<1>(viewed.second[0]), std::get<1>(expect.second[0]));
+  }
+  stream_reader.Close();
+  mmap_reader.Close();
+  EXPECT_FALSE(mmap_reader.IsMmapMode());
+}
 }  // namespace mindrecord
 }  // namespace mindspore
@@ -0,0 +1,90 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "actor/mailbox.h"
+
+namespace mindspore {
+class TestMailBox : public UT::Common {
+ public:
+  TestMailBox() = default;
+  virtual ~TestMailBox() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+/// Feature: lock-free mailbox of actor.
+/// Description: several producers enqueue messages concurrently while the consumer takes them one by one.
+/// Expectation: all messages are received in the sending order of each producer, and the consumer is notified only
+/// when the first message comes after it is released.
+TEST_F(TestMailBox, test_lock_free_mailbox) {
+  const size_t producer_num = 4;
+  const size_t msg_num = 20000;
+  LockFreeMailBox mailbox;
+  std::atomic_int notify_count{0};
+  mailbox.SetNotifyHook(std::make_unique<std::function<void()>>([&notify_count]() { ++notify_count; }));
+  EXPECT_FALSE(mailbox.TakeAllMsgsEachTime());
+
+  // the released consumer is notified by the first message only.
+  (void)mailbox.EnqueueMessage(std::make_unique<MessageBase>("0"));
+  (void)mailbox.EnqueueMessage(std::make_unique<MessageBase>("1"));
+  EXPECT_EQ(notify_count, 1);
+  EXPECT_EQ(mailbox.GetMsg()->Name(), "0");
+  EXPECT_EQ(mailbox.GetMsg()->Name(), "1");
+  EXPECT_EQ(mailbox.GetMsg(), nullptr);
+
+  std::vector<std::thread> producers;
+  for (size_t i = 0; i < producer_num; ++i) {
+    (void)producers.emplace_back([&mailbox, i]() {
+      for (size_t j = 0; j < msg_num; ++j) {
+        (void)mailbox.EnqueueMessage(std::make_unique<MessageBase>(std::to_string(i) + "_" + std::to_string(j)));
+      }
+    });
+  }
+
+  std::vector<size_t> next_index(producer_num, 0);
+  size_t received = 0;
+  while (received < producer_num * msg_num) {
+    auto msg = mailbox.GetMsg();
+    if (msg == nullptr) {
+      std::this_thread::yield();
+      continue;
+    }
+    auto pos = msg->Name().find('_');
+    size_t producer = std::stoul(msg->Name().substr(0, pos));
+    size_t index = std::stoul(msg->Name().substr(pos + 1));
+    ASSERT_LT(producer, producer_num);
+    EXPECT_EQ(index, next_index[producer]);
+    next_index[producer] = index + 1;
+    ++received;
+  }
+  for (auto &producer : producers) {
+    producer.join();
+  }
+  EXPECT_EQ(mailbox.GetMsg(), nullptr);
+  // the consumer is notified again every time it is released and a new message comes.
+  EXPECT_GE(notify_count, 2);
+
+  // the messages left in the mailbox are released with it.
+  (void)mailbox.EnqueueMessage(std::make_unique<MessageBase>("left"));
+}
+}  // namespace mindspore
@@ -0,0 +1,125 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "thread/threadpool.h"
+#include "thread/ws_deque.h"
+
+namespace mindspore {
+class TestThreadPool : public UT::Common {
+ public:
+  TestThreadPool() = default;
+  virtual ~TestThreadPool() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+/// Feature: work stealing deque.
+/// Description: the owner pushes and pops items while several thieves steal items concurrently.
+/// Expectation: every item is taken exactly once.
+TEST_F(TestThreadPool, test_ws_deque) {
+  const int item_num = 100000;
+  const size_t thief_num = 3;
+  WSDeque<int> deque;
+  ASSERT_TRUE(deque.Init(1024));
+  std::vector<int> items(item_num);
+  std::vector<std::atomic_int> taken(item_num);
+  for (int i = 0; i < item_num; ++i) {
+    items[i] = i;
+    taken[i] = 0;
+  }
+
+  std::atomic_bool done{false};
+  std::vector<std::thread> thieves;
+  for (size_t i = 0; i < thief_num; ++i) {
+    (void)thieves.emplace_back([&]() {
+      while (!done || !deque.Empty()) {
+        auto item = deque.Steal();
+        if (item != nullptr) {
+          ++taken[*item];
+        }
+      }
+    });
+  }
+
+  int pushed = 0;
+  while (pushed < item_num) {
+    if (deque.Push(&items[pushed])) {
+      ++pushed;
+    }
+    // pop one item every two pushes
+    if (pushed % 2 == 0) {
+      auto item = deque.Pop();
+      if (item != nullptr) {
+        ++taken[*item];
+      }
+    }
+  }
+  for (auto item = deque.Pop(); item != nullptr; item = deque.Pop()) {
+    ++taken[*item];
+  }
+  done = true;
+  for (auto &thief : thieves) {
+    thief.join();
+  }
+  for (int i = 0; i < item_num; ++i) {
+    EXPECT_EQ(taken[i], 1);
+  }
+}
+
+/// Feature: work stealing mode of thread pool.
+/// Description: launch tasks of uneven cost in work stealing mode.
+/// Expectation: every task runs once with the scales of its own split, and the error status is returned.
+TEST_F(TestThreadPool, test_work_stealing) {
+  const size_t thread_num = 4;
+  const int task_num = 64;
+  ThreadPool *pool = ThreadPool::CreateThreadPool(thread_num);
+  ASSERT_NE(pool, nullptr);
+  ASSERT_EQ(pool->EnableWorkStealing(), THREAD_OK);
+  EXPECT_TRUE(pool->work_stealing());
+
+  std::vector<std::atomic_int> run_count(task_num);
+  std::vector<float> lhs_scales(task_num);
+  for (int i = 0; i < task_num; ++i) {
+    run_count[i] = 0;
+  }
+  auto func = [&](void *, int task_id, float lhs_scale, float) {
+    ++run_count[task_id];
+    lhs_scales[task_id] = lhs_scale;
+    // the first task is the straggler
+    if (task_id == 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return THREAD_OK;
+  };
+  for (int launch = 0; launch < 10; ++launch) {
+    EXPECT_EQ(pool->ParallelLaunch(func, nullptr, task_num), THREAD_OK);
+  }
+  for (int i = 0; i < task_num; ++i) {
+    EXPECT_EQ(run_count[i], 10);
+    EXPECT_FLOAT_EQ(lhs_scales[i], static_cast<float>(i) / task_num);
+  }
+
+  auto error_func = [](void *, int task_id, float, float) { return task_id == 1 ? THREAD_ERROR : THREAD_OK; };
+  EXPECT_EQ(pool->ParallelLaunch(error_func, nullptr, task_num), THREAD_ERROR);
+  delete pool;
+}
+}  // namespace mindspore
@@ -445,5 +445,26 @@ TEST_F(TestOps, GetConv2DPrimPyTest) {
   MS_LOG(INFO) << "Finish GetPyFnTest!";
 }
 
+/// Feature: The hash of the attributes of primitive.
+/// Description: Compute the hash of the attributes added in different orders, then change the attributes.
+/// Expectation: The hash does not depend on the order of the attributes, and it is updated with the attributes.
+TEST_F(TestOps, AttrsHashTest) {
+  auto prim = std::make_shared<Primitive>("Conv2D");
+  (void)prim->AddAttr("pad_mode", MakeValue(std::string("same")));
+  (void)prim->AddAttr("group", MakeValue<int64_t>(1));
+  auto other_prim = std::make_shared<Primitive>("Conv2D");
+  (void)other_prim->AddAttr("group", MakeValue<int64_t>(1));
+  (void)other_prim->AddAttr("pad_mode", MakeValue(std::string("same")));
+  auto attrs_hash = prim->attrs_hash();
+  ASSERT_EQ(attrs_hash, other_prim->attrs_hash());
+
+  prim->set_attr("group", MakeValue<int64_t>(2));
+  ASSERT_NE(attrs_hash, prim->attrs_hash());
+  prim->set_attr("group", MakeValue<int64_t>(1));
+  ASSERT_EQ(attrs_hash, prim->attrs_hash());
+  (void)prim->DelAttr("pad_mode");
+  ASSERT_NE(attrs_hash, prim->attrs_hash());
+}
+
 }  // namespace prim
 }  // namespace mindspore
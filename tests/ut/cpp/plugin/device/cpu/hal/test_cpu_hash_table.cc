@@ -0,0 +1,144 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <random>
+#include <numeric>
+#include "plugin/device/cpu/hal/device/cpu_hash_table.h"
+#include "runtime/device/hash_table_factory.h"
+#include "utils/ms_context.h"
+#include "common/common_test.h"
+
+namespace mindspore {
+namespace device {
+namespace cpu {
+class TestCPUHashTable : public UT::Common {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+};
+
+/// Feature: test cpu hash table.
+/// Description: find missing keys, insert, erase and export keys and values.
+/// Expectation: the values of keys are consistent with the inserted values.
+TEST_F(TestCPUHashTable, FindInsertEraseExport) {
+  using Status = HashTable<int64_t, float>::Status;
+  const int32_t value_dim = 4;
+  const size_t key_num = 100000;
+  const size_t unique_key_num = 70000;
+  CPUHashTable<int64_t, float> hash_table(value_dim, "ones");
+
+  std::vector<int64_t> keys(key_num);
+  for (size_t i = 0; i < key_num; ++i) {
+    keys[i] = static_cast<int64_t>(i % unique_key_num);
+  }
+  std::vector<float> outputs(key_num * value_dim);
+  ASSERT_TRUE(hash_table.Find(keys.data(), key_num, outputs.data(), nullptr));
+  EXPECT_EQ(hash_table.size(), unique_key_num);
+  EXPECT_EQ(outputs[0], 1.0);
+
+  std::vector<float> values(key_num * value_dim);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<float>(keys[i / value_dim]);
+  }
+  ASSERT_TRUE(hash_table.Insert(keys.data(), key_num, values.data(), nullptr));
+  ASSERT_TRUE(hash_table.Find(keys.data(), key_num, outputs.data(), nullptr));
+  EXPECT_EQ(outputs, values);
+
+  const size_t erase_num = unique_key_num / 2;
+  ASSERT_TRUE(hash_table.Erase(keys.data(), erase_num, nullptr));
+  size_t size = hash_table.size();
+  EXPECT_EQ(size, unique_key_num - erase_num);
+
+  std::vector<int64_t> export_keys(size);
+  std::vector<float> export_values(size * value_dim);
+  std::vector<Status> export_status(size);
+  ASSERT_TRUE(hash_table.Export({export_keys.data(), size * sizeof(int64_t)},
+                                {export_values.data(), size * value_dim * sizeof(float)},
+                                {export_status.data(), size * sizeof(Status)}));
+  for (size_t i = 0; i < size; ++i) {
+    EXPECT_GE(export_keys[i], static_cast<int64_t>(erase_num));
+    EXPECT_EQ(export_values[i * value_dim], static_cast<float>(export_keys[i]));
+    EXPECT_EQ(export_status[i], Status::kModified);
+  }
+}
+
+/// Feature: test cpu hash table.
+/// Description: lookup existing keys at different load factors and thread numbers.
+/// Expectation: all lookups return the inserted values, and no key is added and the table does not grow.
+TEST_F(TestCPUHashTable, LookupAtLoadFactors) {
+  const int32_t value_dim = 2;
+  const size_t capacity = 1 << 12;
+  const size_t lookup_num = 1 << 13;
+  const std::vector<float> load_factors = {0.25, 0.5, 0.7};
+  const std::vector<size_t> thread_nums = {1, 2, 4};
+
+  for (float load_factor : load_factors) {
+    for (size_t thread_num : thread_nums) {
+      CPUHashTable<int64_t, float> hash_table(value_dim, "zeros", thread_num);
+      ASSERT_TRUE(hash_table.Reserve(static_cast<size_t>(capacity * kCPUHashTableMaxLoadFactor) - 1));
+      size_t key_num = static_cast<size_t>(hash_table.capacity() * load_factor);
+      std::vector<int64_t> keys(key_num);
+      std::iota(keys.begin(), keys.end(), 0);
+      std::vector<float> values(key_num * value_dim);
+      for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = static_cast<float>(keys[i / value_dim]);
+      }
+      ASSERT_TRUE(hash_table.Insert(keys.data(), key_num, values.data(), nullptr));
+
+      std::mt19937 rng(0);
+      std::uniform_int_distribution<int64_t> dist(0, static_cast<int64_t>(key_num) - 1);
+      std::vector<int64_t> lookup_keys(lookup_num);
+      for (auto &key : lookup_keys) {
+        key = dist(rng);
+      }
+      std::vector<float> lookup_outputs(lookup_num * value_dim);
+      size_t table_capacity = hash_table.capacity();
+      ASSERT_TRUE(hash_table.Find(lookup_keys.data(), lookup_num, lookup_outputs.data(), nullptr));
+      EXPECT_EQ(hash_table.size(), key_num);
+      // The existing keys do not grow the table.
+      EXPECT_EQ(hash_table.capacity(), table_capacity);
+      for (size_t i = 0; i < lookup_num; ++i) {
+        EXPECT_EQ(lookup_outputs[i * value_dim], static_cast<float>(lookup_keys[i]));
+      }
+    }
+  }
+}
+
+/// Feature: test cpu hash table.
+/// Description: create the hash tables registered for the CPU device.
+/// Expectation: the tables of the registered key and value types are CPUHashTable, the others are not registered.
+TEST_F(TestCPUHashTable, CreateByFactory) {
+  const int32_t value_dim = 4;
+  auto &factory = HashTableFactory::GetInstance();
+  auto hash_table = factory.Create<int64_t, float>(kCPUDevice, value_dim, "ones");
+  ASSERT_NE(hash_table, nullptr);
+  auto cpu_hash_table = std::dynamic_pointer_cast<CPUHashTable<int64_t, float>>(hash_table);
+  EXPECT_NE(cpu_hash_table, nullptr);
+  std::vector<int64_t> keys = {3, 5};
+  std::vector<float> outputs(keys.size() * value_dim);
+  ASSERT_TRUE(hash_table->Find(keys.data(), keys.size(), outputs.data(), nullptr));
+  EXPECT_EQ(hash_table->size(), keys.size());
+  EXPECT_EQ(outputs, std::vector<float>(keys.size() * value_dim, 1.0));
+
+  EXPECT_NE((factory.Create<int32_t, float>(kCPUDevice, value_dim, "zeros")), nullptr);
+  EXPECT_EQ((factory.Create<int64_t, double>(kCPUDevice, value_dim, "zeros")), nullptr);
+  EXPECT_EQ((factory.Create<int64_t, float>("NotExistDevice", value_dim, "zeros")), nullptr);
+}
+}  // namespace cpu
+}  // namespace device
+}  // namespace mindspore
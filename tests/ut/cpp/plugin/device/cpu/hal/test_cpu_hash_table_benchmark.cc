@@ -0,0 +1,78 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <numeric>
+#include <iostream>
+#include "plugin/device/cpu/hal/device/cpu_hash_table.h"
+#include "include/common/thread_pool.h"
+#include "common/common_test.h"
+
+namespace mindspore {
+namespace device {
+namespace cpu {
+// The micro benchmark is disabled in the UT suite, run it by:
+//   ./ut_tests --gtest_filter=*CPUHashTableBenchmark* --gtest_also_run_disabled_tests
+class TestCPUHashTableBenchmark : public UT::Common {
+ protected:
+  void SetUp() {}
+  void TearDown() {}
+};
+
+/// Feature: micro benchmark of cpu hash table.
+/// Description: lookup existing keys at different load factors and thread numbers.
+/// Expectation: all lookups succeed, the lookups per second are printed.
+TEST_F(TestCPUHashTableBenchmark, DISABLED_LookupBenchmark) {
+  const int32_t value_dim = 8;
+  const size_t capacity = 1 << 20;
+  const size_t lookup_num = 1 << 21;
+  const std::vector<float> load_factors = {0.25, 0.5, 0.7};
+  size_t max_thread_num = common::ThreadPool::GetInstance().GetSyncRunThreadNum();
+
+  for (float load_factor : load_factors) {
+    for (size_t thread_num = 1; thread_num <= max_thread_num; thread_num *= 2) {
+      CPUHashTable<int64_t, float> hash_table(value_dim, "zeros", thread_num);
+      ASSERT_TRUE(hash_table.Reserve(static_cast<size_t>(capacity * kCPUHashTableMaxLoadFactor) - 1));
+      size_t key_num = static_cast<size_t>(hash_table.capacity() * load_factor);
+      std::vector<int64_t> keys(key_num);
+      std::iota(keys.begin(), keys.end(), 0);
+      std::vector<float> outputs(key_num * value_dim);
+      ASSERT_TRUE(hash_table.Find(keys.data(), key_num, outputs.data(), nullptr));
+
+      std::mt19937 rng(0);
+      std::uniform_int_distribution<int64_t> dist(0, static_cast<int64_t>(key_num) - 1);
+      std::vector<int64_t> lookup_keys(lookup_num);
+      for (auto &key : lookup_keys) {
+        key = dist(rng);
+      }
+      std::vector<float> lookup_outputs(lookup_num * value_dim);
+      auto start = std::chrono::steady_clock::now();
+      ASSERT_TRUE(hash_table.Find(lookup_keys.data(), lookup_num, lookup_outputs.data(), nullptr));
+      auto end = std::chrono::steady_clock::now();
+      EXPECT_EQ(hash_table.size(), key_num);
+
+      double seconds = std::chrono::duration<double>(end - start).count();
+      std::cout << "Load factor: " << hash_table.load_factor() << ", thread num: " << thread_num
+                << ", lookups/sec: " << static_cast<size_t>(lookup_num / seconds) << std::endl;
+    }
+  }
+}
+}  // namespace cpu
+}  // namespace device
+}  // namespace mindspore
@@ -0,0 +1,126 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "backend/common/session/kernel_graph.h"
+#include "backend/common/session/anf_runtime_algorithm.h"
+#include "kernel/kernel_build_info.h"
+#include "runtime/graph_scheduler/kernel_select_cache.h"
+
+namespace mindspore {
+namespace runtime {
+class KernelSelectCacheTest : public UT::Common {
+ public:
+  KernelSelectCacheTest() {}
+  void TearDown() override {
+    KernelSelectCache::GetInstance().Close();
+    (void)remove(kCacheFile);
+  }
+
+ protected:
+  static constexpr char kCacheFile[] = "./kernel_select_cache_test.json";
+  static constexpr char kDeviceKey[] = "sm7.0;format_transform1";
+};
+
+namespace {
+// Create the kernel graph of Add(x, y) and return the Add kernel.
+CNodePtr NewAddKernel(const std::vector<int64_t> &shape) {
+  auto graph = std::make_shared<session::KernelGraph>();
+  auto abs = std::make_shared<abstract::AbstractTensor>(kFloat32, shape);
+  auto x = graph->NewParameter(abs);
+  auto y = graph->NewParameter(abs);
+  auto add = graph->NewCNode({NewValueNode(prim::kPrimAdd), x, y});
+  add->set_abstract(abs);
+  return add;
+}
+
+// Select the kernel of Add and the format of its first input.
+void SelectAddKernel(const CNodePtr &add) {
+  kernel::KernelBuildInfo::KernelBuildInfoBuilder builder;
+  builder.SetKernelType(CPU_KERNEL);
+  builder.SetInputsFormat({kOpFormat_NCHW, kOpFormat_DEFAULT});
+  builder.SetInputsDeviceType({kNumberTypeFloat32, kNumberTypeFloat32});
+  builder.SetOutputsFormat({kOpFormat_NCHW});
+  builder.SetOutputsDeviceType({kNumberTypeFloat32});
+  AnfAlgo::SetSelectKernelBuildInfo(builder.Build(), add.get());
+
+  kernel::KernelBuildInfo::KernelBuildInfoBuilder input_builder;
+  input_builder.SetOutputsFormat({kOpFormat_NCHW});
+  input_builder.SetOutputsDeviceType({kNumberTypeFloat32});
+  AnfAlgo::SetSelectKernelBuildInfo(input_builder.Build(), add->input(1).get());
+}
+}  // namespace
+
+/// Feature: Kernel select cache.
+/// Description: Record the selected kernel, save it to the cache file, and load it in the cache opened again.
+/// Expectation: The kernel with the same signature is restored with the selected build info, and the kernel with
+/// another shape or device key is missed.
+TEST_F(KernelSelectCacheTest, SaveAndRestore) {
+  auto &cache = KernelSelectCache::GetInstance();
+  cache.Open(kCacheFile);
+  ASSERT_TRUE(cache.enabled());
+
+  auto add = NewAddKernel({2, 3});
+  std::string signature;
+  ASSERT_FALSE(cache.Restore(add, kDeviceKey, &signature));
+  ASSERT_FALSE(signature.empty());
+  SelectAddKernel(add);
+  cache.Record(add, signature);
+  cache.Save();
+
+  // Reload the selections from the file.
+  cache.Close();
+  cache.Open(kCacheFile);
+  auto cached_add = NewAddKernel({2, 3});
+  ASSERT_TRUE(cache.Restore(cached_add, kDeviceKey, &signature));
+  auto build_info = AnfAlgo::GetSelectKernelBuildInfo(cached_add);
+  ASSERT_NE(build_info, nullptr);
+  ASSERT_EQ(build_info->kernel_type(), CPU_KERNEL);
+  ASSERT_EQ(build_info->GetInputFormat(0), kOpFormat_NCHW);
+  ASSERT_EQ(build_info->GetOutputDeviceType(0), kNumberTypeFloat32);
+  ASSERT_EQ(AnfAlgo::GetOutputFormat(cached_add->input(1), 0), kOpFormat_NCHW);
+
+  auto other_add = NewAddKernel({3, 2});
+  ASSERT_FALSE(cache.Restore(other_add, kDeviceKey, &signature));
+
+  // The same kernel is missed on another device or with the formats of the graph not transformed.
+  auto other_device_add = NewAddKernel({2, 3});
+  ASSERT_FALSE(cache.Restore(other_device_add, "sm8.0;format_transform1", &signature));
+  ASSERT_FALSE(cache.Restore(other_device_add, "sm7.0;format_transform0", &signature));
+}
+
+/// Feature: Kernel select cache.
+/// Description: Restore and record the kernels when the cache is not opened.
+/// Expectation: Nothing is restored and the signature is left empty.
+TEST_F(KernelSelectCacheTest, Disabled) {
+  auto &cache = KernelSelectCache::GetInstance();
+  ASSERT_FALSE(cache.enabled());
+  auto add = NewAddKernel({2, 3});
+  std::string signature = "stale";
+  ASSERT_FALSE(cache.Restore(add, kDeviceKey, &signature));
+  ASSERT_TRUE(signature.empty());
+  SelectAddKernel(add);
+  cache.Record(add, signature);
+  cache.Save();
+  std::ifstream input(kCacheFile);
+  ASSERT_FALSE(input.good());
+}
+}  // namespace runtime
+}  // namespace mindspore
@@ -158,5 +158,37 @@ TEST_F(SchedulerHelperTest, AddMemoryFreeSign) {
   ASSERT_NE(from_actor->memory_free_insert_position(), nullptr);
   ASSERT_EQ(from_actor->memory_free_insert_position(), to_actor.get());
 }
+
+/// Feature: Priority scheduling of kernel actors.
+/// Description: Test the priority of kernel actors by the longest path from the actor to the end.
+/// Expectation: The kernel actor on the longer path gets the higher priority.
+TEST_F(SchedulerHelperTest, SetKernelActorPriority) {
+  auto memory_manager_actor = std::make_shared<MemoryManagerActor>();
+  MS_EXCEPTION_IF_NULL(memory_manager_actor);
+  auto kernel_graph = std::make_shared<KernelGraph>();
+  MS_EXCEPTION_IF_NULL(kernel_graph);
+  std::set<size_t> ref_input_indexes;
+  std::set<size_t> ref_output_indexes;
+  auto actor_set = std::make_shared<ActorSet>("actor_set");
+  for (const auto &name : {"a", "b", "c", "d", "e"}) {
+    auto backend_node = kernel_graph->NewCNode({NewValueNode(prim::kPrimLess)});
+    MS_EXCEPTION_IF_NULL(backend_node);
+    (void)actor_set->kernel_actors_.emplace_back(
+      std::make_shared<KernelActor>(name, backend_node, nullptr, memory_manager_actor->GetAID(), nullptr, nullptr,
+                                    GraphExecutionStrategy::kPipeline, ref_input_indexes, ref_output_indexes));
+  }
+  const auto &actors = actor_set->kernel_actors_;
+  // The links: a -> b -> c, a -> d, and e has no link.
+  SchedulerHelper::AddControlArrow(actors[0].get(), actors[1].get());
+  SchedulerHelper::AddControlArrow(actors[1].get(), actors[2].get());
+  SchedulerHelper::AddControlArrow(actors[0].get(), actors[3].get());
+
+  SchedulerHelper::SetKernelActorPriority(actor_set.get());
+  ASSERT_EQ(actors[0]->priority(), 3);
+  ASSERT_EQ(actors[1]->priority(), 2);
+  ASSERT_EQ(actors[2]->priority(), 1);
+  ASSERT_EQ(actors[3]->priority(), 1);
+  ASSERT_EQ(actors[4]->priority(), 1);
+}
 }  // namespace runtime
 }  // namespace mindspore
@@ -0,0 +1,197 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include "common/common_test.h"
+#include "runtime/pynative/op_executor.h"
+
+namespace mindspore {
+namespace runtime {
+namespace {
+// The size of the window of run tasks taken by the worker of OpExecutor.
+constexpr size_t kWindowSize = 20;
+
+class TestOpTask : public OpTask {
+ public:
+  TestOpTask(GraphId graph_id, std::function<void()> run)
+      : OpTask(std::make_shared<OpTaskContext>(graph_id, nullptr, std::vector<session::KernelWithIndex>(), nullptr,
+                                               nullptr, false),
+               kRunTask),
+        run_(std::move(run)) {}
+  ~TestOpTask() override = default;
+  void Run() override { run_(); }
+
+ private:
+  std::function<void()> run_;
+};
+
+// A task which blocks the worker until it is released, so that the tasks pushed meanwhile are queued together.
+class Gate {
+ public:
+  std::shared_ptr<OpTask> NewTask(GraphId graph_id) {
+    return std::make_shared<TestOpTask>(graph_id, [this]() {
+      started_.set_value();
+      release_future_.wait();
+    });
+  }
+  void WaitStarted() { started_future_.wait(); }
+  void Release() { release_.set_value(); }
+
+ private:
+  std::promise<void> started_;
+  std::shared_future<void> started_future_{started_.get_future()};
+  std::promise<void> release_;
+  std::shared_future<void> release_future_{release_.get_future()};
+};
+}  // namespace
+
+class OpExecutorTest : public UT::Common {
+ public:
+  OpExecutorTest() {}
+  void SetUp() override { OpExecutor::GetInstance().Reset(); }
+  void TearDown() override { OpExecutor::GetInstance().Reset(); }
+
+ protected:
+  std::shared_ptr<OpTask> NewRecordTask(GraphId graph_id) {
+    return std::make_shared<TestOpTask>(graph_id, [this, graph_id]() { run_order_.push_back(graph_id); });
+  }
+
+  std::vector<GraphId> run_order_;
+};
+
+/// Feature: OpExecutor runs the queued run tasks by windows.
+/// Description: Queue the tasks across several windows behind a blocked task, record in each task whether it and the
+///     task before it are queued, and push a task from the last task of a window.
+/// Expectation: All the tasks run once in order, a task stays queued while it runs and is popped once it finishes.
+TEST_F(OpExecutorTest, TestRunByWindows) {
+  auto &executor = OpExecutor::GetInstance();
+  const GraphId task_num = 2 * kWindowSize + 1;
+  const GraphId pushed_task = task_num + 1;
+  Gate gate;
+  executor.PushOpRunTask(gate.NewTask(0));
+  gate.WaitStarted();
+
+  std::vector<bool> queued(task_num + 1, false);
+  std::vector<bool> prev_queued(task_num + 1, false);
+  for (GraphId i = 1; i <= task_num; ++i) {
+    executor.PushOpRunTask(std::make_shared<TestOpTask>(i, [this, i, &executor, &queued, &prev_queued]() {
+      queued[i] = executor.ActorInQueue(i);
+      prev_queued[i] = executor.ActorInQueue(i - 1);
+      run_order_.push_back(i);
+      if (i == kWindowSize) {
+        executor.PushOpRunTask(NewRecordTask(pushed_task));
+      }
+    }));
+  }
+  EXPECT_FALSE(executor.RunQueueEmpty());
+  gate.Release();
+  executor.Wait();
+
+  EXPECT_TRUE(executor.RunQueueEmpty());
+  ASSERT_EQ(run_order_.size(), task_num + 1);
+  for (GraphId i = 1; i <= task_num; ++i) {
+    EXPECT_EQ(run_order_[i - 1], i);
+    EXPECT_TRUE(queued[i]) << "task " << i;
+    EXPECT_FALSE(prev_queued[i]) << "task " << i;
+    EXPECT_FALSE(executor.ActorInQueue(i));
+  }
+  EXPECT_EQ(run_order_.back(), pushed_task);
+}
+
+/// Feature: OpExecutor runs the queued run tasks by windows.
+/// Description: Call Wait while a task in the middle of a window is running.
+/// Expectation: The finished tasks of the window are popped, and Wait returns after the rest of the window finishes.
+TEST_F(OpExecutorTest, TestWaitInWindow) {
+  auto &executor = OpExecutor::GetInstance();
+  Gate first_gate;
+  executor.PushOpRunTask(first_gate.NewTask(0));
+  first_gate.WaitStarted();
+  Gate gate;
+  executor.PushOpRunTask(NewRecordTask(1));
+  executor.PushOpRunTask(gate.NewTask(2));
+  executor.PushOpRunTask(NewRecordTask(3));
+  first_gate.Release();
+  gate.WaitStarted();
+
+  auto wait_future = std::async(std::launch::async, [&executor]() { executor.Wait(); });
+  EXPECT_EQ(wait_future.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+  EXPECT_FALSE(executor.ActorInQueue(1));
+  EXPECT_TRUE(executor.ActorInQueue(2));
+  EXPECT_TRUE(executor.ActorInQueue(3));
+  gate.Release();
+  EXPECT_NO_THROW(wait_future.get());
+
+  EXPECT_TRUE(executor.RunQueueEmpty());
+  EXPECT_EQ(run_order_, (std::vector<GraphId>{1, 3}));
+}
+
+/// Feature: OpExecutor runs the queued run tasks by windows.
+/// Description: Reset while a task in the middle of a window is running, then push a new task.
+/// Expectation: The rest of the window is dropped after the running task finishes, and the new task runs.
+TEST_F(OpExecutorTest, TestResetInWindow) {
+  auto &executor = OpExecutor::GetInstance();
+  Gate first_gate;
+  executor.PushOpRunTask(first_gate.NewTask(0));
+  first_gate.WaitStarted();
+  Gate gate;
+  executor.PushOpRunTask(NewRecordTask(1));
+  executor.PushOpRunTask(gate.NewTask(2));
+  executor.PushOpRunTask(NewRecordTask(3));
+  first_gate.Release();
+  gate.WaitStarted();
+
+  executor.Reset();
+  EXPECT_TRUE(executor.RunQueueEmpty());
+  EXPECT_FALSE(executor.ActorInQueue(1));
+  executor.PushOpRunTask(NewRecordTask(4));
+  gate.Release();
+  executor.Wait();
+
+  EXPECT_TRUE(executor.RunQueueEmpty());
+  EXPECT_FALSE(executor.ActorInQueue(4));
+  EXPECT_EQ(run_order_, (std::vector<GraphId>{1, 4}));
+}
+
+/// Feature: OpExecutor runs the queued run tasks by windows.
+/// Description: Throw from a task in the middle of a window.
+/// Expectation: The rest of the window and the queue are dropped, Wait rethrows the error once, and the tasks pushed
+///     afterwards run.
+TEST_F(OpExecutorTest, TestErrorInWindow) {
+  auto &executor = OpExecutor::GetInstance();
+  Gate gate;
+  executor.PushOpRunTask(gate.NewTask(0));
+  gate.WaitStarted();
+  executor.PushOpRunTask(NewRecordTask(1));
+  executor.PushOpRunTask(std::make_shared<TestOpTask>(2, []() { throw std::runtime_error("run task failed"); }));
+  executor.PushOpRunTask(NewRecordTask(3));
+  gate.Release();
+
+  EXPECT_THROW(executor.Wait(), std::runtime_error);
+  EXPECT_TRUE(executor.RunQueueEmpty());
+  EXPECT_FALSE(executor.ActorInQueue(3));
+  EXPECT_EQ(run_order_, (std::vector<GraphId>{1}));
+
+  executor.PushOpRunTask(NewRecordTask(4));
+  EXPECT_NO_THROW(executor.Wait());
+  EXPECT_EQ(run_order_, (std::vector<GraphId>{1, 4}));
+}
+}  // namespace runtime
+}  // namespace mindspore
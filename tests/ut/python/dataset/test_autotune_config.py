@@ -51,6 +51,36 @@ class TestAutotuneConfig:
         with pytest.raises(ValueError):
             ds.config.set_autotune_interval(-999)
 
+    @staticmethod
+    def test_autotune_config_budget():
+        """
+        Feature: Autotuning
+        Description: Test set_autotune_cpu_budget() and set_autotune_memory_budget() with valid and invalid input
+        Expectation: Config can be set successfully and invalid input is detected
+        """
+        assert ds.config.get_autotune_cpu_budget() == 0
+        assert ds.config.get_autotune_memory_budget() == 0
+
+        ds.config.set_autotune_cpu_budget(8)
+        assert ds.config.get_autotune_cpu_budget() == 8
+        ds.config.set_autotune_memory_budget(4096)
+        assert ds.config.get_autotune_memory_budget() == 4096
+
+        with pytest.raises(TypeError):
+            ds.config.set_autotune_cpu_budget(2.5)
+
+        with pytest.raises(TypeError):
+            ds.config.set_autotune_memory_budget(True)
+
+        with pytest.raises(ValueError):
+            ds.config.set_autotune_cpu_budget(-1)
+
+        with pytest.raises(ValueError):
+            ds.config.set_autotune_memory_budget(-1)
+
+        ds.config.set_autotune_cpu_budget(0)
+        ds.config.set_autotune_memory_budget(0)
+
     @staticmethod
     def test_autotune_config_filepath_invalid():
         """
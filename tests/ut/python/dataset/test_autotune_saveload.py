@@ -123,6 +123,41 @@ class TestAutotuneSaveLoad:
         assert file.exists()
         validate_jsonfile(file)
 
+    @staticmethod
+    def test_autotune_cpu_budget_pipeline(tmp_path):
+        """
+        Feature: Autotuning
+        Description: Test save final config with a CPU budget: Generator -> Map -> Batch
+        Expectation: Pipeline runs successfully and the saved workers of the ops fit in the CPU budget
+        """
+        original_autotune = ds.config.get_enable_autotune()
+        ds.config.set_enable_autotune(True, str(tmp_path / "test_autotune_cpu_budget_atfinal"))
+        ds.config.set_autotune_cpu_budget(3)
+
+        source = [(np.array([x]),) for x in range(1024)]
+        data1 = ds.GeneratorDataset(source, ["data"])
+        data1 = data1.map(operations=[transforms.TypeCast(np.int32)], input_columns=["data"], num_parallel_workers=4)
+        data1 = data1.batch(32, num_parallel_workers=4)
+
+        itr = data1.create_dict_iterator(num_epochs=5)
+        for _ in range(5):
+            for _ in itr:
+                pass
+        del itr
+        ds.config.set_autotune_cpu_budget(0)
+        ds.config.set_enable_autotune(original_autotune)
+
+        file = tmp_path / ("test_autotune_cpu_budget_atfinal_" + os.environ['RANK_ID'] + ".json")
+        assert validate_jsonfile(file)
+        with file.open() as f:
+            node = json.load(f)["tree"]
+        num_workers = 0
+        while node["op_type"] != "GeneratorDataset":
+            num_workers += node["num_parallel_workers"]
+            node = node["children"][0]
+        # One core is kept for the generator, which is not tuned
+        assert num_workers <= 2
+
     @staticmethod
     def test_autotune_save_overwrite_generator(tmp_path):
         """
@@ -516,6 +516,55 @@ def test_fast_recovery():
     assert "set_fast_recovery() missing 1 required positional argument: 'fast_recovery'" in str(error_info.value)
 
 
+
+def test_shuffle_spill():
+    """
+    Feature: Test the shuffle op which spills the rows beyond get_shuffle_max_rows_in_memory
+    Description: Shuffle a dataset with a shuffle buffer larger than the rows kept in memory
+    Expectation: All the rows are sent out once and the config functions check their inputs
+    """
+    original_rows = ds.config.get_shuffle_max_rows_in_memory()
+    original_dir = ds.config.get_shuffle_spill_dir()
+    ds.config.set_shuffle_max_rows_in_memory(4)
+    ds.config.set_shuffle_spill_dir(os.getcwd())
+    assert ds.config.get_shuffle_max_rows_in_memory() == 4
+    assert ds.config.get_shuffle_spill_dir() == os.path.realpath(os.getcwd())
+
+    data = ds.NumpySlicesDataset({"col": [np.full((8,), i, np.int64) for i in range(50)]}, shuffle=False)
+    data = data.shuffle(20)
+    values = [row["col"][0] for row in data.create_dict_iterator(num_epochs=1, output_numpy=True)]
+    assert sorted(values) == list(range(50))
+
+    config_error_func(ds.config.set_shuffle_max_rows_in_memory, -1, ValueError, "not within the required range")
+    config_error_func(ds.config.set_shuffle_max_rows_in_memory, True, TypeError, "rows must be of type int")
+    config_error_func(ds.config.set_shuffle_spill_dir, "/not/exist/dir", ValueError, "is not a directory")
+
+    ds.config.set_shuffle_max_rows_in_memory(original_rows)
+    ds.config.set_shuffle_spill_dir(original_dir)
+
+
+def test_batch_recycle_memory():
+    """
+    Feature: Test the batch op which recycles the buffers of the released batches
+    Description: Batch a dataset with the recycling of batch buffers enabled
+    Expectation: The batches are the same as the ones without recycling and the config functions check their inputs
+    """
+    original_size = ds.config.get_batch_recycle_memory()
+    ds.config.set_batch_recycle_memory(1)
+    assert ds.config.get_batch_recycle_memory() == 1
+
+    data = ds.NumpySlicesDataset({"col": [np.full((1024,), i, np.int64) for i in range(50)]}, shuffle=False)
+    data = data.batch(8)
+    for i, row in enumerate(data.create_dict_iterator(num_epochs=1, output_numpy=True)):
+        expected = np.repeat(np.arange(i * 8, min(i * 8 + 8, 50), dtype=np.int64), 1024).reshape(-1, 1024)
+        np.testing.assert_array_equal(row["col"], expected)
+
+    config_error_func(ds.config.set_batch_recycle_memory, -1, ValueError, "not within the required range")
+    config_error_func(ds.config.set_batch_recycle_memory, True, TypeError, "size must be of type int")
+
+    ds.config.set_batch_recycle_memory(original_size)
+
+
 if __name__ == '__main__':
     test_basic()
     test_get_seed()
@@ -532,3 +581,5 @@ if __name__ == '__main__':
     test_multiprocessing_timeout_interval()
     test_config_bool_type_error()
     test_fast_recovery()
+    test_shuffle_spill()
+    test_batch_recycle_memory()
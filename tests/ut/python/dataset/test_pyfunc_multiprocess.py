@@ -62,6 +62,51 @@ def test_pyfunc_multiproc_shrmem():
     ds.config.set_prefetch_size(prefetch_original)
 
 
+def test_pyfunc_multiproc_shrmem_row_kinds():
+    """
+    Feature: PyFunc in Map op
+    Description: Test python_multiprocessing=True with shared memory enabled for rows of numeric arrays, of strings,
+        and larger than max_rowsize, which are shipped to the workers in different ways
+    Expectation: Data results are the same as running the functions in the main process
+    """
+
+    def numeric_func(x):
+        return x * 2, np.array(x.sum())
+
+    def string_func(x):
+        return np.array("row_" + str(x.sum())), x
+
+    def large_func(x):
+        # about 2 MB of output, larger than max_rowsize
+        return np.full((512, 1024), x.sum(), dtype=np.float32)
+
+    mem_original = ds.config.get_enable_shared_mem()
+    ds.config.set_enable_shared_mem(True)
+    prefetch_original = ds.config.get_prefetch_size()
+    ds.config.set_prefetch_size(1)
+
+    np_data = np.arange(60, dtype=np.int32).reshape((20, 3))
+    for func, columns in ((numeric_func, ["out1", "out2"]), (string_func, ["out1", "out2"]), (large_func, ["out"])):
+        expected = []
+        data1 = ds.NumpySlicesDataset(np_data, column_names=["col"], shuffle=False)
+        data1 = data1.map(func, input_columns=["col"], output_columns=columns, column_order=columns)
+        for row in data1.create_tuple_iterator(num_epochs=1, output_numpy=True):
+            expected.append(row)
+
+        data2 = ds.NumpySlicesDataset(np_data, column_names=["col"], shuffle=False)
+        data2 = data2.map(func, input_columns=["col"], output_columns=columns, column_order=columns,
+                          num_parallel_workers=2, python_multiprocessing=True, max_rowsize=1)
+        count = 0
+        for row, expected_row in zip(data2.create_tuple_iterator(num_epochs=1, output_numpy=True), expected):
+            for column, expected_column in zip(row, expected_row):
+                np.testing.assert_array_equal(column, expected_column)
+            count += 1
+        assert count == len(np_data)
+
+    ds.config.set_prefetch_size(prefetch_original)
+    ds.config.set_enable_shared_mem(mem_original)
+
+
 def create_dataset_pyop_multiproc(num_parallel_workers=None, max_rowsize=16, batch_size=32, repeat_size=1,
                                   num_samples=None):
     """
@@ -263,6 +308,7 @@ def test_pyfunc_multiproc_mainproc_exception():
 
 if __name__ == '__main__':
     test_pyfunc_multiproc_shrmem()
+    test_pyfunc_multiproc_shrmem_row_kinds()
     test_pyfunc_multiproc_noshrmem()
     test_pyfunc_multiproc_max_rowsize_small()
     test_pyfunc_multiproc_max_rowsize_large()
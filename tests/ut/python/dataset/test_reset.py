@@ -371,6 +371,60 @@ def test_repeatable_reset_distributed(shard_id, num_parallel_workers, to_pil):
     ds.config.set_enable_shared_mem(original_shared_mem)
 
 
+@pytest.mark.parametrize("failure_point", (13, 18, 29))
+def test_reset_checkpoint_np(failure_point):
+    """
+    Feature: Dataset recovery
+    Description: Test fast recovery reset of a pipeline with random sampler and shuffle restored from a checkpoint
+        saved at the epoch of the reset step
+    Expectation: Same dataset after reset as the original run, without replaying the epochs before
+    """
+    dataset_size = 10
+    num_epochs = 3
+    original_seed = ds.config.get_seed()
+    original_fast_recovery = ds.config.get_fast_recovery()
+    ds.config.set_seed(1)
+    ds.config.set_fast_recovery(True)
+    checkpoint_file = "./test_reset_checkpoint_np_{}.json".format(failure_point)
+
+    data = ds.NumpySlicesDataset(list(range(dataset_size)), column_names=["col"], shuffle=True)
+    data = data.shuffle(4)
+
+    expected = []
+    expected_itr = data.create_tuple_iterator(num_epochs=num_epochs, output_numpy=True)
+    for _ in range(num_epochs):
+        for d in expected_itr:
+            expected.append(d[0].item())
+    del expected_itr
+
+    expected2 = []
+    expected2_itr = data.create_tuple_iterator(num_epochs=num_epochs, output_numpy=True)
+    ds.engine.datasets._set_training_dataset(expected2_itr)  # pylint: disable=W0212
+    failure_epoch = failure_point // dataset_size
+    failure = False
+    for epoch in range(num_epochs):
+        for step, d in enumerate(expected2_itr):
+            expected2.append(d[0].item())
+            if epoch == failure_epoch and step == 0:
+                ds.engine.datasets._save_training_dataset_checkpoint(  # pylint: disable=W0212
+                    failure_point, checkpoint_file)
+            if epoch * dataset_size + step + 1 == failure_point:
+                failure = True
+                break
+        if failure:
+            ds.engine.datasets._reset_training_dataset(failure_point, checkpoint_file)  # pylint: disable=W0212
+            failure = False
+            for d in expected2_itr:
+                expected2.append(d[0].item())
+    del expected2_itr
+
+    assert expected == expected2
+
+    os.remove(checkpoint_file)
+    ds.config.set_seed(original_seed)
+    ds.config.set_fast_recovery(original_fast_recovery)
+
+
 if __name__ == "__main__":
     test_reset_np()
     test_reset_cifar1()
@@ -380,3 +434,4 @@ if __name__ == "__main__":
     test_reset_np_error()
     test_repeatable_reset_imagenet()
     test_repeatable_reset_distributed()
+    test_reset_checkpoint_np(18)